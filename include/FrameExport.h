@@ -0,0 +1,128 @@
+/**********************************************************************************************//**
+ * @file	WindowAPI\FrameExport.h
+ *
+ * @brief	Declares the shared memory frame exporter and reader classes.
+ **************************************************************************************************/
+#ifndef FRAME_EXPORT_H
+#define FRAME_EXPORT_H
+
+#include "WindowAPI_Defs.h"
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+#define FRAMEEXPORT_SLOTS 4 /**< how many frames the shared ring holds. a reader has about this many frames to finish with one */
+#define FRAMEEXPORT_MAGIC 0x58455746 /**< marks a shared memory block as a frame export ("FWEX") */
+#define FRAMEEXPORT_VERSION 1 /**< bumped whenever the shared layout changes */
+
+/**
+* a frame in the shared ring. the pixels live at Offset from the start of the block
+*/
+struct FFrameExportSlot
+{
+	std::atomic<GLuint64> Sequence; /**< odd while the exporter is writing the slot. changes every time it is rewritten */
+	GLuint64 FrameNumber; /**< which frame this is, counting from 1 */
+	GLuint Width; /**< the size of the frame */
+	GLuint Height;
+	GLdouble Timestamp; /**< when the frame was published according to GetMonotonicTime */
+	GLuint64 Offset; /**< where the pixels start, in bytes from the start of the block */
+};
+
+/**
+* the start of the shared memory block. the pixels of each slot follow it
+*/
+struct FFrameExportHeader
+{
+	GLuint Magic; /**< FRAMEEXPORT_MAGIC */
+	GLuint Version; /**< FRAMEEXPORT_VERSION */
+	GLuint MaxWidth; /**< the largest frame a slot can hold */
+	GLuint MaxHeight;
+	std::atomic<GLuint> Published; /**< how many frames have been published, wrapping. readers wait on this as a futex */
+	std::atomic<GLuint64> LatestFrame; /**< the frame number of the newest complete frame. 0 if none yet */
+	FFrameExportSlot Slots[FRAMEEXPORT_SLOTS]; /**< the frames in the ring */
+};
+
+//the block is shared between processes, which only works if these atomics never fall back to a lock
+static_assert(ATOMIC_INT_LOCK_FREE == 2, "frame export needs lock free 32 bit atomics");
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "frame export needs lock free 64 bit atomics");
+static_assert(sizeof(std::atomic<GLuint>) == sizeof(GLuint) && sizeof(std::atomic<GLuint64>) == sizeof(GLuint64),
+	"frame export atomics must have the same layout as the plain types");
+
+/**
+* publishes frames into a named block of shared memory so other processes can read them in
+* place. every frame goes in the next slot of a small ring and waiting readers are woken
+* through a futex on the publish counter. attach one to a window with
+* FWindow::EnableFrameExport to publish every frame it presents
+*/
+class FrameExporter
+{
+public:
+
+	FrameExporter();
+	~FrameExporter();
+
+	//create the shared block under the given name, big enough for frames up to MaxWidth by MaxHeight
+	GLboolean Create(const char* Name, GLuint MaxWidth, GLuint MaxHeight);
+	//unmap and remove the shared block. readers that are attached keep their mapping
+	void Destroy();
+
+	//copy an RGBA frame into the next slot and wake any waiting readers. frames that don't fit are dropped
+	GLboolean Publish(const GLubyte* Pixels, GLuint Width, GLuint Height);
+
+	//return how many frames have been published and dropped
+	GLuint64 GetPublishedFrames();
+	GLuint64 GetDroppedFrames();
+
+private:
+
+	std::string Name; /**< the name the block was created under */
+	FFrameExportHeader* Header; /**< the mapped block. null if not created */
+	GLuint64 BlockSize; /**< how big the mapped block is */
+	GLuint64 FrameCount; /**< how many frames have been published */
+	GLuint64 DroppedFrames; /**< how many frames were too big for a slot */
+
+#if defined(_WIN32) || defined(_WIN64)
+	HANDLE Mapping; /**< the file mapping backing the block */
+#endif
+};
+
+/**
+* attaches to a block published by a FrameExporter, possibly in another process, and reads
+* frames straight out of it. a frame stays valid until the exporter wraps around to its slot,
+* which ReleaseFrame reports
+*/
+class FrameExportReader
+{
+public:
+
+	FrameExportReader();
+	~FrameExportReader();
+
+	//map the block published under the given name
+	GLboolean Attach(const char* Name);
+	void Detach();
+
+	//return the newest frame if it is newer than the last one acquired, waiting up to Timeout seconds for
+	//one to be published. returns null if none arrived. the pixels are RGBA rows from the bottom up
+	const GLubyte* AcquireFrame(GLdouble Timeout, GLuint& Width, GLuint& Height, GLuint64& FrameNumber);
+	//finish reading the acquired frame. returns false if the exporter overwrote it in the meantime
+	GLboolean ReleaseFrame();
+
+private:
+
+	//block until the publish counter moves past Expected or the timeout runs out
+	void WaitForPublish(GLuint Expected, GLdouble Timeout);
+
+	FFrameExportHeader* Header; /**< the mapped block. null if not attached */
+	GLuint64 BlockSize; /**< how big the mapped block is */
+	GLuint64 LastFrame; /**< the frame number of the last frame acquired */
+	FFrameExportSlot* CurrentSlot; /**< the slot of the frame being read. null if none */
+	GLuint64 CurrentSequence; /**< the sequence of that slot when the frame was acquired */
+
+#if defined(_WIN32) || defined(_WIN64)
+	HANDLE Mapping; /**< the file mapping backing the block */
+#endif
+};
+
+#endif
@@ -0,0 +1,77 @@
+/**********************************************************************************************//**
+ * @file	WindowAPI\FrameHistogram.h
+ *
+ * @brief	Declares the frame histogram class.
+ **************************************************************************************************/
+#ifndef FRAME_HISTOGRAM_H
+#define FRAME_HISTOGRAM_H
+
+#include "WindowAPI_Defs.h"
+
+/*the histogram has 16 linear buckets for the first 16 microseconds then 16 buckets per
+doubling after that, so every bucket is within about 3% of the value it holds*/
+#define FRAMEHISTOGRAM_SUBBUCKETS 16 /**< how many buckets each doubling of time is split into */
+#define FRAMEHISTOGRAM_BUCKETS 512 /**< how many buckets the histogram has. covers a few hours */
+
+/**
+* a summary of a frame histogram. all times are in seconds
+*/
+struct FFrameStatistics
+{
+	GLuint64 Count; /**< how many samples were recorded */
+	GLdouble Min; /**< the shortest sample */
+	GLdouble Mean; /**< the average sample */
+	GLdouble P50; /**< the median sample */
+	GLdouble P95; /**< 95% of samples were at or below this */
+	GLdouble P99; /**< 99% of samples were at or below this */
+	GLdouble Max; /**< the longest sample */
+	GLuint64 MissedDeadlines; /**< how many samples were over the deadline. only counted for frame intervals */
+
+	FFrameStatistics() :
+		Count(0),
+		Min(0),
+		Mean(0),
+		P50(0),
+		P95(0),
+		P99(0),
+		Max(0),
+		MissedDeadlines(0)
+	{}
+};
+
+/**
+* a fixed size histogram of frame times. recording is lock free and never allocates so the
+* render thread can record every frame while another thread reads the statistics. a read
+* that races a record may be off by that one sample, and a reset that races a record may
+* keep it
+*/
+class FrameHistogram
+{
+public:
+
+	FrameHistogram();
+
+	//record a sample in seconds. counts as a missed deadline if Deadline is above 0 and the sample is over it
+	void Record(GLdouble Seconds, GLdouble Deadline = 0);
+
+	//summarize everything recorded since the last reset
+	FFrameStatistics GetStatistics();
+
+	//forget everything recorded so far
+	void Reset();
+
+private:
+
+	//return which bucket a sample in microseconds falls in
+	static GLuint GetBucket(GLuint64 Microseconds);
+	//return the middle of the given bucket, in microseconds
+	static GLdouble GetBucketValue(GLuint Bucket);
+
+	std::atomic<GLuint64> Buckets[FRAMEHISTOGRAM_BUCKETS]; /**< how many samples fell into each bucket */
+	std::atomic<GLuint64> Total; /**< the sum of every sample in microseconds */
+	std::atomic<GLuint64> Min; /**< the shortest sample in microseconds */
+	std::atomic<GLuint64> Max; /**< the longest sample in microseconds */
+	std::atomic<GLuint64> MissedDeadlines; /**< how many samples were over their deadline */
+};
+
+#endif
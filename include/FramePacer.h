@@ -0,0 +1,70 @@
+/**********************************************************************************************//**
+ * @file	WindowAPI\FramePacer.h
+ *
+ * @brief	Declares the frame pacer class.
+ **************************************************************************************************/
+#ifndef FRAME_PACER_H
+#define FRAME_PACER_H
+
+#include "WindowAPI_Defs.h"
+
+#define FRAMEPACER_HISTORY 128 /**< how many frame times are kept for the jitter measurement */
+
+/**
+* caps how often a window presents. attach one to a window with FWindow::SetFramePacer and
+* every SwapDrawBuffers call waits until the next frame is due. the wait sleeps for most of
+* the remaining time and spins for the last stretch since sleeping alone overshoots by up
+* to a scheduler tick. when the window can report vblank timestamps (GLX_OML_sync_control)
+* frames are lined up with the display's refresh instead of a free running clock
+*/
+class FramePacer
+{
+public:
+
+	//a target of 0 doesn't cap the frame rate but still measures it
+	FramePacer(GLdouble TargetFPS = 0);
+
+	//set and get the frame rate to cap to. 0 for uncapped
+	GLboolean SetTargetFPS(GLdouble TargetFPS);
+	GLdouble GetTargetFPS();
+
+	//set how long before a deadline to stop sleeping and start spinning, in seconds
+	GLboolean SetSpinThreshold(GLdouble Seconds);
+
+	//block until the next frame is due. called by the window right before it swaps
+	void WaitForNextFrame();
+	//record that a frame was just presented. called by the window right after it swaps
+	void FrameFinished();
+
+	//tell the pacer when the display last refreshed and how often it does, both in seconds.
+	//a Time of 0 means only the period is known
+	void SetVBlank(GLdouble Time, GLdouble Period);
+
+	//return the time between the last two frames, in seconds
+	GLdouble GetLastFrameTime();
+	//return the average time between frames over the recent history, in seconds
+	GLdouble GetAverageFrameTime();
+	//return the standard deviation of the time between frames over the recent history, in seconds
+	GLdouble GetJitter();
+
+	//forget the frame history and the current deadline
+	void Reset();
+
+private:
+
+	//sleep then spin until the given time according to GetMonotonicTime
+	void WaitUntil(GLdouble Deadline);
+
+	GLdouble TargetFrameTime; /**< how long each frame should take, in seconds. 0 for uncapped */
+	GLdouble SpinThreshold; /**< how close to a deadline the pacer stops sleeping and spins, in seconds */
+	GLdouble NextFrameTime; /**< when the next frame is due. 0 until the first frame */
+	GLdouble VBlankTime; /**< when the display last refreshed. 0 if unknown */
+	GLdouble VBlankPeriod; /**< how long a refresh of the display takes. 0 if unknown */
+	GLdouble LastPresentTime; /**< when the last frame was presented. 0 until the first frame */
+
+	GLdouble FrameTimes[FRAMEPACER_HISTORY]; /**< the most recent frame times, used as a ring */
+	GLuint FrameTimeIndex; /**< where the next frame time goes in the ring */
+	GLuint FrameTimeCount; /**< how many of the frame times are valid */
+};
+
+#endif
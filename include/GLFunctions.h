@@ -0,0 +1,43 @@
+/**********************************************************************************************//**
+ * @file	WindowAPI\GLFunctions.h
+ *
+ * @brief	Declares the OpenGL function dispatch table.
+ **************************************************************************************************/
+#ifndef GL_FUNCTIONS_H
+#define GL_FUNCTIONS_H
+
+#include "WindowAPI_Defs.h"
+
+/**
+* a dispatch table holding every OpenGL (and on Linux GLX) entry point declared in the bundled
+* extension headers. tables are cached per renderer by the window manager and shared by every
+* window running on that renderer. each entry starts out pointing at a trampoline that looks the
+* real function up the first time it is called and stores it in the table it belongs to, or Load
+* can resolve all of them up front. an entry being set does not mean the function is supported,
+* use HasGLExtension for that
+*/
+struct FGLFunctions
+{
+#define FOUNDATION_GL_FUNCTION(Return, Name, Parameters) Return (APIENTRY *Name) Parameters;
+#include "dependencies/glfunctionlist.h"
+#undef FOUNDATION_GL_FUNCTION
+
+	std::string Renderer; /**< the renderer and version strings this table was made for */
+	GLboolean Loaded; /**< whether every entry has been resolved already */
+	GLuint Slot; /**< which set of trampolines the table uses. GLFUNCTIONS_MAXTABLES if it has none of its own */
+
+	//point every entry at the trampolines of a free slot
+	FGLFunctions();
+	//give the slot back
+	~FGLFunctions();
+
+	//resolve every entry now instead of on first use. only does the work once
+	void Load();
+
+	//look up a single function of the current context by name. null if it can't be found
+	static void* Resolve(const char* Name);
+
+	static FOUNDATION_THREADLOCAL FGLFunctions* Current; /**< the table of the context that is current on this thread. used by the trampolines */
+};
+
+#endif
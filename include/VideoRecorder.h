@@ -0,0 +1,81 @@
+/**********************************************************************************************//**
+ * @file	WindowAPI\VideoRecorder.h
+ *
+ * @brief	Declares the Y4M video recorder class.
+ **************************************************************************************************/
+#ifndef VIDEO_RECORDER_H
+#define VIDEO_RECORDER_H
+
+#include "WindowAPI_Defs.h"
+#include "FrameHistogram.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+
+#define VIDEORECORDER_QUEUE 8 /**< how many converted frames the ring holds. one of them keeps the last written frame */
+
+/**
+* records frames to a raw YUV4MPEG2 (Y4M) file. frames are converted from RGBA to YUV 4:2:0
+* on the calling thread straight into a fixed ring of buffers, and a writer thread drains the
+* ring to disk. if the disk falls behind and the ring fills up, new frames are dropped and
+* counted so the caller never waits on I/O. the stream has a single size, so frames of any
+* other size are dropped too. the stream has a constant frame rate, so every dropped frame is
+* written as a copy of the one before it. attach one to a window with FWindow::StartRecording
+*/
+class VideoRecorder
+{
+public:
+
+	VideoRecorder();
+	~VideoRecorder();
+
+	//create the file, write the stream header and start the writer thread. odd sizes are rounded down
+	GLboolean Start(const char* FileName, GLuint Width, GLuint Height, GLuint FramesPerSecond);
+	//write every frame still queued, stop the writer thread and close the file
+	void Stop();
+	//return whether a recording is in progress
+	GLboolean GetIsRecording();
+
+	//convert an RGBA frame with rows from the bottom up and queue it for writing. never blocks
+	GLboolean SubmitFrame(const GLubyte* Pixels, GLuint Width, GLuint Height);
+
+	//return how many frames have been written and dropped
+	GLuint64 GetWrittenFrames();
+	GLuint64 GetDroppedFrames();
+	//return statistics on how long converting a frame took on the calling thread. safe to call from any thread
+	FFrameStatistics GetConvertStatistics();
+	//return statistics on how long writing a frame took on the writer thread. safe to call from any thread
+	FFrameStatistics GetWriteStatistics();
+
+private:
+
+	//write queued frames until told to stop and the queue is empty
+	void WriterLoop();
+	//write one converted frame to the file unless a write already failed
+	void WriteFrame(const std::vector<GLubyte>& Frame);
+
+	//convert two RGBA rows into two rows of luma and one row of each chroma plane
+	static void ConvertRowPair(const GLubyte* Top, const GLubyte* Bottom, GLubyte* TopLuma, GLubyte* BottomLuma,
+		GLubyte* ChromaU, GLubyte* ChromaV, GLuint Width);
+
+	FILE* File; /**< the file being written. null if not recording */
+	GLuint Width; /**< the size of the stream. always even */
+	GLuint Height;
+	GLuint64 FrameSize; /**< how many bytes a converted frame takes */
+	std::vector<GLubyte> Frames[VIDEORECORDER_QUEUE]; /**< the converted frames waiting to be written, used as a ring */
+	GLuint64 DropsBefore[VIDEORECORDER_QUEUE]; /**< how many frames were dropped right before each queued frame */
+	GLuint64 PendingDrops; /**< how many frames were dropped since the last queued one. only the submitting thread touches it */
+	std::atomic<GLuint64> Submitted; /**< how many frames have been queued. only the submitting thread writes it */
+	std::atomic<GLuint64> Written; /**< how many frames have been written. only the writer thread writes it */
+	std::atomic<GLuint64> DroppedFrames; /**< how many frames were dropped */
+	std::atomic<GLboolean> Running; /**< cleared to tell the writer thread to finish */
+	std::atomic<GLboolean> WriteFailed; /**< set by the writer thread if the disk refused a write */
+	std::thread Writer; /**< the thread writing frames to disk */
+	std::mutex WakeLock; /**< guards waking the writer thread. never held during I/O */
+	std::condition_variable WakeWriter; /**< signalled whenever a frame is queued */
+	FrameHistogram ConvertTimes; /**< how long each frame took to convert */
+	FrameHistogram WriteTimes; /**< how long each frame took to write */
+};
+
+#endif
@@ -0,0 +1,125 @@
+/**********************************************************************************************//**
+ * @file	WindowAPI\VirtualWindow.h
+ *
+ * @brief	Declares the virtual window class.
+ **************************************************************************************************/
+#ifndef VIRTUAL_WINDOW_H
+#define VIRTUAL_WINDOW_H
+
+#include "WindowAPI_Defs.h"
+
+/**
+* a panel that lives inside a region of a real host window instead of having an X window,
+* visual and OpenGL context of its own. it renders into its own framebuffer object on the
+* host's context, and the host composites every panel into its back buffer in
+* SwapDrawBuffers, so any number of panels still cost a single swap. input that lands on a
+* panel is routed to it instead of the host, and key events go to the focused panel. it is
+* not an FWindow and isn't added to the WindowManager, so it can't be looked up by name or
+* index there. it only has a few functions named after FWindow's for its size, position,
+* focus and input callbacks. positions are in host window coordinates(origin at the top left)
+*/
+class FVirtualWindow
+{
+public:
+
+	FVirtualWindow(const char* WindowName, GLuint Width = 320, GLuint Height = 240, GLuint X = 0, GLuint Y = 0);
+	~FVirtualWindow();
+
+	//put the panel on top of the other panels of the host. the host must have or be able to create an OpenGL context
+	//with framebuffer objects. the panel must be shut down before the host is destroyed, or the host detaches it
+	GLboolean Initialize(FWindow* Host);
+	//delete the panel's framebuffer and take it out of its host
+	GLboolean Shutdown();
+	//return the window the panel lives in. null if it isn't initialized
+	FWindow* GetHost();
+
+	//return the name of the panel
+	const char* GetWindowName();
+
+	//return the resolution of the panel
+	GLboolean GetResolution(GLuint& Width, GLuint& Height);
+	GLuint* GetResolution();
+	//set the resolution of the panel. the contents are lost and have to be redrawn
+	GLboolean SetResolution(GLuint Width, GLuint Height);
+
+	//return the position of the panel within the host
+	GLboolean GetPosition(GLuint& X, GLuint& Y);
+	GLuint* GetPosition();
+	//move the panel within the host
+	GLboolean SetPosition(GLuint X, GLuint Y);
+
+	//return the mouse position relative to the panel
+	GLboolean GetMousePosition(GLuint& X, GLuint& Y);
+	GLuint* GetMousePosition();
+
+	//get the state of a key(Down/Up) by index
+	GLboolean GetKeyState(GLuint Key);
+
+	//hide or show the panel. a minimized panel isn't drawn and gets no input
+	GLboolean Minimize(GLboolean NewState);
+	GLboolean GetIsMinimized();
+
+	//whether the panel gets the host's key events
+	GLboolean GetInFocus();
+	GLboolean Focus(GLboolean NewState);
+
+	//put the panel on top of the other panels of the host
+	GLboolean Raise();
+
+	//make the host's context current and bind the panel's framebuffer, sized to the panel, for drawing. unlike
+	//FWindow::MakeCurrentContext this doesn't start timing a frame of the host or bind its render target
+	GLboolean MakeCurrentContext();
+	//finish drawing the panel and bind the host's framebuffer again. the host shows the panel at its next swap
+	//and keeps showing it until it is drawn again
+	GLboolean SwapDrawBuffers();
+
+	//return the colour texture the panel is drawn into. 0 until it has been drawn
+	GLuint GetColourTexture();
+
+	//set the on key event callback for this panel
+	GLboolean SetOnKeyEvent(OnKeyEvent OnKey);
+	//set the on mouse button event callback for this panel
+	GLboolean SetOnMouseButtonEvent(OnMouseButtonEvent OnMouseButton);
+	//set the on mouse wheel event callback for this panel
+	GLboolean SetOnMouseWheelEvent(OnMouseWheelEvent OnMouseWheel);
+	//set the on mouse move callback for this panel. window coordinates are relative to the panel
+	GLboolean SetOnMouseMove(OnMouseMoveEvent OnMouseMove);
+	//set the on focus callback for this panel
+	GLboolean SetOnFocus(OnFocusEvent OnFocus);
+
+private:
+
+	friend class FWindow; // lets the host route input to the panel and composite it
+
+	//remake the framebuffer at the panel's resolution. the host's context must be current
+	GLboolean CreateFramebuffer();
+	void DestroyFramebuffer();
+
+	//return whether a point in host coordinates is on the panel
+	GLboolean Contains(GLint X, GLint Y);
+
+	std::string Name; /**< the name of the panel */
+	FWindow* Host; /**< the window the panel lives in. null if not initialized */
+	GLuint Resolution[2]; /**< the size of the panel */
+	GLuint Position[2]; /**< the top left corner of the panel in host coordinates */
+	GLuint MousePosition[2]; /**< the mouse position relative to the panel */
+	GLboolean Keys[KEY_LAST]; /**< which keys the panel has seen go down and not up */
+	GLboolean MouseButton[MOUSE_LAST]; /**< which mouse buttons the panel has seen go down and not up */
+	GLboolean Minimized; /**< whether the panel is hidden */
+	GLboolean InFocus; /**< whether the panel gets the host's key events */
+	GLboolean Drawn; /**< whether the framebuffer holds something to show */
+
+	GLuint Framebuffer; /**< the framebuffer the panel is drawn into */
+	GLuint Colour; /**< the colour texture of the framebuffer */
+	GLuint DepthStencil; /**< the depth and stencil renderbuffer of the framebuffer */
+	GLuint FramebufferSize[2]; /**< the size the framebuffer was made at */
+	FDamageRect CompositedArea; /**< where the panel was last composited into the host. empty if it wasn't */
+
+	OnKeyEvent KeyEvent; /**< called when a key event is routed to the panel */
+	OnMouseButtonEvent MouseButtonEvent; /**< called when a mouse button event is routed to the panel */
+	OnMouseWheelEvent MouseWheelEvent; /**< called when a mouse wheel event is routed to the panel */
+	OnMouseMoveEvent MouseMoveEvent; /**< called when the mouse moves over the panel */
+	OnFocusEvent FocusEvent; /**< called when the panel gains or loses focus */
+};
+
+#endif
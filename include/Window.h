@@ -5,7 +5,15 @@
 #include <stdlib.h>
 #include <string>
 #include <fcntl.h>
+#include <thread>
+#include <vector>
 #include "WindowAPI_Defs.h"
+#include "GLFunctions.h"
+#include "FramePacer.h"
+#include "FrameHistogram.h"
+#include "FrameExport.h"
+#include "VideoRecorder.h"
+#include "VirtualWindow.h"
 
 #if defined(_WIN32) || defined(_WIN64)
 #include <io.h>
@@ -69,12 +77,46 @@ public:
 
 	//make the window swap draw buffers
 	GLboolean SwapDrawBuffers();
+	//present only the given rectangles and any exposed areas where the platform supports it 
+	//(GLX_MESA_copy_sub_buffer) and vertical sync is off, since the copy would tear. otherwise the whole window is swapped
+	GLboolean SwapDrawBuffers(const FDamageRect* Rects, GLuint NumRects);
+
+	//mark part of the window as changed. a full swap with no damage marked counts as the whole window changing
+	GLboolean AddDamage(const FDamageRect& Rect);
+	//return how many frames old the contents of the back buffer are. 0 if unknown, in which case redraw everything
+	GLuint GetBufferAge();
+	//return the area that has to be redrawn this frame for the back buffer to be up to date
+	FDamageRect GetRepaintBounds();
+
+	//return the CPU pixel buffer of a window created with CONTEXTCREATION_SOFTWARE. the pixels are 32 bit in the
+	//layout GetSoftwareSurfaceFormat returns, with rows from the top down, Stride bytes apart. draw into it then call
+	//SwapDrawBuffers, with damage rectangles to only present what changed. the buffer is kept between frames but
+	//replaced when the window is resized, so call this every frame
+	GLubyte* GetSoftwareSurface(GLuint& Width, GLuint& Height, GLuint& Stride);
+	//return the byte order of the software surface's pixels(SOFTWAREFORMAT_RGBA or SOFTWAREFORMAT_BGRA). it is the
+	//platform's own layout whenever the surface can be presented without converting it
+	GLuint GetSoftwareSurfaceFormat();
 
 	//toggle full screen mode depending on NewState. (true = Full screen, false = normal)
 	GLboolean FullScreen(GLboolean NewState);
 	//return if the window is in full screen mode
 	GLboolean GetIsFullScreen();
 
+	//toggle low latency mode. a low latency window asks the compositor to stop copying its frames
+	//(_NET_WM_BYPASS_COMPOSITOR) even when it isn't full screen. full screen windows always ask
+	GLboolean SetLowLatencyMode(GLboolean NewState);
+	GLboolean GetLowLatencyMode();
+	//return whether the window currently asks the compositor to be bypassed
+	GLboolean GetIsBypassingCompositor();
+
+	//return the modes the display the window is on supports, along with their refresh rates. needs XRandR 1.3 on Linux
+	std::list<FDisplayMode> GetDisplayModes();
+	//go full screen and switch the display the window is on to the given resolution. a RefreshRate of 0 picks
+	//the fastest. the original mode comes back when leaving full screen, on Shutdown, and if the process exits or crashes
+	GLboolean ExclusiveFullScreen(GLuint Width, GLuint Height, GLdouble RefreshRate = 0);
+	//return whether the window has switched the display mode
+	GLboolean GetIsExclusiveFullScreen();
+
 	//toggle minimization depending on NewState. (true = minimized, false = normal)
 	GLboolean Minimize(GLboolean NewState);
 	//return if the window is Minimized
@@ -90,6 +132,27 @@ public:
 	//creates on OpenGL Context
 	GLboolean InitializeGL();
 
+	//set the attributes of the OpenGL context. must be called before the window is initialized
+	GLboolean SetContextAttributes(const FContextAttributes& Attributes);
+	//return the attributes of the OpenGL context. once created this reflects what was actually granted
+	const FContextAttributes& GetContextAttributes();
+
+	//share OpenGL resources with another window that has already been initialized. must be called before 
+	//this window is initialized. ShareMode is either CONTEXTSHARE_GROUP or CONTEXTSHARE_SINGLE.
+	//the source window must outlive this window
+	GLboolean ShareContext(FWindow* SourceWindow, GLuint ShareMode);
+	//return how this window shares its context
+	GLuint GetContextShareMode();
+
+	//set when the OpenGL context is created(CONTEXTCREATION_IMMEDIATE, _LAZY or _BACKGROUND), or that the window
+	//is drawn on the CPU without one(CONTEXTCREATION_SOFTWARE). must be called before the window is initialized
+	GLboolean SetContextCreation(GLuint CreationMode);
+
+	//return how long after initialization the window was first mapped, in seconds. 0 if it hasn't been yet
+	GLdouble GetTimeToFirstMap();
+	//return how long after initialization the first frame was presented, in seconds. 0 if it hasn't been yet
+	GLdouble GetTimeToFirstFrame();
+
 	//get and set for window name
 	const char* GetWindowName();
 	GLboolean SetTitleBar(const char* NewText);
@@ -117,6 +180,93 @@ public:
 	//a swap setting of -1 turns on adaptive V-sync on supported systems
 	GLboolean SetSwapInterval(GLint SwapSetting);
 
+	//attach a frame pacer that SwapDrawBuffers waits on. null detaches it. 
+	//the pacer must outlive the window or be detached first
+	GLboolean SetFramePacer(FramePacer* NewPacer);
+	FramePacer* GetFramePacer();
+
+	//return statistics on how much CPU time SwapDrawBuffers took. safe to call from any thread
+	FFrameStatistics GetSwapTimeStatistics();
+	//return statistics on the time between calls to SwapDrawBuffers. safe to call from any thread
+	FFrameStatistics GetFrameIntervalStatistics();
+	//forget the frame statistics gathered so far. safe to call from any thread
+	GLboolean ResetFrameStatistics();
+	//set how long a frame may take before it counts as a missed deadline, in seconds.
+	//0 uses one and a half frames of the frame pacer's target, if there is one
+	GLboolean SetFrameDeadline(GLdouble Seconds);
+
+	//time every frame on the GPU with a ring of timer queries, from the first MakeCurrentContext of the frame
+	//to SwapDrawBuffers, not counting the pacer wait or the swap. results are read back a few frames later without 
+	//stalling. needs GL_ARB_timer_query
+	GLboolean EnableGPUTiming(GLuint QueryCount = 4);
+	GLboolean DisableGPUTiming();
+	//return statistics on how long frames took on the GPU. safe to call from any thread
+	FFrameStatistics GetGPUTimeStatistics();
+	//return statistics on the CPU time over the same span the GPU time is measured. safe to call from any thread
+	FFrameStatistics GetCPUTimeStatistics();
+
+	//limit how many frames the driver may queue ahead of the GPU using fences. 0 removes the limit.
+	//needs GL_ARB_sync
+	GLboolean SetMaxFramesInFlight(GLuint MaxFrames);
+	GLuint GetMaxFramesInFlight();
+	//return statistics on how long SwapDrawBuffers waited for the GPU to catch up. safe to call from any thread
+	FFrameStatistics GetFenceWaitStatistics();
+
+	//return what the compositor last reported about a presented frame. everything is 0 unless the
+	//window manager supports _NET_WM_FRAME_TIMINGS. call from the thread that polls events
+	FFrameTimings GetFrameTimings();
+	//return statistics on how long after SwapDrawBuffers frames reached the screen, as reported by
+	//the compositor. safe to call from any thread
+	FFrameStatistics GetPresentLatencyStatistics();
+
+	//render into an offscreen target whose resolution follows the render time, kept between MinScale and MaxScale 
+	//of the window's size, and upscale it to the window in SwapDrawBuffers. a TargetFrameTime of 0 uses the 
+	//frame pacer's target or 60 fps. the target is bound after every swap. the render time is timed on the GPU
+	//from the start of the frame to the upscale, turning GPU timing on if GL_ARB_timer_query is there, and on
+	//the CPU otherwise. the swap and the pacer never count, so the scale comes back up once the load drops
+	GLboolean EnableDynamicResolution(GLdouble TargetFrameTime = 0, GLdouble MinScale = 0.5, GLdouble MaxScale = 1.0);
+	GLboolean DisableDynamicResolution();
+	//return the size that is currently being rendered at. use it instead of the window resolution for glViewport
+	GLboolean GetRenderResolution(GLuint& Width, GLuint& Height);
+	//return the current render resolution as a fraction of the window's resolution
+	GLdouble GetRenderScale();
+
+	//read the next frame back into a ring of pixel buffers and hand it to OnCapture a few frames later, once
+	//the GPU is done with it, so the render thread never waits. Continuous keeps capturing every frame until
+	//RequestCapture is called with null. the pixels are only valid during the callback. needs GL_ARB_sync
+	GLboolean RequestCapture(OnCaptureEvent OnCapture, GLboolean Continuous = GL_FALSE);
+	//return statistics on how much time capturing added to SwapDrawBuffers. safe to call from any thread
+	FFrameStatistics GetCaptureCostStatistics();
+	//return statistics on the time from a frame being read to the callback getting it. safe to call from any thread
+	FFrameStatistics GetCaptureLatencyStatistics();
+	//return how many requested frames were skipped because every pixel buffer was still busy
+	GLuint64 GetDroppedCaptures();
+
+	//publish every frame into a shared memory ring other processes can read in place by attaching a
+	//FrameExportReader with the same name. frames are read back asynchronously like RequestCapture.
+	//a MaxWidth or MaxHeight of 0 uses the screen resolution. needs GL_ARB_sync
+	GLboolean EnableFrameExport(const char* Name, GLuint MaxWidth = 0, GLuint MaxHeight = 0);
+	GLboolean DisableFrameExport();
+	//return the exporter of this window. null if frame export is off
+	FrameExporter* GetFrameExporter();
+
+	//record every frame to a Y4M file. frames are read back asynchronously like RequestCapture, converted to
+	//YUV 4:2:0 and written by a background thread. frames are dropped rather than waited on if the disk falls
+	//behind, and so are frames after a resize. a FramesPerSecond of 0 uses the frame pacer's target or 60. needs GL_ARB_sync
+	GLboolean StartRecording(const char* FileName, GLuint FramesPerSecond = 0);
+	//write out the frames still queued and close the file
+	GLboolean StopRecording();
+	//return the recorder of this window, e.g. for its dropped frames. null if not recording
+	VideoRecorder* GetVideoRecorder();
+
+	//present the last frame of another window instead of drawing, scaled to fit this window(so a smaller mirror is a downscaled
+	//copy). each frame the source blits its back buffer into one of two textures shared with its mirrors and each mirror blits it
+	//to its own back buffer, so nothing is rendered twice. this window's context must be in the source's share group 
+	//(ShareContext) and both should be swapped from the same thread. null stops mirroring
+	GLboolean SetMirrorSource(FWindow* Source, GLboolean KeepAspectRatio = GL_TRUE);
+	//return the window this window mirrors. null if it isn't a mirror
+	FWindow* GetMirrorSource();
+
 	//set the on key event callback for this window
 	GLboolean SetOnKeyEvent(OnKeyEvent OnKey);
 	//set the on mouse button event callback for this window
@@ -139,6 +289,18 @@ public:
 	GLboolean SetOnResize(OnResizeEvent OnResize);
 	//set the window on Mouse move callback event for this window
 	GLboolean SetOnMouseMove(OnMouseMoveEvent OnMouseMove);
+	//set the callback that runs right before this window swaps, after the mouse and keyboard state has been read 
+	//straight from the platform. no other callbacks run. use it to sample input as late as possible, e.g. to patch a camera uniform
+	GLboolean SetOnLateLatch(OnLateLatchEvent OnLateLatch);
+	//return statistics on how much fresher the late latched input was than input sampled at the 
+	//start of the frame. frames where the input didn't change count as 0. safe to call from any thread
+	FFrameStatistics GetLateLatchStatistics();
+
+	//add a function to run right before(SWAPHOOK_PRE) or right after(SWAPHOOK_POST) every swap of this window, with the
+	//context current. hooks run in order of Priority, lowest first, and never allocate. hooks added through the window
+	//manager run around them. only change hooks from the thread that swaps, and never from inside a hook
+	GLboolean AddSwapHook(GLuint Stage, OnSwapEvent Hook, void* UserData = nullptr, GLint Priority = 0);
+	GLboolean RemoveSwapHook(GLuint Stage, OnSwapEvent Hook, void* UserData = nullptr);
 
 	//print the current OpenGL version
 	GLboolean PrintOpenGLVersion();
@@ -146,8 +308,16 @@ public:
 	const char* GetOpenGLVersion();
 	//print all supported extensions
 	GLboolean PrintOpenGLExtensions();
-	//return all the supported extensions
+	//return all the supported extensions separated by spaces. works on core profiles as well
 	const char* GetOpenGLExtensions();
+	//whether the context of this window supports the given OpenGL extension
+	GLboolean HasGLExtension(const char* Extension);
+
+	//return the OpenGL function table of this window's renderer. entries are looked up the first 
+	//time they are called and the table is shared with every other window on the same renderer
+	FGLFunctions* GetGLFunctions();
+	//look up every function in the table now rather than on first use
+	GLboolean LoadGLFunctions();
 
 	//enable window decorator
 	GLboolean EnableDecorator(GLbitfield Decorator);
@@ -155,6 +325,7 @@ public:
 	GLboolean DisableDecorator(GLbitfield Decorator);
 
 	friend class WindowManager; // lets window use private variables of WindowManager
+	friend class FVirtualWindow; // lets virtual windows draw with this window's context
 
 private:
 
@@ -172,15 +343,107 @@ private:
 	GLboolean InFocus; /**< Whether the FWindow is currently in focus(if it is the current window be used)*/
 	GLboolean Initialized; /**< Whether the FWindoa has been fully Initialized*/
 	GLboolean ContextCreated; /**< Whether the OpenGL context for this window has been created*/
-	GLboolean IsCurrentContext; /**< Whether the window is the current window that is being drawn to */
 	GLuint CurrentState; /**< The current state of the window. these states include Normal, Minimized, Maximized and Full screen*/
+	GLboolean LowLatencyMode; /**< whether the window asks to bypass the compositor even when not full screen */
+	GLboolean DisplayModeChanged; /**< whether the window has switched the display mode for exclusive full screen */
 	GLuint CurrentSwapInterval; /**< The current swap interval of the window(V-Sync). a value of -1 enables adaptive V-Sync on supported systems */
 	GLbitfield CurrentWindowStyle; /**< the current window style */
+	FContextAttributes ContextAttributes; /**< the attributes of the OpenGL context (version, profile, etc.) */
+	FWindow* ShareWindow; /**< the window whose context this window shares with. null if it shares nothing */
+	GLuint ShareMode; /**< how the context is shared with ShareWindow. CONTEXTSHARE_NONE, _GROUP or _SINGLE */
+	GLuint ContextCreation; /**< when the context gets created. CONTEXTCREATION_IMMEDIATE, _LAZY or _BACKGROUND */
+	GLdouble InitializeTime; /**< when Initialize was called, according to GetMonotonicTime */
+	GLdouble TimeToFirstMap; /**< seconds between Initialize and the window first being mapped */
+	GLdouble TimeToFirstFrame; /**< seconds between Initialize and the first frame being presented */
+	FExtensionSet* Extensions; /**< the OpenGL extensions of this window's renderer. owned by the window manager */
+	FGLFunctions* GLFunctions; /**< the OpenGL function table of this window's renderer. owned by the window manager */
+	FramePacer* Pacer; /**< the frame pacer SwapDrawBuffers waits on. null if there isn't one */
+	FrameHistogram SwapTimes; /**< how much CPU time each SwapDrawBuffers call took */
+	FrameHistogram FrameIntervals; /**< the time between SwapDrawBuffers calls */
+	GLdouble LastSwapTime; /**< when SwapDrawBuffers last returned. 0 before the first frame */
+	GLdouble FrameDeadline; /**< how long a frame may take before it counts as missed. 0 to use the pacer's target */
+
+	//start timing a frame if GPU timing is on and a frame isn't being timed already
+	void BeginGPUTiming();
+	//mark where the current frame stopped rendering, i.e. right after the render target was resolved
+	void MarkGPUResolve();
+	//stop timing the current frame and collect any results that are ready
+	void EndGPUTiming();
+
+	GLboolean GPUTimingEnabled; /**< whether frames are being timed on the GPU */
+	GLuint GPUQueries[GPUTIMING_MAXQUERIES * 3]; /**< a start, render target resolved and end timestamp query for each frame in the ring */
+	GLuint GPUQueryCount; /**< how many frames the ring holds */
+	GLuint GPUQueryHead; /**< the ring slot the next frame is timed with */
+	GLuint GPUQueryPending; /**< how many frames are waiting on results */
+	GLboolean GPUFrameOpen; /**< whether the start timestamp of the current frame was issued */
+	GLboolean GPUResolveMarked; /**< whether the resolved timestamp of the current frame was issued */
+	GLdouble CPUFrameStart; /**< when the current frame started on the CPU */
+	FrameHistogram GPUFrameTimes; /**< how long each frame took on the GPU */
+	FrameHistogram CPUFrameTimes; /**< how long each frame took on the CPU over the same span */
+	GLdouble LastGPUFrameTime; /**< how long the most recently read back frame took on the GPU */
+
+	//make sure the render target matches the window size then bind it for the next frame
+	void BeginRenderTarget();
+	//upscale the render target to the window's back buffer
+	void ResolveRenderTarget();
+	//pick the render scale for the next frame from how long the last one took to render
+	void UpdateRenderScale(GLdouble RenderTime);
+	void DestroyRenderTarget();
+
+	GLboolean DynamicResolutionEnabled; /**< whether frames are rendered offscreen at a dynamic resolution */
+	GLdouble RenderScale; /**< the current render resolution as a fraction of the window's */
+	GLdouble MinRenderScale; /**< the lowest the render scale may go */
+	GLdouble MaxRenderScale; /**< the highest the render scale may go */
+	GLdouble TargetRenderTime; /**< the frame time the render scale aims for. 0 to use the pacer's */
+	GLdouble SmoothedRenderTime; /**< a moving average of recent render times */
+	GLboolean DynamicResolutionTiming; /**< whether EnableDynamicResolution turned GPU timing on itself */
+	GLdouble PacerWaitTime; /**< how long SwapDrawBuffers waited on the frame pacer this frame */
+	GLuint RenderFramebuffer; /**< the offscreen framebuffer */
+	GLuint RenderColour; /**< the colour texture of the offscreen framebuffer */
+	GLuint RenderDepthStencil; /**< the depth and stencil renderbuffer of the offscreen framebuffer */
+	GLuint RenderTargetSize[2]; /**< the size the render target was allocated at, i.e. MaxRenderScale of the window */
+	GLuint RenderResolution[2]; /**< the part of the render target currently rendered to */
+
+	//deliver every finished capture then start reading this frame back if one was requested
+	void ProcessCaptures();
+	//drop every pending capture and delete the pixel buffers
+	void DestroyCaptures();
+
+	OnCaptureEvent CaptureEvent; /**< who gets the next captured frame. null if none was requested */
+	GLboolean ContinuousCapture; /**< whether every frame is captured rather than just the next one */
+	FCaptureSlot CaptureSlots[CAPTURE_RINGSIZE]; /**< the pixel buffers frames are read into, used as a ring */
+	GLuint CaptureHead; /**< the ring slot the next frame is read into */
+	GLuint CapturePending; /**< how many slots are waiting on the GPU */
+	GLuint64 DroppedCaptures; /**< how many frames were skipped because the ring was full */
+	FrameHistogram CaptureCosts; /**< how long capturing took in each SwapDrawBuffers that did any */
+	FrameHistogram CaptureLatencies; /**< how long each capture took to reach its callback */
+	FrameExporter* Exporter; /**< publishes every frame to other processes. null if frame export is off */
+	VideoRecorder* Recorder; /**< records every frame to disk. null if not recording */
+
+	//fence the frame that was just swapped and wait for older frames until few enough are in flight
+	void LimitFramesInFlight();
+
+	GLuint MaxFramesInFlight; /**< how many frames may be queued ahead of the GPU. 0 for no limit */
+	GLsync FrameFences[FRAMESINFLIGHT_MAX]; /**< a fence after each frame that is still in flight, used as a ring */
+	GLuint FrameFenceHead; /**< the ring slot the next fence goes in */
+	GLuint FrameFencePending; /**< how many fences haven't been waited on yet */
+	FrameHistogram FenceWaitTimes; /**< how long each wait for the GPU to catch up took */
+
+	FFrameTimings FrameTimings; /**< what the compositor last reported about a presented frame */
+	FPendingFrame PendingFrames[FRAMETIMINGS_HISTORY]; /**< recently presented frames keyed by frame counter value, used as a ring */
+	FrameHistogram PresentLatencies; /**< how long after SwapDrawBuffers each frame reached the screen */
+
+	//make this window's context current on the calling thread, skipping the driver if it already is
+	void BindContext();
+	//release this window's context if it is current on the calling thread. used before it is destroyed
+	void UnbindContext();
 
 	//set all the Events to null 
 	void InitializeEvents();
 	//Initializes OpenGL extensions
 	void InitGLExtensions();
+	//put the display back to the mode it had before ExclusiveFullScreen
+	void RestoreDisplayMode();
 
 	OnKeyEvent KeyEvent; /**< this is the callback to be used when a key has been pressed*/
 	OnMouseButtonEvent MouseButtonEvent; /**< this is the callback to be used when a mouse button has been pressed*/
@@ -193,6 +456,78 @@ private:
 	OnMovedEvent MovedEvent;  /**< this is the callback to be used the window has been moved in a non-programmatic fashion*/
 	OnResizeEvent ResizeEvent; /**< this is a callback to be used when the window has been resized in a non-programmatic fashion*/
 	OnMouseMoveEvent MouseMoveEvent; /**< this is a callback to be used when the mouse has been moved*/
+	OnLateLatchEvent LateLatchEvent; /**< this is a callback to be used right before the window swaps*/
+	GLdouble FrameStartTime; /**< when the current frame started, i.e. when input would normally have been sampled. 0 if it hasn't */
+	FrameHistogram LateLatchGains; /**< how much fresher late latched input was than start of frame input */
+
+	//read the mouse and keyboard state straight from the platform without dispatching any events. returns whether it changed
+	GLboolean LatchInput();
+
+	//run the global and window swap hooks of a stage, if there are any. pre hooks run global ones first, post hooks last
+	void RunSwapHooks(GLuint Stage, GLdouble SwapStart, GLdouble SwapEnd);
+
+	FSwapHookList SwapHooks[2]; /**< the hooks that run before and after each swap of this window */
+	GLuint64 SwapCount; /**< how many frames have been swapped */
+
+	//hand input to the virtual window under the mouse(or holding it) or in focus. returns false if no virtual window took it
+	GLboolean RouteVirtualKey(GLuint Key, GLboolean KeyState);
+	GLboolean RouteVirtualMouseButton(GLuint Button, GLboolean ButtonState);
+	GLboolean RouteVirtualMouseWheel(GLuint WheelDirection);
+	GLboolean RouteVirtualMouseMove(GLuint WindowX, GLuint WindowY, GLuint ScreenX, GLuint ScreenY);
+	//return the topmost visible virtual window at a point. null if there isn't one
+	FVirtualWindow* GetVirtualWindowAt(GLint X, GLint Y);
+	//copy every visible virtual window into the back buffer, bottom first
+	void CompositeVirtualWindows();
+
+	std::vector<FVirtualWindow*> VirtualWindows; /**< the panels hosted in this window, bottom first */
+	FVirtualWindow* FocusedVirtualWindow; /**< the panel that gets key events. null if the window gets them */
+	FVirtualWindow* PointerVirtualWindow; /**< the panel a mouse button was pressed on, which gets the mouse until it is released */
+
+	//copy the back buffer into the next of the textures the mirrors of this window read from
+	void UpdateMirrorTexture();
+	void DestroyMirrorTexture();
+	//blit the last frame of the mirror source into the back buffer, scaled to fit, and fence the read
+	void DrawMirror();
+	//return the window whose context this window's context shares objects with, following the chain to the first one
+	FWindow* GetShareRoot();
+
+	FWindow* MirrorSource; /**< the window this window mirrors. null if it draws itself */
+	GLboolean MirrorKeepAspect; /**< whether the mirrored frame keeps its aspect ratio, with black bars around it */
+	GLuint MirrorReadFramebuffer; /**< a framebuffer on this window's context that the source's mirror texture is attached to */
+	GLsync MirrorReadFence; /**< signalled once this mirror's last blit from the source has finished. null if there is none */
+	GLuint MirrorReadSlot; /**< which of the source's mirror textures that blit read */
+	std::vector<FWindow*> MirrorWindows; /**< the windows mirroring this one */
+	GLuint MirrorFramebuffers[MIRROR_BUFFERS]; /**< the framebuffers the back buffer is copied into for the mirrors, in turn */
+	GLuint MirrorTextures[MIRROR_BUFFERS]; /**< the colour textures of those framebuffers, shared with the mirrors */
+	GLsync MirrorFences[MIRROR_BUFFERS]; /**< signalled once the last copy into each texture has finished. null if fences aren't supported */
+	GLuint MirrorHead; /**< which texture holds the newest frame */
+	GLuint MirrorSize[2]; /**< the size of the mirror textures */
+
+	//remember what changed in the frame that was just presented, for buffer age
+	void RecordDamage(const FDamageRect* Rects, GLuint NumRects);
+	//mark the whole window as damaged and forget the history, after a resize reallocated the buffers
+	void ResetDamage();
+
+	FDamageRect PendingDamage[DAMAGE_MAXRECTS]; /**< what has changed since the last present */
+	GLuint PendingDamageCount; /**< how many pending rectangles there are */
+	FDamageRect DamageHistory[DAMAGE_HISTORY]; /**< the bounds of what changed in each recently presented frame, used as a ring */
+	GLuint DamageHistoryHead; /**< the ring slot the next presented frame goes in */
+	GLboolean LastSwapWasPartial; /**< whether the last present copied regions instead of swapping, which keeps the back buffer intact */
+
+	//present the software surface instead of swapping, with the same pacing and statistics
+	GLboolean SwapSoftwareSurface(const FDamageRect* Rects, GLuint NumRects);
+	//(re)create the software surface at the window's resolution
+	GLboolean CreateSoftwareSurface();
+	void DestroySoftwareSurface();
+	//convert a row of RGBA pixels to 32 bit pixels with each channel at the given bit offset
+	static void ConvertSoftwareRow(const GLubyte* Source, GLuint* Destination, GLuint Width,
+		GLuint RedShift, GLuint GreenShift, GLuint BlueShift);
+
+	GLubyte* SoftwarePixels; /**< the pixels the application draws into. null if there is no software surface */
+	GLuint SoftwareSize[2]; /**< the size the software surface was created at */
+	GLuint SoftwareStride; /**< how many bytes apart the rows of SoftwarePixels are */
+	GLuint SoftwareFormat; /**< the byte order of SoftwarePixels */
+	GLboolean SoftwareStaged; /**< whether SoftwarePixels is a separate RGBA copy converted into the platform image on every present */
 
 	GLboolean EXTSwapControlSupported; /**< Whether the EXT_Swap_Control(Generic) GL extension is supported on this machine */
 	GLboolean SGISwapControlSupported; /**< Whether the SGI_Swap_Control(Silicon graphics) GL extension is supported on this machine */
@@ -220,6 +555,11 @@ private:
 	drawn above the toolbar. changing the screen resolution to match has been disabled 
 	due to event handling issues*/
 	void Windows_FullScreen();
+	//list the modes of the primary display via EnumDisplaySettings
+	std::list<FDisplayMode> Windows_GetDisplayModes();
+	//switch the primary display to the given mode and cover it with the window
+	GLboolean Windows_SetDisplayMode(const FDisplayMode& Mode);
+	void Windows_RestoreDisplayMode();
 	//uses the win32 system to minimize/hide the window. minimized windows don't receive events
 	void Windows_Minimize();
 	//uses the win32 system to maximize the window. 
@@ -253,6 +593,19 @@ private:
 	//initialize NEEDED OpenGL extensions for the windows platform
 	void Windows_InitGLExtensions();
 
+	//create a DIB section the software surface is converted into
+	GLboolean Windows_CreateSoftwareSurface();
+	void Windows_DestroySoftwareSurface();
+	//convert the given rectangles into the DIB section and blit them to the window
+	void Windows_PresentSoftwareSurface(const FDamageRect* Rects, GLuint NumRects);
+	//poll the cursor and the keyboard with GetCursorPos and GetAsyncKeyState
+	GLboolean Windows_LatchInput();
+
+	HDC SurfaceDeviceContext; /**< the memory device context the software surface's DIB section is selected into */
+	HBITMAP SurfaceBitmap; /**< the DIB section the software surface is presented from */
+	HGDIOBJ SurfaceOldBitmap; /**< the bitmap that was selected into the memory device context before */
+	GLuint* SurfaceBits; /**< the pixels of the DIB section */
+
 	HDC DeviceContextHandle; /**< the handle to the device context */
 	HGLRC GLRenderingContextHandle; /**< the handle to the OpenGL rendering context*/
 	HPALETTE PaletteHandle; /**< handle to the draw palette*/
@@ -266,6 +619,11 @@ private:
 	PFNWGLSWAPBUFFERSMSCOMLPROC SwapIntervalMSCOM; // what the holy fuck is MSCOM?
 	PFNWGLGETEXTENSIONSSTRINGEXTPROC GetExtensionsStringEXT; /**< OpenGL extension for revealing available extensions*/
 
+	/*the device context and rendering context that are current on the calling thread. 
+	checked by MakeCurrentContext so redundant calls never reach wglMakeCurrent*/
+	static FOUNDATION_THREADLOCAL HDC CurrentDeviceContext; /**< the device context of the current context on this thread */
+	static FOUNDATION_THREADLOCAL HGLRC CurrentRenderingContext; /**< the current rendering context on this thread */
+
 #else
 	//uses the X11 system to initialize the window
 	GLboolean Linux_Initialize();
@@ -277,6 +635,15 @@ private:
 	void Linux_SetMousePosition(GLuint X, GLuint Y);
 	//uses the X11 system to toggle full screen mode 
 	void Linux_FullScreen(GLboolean NewState);
+	//set or clear _NET_WM_BYPASS_COMPOSITOR depending on the full screen state and low latency mode
+	void Linux_UpdateCompositorBypass();
+	//read _NET_WM_BYPASS_COMPOSITOR back from the X server
+	GLboolean Linux_GetIsBypassingCompositor();
+	//list the modes of the output the window is on via XRandR
+	std::list<FDisplayMode> Linux_GetDisplayModes();
+	//switch the CRTC the window is on to the given mode and cover it with the window
+	GLboolean Linux_SetDisplayMode(const FDisplayMode& Mode);
+	void Linux_RestoreDisplayMode();
 	//uses the X11 system to toggle minimization
 	void Linux_Minimize(GLboolean NewState);
 	//uses the X11 system to toggle maximization
@@ -291,6 +658,8 @@ private:
 	void Linux_SetIcon(const char* Icon, GLuint Width, GLuint Height);
 	//uses the X11 system to initialize create an OpenGL context for the window
 	GLboolean Linux_InitializeGL();
+	//creates the GLX context via GLX_ARB_create_context, falling back to a legacy context
+	GLXContext Linux_CreateContext();
 	//uses OpenGL extensions for Linux to toggle Vertical syncing
 	void Linux_VerticalSync(GLint EnableSync);
 	//shut down the window. closes all connections to the X11 system
@@ -306,12 +675,37 @@ private:
 	void InitializeAtomics();
 	//initialize the NEEDED OpenGL extensions that are supported on Linux
 	void Linux_InitGLExtensions();
+	//get when the display last refreshed and its refresh period via GLX_OML_sync_control
+	GLboolean Linux_GetVBlank(GLdouble& Time, GLdouble& Period);
+	//poll the pointer and the keyboard with XQueryPointer and XQueryKeymap
+	GLboolean Linux_LatchInput();
+	//swap the buffers, or copy only the damaged regions to the front buffer if possible
+	void Linux_PresentBuffers(const FDamageRect* Rects, GLuint NumRects);
+	//create the counter the window manager waits on during interactive resizes and advertise it
+	void Linux_InitSyncCounter();
+	//mark a frame as being drawn on the extended frame counter so the compositor holds off until it is done
+	void Linux_BeginFrameSync();
+	//mark the frame as done on the frame counters, and tell the window manager if it was the first at a new size
+	void Linux_EndFrameSync();
+	//handle the compositor reporting that a frame was drawn(_NET_WM_FRAME_DRAWN)
+	void Linux_OnFrameDrawn(GLuint64 Frame, GLdouble DrawnTime);
+	//handle the compositor reporting when a frame reached the screen(_NET_WM_FRAME_TIMINGS)
+	void Linux_OnFrameTimings(GLuint64 Frame, GLint PresentOffset, GLuint RefreshInterval, GLuint FrameDelay);
+
+	//create an XImage for the software surface, in MIT-SHM shared memory if the server allows it. the application
+	//draws straight into it when it is RGBA or BGRA in the host's byte order
+	GLboolean Linux_CreateSoftwareSurface();
+	void Linux_DestroySoftwareSurface();
+	//convert the given rectangles into the XImage and put them on the window
+	void Linux_PresentSoftwareSurface(const FDamageRect* Rects, GLuint NumRects);
 
 	//get the Handle To the Window
 	Window GetWindowHandle();
 
 	GLXFBConfig GetBestFrameBufferConfig();
 
+	GLXFBConfig FrameBufferConfig; /**< the frame buffer configuration the window and its context were created with */
+	std::thread ContextThread; /**< the worker thread creating the context when using CONTEXTCREATION_BACKGROUND */
 	Window WindowHandle; /**< the X11 handle to the window. I wish they didn't name the type 'Window' */
 	GLXContext Context; /**< the handle to the GLX rendering context */
 	XVisualInfo* VisualInfo; /**< the handle to the Visual Information. similar purpose to PixelformatDesriptor*/
@@ -323,6 +717,31 @@ private:
 	PFNGLXSWAPINTERVALMESAPROC SwapIntervalMESA; /**< the mesa swap interval extension */
 	PFNGLXSWAPINTERVALEXTPROC SwapIntervalEXT; /**< the generic swap interval extension*/
 	PFNGLXSWAPINTERVALSGIPROC SwapIntervalSGI;	 /**< the Silicon graphics swap interval extension*/
+	GLboolean OMLSyncControlSupported; /**< Whether GLX_OML_sync_control is supported, for vblank timestamps */
+	GLdouble RefreshPeriod; /**< the refresh period glXGetMscRateOML last reported. 0 until queried, and again after the window moves */
+	GLboolean CopySubBufferSupported; /**< Whether GLX_MESA_copy_sub_buffer is supported, for presenting only damaged regions */
+	GLboolean BufferAgeSupported; /**< Whether GLX_EXT_buffer_age is supported */
+	XID ModeSwitchedCrtc; /**< the RandR CRTC the window switched the mode of. 0 if none */
+
+	XImage* SurfaceImage; /**< the image the software surface is presented from. null if there is none */
+	XShmSegmentInfo SurfaceSegment; /**< the shared memory behind SurfaceImage. shmid is -1 if it isn't shared */
+	GC SurfaceGC; /**< the graphics context used to put the image */
+	GLboolean SurfaceBusy; /**< whether the X server may still be reading the shared image from the last present */
+
+	XSyncCounter SyncCounter; /**< the counter the window manager waits on while resizing. None if XSync is missing */
+	XSyncValue SyncValue; /**< the value the window manager asked the counter to be set to */
+	GLboolean SyncRequestPending; /**< whether the counter is due to be set after the next swap */
+	XSyncCounter FrameCounter; /**< the extended counter. odd while a frame is being presented, even otherwise */
+	GLuint64 FrameCounterValue; /**< the current value of the extended counter */
+	GLuint64 FrameSyncValue; /**< the value the window manager asked the extended counter to reach */
+	GLboolean FrameSyncPending; /**< whether the extended counter has to reach FrameSyncValue on the next frame */
+	GLboolean SyncResizeApplied; /**< whether the ConfigureNotify that follows the last sync request has been processed */
+
+	/*the display, drawable and context that are current on the calling thread. 
+	checked by MakeCurrentContext so redundant calls never reach glXMakeCurrent*/
+	static FOUNDATION_THREADLOCAL Display* CurrentDisplay; /**< the display of the current context on this thread */
+	static FOUNDATION_THREADLOCAL GLXDrawable CurrentDrawable; /**< the drawable of the current context on this thread */
+	static FOUNDATION_THREADLOCAL GLXContext CurrentContext; /**< the current context on this thread */
 
 	/*these atomics are needed to change window states via the extended window manager
 	I might move them to window manager considering these are essentially constants
@@ -355,6 +774,13 @@ private:
 
 	Atom AtomDesktopGeometry; /**< atom for Dedktop Geometry */
 
+	Atom AtomProtocols; /**< atom for the window manager protocols */ //WM_PROTOCOLS
+	Atom AtomSyncRequest; /**< atom for the resize synchronization protocol */ //_NET_WM_SYNC_REQUEST
+	Atom AtomSyncRequestCounter; /**< atom for the counter used by the resize synchronization protocol */ //_NET_WM_SYNC_REQUEST_COUNTER
+	Atom AtomFrameDrawn; /**< atom for the compositor saying a frame was drawn */ //_NET_WM_FRAME_DRAWN
+	Atom AtomFrameTimings; /**< atom for the compositor saying when a frame was shown */ //_NET_WM_FRAME_TIMINGS
+	Atom AtomBypassCompositor; /**< atom for asking the compositor to stop redirecting the window */ //_NET_WM_BYPASS_COMPOSITOR
+
 #endif
 };
 
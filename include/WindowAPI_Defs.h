@@ -10,6 +10,23 @@
 #include <stdlib.h>
 #include <list>
 #include <time.h>
+#include <math.h>
+#include <atomic>
+#include <string>
+#include <unordered_set>
+
+//older versions of Visual studio don't support the C++11 thread_local keyword
+#if defined(_MSC_VER) && (_MSC_VER < 1900)
+#define FOUNDATION_THREADLOCAL __declspec(thread)
+#else
+#define FOUNDATION_THREADLOCAL thread_local
+#endif
+
+//pixel conversion kernels use SSE2 when the compiler targets it and plain loops otherwise
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FOUNDATION_SSE2
+#endif
 
 #if defined(_WIN32) || defined(_WIN64)
 #ifndef WIN32_LEAN_AND_MEAN
@@ -17,6 +34,7 @@
 #endif
 #include <windows.h>
 #include <gl/GL.h>
+#include "dependencies/glext.h"
 #include "dependencies/wglext.h"
 #endif
 
@@ -30,7 +48,37 @@
 #include <X11/Xlib.h>
 #include <X11/keysym.h>
 #include <X11/Xatom.h>
+#include <X11/extensions/sync.h>
+#include <X11/extensions/XShm.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+
+//display mode switching needs the library to be built with FOUNDATION_XRANDR(and -lXrandr), which the makefile 
+//does when the XRandR development headers are installed. without it it reports an error. only the sources include 
+//XRandR so the public classes look the same whether or not it was built in
+struct _XRRScreenResources;
 #include <string>
+
+//older glxext.h headers don't know about these yet
+#ifndef GLX_CONTEXT_OPENGL_NO_ERROR_ARB
+#define GLX_CONTEXT_OPENGL_NO_ERROR_ARB 0x31B3
+#endif
+#ifndef GLX_CONTEXT_RELEASE_BEHAVIOR_ARB
+#define GLX_CONTEXT_RELEASE_BEHAVIOR_ARB 0x2097
+#define GLX_CONTEXT_RELEASE_BEHAVIOR_NONE_ARB 0
+#define GLX_CONTEXT_RELEASE_BEHAVIOR_FLUSH_ARB 0x2098
+#endif
+#ifndef GLX_BACK_BUFFER_AGE_EXT
+#define GLX_BACK_BUFFER_AGE_EXT 0x20F4
+#endif
+#endif
+
+//the Windows GL header stops at OpenGL 1.1
+#ifndef GL_NUM_EXTENSIONS
+#define GL_NUM_EXTENSIONS 0x821D
+#endif
+#ifndef GL_MAJOR_VERSION
+#define GL_MAJOR_VERSION 0x821B
 #endif
 
 #define KEYSTATE_DOWN 1 /**< the key is currently up */
@@ -157,9 +205,55 @@
 #define ERROR_WINDOWS_CANNOTCREATEWINDOW 19
 #define ERROR_WINDOWS_CANNOTINITIALIZE 20
 #define ERROR_WINDOWS_FUNCTIONNOTIMPLEMENTED 21
+#define ERROR_INVALIDSHARECONTEXT 22
+#define ERROR_GLFUNCTIONNOTFOUND 23
+#define ERROR_INVALIDFRAMERATE 24
+#define ERROR_NOTIMERQUERY 25
+#define ERROR_NOFENCESYNC 26
+#define ERROR_INVALIDDISPLAYMODE 27
+#define ERROR_NOMODESWITCHING 28
+#define ERROR_NOFRAMEBUFFEROBJECT 29
+#define ERROR_INVALIDRENDERSCALE 30
+#define ERROR_FRAMEEXPORT 31
+#define ERROR_VIDEORECORDER 32
+#define ERROR_NOSOFTWARESURFACE 33
+#define ERROR_SCREENCAPTURE 34
+#define ERROR_SWAPHOOK 35
+#define ERROR_VIRTUALWINDOW 36
+#define ERROR_MIRROR 37
 
 #define WARNING_NOTCURRENTCONTEXT 0
 #define WARNING_NOGLEXTENSIONS 1
+#define WARNING_LEGACYCONTEXT 2
+
+#define CONTEXTPROFILE_COMPATIBILITY 0 /**< the context supports deprecated OpenGL functionality */
+#define CONTEXTPROFILE_CORE 1 /**< the context only supports core OpenGL functionality */
+
+#define CONTEXTSHARE_NONE 0 /**< the window creates its own context and shares nothing */
+#define CONTEXTSHARE_GROUP 1 /**< the window creates its own context in the share group of another window */
+#define CONTEXTSHARE_SINGLE 2 /**< the window renders with the context of another window */
+#define GLFUNCTIONS_MAXTABLES 4 /**< how many function tables get trampolines of their own. tables past that resolve on every call until loaded */
+
+#define GPUTIMING_MAXQUERIES 16 /**< the most frames that can be waiting on GPU timer queries at once */
+#define FRAMESINFLIGHT_MAX 8 /**< the most frames SetMaxFramesInFlight can allow to be queued */
+#define CAPTURE_RINGSIZE 3 /**< how many captured frames can be waiting on the GPU at once */
+#define MIRROR_BUFFERS 2 /**< how many textures a mirrored window copies its frames into in turn, so mirrors read one while the next is written */
+
+#define DAMAGE_MAXRECTS 16 /**< how many damaged rectangles a window keeps before merging them into one */
+#define DAMAGE_HISTORY 8 /**< how many presented frames of damage a window remembers for buffer age */
+#define FRAMETIMINGS_HISTORY 16 /**< how many presented frames a window remembers while waiting for compositor feedback */
+
+#define SWAPHOOK_PRE 0 /**< the hook runs right before the platform swap, with the frame fully drawn */
+#define SWAPHOOK_POST 1 /**< the hook runs right after the platform swap */
+#define SWAPHOOK_MAX 16 /**< how many hooks each stage of a hook chain can hold */
+
+#define CONTEXTCREATION_IMMEDIATE 0 /**< the context is created as soon as the window is initialized */
+#define CONTEXTCREATION_LAZY 1 /**< the context is created the first time the window is made current */
+#define CONTEXTCREATION_BACKGROUND 2 /**< the context is created on a worker thread once the window is initialized */
+#define CONTEXTCREATION_SOFTWARE 3 /**< no context is created. the window is drawn on the CPU through FWindow::GetSoftwareSurface */
+
+#define SOFTWAREFORMAT_RGBA 0 /**< each pixel of the software surface is red, green, blue then an unused byte in memory */
+#define SOFTWAREFORMAT_BGRA 1 /**< each pixel of the software surface is blue, green, red then an unused byte in memory */
 
 #define LINUX_FUNCTION 1
 #define LINUX_DECORATOR 2
@@ -177,6 +271,327 @@ typedef void (*OnFocusEvent)(GLboolean InFocus);	/**<To be called when the windo
 typedef void (*OnMovedEvent)(GLuint X, GLuint Y);   /**<To be called when the window has been moved*/
 typedef void (*OnResizeEvent)(GLuint Width, GLuint Height); /**<To be called when the window has been resized*/
 typedef void (*OnMouseMoveEvent)(GLuint WindowX, GLuint WindowY, GLuint ScreenX, GLuint ScreenY);   /**<To be called when the mouse has been moved within the window*/ 
+typedef void (*OnLateLatchEvent)(GLuint WindowX, GLuint WindowY);	/**<To be called right before the window swaps, with the mouse position read right then */
+typedef void (*OnCaptureEvent)(const GLubyte* Pixels, GLuint Width, GLuint Height); /**<To be called when a captured frame has been read back. RGBA rows from the bottom up */
+
+class FWindow; //just forward declarations for the swap hooks
+struct FSwapInfo;
+typedef void (*OnSwapEvent)(FWindow* Window, const FSwapInfo& Info, void* UserData); /**<To be called right before or after a window swaps */
+
+/**
+* describes the OpenGL context a window should create. the defaults ask for 
+* the same legacy context that FWindow has always created
+*/
+struct FContextAttributes
+{
+	GLint MajorVersion; /**< the requested OpenGL major version. 0 lets the driver decide */
+	GLint MinorVersion; /**< the requested OpenGL minor version */
+	GLuint Profile; /**< CONTEXTPROFILE_COMPATIBILITY or CONTEXTPROFILE_CORE */
+	GLboolean Debug; /**< whether to create a debug context */
+	GLboolean ForwardCompatible; /**< whether to remove deprecated functionality from the context */
+	GLboolean NoError; /**< whether the driver should skip error checking (GLX_ARB_create_context_no_error). ignored for debug contexts */
+	GLboolean FlushOnRelease; /**< whether the driver flushes when the context is released (GLX_ARB_context_flush_control) */
+
+	FContextAttributes() :
+		MajorVersion(0),
+		MinorVersion(0),
+		Profile(CONTEXTPROFILE_COMPATIBILITY),
+		Debug(GL_FALSE),
+		ForwardCompatible(GL_FALSE),
+		NoError(GL_FALSE),
+		FlushOnRelease(GL_TRUE)
+	{}
+};
+
+/**
+* the OpenGL extensions of one renderer, parsed once and shared by every 
+* window whose context runs on that renderer
+*/
+struct FExtensionSet
+{
+	std::string Renderer; /**< the renderer and version strings the extensions were queried from */
+	std::string ExtensionString; /**< every extension separated by spaces, like glGetString(GL_EXTENSIONS) used to return */
+	std::unordered_set<std::string> Extensions; /**< the extensions themselves for O(1) lookups */
+};
+
+/**
+* what the compositor last reported about a presented frame via _NET_WM_FRAME_DRAWN and
+* _NET_WM_FRAME_TIMINGS. times are in seconds on the GetMonotonicTime clock. 0 means unknown
+*/
+struct FFrameTimings
+{
+	GLuint64 Frame; /**< the frame counter value the report is about */
+	GLdouble DrawnTime; /**< when the compositor drew the frame */
+	GLdouble PresentTime; /**< when the frame reached the screen */
+	GLdouble RefreshInterval; /**< the refresh period of the display the window is on */
+	GLdouble Latency; /**< how long after SwapDrawBuffers returned the frame reached the screen */
+
+	FFrameTimings() :
+		Frame(0),
+		DrawnTime(0),
+		PresentTime(0),
+		RefreshInterval(0),
+		Latency(0)
+	{}
+};
+
+/**
+* a view of pixels captured from the screen or a window. the pixels stay in the screen's native
+* 32 bit layout, rows from the top down, and are only valid until the next capture
+*/
+struct FScreenCapture
+{
+	const GLubyte* Pixels; /**< the top left pixel of the captured area */
+	GLuint Width; /**< the size of the captured area. smaller than asked for if it went past the edge */
+	GLuint Height;
+	GLuint Stride; /**< how many bytes apart the rows are */
+	GLuint RedShift; /**< the bit offset of each 8 bit channel within a pixel */
+	GLuint GreenShift;
+	GLuint BlueShift;
+
+	FScreenCapture() :
+		Pixels(nullptr),
+		Width(0),
+		Height(0),
+		Stride(0),
+		RedShift(0),
+		GreenShift(0),
+		BlueShift(0)
+	{}
+};
+
+/**
+* a mode the display can be switched to
+*/
+struct FDisplayMode
+{
+	GLuint Width; /**< the horizontal resolution of the mode */
+	GLuint Height; /**< the vertical resolution of the mode */
+	GLdouble RefreshRate; /**< how many times a second the display refreshes in this mode */
+	GLuint64 Handle; /**< the RandR mode on Linux, the EnumDisplaySettings index on Windows */
+
+	FDisplayMode(GLuint Width = 0, GLuint Height = 0, GLdouble RefreshRate = 0, GLuint64 Handle = 0) :
+		Width(Width),
+		Height(Height),
+		RefreshRate(RefreshRate),
+		Handle(Handle)
+	{}
+};
+
+/**
+* a frame being read back into a pixel buffer object
+*/
+struct FCaptureSlot
+{
+	GLuint Buffer; /**< the pixel buffer object the frame is read into */
+	GLsizeiptr BufferSize; /**< how big the pixel buffer object is */
+	GLsync Fence; /**< signalled once the read has finished. null if the slot is free */
+	GLuint Width; /**< the size of the captured frame */
+	GLuint Height;
+	OnCaptureEvent Callback; /**< who gets the pixels. null if only exported */
+	GLboolean Export; /**< whether the frame goes to the window's frame exporter */
+	GLboolean Record; /**< whether the frame goes to the window's video recorder */
+	GLdouble IssueTime; /**< when the read was issued */
+
+	FCaptureSlot() :
+		Buffer(0),
+		BufferSize(0),
+		Fence(nullptr),
+		Width(0),
+		Height(0),
+		Callback(nullptr),
+		Export(GL_FALSE),
+		Record(GL_FALSE),
+		IssueTime(0)
+	{}
+};
+
+/**
+* a swapped frame waiting for the compositor to say when it was drawn and shown
+*/
+struct FPendingFrame
+{
+	GLuint64 Frame; /**< the frame counter value when the frame finished */
+	GLdouble SwapTime; /**< when SwapDrawBuffers returned */
+	GLdouble DrawnTime; /**< when the compositor drew it. 0 until _NET_WM_FRAME_DRAWN arrives */
+
+	FPendingFrame() :
+		Frame(0),
+		SwapTime(0),
+		DrawnTime(0)
+	{}
+};
+
+/**
+* a rectangle of a window that has changed, in window coordinates(origin at the top left)
+*/
+struct FDamageRect
+{
+	GLint X; /**< the left edge of the rectangle */
+	GLint Y; /**< the top edge of the rectangle */
+	GLint Width; /**< the width of the rectangle */
+	GLint Height; /**< the height of the rectangle */
+
+	FDamageRect(GLint X = 0, GLint Y = 0, GLint Width = 0, GLint Height = 0) :
+		X(X),
+		Y(Y),
+		Width(Width),
+		Height(Height)
+	{}
+
+	//return whether the rectangle covers nothing
+	GLboolean IsEmpty() const
+	{
+		return (Width <= 0 || Height <= 0);
+	}
+
+	//return the smallest rectangle containing both rectangles
+	FDamageRect Union(const FDamageRect& Other) const
+	{
+		if(IsEmpty())
+		{
+			return Other;
+		}
+
+		if(Other.IsEmpty())
+		{
+			return *this;
+		}
+
+		GLint Left = (X < Other.X) ? X : Other.X;
+		GLint Top = (Y < Other.Y) ? Y : Other.Y;
+		GLint Right = ((X + Width) > (Other.X + Other.Width)) ? (X + Width) : (Other.X + Other.Width);
+		GLint Bottom = ((Y + Height) > (Other.Y + Other.Height)) ? (Y + Height) : (Other.Y + Other.Height);
+		return FDamageRect(Left, Top, Right - Left, Bottom - Top);
+	}
+
+	//return the part of the rectangle that is inside the other rectangle. empty if they don't overlap
+	FDamageRect Intersect(const FDamageRect& Other) const
+	{
+		GLint Left = (X > Other.X) ? X : Other.X;
+		GLint Top = (Y > Other.Y) ? Y : Other.Y;
+		GLint Right = ((X + Width) < (Other.X + Other.Width)) ? (X + Width) : (Other.X + Other.Width);
+		GLint Bottom = ((Y + Height) < (Other.Y + Other.Height)) ? (Y + Height) : (Other.Y + Other.Height);
+		return (Right > Left && Bottom > Top) ? FDamageRect(Left, Top, Right - Left, Bottom - Top) : FDamageRect();
+	}
+};
+
+/**
+* what a swap hook is told about the frame being swapped. times are in seconds on the 
+* GetMonotonicTime clock
+*/
+struct FSwapInfo
+{
+	GLuint Stage; /**< SWAPHOOK_PRE or SWAPHOOK_POST */
+	GLuint64 Frame; /**< the index of the frame being swapped, counting from 0 */
+	GLdouble FrameStartTime; /**< when the previous swap returned, i.e. when this frame started. 0 for the first frame */
+	GLdouble PacerWaitTime; /**< how long the frame pacer held this frame back. 0 before the swap since the wait comes right before it */
+	GLdouble SwapStartTime; /**< when the platform swap started. 0 before it */
+	GLdouble SwapEndTime; /**< when the platform swap returned. 0 before it */
+
+	FSwapInfo() :
+		Stage(SWAPHOOK_PRE),
+		Frame(0),
+		FrameStartTime(0),
+		PacerWaitTime(0),
+		SwapStartTime(0),
+		SwapEndTime(0)
+	{}
+};
+
+/**
+* a function to call at the swap, with the pointer it was registered with
+*/
+struct FSwapHook
+{
+	OnSwapEvent Callback; /**< the function to call */
+	void* UserData; /**< handed back to the function untouched */
+	GLint Priority; /**< hooks with lower priorities run first */
+
+	FSwapHook() :
+		Callback(nullptr),
+		UserData(nullptr),
+		Priority(0)
+	{}
+};
+
+/**
+* an ordered list of swap hooks in a fixed array, so registering and running them never
+* allocates. hooks of equal priority run in the order they were added. not thread safe,
+* so only change it from the thread that swaps, and never from inside a hook
+*/
+struct FSwapHookList
+{
+	FSwapHook Hooks[SWAPHOOK_MAX]; /**< the hooks in the order they run */
+	GLuint Count; /**< how many hooks there are */
+
+	FSwapHookList() :
+		Count(0)
+	{}
+
+	//insert the hook after every hook of the same or a lower priority. fails if the list is full or the hook is already in it
+	GLboolean Add(OnSwapEvent Callback, void* UserData, GLint Priority)
+	{
+		if(!Callback || Count == SWAPHOOK_MAX)
+		{
+			return GL_FALSE;
+		}
+
+		GLuint Position = Count;
+
+		for(GLuint Iterator = 0; Iterator < Count; Iterator++)
+		{
+			if(Hooks[Iterator].Callback == Callback && Hooks[Iterator].UserData == UserData)
+			{
+				return GL_FALSE;
+			}
+
+			if(Position == Count && Hooks[Iterator].Priority > Priority)
+			{
+				Position = Iterator;
+			}
+		}
+
+		for(GLuint Iterator = Count; Iterator > Position; Iterator--)
+		{
+			Hooks[Iterator] = Hooks[Iterator - 1];
+		}
+
+		Hooks[Position].Callback = Callback;
+		Hooks[Position].UserData = UserData;
+		Hooks[Position].Priority = Priority;
+		Count++;
+		return GL_TRUE;
+	}
+
+	//remove the hook that was added with the same function and pointer. fails if there isn't one
+	GLboolean Remove(OnSwapEvent Callback, void* UserData)
+	{
+		for(GLuint Iterator = 0; Iterator < Count; Iterator++)
+		{
+			if(Hooks[Iterator].Callback == Callback && Hooks[Iterator].UserData == UserData)
+			{
+				for(Count--; Iterator < Count; Iterator++)
+				{
+					Hooks[Iterator] = Hooks[Iterator + 1];
+				}
+
+				return GL_TRUE;
+			}
+		}
+
+		return GL_FALSE;
+	}
+
+	//call every hook in order
+	void Run(FWindow* Window, const FSwapInfo& Info) const
+	{
+		for(GLuint Iterator = 0; Iterator < Count; Iterator++)
+		{
+			Hooks[Iterator].Callback(Window, Info, Hooks[Iterator].UserData);
+		}
+	}
+};
 
 //return wether the given string is valid
 static inline GLboolean IsValidString(const char* String)
@@ -184,6 +599,48 @@ static inline GLboolean IsValidString(const char* String)
 	return (String != nullptr);
 }
 
+//return the time in seconds from a monotonic clock. only useful for measuring intervals
+static inline GLdouble GetMonotonicTime()
+{
+#if defined(_WIN32) || defined(_WIN64)
+	LARGE_INTEGER Frequency, Counter;
+	QueryPerformanceFrequency(&Frequency);
+	QueryPerformanceCounter(&Counter);
+	return (GLdouble)Counter.QuadPart / (GLdouble)Frequency.QuadPart;
+#else
+	timespec Now;
+	clock_gettime(CLOCK_MONOTONIC, &Now);
+	return (GLdouble)Now.tv_sec + ((GLdouble)Now.tv_nsec * 1e-9);
+#endif
+}
+
+//move a render scale towards the scale that renders in Target seconds and return it. RenderTime is how long
+//the last frame took to render, not counting the swap or the frame pacer, and is folded into SmoothedTime.
+//the cost of a frame grows with the square of the scale, so the scale moves by the square root of how far off
+//the target the smoothed time is, capped at 10% a step. nothing changes within 10% under the target
+static inline GLdouble StepRenderScale(GLdouble Scale, GLdouble& SmoothedTime, GLdouble RenderTime, 
+	GLdouble Target, GLdouble MinScale, GLdouble MaxScale)
+{
+	if(RenderTime <= 0 || Target <= 0)
+	{
+		return Scale;
+	}
+
+	SmoothedTime = (SmoothedTime > 0) ? (SmoothedTime * 0.9) + (RenderTime * 0.1) : RenderTime;
+
+	if(SmoothedTime <= Target && SmoothedTime >= Target * 0.9)
+	{
+		return Scale;
+	}
+
+	GLdouble Step = sqrt(Target / SmoothedTime);
+	Step = (Step < 0.9) ? 0.9 : (Step > 1.1) ? 1.1 : Step;
+
+	Scale *= Step;
+	Scale = (Scale < MinScale) ? MinScale : Scale;
+	return (Scale > MaxScale) ? MaxScale : Scale;
+}
+
 //return whether the given event is valid
 static inline GLboolean IsValidKeyEvent(OnKeyEvent OnKeyPressed)
 {
@@ -215,6 +672,17 @@ static inline GLboolean IsValidMouseMoveEvent(OnMouseMoveEvent OnMouseMove)
 	return (OnMouseMove != nullptr);
 }
 
+//return whether the given late latch event is valid
+static inline GLboolean IsValidLateLatchEvent(OnLateLatchEvent OnLateLatch)
+{
+	return (OnLateLatch != nullptr);
+}
+//return whether the given event is valid
+static inline GLboolean IsValidCaptureEvent(OnCaptureEvent OnCapture)
+{
+	return (OnCapture != nullptr);
+}
+
 //print the warning message assosciated with the given warning number
 static inline void PrintWarningMessage(GLuint WarningNumber)
 {
@@ -232,6 +700,12 @@ static inline void PrintWarningMessage(GLuint WarningNumber)
 				break;
 			}
 
+		case WARNING_LEGACYCONTEXT:
+			{
+				printf("Warning: requested context attributes not supported. falling back to a legacy context \n");
+				break;
+			}
+
 		default:
 			{
 				printf("Warning: unspecified warning \n");
@@ -371,6 +845,102 @@ static void PrintErrorMessage(GLuint ErrorNumber)
 			break;
 		}
 
+		case ERROR_INVALIDSHARECONTEXT:
+		{
+			printf("Error: the window to share a context with must be initialized first \n");
+			break;
+		}
+
+		case ERROR_GLFUNCTIONNOTFOUND:
+		{
+			printf("Error: the OpenGL function could not be found or there is no current context \n");
+			break;
+		}
+
+		case ERROR_INVALIDFRAMERATE:
+		{
+			printf("Error: frame rates and frame pacing times cannot be negative \n");
+			break;
+		}
+
+		case ERROR_NOTIMERQUERY:
+		{
+			printf("Error: GL_ARB_timer_query is not supported by this context \n");
+			break;
+		}
+
+		case ERROR_NOFENCESYNC:
+		{
+			printf("Error: GL_ARB_sync is not supported by this context \n");
+			break;
+		}
+
+		case ERROR_INVALIDDISPLAYMODE:
+		{
+			printf("Error: the display does not support the requested mode \n");
+			break;
+		}
+
+		case ERROR_NOMODESWITCHING:
+		{
+			printf("Error: display modes cannot be changed. on Linux this needs XRandR 1.3 \n");
+			break;
+		}
+
+		case ERROR_NOFRAMEBUFFEROBJECT:
+		{
+			printf("Error: framebuffer objects(OpenGL 3.0 or GL_ARB_framebuffer_object) are not supported by this context \n");
+			break;
+		}
+
+		case ERROR_INVALIDRENDERSCALE:
+		{
+			printf("Error: render scales must be above 0 and the minimum can't be above the maximum \n");
+			break;
+		}
+
+		case ERROR_FRAMEEXPORT:
+		{
+			printf("Error: could not create or attach to the shared memory frame export \n");
+			break;
+		}
+
+		case ERROR_VIDEORECORDER:
+		{
+			printf("Error: could not start recording. check the file can be created and the frame rate is above 0 \n");
+			break;
+		}
+
+		case ERROR_NOSOFTWARESURFACE:
+		{
+			printf("Error: window has no software surface. use CONTEXTCREATION_SOFTWARE before initializing the window \n");
+			break;
+		}
+
+		case ERROR_SCREENCAPTURE:
+		{
+			printf("Error: could not capture the screen. the area must overlap it and the screen must use 32 bit pixels \n");
+			break;
+		}
+
+		case ERROR_SWAPHOOK:
+		{
+			printf("Error: could not change the swap hooks. the stage must be SWAPHOOK_PRE or SWAPHOOK_POST, each stage holds at most 16 hooks, and a hook can only be added once \n");
+			break;
+		}
+
+		case ERROR_VIRTUALWINDOW:
+		{
+			printf("Error: the virtual window needs a host. the host must be initialized and must not be a software window \n");
+			break;
+		}
+
+		case ERROR_MIRROR:
+		{
+			printf("Error: could not mirror the window. both windows need OpenGL contexts in the same share group(see FWindow::ShareContext) with framebuffer objects \n");
+			break;
+		}
+
 		default:
 		{
 			printf("Error: unspecified Error \n");
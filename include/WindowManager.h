@@ -4,6 +4,8 @@
 
 #include "WindowAPI_Defs.h"
 #include "Window.h"
+#include "GLFunctions.h"
+#include <vector>
 
 class FWindow;
 
@@ -135,6 +137,29 @@ class WindowManager
 		static GLboolean PollForEvents();
 		static GLboolean WaitForEvents();
 
+		//return how many times a context was actually made current during the last frame.
+		//a frame ends every time events are polled or waited for
+		static GLuint GetContextSwitchesPerFrame();
+
+		//capture part of the screen into a buffer the manager keeps between calls(MIT-SHM shared memory on Linux, a DIB
+		//section on Windows), so repeated captures neither allocate nor copy through the X connection. a Width or Height
+		//of 0 captures to the edge. the capture is only valid until the next one
+		static GLboolean CaptureScreen(FScreenCapture& Capture, GLint X = 0, GLint Y = 0, GLuint Width = 0, GLuint Height = 0);
+		//capture part of a window the same way. the contents of areas that are covered or offscreen are undefined
+		static GLboolean CaptureWindow(const char* WindowName, FScreenCapture& Capture, GLint X = 0, GLint Y = 0, GLuint Width = 0, GLuint Height = 0);
+		static GLboolean CaptureWindow(GLuint WindowIndex, FScreenCapture& Capture, GLint X = 0, GLint Y = 0, GLuint Width = 0, GLuint Height = 0);
+		//return statistics on how long each capture took. safe to call from any thread
+		static FFrameStatistics GetScreenCaptureStatistics();
+
+		//add a function to run before or after the swap of every window, around the window's own swap hooks. see
+		//FWindow::AddSwapHook. only change hooks from the thread that swaps, and never from inside a hook
+		static GLboolean AddSwapHook(GLuint Stage, OnSwapEvent Hook, void* UserData = nullptr, GLint Priority = 0);
+		static GLboolean RemoveSwapHook(GLuint Stage, OnSwapEvent Hook, void* UserData = nullptr);
+
+		//whether the display supports the given GLX extension. the extensions are parsed once
+		//when the manager is initialized. always false on Windows
+		static GLboolean HasGLXExtension(const char* Extension);
+
 		//NOTE: moved to TinyClock API
 		//static GLdouble GetTotalTime();
 		//static GLdouble GetDeltaTime();
@@ -205,6 +230,28 @@ class WindowManager
 
 		GLboolean Initialized; /**<whether the window manager has been initialized*/
 
+		//marks the end of a frame for the per frame counters
+		static void EndFrame();
+
+		std::atomic<GLuint> ContextSwitches; /**< how many real context switches have happened this frame, across all threads */
+		GLuint ContextSwitchesLastFrame; /**< how many real context switches happened in the last frame */
+
+		//return the extensions of the renderer behind the current context, parsing them the first time that renderer is seen
+		static FExtensionSet* GetCurrentExtensionSet();
+
+		std::list<FExtensionSet*> ExtensionSets; /**< the parsed OpenGL extensions of every renderer seen so far */
+
+		//return the function table of the renderer behind the current context, making it the first time that renderer is seen
+		static FGLFunctions* GetCurrentGLFunctions();
+
+		std::list<FGLFunctions*> FunctionTables; /**< the function tables of every renderer seen so far */
+
+		//clip the area to the source and capture it. Source is the window to capture, null for the whole screen
+		static GLboolean CaptureArea(FWindow* Source, GLint X, GLint Y, GLuint Width, GLuint Height, FScreenCapture& Capture);
+
+		FrameHistogram ScreenCaptureTimes; /**< how long each screen or window capture took */
+		FSwapHookList SwapHooks[2]; /**< the hooks that run before and after the swap of every window */
+
 		//NOTE: moved to TinyClock API
 		//GLdouble TotalTime; /**< How long the window manager has been running*/ 
 		//GLdouble PreviousTime; /**the previous amount of time between cycles. used to calculate Delta time */
@@ -226,6 +273,16 @@ class WindowManager
 		static void CreateTerminal();
 		static GLuint Windows_TranslateKey(WPARAM WordParam, LPARAM LongParam);
 
+		//BitBlt the area of the window(or the screen if null) into the capture DIB section, growing it if needed
+		static GLboolean Windows_CaptureArea(HWND Source, const FDamageRect& Area, FScreenCapture& Capture);
+		static void Windows_DestroyCapture();
+
+		HDC CaptureDeviceContext; /**< the memory device context the capture DIB section is selected into */
+		HBITMAP CaptureBitmap; /**< the DIB section captures are copied into. null until the first capture */
+		HGDIOBJ CaptureOldBitmap; /**< the bitmap that was selected into the memory device context before */
+		GLubyte* CaptureBits; /**< the pixels of the DIB section */
+		GLuint CaptureCapacity[2]; /**< the size of the DIB section */
+
 		HDC DeviceContextHandle; /**< the device context handle for the window*/
 		MSG Message; /**< the Win32 message that contains event information */
 #else
@@ -233,6 +290,8 @@ class WindowManager
 		static FWindow* GetWindowByEvent(XEvent Event);
 
 		static GLboolean Linux_Initialize();
+		//parse the GLX extensions of the display and resolve the ones windows need
+		static void Linux_InitGLXExtensions();
 		static void Linux_Shutdown();
 
 		static GLboolean Linux_PollForEvents();
@@ -241,10 +300,54 @@ class WindowManager
 		static GLboolean Linux_SetMousePositionInScreen(GLuint X, GLuint Y);
 		static Display* GetDisplay();
 
+		//catch the X errors of the requests made until Linux_EndErrorTrap instead of letting them kill the 
+		//process. holds the display and a process wide lock in between, so keep it to the requests that may fail
+		static void Linux_BeginErrorTrap();
+		//wait for the trapped requests to be processed and return whether any of them failed
+		static GLboolean Linux_EndErrorTrap();
+		//create a MIT-SHM segment of the given size and attach it to the server. on failure the segment's shmid is -1
+		static GLboolean Linux_AttachSharedSegment(XShmSegmentInfo& Segment, size_t Size);
+		//detach a segment from the server and this process
+		static void Linux_DetachSharedSegment(XShmSegmentInfo& Segment);
+
+		//return the CRTC showing the given point of the screen, or the first active one. needs FOUNDATION_XRANDR
+		static XID Linux_GetCrtcAt(_XRRScreenResources* Resources, GLint X, GLint Y);
+		//remember how a CRTC was configured before its mode is changed. only the first call per CRTC counts
+		static void Linux_SaveCrtc(_XRRScreenResources* Resources, XID Crtc);
+		//put a CRTC back to how it was before its mode was changed
+		static void Linux_RestoreCrtc(XID Crtc);
+		//put every CRTC whose mode was changed back. also runs on exit
+		static void Linux_RestoreDisplayModes();
+		//put the CRTCs back through a connection of its own, then hand the signal to whoever had it before
+		static void Linux_OnFatalSignal(int Signal);
+
+		//read the area of the window into the capture image with XShmGetImage, or XGetSubImage without MIT-SHM
+		static GLboolean Linux_CaptureArea(Window Source, const FDamageRect& Area, FScreenCapture& Capture);
+		//make the capture image the given size and format, reusing the shared memory segment if it is big enough
+		static GLboolean Linux_ResizeCaptureImage(GLuint Width, GLuint Height, Visual* ImageVisual, GLint Depth);
+		static void Linux_DestroyCapture();
+
 		static GLuint Linux_TranslateKey(GLuint KeySym);
 		static const char* Linux_GetEventType(XEvent Event);
 
 		Display* m_Display; /**< a reference to the X11 display */
+		std::unordered_set<std::string> GLXExtensions; /**< the parsed GLX extensions of the default screen */
+
+		//the GLX swap interval extensions. resolved once and handed to each window
+		PFNGLXSWAPINTERVALMESAPROC SwapIntervalMESA; /**< the mesa swap interval extension */
+		PFNGLXSWAPINTERVALEXTPROC SwapIntervalEXT; /**< the generic swap interval extension*/
+		PFNGLXSWAPINTERVALSGIPROC SwapIntervalSGI;	 /**< the Silicon graphics swap interval extension*/
+		PFNGLXGETSYNCVALUESOMLPROC GetSyncValuesOML; /**< returns the time and count of the last vblank */
+		PFNGLXGETMSCRATEOMLPROC GetMscRateOML; /**< returns the refresh rate */
+		PFNGLXCOPYSUBBUFFERMESAPROC CopySubBufferMESA; /**< copies part of the back buffer to the front buffer */
+		GLboolean XSyncSupported; /**< whether the X server has the SYNC extension, for _NET_WM_SYNC_REQUEST */
+		GLboolean XRandRSupported; /**< whether the X server has XRandR 1.3, for display mode switching */
+		GLboolean XShmSupported; /**< whether the X server has MIT-SHM, for presenting software surfaces without a copy over the socket */
+		XImage* CaptureImage; /**< the image screen captures are read into. null until the first capture */
+		XShmSegmentInfo CaptureSegment; /**< the shared memory behind CaptureImage. shmid is -1 if there is none */
+		size_t CaptureSegmentSize; /**< how big the shared memory segment is */
+		Visual* CaptureVisual; /**< the visual of the window CaptureImage was made for */
+		GLboolean CaptureSharedFailed; /**< whether the server refused a capture segment, after which captures use XGetSubImage */
 		XEvent m_Event; /**< the current X11 event*/
 #endif
 };
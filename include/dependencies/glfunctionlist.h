@@ -0,0 +1,3100 @@
+/**********************************************************************************************//**
+ * @file	WindowAPI\dependencies\glfunctionlist.h
+ *
+ * @brief	Lists every OpenGL and GLX entry point declared in the bundled glext.h and glxext.h
+ * 			as FOUNDATION_GL_FUNCTION(Return, Name, Parameters), grouped by the version or extension that 
+ * 			declares it so entries the included headers don't know about are skipped. 
+ * 			define FOUNDATION_GL_FUNCTION before including this file. the signatures are 
+ * 			taken from the PFN...PROC typedefs of the bundled headers rather than relying on the 
+ * 			system headers to declare the same typedefs. regenerated by tools/glfunctionlist.py.
+ **************************************************************************************************/
+
+#ifdef GL_VERSION_1_2
+FOUNDATION_GL_FUNCTION(void, glDrawRangeElements, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices))
+FOUNDATION_GL_FUNCTION(void, glTexImage3D, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels))
+FOUNDATION_GL_FUNCTION(void, glTexSubImage3D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels))
+FOUNDATION_GL_FUNCTION(void, glCopyTexSubImage3D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height))
+#endif
+
+#ifdef GL_VERSION_1_3
+FOUNDATION_GL_FUNCTION(void, glActiveTexture, (GLenum texture))
+FOUNDATION_GL_FUNCTION(void, glSampleCoverage, (GLfloat value, GLboolean invert))
+FOUNDATION_GL_FUNCTION(void, glCompressedTexImage3D, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data))
+FOUNDATION_GL_FUNCTION(void, glCompressedTexImage2D, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data))
+FOUNDATION_GL_FUNCTION(void, glCompressedTexImage1D, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data))
+FOUNDATION_GL_FUNCTION(void, glCompressedTexSubImage3D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data))
+FOUNDATION_GL_FUNCTION(void, glCompressedTexSubImage2D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data))
+FOUNDATION_GL_FUNCTION(void, glCompressedTexSubImage1D, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data))
+FOUNDATION_GL_FUNCTION(void, glGetCompressedTexImage, (GLenum target, GLint level, void *img))
+FOUNDATION_GL_FUNCTION(void, glClientActiveTexture, (GLenum texture))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord1d, (GLenum target, GLdouble s))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord1dv, (GLenum target, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord1f, (GLenum target, GLfloat s))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord1fv, (GLenum target, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord1i, (GLenum target, GLint s))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord1iv, (GLenum target, const GLint *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord1s, (GLenum target, GLshort s))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord1sv, (GLenum target, const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord2d, (GLenum target, GLdouble s, GLdouble t))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord2dv, (GLenum target, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord2f, (GLenum target, GLfloat s, GLfloat t))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord2fv, (GLenum target, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord2i, (GLenum target, GLint s, GLint t))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord2iv, (GLenum target, const GLint *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord2s, (GLenum target, GLshort s, GLshort t))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord2sv, (GLenum target, const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord3d, (GLenum target, GLdouble s, GLdouble t, GLdouble r))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord3dv, (GLenum target, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord3f, (GLenum target, GLfloat s, GLfloat t, GLfloat r))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord3fv, (GLenum target, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord3i, (GLenum target, GLint s, GLint t, GLint r))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord3iv, (GLenum target, const GLint *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord3s, (GLenum target, GLshort s, GLshort t, GLshort r))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord3sv, (GLenum target, const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord4d, (GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord4dv, (GLenum target, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord4f, (GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord4fv, (GLenum target, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord4i, (GLenum target, GLint s, GLint t, GLint r, GLint q))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord4iv, (GLenum target, const GLint *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord4s, (GLenum target, GLshort s, GLshort t, GLshort r, GLshort q))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord4sv, (GLenum target, const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glLoadTransposeMatrixf, (const GLfloat *m))
+FOUNDATION_GL_FUNCTION(void, glLoadTransposeMatrixd, (const GLdouble *m))
+FOUNDATION_GL_FUNCTION(void, glMultTransposeMatrixf, (const GLfloat *m))
+FOUNDATION_GL_FUNCTION(void, glMultTransposeMatrixd, (const GLdouble *m))
+#endif
+
+#ifdef GL_VERSION_1_4
+FOUNDATION_GL_FUNCTION(void, glBlendFuncSeparate, (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha))
+FOUNDATION_GL_FUNCTION(void, glMultiDrawArrays, (GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount))
+FOUNDATION_GL_FUNCTION(void, glMultiDrawElements, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount))
+FOUNDATION_GL_FUNCTION(void, glPointParameterf, (GLenum pname, GLfloat param))
+FOUNDATION_GL_FUNCTION(void, glPointParameterfv, (GLenum pname, const GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glPointParameteri, (GLenum pname, GLint param))
+FOUNDATION_GL_FUNCTION(void, glPointParameteriv, (GLenum pname, const GLint *params))
+FOUNDATION_GL_FUNCTION(void, glFogCoordf, (GLfloat coord))
+FOUNDATION_GL_FUNCTION(void, glFogCoordfv, (const GLfloat *coord))
+FOUNDATION_GL_FUNCTION(void, glFogCoordd, (GLdouble coord))
+FOUNDATION_GL_FUNCTION(void, glFogCoorddv, (const GLdouble *coord))
+FOUNDATION_GL_FUNCTION(void, glFogCoordPointer, (GLenum type, GLsizei stride, const void *pointer))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3b, (GLbyte red, GLbyte green, GLbyte blue))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3bv, (const GLbyte *v))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3d, (GLdouble red, GLdouble green, GLdouble blue))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3dv, (const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3f, (GLfloat red, GLfloat green, GLfloat blue))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3fv, (const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3i, (GLint red, GLint green, GLint blue))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3iv, (const GLint *v))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3s, (GLshort red, GLshort green, GLshort blue))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3sv, (const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3ub, (GLubyte red, GLubyte green, GLubyte blue))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3ubv, (const GLubyte *v))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3ui, (GLuint red, GLuint green, GLuint blue))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3uiv, (const GLuint *v))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3us, (GLushort red, GLushort green, GLushort blue))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3usv, (const GLushort *v))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColorPointer, (GLint size, GLenum type, GLsizei stride, const void *pointer))
+FOUNDATION_GL_FUNCTION(void, glWindowPos2d, (GLdouble x, GLdouble y))
+FOUNDATION_GL_FUNCTION(void, glWindowPos2dv, (const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glWindowPos2f, (GLfloat x, GLfloat y))
+FOUNDATION_GL_FUNCTION(void, glWindowPos2fv, (const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glWindowPos2i, (GLint x, GLint y))
+FOUNDATION_GL_FUNCTION(void, glWindowPos2iv, (const GLint *v))
+FOUNDATION_GL_FUNCTION(void, glWindowPos2s, (GLshort x, GLshort y))
+FOUNDATION_GL_FUNCTION(void, glWindowPos2sv, (const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glWindowPos3d, (GLdouble x, GLdouble y, GLdouble z))
+FOUNDATION_GL_FUNCTION(void, glWindowPos3dv, (const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glWindowPos3f, (GLfloat x, GLfloat y, GLfloat z))
+FOUNDATION_GL_FUNCTION(void, glWindowPos3fv, (const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glWindowPos3i, (GLint x, GLint y, GLint z))
+FOUNDATION_GL_FUNCTION(void, glWindowPos3iv, (const GLint *v))
+FOUNDATION_GL_FUNCTION(void, glWindowPos3s, (GLshort x, GLshort y, GLshort z))
+FOUNDATION_GL_FUNCTION(void, glWindowPos3sv, (const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glBlendColor, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha))
+FOUNDATION_GL_FUNCTION(void, glBlendEquation, (GLenum mode))
+#endif
+
+#ifdef GL_VERSION_1_5
+FOUNDATION_GL_FUNCTION(void, glGenQueries, (GLsizei n, GLuint *ids))
+FOUNDATION_GL_FUNCTION(void, glDeleteQueries, (GLsizei n, const GLuint *ids))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsQuery, (GLuint id))
+FOUNDATION_GL_FUNCTION(void, glBeginQuery, (GLenum target, GLuint id))
+FOUNDATION_GL_FUNCTION(void, glEndQuery, (GLenum target))
+FOUNDATION_GL_FUNCTION(void, glGetQueryiv, (GLenum target, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetQueryObjectiv, (GLuint id, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetQueryObjectuiv, (GLuint id, GLenum pname, GLuint *params))
+FOUNDATION_GL_FUNCTION(void, glBindBuffer, (GLenum target, GLuint buffer))
+FOUNDATION_GL_FUNCTION(void, glDeleteBuffers, (GLsizei n, const GLuint *buffers))
+FOUNDATION_GL_FUNCTION(void, glGenBuffers, (GLsizei n, GLuint *buffers))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsBuffer, (GLuint buffer))
+FOUNDATION_GL_FUNCTION(void, glBufferData, (GLenum target, GLsizeiptr size, const void *data, GLenum usage))
+FOUNDATION_GL_FUNCTION(void, glBufferSubData, (GLenum target, GLintptr offset, GLsizeiptr size, const void *data))
+FOUNDATION_GL_FUNCTION(void, glGetBufferSubData, (GLenum target, GLintptr offset, GLsizeiptr size, void *data))
+FOUNDATION_GL_FUNCTION(void *, glMapBuffer, (GLenum target, GLenum access))
+FOUNDATION_GL_FUNCTION(GLboolean, glUnmapBuffer, (GLenum target))
+FOUNDATION_GL_FUNCTION(void, glGetBufferParameteriv, (GLenum target, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetBufferPointerv, (GLenum target, GLenum pname, void **params))
+#endif
+
+#ifdef GL_VERSION_2_0
+FOUNDATION_GL_FUNCTION(void, glBlendEquationSeparate, (GLenum modeRGB, GLenum modeAlpha))
+FOUNDATION_GL_FUNCTION(void, glDrawBuffers, (GLsizei n, const GLenum *bufs))
+FOUNDATION_GL_FUNCTION(void, glStencilOpSeparate, (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass))
+FOUNDATION_GL_FUNCTION(void, glStencilFuncSeparate, (GLenum face, GLenum func, GLint ref, GLuint mask))
+FOUNDATION_GL_FUNCTION(void, glStencilMaskSeparate, (GLenum face, GLuint mask))
+FOUNDATION_GL_FUNCTION(void, glAttachShader, (GLuint program, GLuint shader))
+FOUNDATION_GL_FUNCTION(void, glBindAttribLocation, (GLuint program, GLuint index, const GLchar *name))
+FOUNDATION_GL_FUNCTION(void, glCompileShader, (GLuint shader))
+FOUNDATION_GL_FUNCTION(GLuint, glCreateProgram, (void))
+FOUNDATION_GL_FUNCTION(GLuint, glCreateShader, (GLenum type))
+FOUNDATION_GL_FUNCTION(void, glDeleteProgram, (GLuint program))
+FOUNDATION_GL_FUNCTION(void, glDeleteShader, (GLuint shader))
+FOUNDATION_GL_FUNCTION(void, glDetachShader, (GLuint program, GLuint shader))
+FOUNDATION_GL_FUNCTION(void, glDisableVertexAttribArray, (GLuint index))
+FOUNDATION_GL_FUNCTION(void, glEnableVertexAttribArray, (GLuint index))
+FOUNDATION_GL_FUNCTION(void, glGetActiveAttrib, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name))
+FOUNDATION_GL_FUNCTION(void, glGetActiveUniform, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name))
+FOUNDATION_GL_FUNCTION(void, glGetAttachedShaders, (GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders))
+FOUNDATION_GL_FUNCTION(GLint, glGetAttribLocation, (GLuint program, const GLchar *name))
+FOUNDATION_GL_FUNCTION(void, glGetProgramiv, (GLuint program, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetProgramInfoLog, (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog))
+FOUNDATION_GL_FUNCTION(void, glGetShaderiv, (GLuint shader, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetShaderInfoLog, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog))
+FOUNDATION_GL_FUNCTION(void, glGetShaderSource, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source))
+FOUNDATION_GL_FUNCTION(GLint, glGetUniformLocation, (GLuint program, const GLchar *name))
+FOUNDATION_GL_FUNCTION(void, glGetUniformfv, (GLuint program, GLint location, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetUniformiv, (GLuint program, GLint location, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetVertexAttribdv, (GLuint index, GLenum pname, GLdouble *params))
+FOUNDATION_GL_FUNCTION(void, glGetVertexAttribfv, (GLuint index, GLenum pname, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetVertexAttribiv, (GLuint index, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetVertexAttribPointerv, (GLuint index, GLenum pname, void **pointer))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsProgram, (GLuint program))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsShader, (GLuint shader))
+FOUNDATION_GL_FUNCTION(void, glLinkProgram, (GLuint program))
+FOUNDATION_GL_FUNCTION(void, glShaderSource, (GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length))
+FOUNDATION_GL_FUNCTION(void, glUseProgram, (GLuint program))
+FOUNDATION_GL_FUNCTION(void, glUniform1f, (GLint location, GLfloat v0))
+FOUNDATION_GL_FUNCTION(void, glUniform2f, (GLint location, GLfloat v0, GLfloat v1))
+FOUNDATION_GL_FUNCTION(void, glUniform3f, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2))
+FOUNDATION_GL_FUNCTION(void, glUniform4f, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3))
+FOUNDATION_GL_FUNCTION(void, glUniform1i, (GLint location, GLint v0))
+FOUNDATION_GL_FUNCTION(void, glUniform2i, (GLint location, GLint v0, GLint v1))
+FOUNDATION_GL_FUNCTION(void, glUniform3i, (GLint location, GLint v0, GLint v1, GLint v2))
+FOUNDATION_GL_FUNCTION(void, glUniform4i, (GLint location, GLint v0, GLint v1, GLint v2, GLint v3))
+FOUNDATION_GL_FUNCTION(void, glUniform1fv, (GLint location, GLsizei count, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glUniform2fv, (GLint location, GLsizei count, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glUniform3fv, (GLint location, GLsizei count, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glUniform4fv, (GLint location, GLsizei count, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glUniform1iv, (GLint location, GLsizei count, const GLint *value))
+FOUNDATION_GL_FUNCTION(void, glUniform2iv, (GLint location, GLsizei count, const GLint *value))
+FOUNDATION_GL_FUNCTION(void, glUniform3iv, (GLint location, GLsizei count, const GLint *value))
+FOUNDATION_GL_FUNCTION(void, glUniform4iv, (GLint location, GLsizei count, const GLint *value))
+FOUNDATION_GL_FUNCTION(void, glUniformMatrix2fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glUniformMatrix3fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glUniformMatrix4fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glValidateProgram, (GLuint program))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib1d, (GLuint index, GLdouble x))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib1dv, (GLuint index, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib1f, (GLuint index, GLfloat x))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib1fv, (GLuint index, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib1s, (GLuint index, GLshort x))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib1sv, (GLuint index, const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib2d, (GLuint index, GLdouble x, GLdouble y))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib2dv, (GLuint index, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib2f, (GLuint index, GLfloat x, GLfloat y))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib2fv, (GLuint index, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib2s, (GLuint index, GLshort x, GLshort y))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib2sv, (GLuint index, const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib3d, (GLuint index, GLdouble x, GLdouble y, GLdouble z))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib3dv, (GLuint index, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib3f, (GLuint index, GLfloat x, GLfloat y, GLfloat z))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib3fv, (GLuint index, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib3s, (GLuint index, GLshort x, GLshort y, GLshort z))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib3sv, (GLuint index, const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4Nbv, (GLuint index, const GLbyte *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4Niv, (GLuint index, const GLint *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4Nsv, (GLuint index, const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4Nub, (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4Nubv, (GLuint index, const GLubyte *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4Nuiv, (GLuint index, const GLuint *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4Nusv, (GLuint index, const GLushort *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4bv, (GLuint index, const GLbyte *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4d, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4dv, (GLuint index, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4f, (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4fv, (GLuint index, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4iv, (GLuint index, const GLint *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4s, (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4sv, (GLuint index, const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4ubv, (GLuint index, const GLubyte *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4uiv, (GLuint index, const GLuint *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4usv, (GLuint index, const GLushort *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribPointer, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer))
+#endif
+
+#ifdef GL_VERSION_2_1
+FOUNDATION_GL_FUNCTION(void, glUniformMatrix2x3fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glUniformMatrix3x2fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glUniformMatrix2x4fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glUniformMatrix4x2fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glUniformMatrix3x4fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glUniformMatrix4x3fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value))
+#endif
+
+#ifdef GL_VERSION_3_0
+FOUNDATION_GL_FUNCTION(void, glColorMaski, (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a))
+FOUNDATION_GL_FUNCTION(void, glGetBooleani_v, (GLenum target, GLuint index, GLboolean *data))
+FOUNDATION_GL_FUNCTION(void, glGetIntegeri_v, (GLenum target, GLuint index, GLint *data))
+FOUNDATION_GL_FUNCTION(void, glEnablei, (GLenum target, GLuint index))
+FOUNDATION_GL_FUNCTION(void, glDisablei, (GLenum target, GLuint index))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsEnabledi, (GLenum target, GLuint index))
+FOUNDATION_GL_FUNCTION(void, glBeginTransformFeedback, (GLenum primitiveMode))
+FOUNDATION_GL_FUNCTION(void, glEndTransformFeedback, (void))
+FOUNDATION_GL_FUNCTION(void, glBindBufferRange, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size))
+FOUNDATION_GL_FUNCTION(void, glBindBufferBase, (GLenum target, GLuint index, GLuint buffer))
+FOUNDATION_GL_FUNCTION(void, glTransformFeedbackVaryings, (GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode))
+FOUNDATION_GL_FUNCTION(void, glGetTransformFeedbackVarying, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name))
+FOUNDATION_GL_FUNCTION(void, glClampColor, (GLenum target, GLenum clamp))
+FOUNDATION_GL_FUNCTION(void, glBeginConditionalRender, (GLuint id, GLenum mode))
+FOUNDATION_GL_FUNCTION(void, glEndConditionalRender, (void))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribIPointer, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer))
+FOUNDATION_GL_FUNCTION(void, glGetVertexAttribIiv, (GLuint index, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetVertexAttribIuiv, (GLuint index, GLenum pname, GLuint *params))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI1i, (GLuint index, GLint x))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI2i, (GLuint index, GLint x, GLint y))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI3i, (GLuint index, GLint x, GLint y, GLint z))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI4i, (GLuint index, GLint x, GLint y, GLint z, GLint w))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI1ui, (GLuint index, GLuint x))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI2ui, (GLuint index, GLuint x, GLuint y))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI3ui, (GLuint index, GLuint x, GLuint y, GLuint z))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI4ui, (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI1iv, (GLuint index, const GLint *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI2iv, (GLuint index, const GLint *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI3iv, (GLuint index, const GLint *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI4iv, (GLuint index, const GLint *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI1uiv, (GLuint index, const GLuint *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI2uiv, (GLuint index, const GLuint *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI3uiv, (GLuint index, const GLuint *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI4uiv, (GLuint index, const GLuint *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI4bv, (GLuint index, const GLbyte *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI4sv, (GLuint index, const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI4ubv, (GLuint index, const GLubyte *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI4usv, (GLuint index, const GLushort *v))
+FOUNDATION_GL_FUNCTION(void, glGetUniformuiv, (GLuint program, GLint location, GLuint *params))
+FOUNDATION_GL_FUNCTION(void, glBindFragDataLocation, (GLuint program, GLuint color, const GLchar *name))
+FOUNDATION_GL_FUNCTION(GLint, glGetFragDataLocation, (GLuint program, const GLchar *name))
+FOUNDATION_GL_FUNCTION(void, glUniform1ui, (GLint location, GLuint v0))
+FOUNDATION_GL_FUNCTION(void, glUniform2ui, (GLint location, GLuint v0, GLuint v1))
+FOUNDATION_GL_FUNCTION(void, glUniform3ui, (GLint location, GLuint v0, GLuint v1, GLuint v2))
+FOUNDATION_GL_FUNCTION(void, glUniform4ui, (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3))
+FOUNDATION_GL_FUNCTION(void, glUniform1uiv, (GLint location, GLsizei count, const GLuint *value))
+FOUNDATION_GL_FUNCTION(void, glUniform2uiv, (GLint location, GLsizei count, const GLuint *value))
+FOUNDATION_GL_FUNCTION(void, glUniform3uiv, (GLint location, GLsizei count, const GLuint *value))
+FOUNDATION_GL_FUNCTION(void, glUniform4uiv, (GLint location, GLsizei count, const GLuint *value))
+FOUNDATION_GL_FUNCTION(void, glTexParameterIiv, (GLenum target, GLenum pname, const GLint *params))
+FOUNDATION_GL_FUNCTION(void, glTexParameterIuiv, (GLenum target, GLenum pname, const GLuint *params))
+FOUNDATION_GL_FUNCTION(void, glGetTexParameterIiv, (GLenum target, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetTexParameterIuiv, (GLenum target, GLenum pname, GLuint *params))
+FOUNDATION_GL_FUNCTION(void, glClearBufferiv, (GLenum buffer, GLint drawbuffer, const GLint *value))
+FOUNDATION_GL_FUNCTION(void, glClearBufferuiv, (GLenum buffer, GLint drawbuffer, const GLuint *value))
+FOUNDATION_GL_FUNCTION(void, glClearBufferfv, (GLenum buffer, GLint drawbuffer, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glClearBufferfi, (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil))
+FOUNDATION_GL_FUNCTION(const GLubyte *, glGetStringi, (GLenum name, GLuint index))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsRenderbuffer, (GLuint renderbuffer))
+FOUNDATION_GL_FUNCTION(void, glBindRenderbuffer, (GLenum target, GLuint renderbuffer))
+FOUNDATION_GL_FUNCTION(void, glDeleteRenderbuffers, (GLsizei n, const GLuint *renderbuffers))
+FOUNDATION_GL_FUNCTION(void, glGenRenderbuffers, (GLsizei n, GLuint *renderbuffers))
+FOUNDATION_GL_FUNCTION(void, glRenderbufferStorage, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height))
+FOUNDATION_GL_FUNCTION(void, glGetRenderbufferParameteriv, (GLenum target, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsFramebuffer, (GLuint framebuffer))
+FOUNDATION_GL_FUNCTION(void, glBindFramebuffer, (GLenum target, GLuint framebuffer))
+FOUNDATION_GL_FUNCTION(void, glDeleteFramebuffers, (GLsizei n, const GLuint *framebuffers))
+FOUNDATION_GL_FUNCTION(void, glGenFramebuffers, (GLsizei n, GLuint *framebuffers))
+FOUNDATION_GL_FUNCTION(GLenum, glCheckFramebufferStatus, (GLenum target))
+FOUNDATION_GL_FUNCTION(void, glFramebufferTexture1D, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level))
+FOUNDATION_GL_FUNCTION(void, glFramebufferTexture2D, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level))
+FOUNDATION_GL_FUNCTION(void, glFramebufferTexture3D, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset))
+FOUNDATION_GL_FUNCTION(void, glFramebufferRenderbuffer, (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer))
+FOUNDATION_GL_FUNCTION(void, glGetFramebufferAttachmentParameteriv, (GLenum target, GLenum attachment, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGenerateMipmap, (GLenum target))
+FOUNDATION_GL_FUNCTION(void, glBlitFramebuffer, (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter))
+FOUNDATION_GL_FUNCTION(void, glRenderbufferStorageMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height))
+FOUNDATION_GL_FUNCTION(void, glFramebufferTextureLayer, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer))
+FOUNDATION_GL_FUNCTION(void *, glMapBufferRange, (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access))
+FOUNDATION_GL_FUNCTION(void, glFlushMappedBufferRange, (GLenum target, GLintptr offset, GLsizeiptr length))
+FOUNDATION_GL_FUNCTION(void, glBindVertexArray, (GLuint array))
+FOUNDATION_GL_FUNCTION(void, glDeleteVertexArrays, (GLsizei n, const GLuint *arrays))
+FOUNDATION_GL_FUNCTION(void, glGenVertexArrays, (GLsizei n, GLuint *arrays))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsVertexArray, (GLuint array))
+#endif
+
+#ifdef GL_VERSION_3_1
+FOUNDATION_GL_FUNCTION(void, glDrawArraysInstanced, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount))
+FOUNDATION_GL_FUNCTION(void, glDrawElementsInstanced, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount))
+FOUNDATION_GL_FUNCTION(void, glTexBuffer, (GLenum target, GLenum internalformat, GLuint buffer))
+FOUNDATION_GL_FUNCTION(void, glPrimitiveRestartIndex, (GLuint index))
+FOUNDATION_GL_FUNCTION(void, glCopyBufferSubData, (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size))
+FOUNDATION_GL_FUNCTION(void, glGetUniformIndices, (GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices))
+FOUNDATION_GL_FUNCTION(void, glGetActiveUniformsiv, (GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetActiveUniformName, (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName))
+FOUNDATION_GL_FUNCTION(GLuint, glGetUniformBlockIndex, (GLuint program, const GLchar *uniformBlockName))
+FOUNDATION_GL_FUNCTION(void, glGetActiveUniformBlockiv, (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetActiveUniformBlockName, (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName))
+FOUNDATION_GL_FUNCTION(void, glUniformBlockBinding, (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding))
+#endif
+
+#ifdef GL_VERSION_3_2
+FOUNDATION_GL_FUNCTION(void, glDrawElementsBaseVertex, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex))
+FOUNDATION_GL_FUNCTION(void, glDrawRangeElementsBaseVertex, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex))
+FOUNDATION_GL_FUNCTION(void, glDrawElementsInstancedBaseVertex, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex))
+FOUNDATION_GL_FUNCTION(void, glMultiDrawElementsBaseVertex, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex))
+FOUNDATION_GL_FUNCTION(void, glProvokingVertex, (GLenum mode))
+FOUNDATION_GL_FUNCTION(GLsync, glFenceSync, (GLenum condition, GLbitfield flags))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsSync, (GLsync sync))
+FOUNDATION_GL_FUNCTION(void, glDeleteSync, (GLsync sync))
+FOUNDATION_GL_FUNCTION(GLenum, glClientWaitSync, (GLsync sync, GLbitfield flags, GLuint64 timeout))
+FOUNDATION_GL_FUNCTION(void, glWaitSync, (GLsync sync, GLbitfield flags, GLuint64 timeout))
+FOUNDATION_GL_FUNCTION(void, glGetInteger64v, (GLenum pname, GLint64 *params))
+FOUNDATION_GL_FUNCTION(void, glGetSynciv, (GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values))
+FOUNDATION_GL_FUNCTION(void, glGetInteger64i_v, (GLenum target, GLuint index, GLint64 *data))
+FOUNDATION_GL_FUNCTION(void, glGetBufferParameteri64v, (GLenum target, GLenum pname, GLint64 *params))
+FOUNDATION_GL_FUNCTION(void, glFramebufferTexture, (GLenum target, GLenum attachment, GLuint texture, GLint level))
+FOUNDATION_GL_FUNCTION(void, glTexImage2DMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations))
+FOUNDATION_GL_FUNCTION(void, glTexImage3DMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations))
+FOUNDATION_GL_FUNCTION(void, glGetMultisamplefv, (GLenum pname, GLuint index, GLfloat *val))
+FOUNDATION_GL_FUNCTION(void, glSampleMaski, (GLuint index, GLbitfield mask))
+#endif
+
+#ifdef GL_VERSION_3_3
+FOUNDATION_GL_FUNCTION(void, glBindFragDataLocationIndexed, (GLuint program, GLuint colorNumber, GLuint index, const GLchar *name))
+FOUNDATION_GL_FUNCTION(GLint, glGetFragDataIndex, (GLuint program, const GLchar *name))
+FOUNDATION_GL_FUNCTION(void, glGenSamplers, (GLsizei count, GLuint *samplers))
+FOUNDATION_GL_FUNCTION(void, glDeleteSamplers, (GLsizei count, const GLuint *samplers))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsSampler, (GLuint sampler))
+FOUNDATION_GL_FUNCTION(void, glBindSampler, (GLuint unit, GLuint sampler))
+FOUNDATION_GL_FUNCTION(void, glSamplerParameteri, (GLuint sampler, GLenum pname, GLint param))
+FOUNDATION_GL_FUNCTION(void, glSamplerParameteriv, (GLuint sampler, GLenum pname, const GLint *param))
+FOUNDATION_GL_FUNCTION(void, glSamplerParameterf, (GLuint sampler, GLenum pname, GLfloat param))
+FOUNDATION_GL_FUNCTION(void, glSamplerParameterfv, (GLuint sampler, GLenum pname, const GLfloat *param))
+FOUNDATION_GL_FUNCTION(void, glSamplerParameterIiv, (GLuint sampler, GLenum pname, const GLint *param))
+FOUNDATION_GL_FUNCTION(void, glSamplerParameterIuiv, (GLuint sampler, GLenum pname, const GLuint *param))
+FOUNDATION_GL_FUNCTION(void, glGetSamplerParameteriv, (GLuint sampler, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetSamplerParameterIiv, (GLuint sampler, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetSamplerParameterfv, (GLuint sampler, GLenum pname, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetSamplerParameterIuiv, (GLuint sampler, GLenum pname, GLuint *params))
+FOUNDATION_GL_FUNCTION(void, glQueryCounter, (GLuint id, GLenum target))
+FOUNDATION_GL_FUNCTION(void, glGetQueryObjecti64v, (GLuint id, GLenum pname, GLint64 *params))
+FOUNDATION_GL_FUNCTION(void, glGetQueryObjectui64v, (GLuint id, GLenum pname, GLuint64 *params))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribDivisor, (GLuint index, GLuint divisor))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribP1ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribP1uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribP2ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribP2uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribP3ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribP3uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribP4ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribP4uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value))
+FOUNDATION_GL_FUNCTION(void, glVertexP2ui, (GLenum type, GLuint value))
+FOUNDATION_GL_FUNCTION(void, glVertexP2uiv, (GLenum type, const GLuint *value))
+FOUNDATION_GL_FUNCTION(void, glVertexP3ui, (GLenum type, GLuint value))
+FOUNDATION_GL_FUNCTION(void, glVertexP3uiv, (GLenum type, const GLuint *value))
+FOUNDATION_GL_FUNCTION(void, glVertexP4ui, (GLenum type, GLuint value))
+FOUNDATION_GL_FUNCTION(void, glVertexP4uiv, (GLenum type, const GLuint *value))
+FOUNDATION_GL_FUNCTION(void, glTexCoordP1ui, (GLenum type, GLuint coords))
+FOUNDATION_GL_FUNCTION(void, glTexCoordP1uiv, (GLenum type, const GLuint *coords))
+FOUNDATION_GL_FUNCTION(void, glTexCoordP2ui, (GLenum type, GLuint coords))
+FOUNDATION_GL_FUNCTION(void, glTexCoordP2uiv, (GLenum type, const GLuint *coords))
+FOUNDATION_GL_FUNCTION(void, glTexCoordP3ui, (GLenum type, GLuint coords))
+FOUNDATION_GL_FUNCTION(void, glTexCoordP3uiv, (GLenum type, const GLuint *coords))
+FOUNDATION_GL_FUNCTION(void, glTexCoordP4ui, (GLenum type, GLuint coords))
+FOUNDATION_GL_FUNCTION(void, glTexCoordP4uiv, (GLenum type, const GLuint *coords))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoordP1ui, (GLenum texture, GLenum type, GLuint coords))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoordP1uiv, (GLenum texture, GLenum type, const GLuint *coords))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoordP2ui, (GLenum texture, GLenum type, GLuint coords))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoordP2uiv, (GLenum texture, GLenum type, const GLuint *coords))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoordP3ui, (GLenum texture, GLenum type, GLuint coords))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoordP3uiv, (GLenum texture, GLenum type, const GLuint *coords))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoordP4ui, (GLenum texture, GLenum type, GLuint coords))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoordP4uiv, (GLenum texture, GLenum type, const GLuint *coords))
+FOUNDATION_GL_FUNCTION(void, glNormalP3ui, (GLenum type, GLuint coords))
+FOUNDATION_GL_FUNCTION(void, glNormalP3uiv, (GLenum type, const GLuint *coords))
+FOUNDATION_GL_FUNCTION(void, glColorP3ui, (GLenum type, GLuint color))
+FOUNDATION_GL_FUNCTION(void, glColorP3uiv, (GLenum type, const GLuint *color))
+FOUNDATION_GL_FUNCTION(void, glColorP4ui, (GLenum type, GLuint color))
+FOUNDATION_GL_FUNCTION(void, glColorP4uiv, (GLenum type, const GLuint *color))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColorP3ui, (GLenum type, GLuint color))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColorP3uiv, (GLenum type, const GLuint *color))
+#endif
+
+#ifdef GL_VERSION_4_0
+FOUNDATION_GL_FUNCTION(void, glMinSampleShading, (GLfloat value))
+FOUNDATION_GL_FUNCTION(void, glBlendEquationi, (GLuint buf, GLenum mode))
+FOUNDATION_GL_FUNCTION(void, glBlendEquationSeparatei, (GLuint buf, GLenum modeRGB, GLenum modeAlpha))
+FOUNDATION_GL_FUNCTION(void, glBlendFunci, (GLuint buf, GLenum src, GLenum dst))
+FOUNDATION_GL_FUNCTION(void, glBlendFuncSeparatei, (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha))
+FOUNDATION_GL_FUNCTION(void, glDrawArraysIndirect, (GLenum mode, const void *indirect))
+FOUNDATION_GL_FUNCTION(void, glDrawElementsIndirect, (GLenum mode, GLenum type, const void *indirect))
+FOUNDATION_GL_FUNCTION(void, glUniform1d, (GLint location, GLdouble x))
+FOUNDATION_GL_FUNCTION(void, glUniform2d, (GLint location, GLdouble x, GLdouble y))
+FOUNDATION_GL_FUNCTION(void, glUniform3d, (GLint location, GLdouble x, GLdouble y, GLdouble z))
+FOUNDATION_GL_FUNCTION(void, glUniform4d, (GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w))
+FOUNDATION_GL_FUNCTION(void, glUniform1dv, (GLint location, GLsizei count, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glUniform2dv, (GLint location, GLsizei count, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glUniform3dv, (GLint location, GLsizei count, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glUniform4dv, (GLint location, GLsizei count, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glUniformMatrix2dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glUniformMatrix3dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glUniformMatrix4dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glUniformMatrix2x3dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glUniformMatrix2x4dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glUniformMatrix3x2dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glUniformMatrix3x4dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glUniformMatrix4x2dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glUniformMatrix4x3dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glGetUniformdv, (GLuint program, GLint location, GLdouble *params))
+FOUNDATION_GL_FUNCTION(GLint, glGetSubroutineUniformLocation, (GLuint program, GLenum shadertype, const GLchar *name))
+FOUNDATION_GL_FUNCTION(GLuint, glGetSubroutineIndex, (GLuint program, GLenum shadertype, const GLchar *name))
+FOUNDATION_GL_FUNCTION(void, glGetActiveSubroutineUniformiv, (GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values))
+FOUNDATION_GL_FUNCTION(void, glGetActiveSubroutineUniformName, (GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name))
+FOUNDATION_GL_FUNCTION(void, glGetActiveSubroutineName, (GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name))
+FOUNDATION_GL_FUNCTION(void, glUniformSubroutinesuiv, (GLenum shadertype, GLsizei count, const GLuint *indices))
+FOUNDATION_GL_FUNCTION(void, glGetUniformSubroutineuiv, (GLenum shadertype, GLint location, GLuint *params))
+FOUNDATION_GL_FUNCTION(void, glGetProgramStageiv, (GLuint program, GLenum shadertype, GLenum pname, GLint *values))
+FOUNDATION_GL_FUNCTION(void, glPatchParameteri, (GLenum pname, GLint value))
+FOUNDATION_GL_FUNCTION(void, glPatchParameterfv, (GLenum pname, const GLfloat *values))
+FOUNDATION_GL_FUNCTION(void, glBindTransformFeedback, (GLenum target, GLuint id))
+FOUNDATION_GL_FUNCTION(void, glDeleteTransformFeedbacks, (GLsizei n, const GLuint *ids))
+FOUNDATION_GL_FUNCTION(void, glGenTransformFeedbacks, (GLsizei n, GLuint *ids))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsTransformFeedback, (GLuint id))
+FOUNDATION_GL_FUNCTION(void, glPauseTransformFeedback, (void))
+FOUNDATION_GL_FUNCTION(void, glResumeTransformFeedback, (void))
+FOUNDATION_GL_FUNCTION(void, glDrawTransformFeedback, (GLenum mode, GLuint id))
+FOUNDATION_GL_FUNCTION(void, glDrawTransformFeedbackStream, (GLenum mode, GLuint id, GLuint stream))
+FOUNDATION_GL_FUNCTION(void, glBeginQueryIndexed, (GLenum target, GLuint index, GLuint id))
+FOUNDATION_GL_FUNCTION(void, glEndQueryIndexed, (GLenum target, GLuint index))
+FOUNDATION_GL_FUNCTION(void, glGetQueryIndexediv, (GLenum target, GLuint index, GLenum pname, GLint *params))
+#endif
+
+#ifdef GL_VERSION_4_1
+FOUNDATION_GL_FUNCTION(void, glReleaseShaderCompiler, (void))
+FOUNDATION_GL_FUNCTION(void, glShaderBinary, (GLsizei count, const GLuint *shaders, GLenum binaryformat, const void *binary, GLsizei length))
+FOUNDATION_GL_FUNCTION(void, glGetShaderPrecisionFormat, (GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision))
+FOUNDATION_GL_FUNCTION(void, glDepthRangef, (GLfloat n, GLfloat f))
+FOUNDATION_GL_FUNCTION(void, glClearDepthf, (GLfloat d))
+FOUNDATION_GL_FUNCTION(void, glGetProgramBinary, (GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary))
+FOUNDATION_GL_FUNCTION(void, glProgramBinary, (GLuint program, GLenum binaryFormat, const void *binary, GLsizei length))
+FOUNDATION_GL_FUNCTION(void, glProgramParameteri, (GLuint program, GLenum pname, GLint value))
+FOUNDATION_GL_FUNCTION(void, glUseProgramStages, (GLuint pipeline, GLbitfield stages, GLuint program))
+FOUNDATION_GL_FUNCTION(void, glActiveShaderProgram, (GLuint pipeline, GLuint program))
+FOUNDATION_GL_FUNCTION(GLuint, glCreateShaderProgramv, (GLenum type, GLsizei count, const GLchar *const*strings))
+FOUNDATION_GL_FUNCTION(void, glBindProgramPipeline, (GLuint pipeline))
+FOUNDATION_GL_FUNCTION(void, glDeleteProgramPipelines, (GLsizei n, const GLuint *pipelines))
+FOUNDATION_GL_FUNCTION(void, glGenProgramPipelines, (GLsizei n, GLuint *pipelines))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsProgramPipeline, (GLuint pipeline))
+FOUNDATION_GL_FUNCTION(void, glGetProgramPipelineiv, (GLuint pipeline, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform1i, (GLuint program, GLint location, GLint v0))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform1iv, (GLuint program, GLint location, GLsizei count, const GLint *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform1f, (GLuint program, GLint location, GLfloat v0))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform1fv, (GLuint program, GLint location, GLsizei count, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform1d, (GLuint program, GLint location, GLdouble v0))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform1dv, (GLuint program, GLint location, GLsizei count, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform1ui, (GLuint program, GLint location, GLuint v0))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform1uiv, (GLuint program, GLint location, GLsizei count, const GLuint *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform2i, (GLuint program, GLint location, GLint v0, GLint v1))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform2iv, (GLuint program, GLint location, GLsizei count, const GLint *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform2f, (GLuint program, GLint location, GLfloat v0, GLfloat v1))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform2fv, (GLuint program, GLint location, GLsizei count, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform2d, (GLuint program, GLint location, GLdouble v0, GLdouble v1))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform2dv, (GLuint program, GLint location, GLsizei count, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform2ui, (GLuint program, GLint location, GLuint v0, GLuint v1))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform2uiv, (GLuint program, GLint location, GLsizei count, const GLuint *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform3i, (GLuint program, GLint location, GLint v0, GLint v1, GLint v2))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform3iv, (GLuint program, GLint location, GLsizei count, const GLint *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform3f, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform3fv, (GLuint program, GLint location, GLsizei count, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform3d, (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform3dv, (GLuint program, GLint location, GLsizei count, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform3ui, (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform3uiv, (GLuint program, GLint location, GLsizei count, const GLuint *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform4i, (GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform4iv, (GLuint program, GLint location, GLsizei count, const GLint *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform4f, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform4fv, (GLuint program, GLint location, GLsizei count, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform4d, (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform4dv, (GLuint program, GLint location, GLsizei count, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform4ui, (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform4uiv, (GLuint program, GLint location, GLsizei count, const GLuint *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix2fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix3fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix4fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix2dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix3dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix4dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix2x3fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix3x2fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix2x4fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix4x2fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix3x4fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix4x3fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix2x3dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix3x2dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix2x4dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix4x2dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix3x4dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix4x3dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glValidateProgramPipeline, (GLuint pipeline))
+FOUNDATION_GL_FUNCTION(void, glGetProgramPipelineInfoLog, (GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL1d, (GLuint index, GLdouble x))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL2d, (GLuint index, GLdouble x, GLdouble y))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL3d, (GLuint index, GLdouble x, GLdouble y, GLdouble z))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL4d, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL1dv, (GLuint index, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL2dv, (GLuint index, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL3dv, (GLuint index, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL4dv, (GLuint index, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribLPointer, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer))
+FOUNDATION_GL_FUNCTION(void, glGetVertexAttribLdv, (GLuint index, GLenum pname, GLdouble *params))
+FOUNDATION_GL_FUNCTION(void, glViewportArrayv, (GLuint first, GLsizei count, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glViewportIndexedf, (GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h))
+FOUNDATION_GL_FUNCTION(void, glViewportIndexedfv, (GLuint index, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glScissorArrayv, (GLuint first, GLsizei count, const GLint *v))
+FOUNDATION_GL_FUNCTION(void, glScissorIndexed, (GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height))
+FOUNDATION_GL_FUNCTION(void, glScissorIndexedv, (GLuint index, const GLint *v))
+FOUNDATION_GL_FUNCTION(void, glDepthRangeArrayv, (GLuint first, GLsizei count, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glDepthRangeIndexed, (GLuint index, GLdouble n, GLdouble f))
+FOUNDATION_GL_FUNCTION(void, glGetFloati_v, (GLenum target, GLuint index, GLfloat *data))
+FOUNDATION_GL_FUNCTION(void, glGetDoublei_v, (GLenum target, GLuint index, GLdouble *data))
+#endif
+
+#ifdef GL_VERSION_4_2
+FOUNDATION_GL_FUNCTION(void, glDrawArraysInstancedBaseInstance, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance))
+FOUNDATION_GL_FUNCTION(void, glDrawElementsInstancedBaseInstance, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance))
+FOUNDATION_GL_FUNCTION(void, glDrawElementsInstancedBaseVertexBaseInstance, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance))
+FOUNDATION_GL_FUNCTION(void, glGetInternalformativ, (GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetActiveAtomicCounterBufferiv, (GLuint program, GLuint bufferIndex, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glBindImageTexture, (GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format))
+FOUNDATION_GL_FUNCTION(void, glMemoryBarrier, (GLbitfield barriers))
+FOUNDATION_GL_FUNCTION(void, glTexStorage1D, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width))
+FOUNDATION_GL_FUNCTION(void, glTexStorage2D, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height))
+FOUNDATION_GL_FUNCTION(void, glTexStorage3D, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth))
+FOUNDATION_GL_FUNCTION(void, glDrawTransformFeedbackInstanced, (GLenum mode, GLuint id, GLsizei instancecount))
+FOUNDATION_GL_FUNCTION(void, glDrawTransformFeedbackStreamInstanced, (GLenum mode, GLuint id, GLuint stream, GLsizei instancecount))
+#endif
+
+#ifdef GL_VERSION_4_3
+FOUNDATION_GL_FUNCTION(void, glClearBufferData, (GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data))
+FOUNDATION_GL_FUNCTION(void, glClearBufferSubData, (GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data))
+FOUNDATION_GL_FUNCTION(void, glDispatchCompute, (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z))
+FOUNDATION_GL_FUNCTION(void, glDispatchComputeIndirect, (GLintptr indirect))
+FOUNDATION_GL_FUNCTION(void, glCopyImageSubData, (GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth))
+FOUNDATION_GL_FUNCTION(void, glFramebufferParameteri, (GLenum target, GLenum pname, GLint param))
+FOUNDATION_GL_FUNCTION(void, glGetFramebufferParameteriv, (GLenum target, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetInternalformati64v, (GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint64 *params))
+FOUNDATION_GL_FUNCTION(void, glInvalidateTexSubImage, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth))
+FOUNDATION_GL_FUNCTION(void, glInvalidateTexImage, (GLuint texture, GLint level))
+FOUNDATION_GL_FUNCTION(void, glInvalidateBufferSubData, (GLuint buffer, GLintptr offset, GLsizeiptr length))
+FOUNDATION_GL_FUNCTION(void, glInvalidateBufferData, (GLuint buffer))
+FOUNDATION_GL_FUNCTION(void, glInvalidateFramebuffer, (GLenum target, GLsizei numAttachments, const GLenum *attachments))
+FOUNDATION_GL_FUNCTION(void, glInvalidateSubFramebuffer, (GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height))
+FOUNDATION_GL_FUNCTION(void, glMultiDrawArraysIndirect, (GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride))
+FOUNDATION_GL_FUNCTION(void, glMultiDrawElementsIndirect, (GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride))
+FOUNDATION_GL_FUNCTION(void, glGetProgramInterfaceiv, (GLuint program, GLenum programInterface, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(GLuint, glGetProgramResourceIndex, (GLuint program, GLenum programInterface, const GLchar *name))
+FOUNDATION_GL_FUNCTION(void, glGetProgramResourceName, (GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name))
+FOUNDATION_GL_FUNCTION(void, glGetProgramResourceiv, (GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei bufSize, GLsizei *length, GLint *params))
+FOUNDATION_GL_FUNCTION(GLint, glGetProgramResourceLocation, (GLuint program, GLenum programInterface, const GLchar *name))
+FOUNDATION_GL_FUNCTION(GLint, glGetProgramResourceLocationIndex, (GLuint program, GLenum programInterface, const GLchar *name))
+FOUNDATION_GL_FUNCTION(void, glShaderStorageBlockBinding, (GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding))
+FOUNDATION_GL_FUNCTION(void, glTexBufferRange, (GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size))
+FOUNDATION_GL_FUNCTION(void, glTexStorage2DMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations))
+FOUNDATION_GL_FUNCTION(void, glTexStorage3DMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations))
+FOUNDATION_GL_FUNCTION(void, glTextureView, (GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers))
+FOUNDATION_GL_FUNCTION(void, glBindVertexBuffer, (GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribFormat, (GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribIFormat, (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribLFormat, (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribBinding, (GLuint attribindex, GLuint bindingindex))
+FOUNDATION_GL_FUNCTION(void, glVertexBindingDivisor, (GLuint bindingindex, GLuint divisor))
+FOUNDATION_GL_FUNCTION(void, glDebugMessageControl, (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled))
+FOUNDATION_GL_FUNCTION(void, glDebugMessageInsert, (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf))
+FOUNDATION_GL_FUNCTION(void, glDebugMessageCallback, (GLDEBUGPROC callback, const void *userParam))
+FOUNDATION_GL_FUNCTION(GLuint, glGetDebugMessageLog, (GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog))
+FOUNDATION_GL_FUNCTION(void, glPushDebugGroup, (GLenum source, GLuint id, GLsizei length, const GLchar *message))
+FOUNDATION_GL_FUNCTION(void, glPopDebugGroup, (void))
+FOUNDATION_GL_FUNCTION(void, glObjectLabel, (GLenum identifier, GLuint name, GLsizei length, const GLchar *label))
+FOUNDATION_GL_FUNCTION(void, glGetObjectLabel, (GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label))
+FOUNDATION_GL_FUNCTION(void, glObjectPtrLabel, (const void *ptr, GLsizei length, const GLchar *label))
+FOUNDATION_GL_FUNCTION(void, glGetObjectPtrLabel, (const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label))
+#endif
+
+#ifdef GL_VERSION_4_4
+FOUNDATION_GL_FUNCTION(void, glBufferStorage, (GLenum target, GLsizeiptr size, const void *data, GLbitfield flags))
+FOUNDATION_GL_FUNCTION(void, glClearTexImage, (GLuint texture, GLint level, GLenum format, GLenum type, const void *data))
+FOUNDATION_GL_FUNCTION(void, glClearTexSubImage, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data))
+FOUNDATION_GL_FUNCTION(void, glBindBuffersBase, (GLenum target, GLuint first, GLsizei count, const GLuint *buffers))
+FOUNDATION_GL_FUNCTION(void, glBindBuffersRange, (GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes))
+FOUNDATION_GL_FUNCTION(void, glBindTextures, (GLuint first, GLsizei count, const GLuint *textures))
+FOUNDATION_GL_FUNCTION(void, glBindSamplers, (GLuint first, GLsizei count, const GLuint *samplers))
+FOUNDATION_GL_FUNCTION(void, glBindImageTextures, (GLuint first, GLsizei count, const GLuint *textures))
+FOUNDATION_GL_FUNCTION(void, glBindVertexBuffers, (GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides))
+#endif
+
+#ifdef GL_ARB_bindless_texture
+FOUNDATION_GL_FUNCTION(GLuint64, glGetTextureHandleARB, (GLuint texture))
+FOUNDATION_GL_FUNCTION(GLuint64, glGetTextureSamplerHandleARB, (GLuint texture, GLuint sampler))
+FOUNDATION_GL_FUNCTION(void, glMakeTextureHandleResidentARB, (GLuint64 handle))
+FOUNDATION_GL_FUNCTION(void, glMakeTextureHandleNonResidentARB, (GLuint64 handle))
+FOUNDATION_GL_FUNCTION(GLuint64, glGetImageHandleARB, (GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum format))
+FOUNDATION_GL_FUNCTION(void, glMakeImageHandleResidentARB, (GLuint64 handle, GLenum access))
+FOUNDATION_GL_FUNCTION(void, glMakeImageHandleNonResidentARB, (GLuint64 handle))
+FOUNDATION_GL_FUNCTION(void, glUniformHandleui64ARB, (GLint location, GLuint64 value))
+FOUNDATION_GL_FUNCTION(void, glUniformHandleui64vARB, (GLint location, GLsizei count, const GLuint64 *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformHandleui64ARB, (GLuint program, GLint location, GLuint64 value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformHandleui64vARB, (GLuint program, GLint location, GLsizei count, const GLuint64 *values))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsTextureHandleResidentARB, (GLuint64 handle))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsImageHandleResidentARB, (GLuint64 handle))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL1ui64ARB, (GLuint index, GLuint64EXT x))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL1ui64vARB, (GLuint index, const GLuint64EXT *v))
+FOUNDATION_GL_FUNCTION(void, glGetVertexAttribLui64vARB, (GLuint index, GLenum pname, GLuint64EXT *params))
+#endif
+
+#ifdef GL_ARB_cl_event
+FOUNDATION_GL_FUNCTION(GLsync, glCreateSyncFromCLeventARB, (struct _cl_context *context, struct _cl_event *event, GLbitfield flags))
+#endif
+
+#ifdef GL_ARB_color_buffer_float
+FOUNDATION_GL_FUNCTION(void, glClampColorARB, (GLenum target, GLenum clamp))
+#endif
+
+#ifdef GL_ARB_compute_variable_group_size
+FOUNDATION_GL_FUNCTION(void, glDispatchComputeGroupSizeARB, (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z, GLuint group_size_x, GLuint group_size_y, GLuint group_size_z))
+#endif
+
+#ifdef GL_ARB_debug_output
+FOUNDATION_GL_FUNCTION(void, glDebugMessageControlARB, (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled))
+FOUNDATION_GL_FUNCTION(void, glDebugMessageInsertARB, (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf))
+FOUNDATION_GL_FUNCTION(void, glDebugMessageCallbackARB, (GLDEBUGPROCARB callback, const void *userParam))
+FOUNDATION_GL_FUNCTION(GLuint, glGetDebugMessageLogARB, (GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog))
+#endif
+
+#ifdef GL_ARB_draw_buffers
+FOUNDATION_GL_FUNCTION(void, glDrawBuffersARB, (GLsizei n, const GLenum *bufs))
+#endif
+
+#ifdef GL_ARB_draw_buffers_blend
+FOUNDATION_GL_FUNCTION(void, glBlendEquationiARB, (GLuint buf, GLenum mode))
+FOUNDATION_GL_FUNCTION(void, glBlendEquationSeparateiARB, (GLuint buf, GLenum modeRGB, GLenum modeAlpha))
+FOUNDATION_GL_FUNCTION(void, glBlendFunciARB, (GLuint buf, GLenum src, GLenum dst))
+FOUNDATION_GL_FUNCTION(void, glBlendFuncSeparateiARB, (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha))
+#endif
+
+#ifdef GL_ARB_draw_instanced
+FOUNDATION_GL_FUNCTION(void, glDrawArraysInstancedARB, (GLenum mode, GLint first, GLsizei count, GLsizei primcount))
+FOUNDATION_GL_FUNCTION(void, glDrawElementsInstancedARB, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei primcount))
+#endif
+
+#ifdef GL_ARB_fragment_program
+FOUNDATION_GL_FUNCTION(void, glProgramStringARB, (GLenum target, GLenum format, GLsizei len, const void *string))
+FOUNDATION_GL_FUNCTION(void, glBindProgramARB, (GLenum target, GLuint program))
+FOUNDATION_GL_FUNCTION(void, glDeleteProgramsARB, (GLsizei n, const GLuint *programs))
+FOUNDATION_GL_FUNCTION(void, glGenProgramsARB, (GLsizei n, GLuint *programs))
+FOUNDATION_GL_FUNCTION(void, glProgramEnvParameter4dARB, (GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w))
+FOUNDATION_GL_FUNCTION(void, glProgramEnvParameter4dvARB, (GLenum target, GLuint index, const GLdouble *params))
+FOUNDATION_GL_FUNCTION(void, glProgramEnvParameter4fARB, (GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w))
+FOUNDATION_GL_FUNCTION(void, glProgramEnvParameter4fvARB, (GLenum target, GLuint index, const GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glProgramLocalParameter4dARB, (GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w))
+FOUNDATION_GL_FUNCTION(void, glProgramLocalParameter4dvARB, (GLenum target, GLuint index, const GLdouble *params))
+FOUNDATION_GL_FUNCTION(void, glProgramLocalParameter4fARB, (GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w))
+FOUNDATION_GL_FUNCTION(void, glProgramLocalParameter4fvARB, (GLenum target, GLuint index, const GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetProgramEnvParameterdvARB, (GLenum target, GLuint index, GLdouble *params))
+FOUNDATION_GL_FUNCTION(void, glGetProgramEnvParameterfvARB, (GLenum target, GLuint index, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetProgramLocalParameterdvARB, (GLenum target, GLuint index, GLdouble *params))
+FOUNDATION_GL_FUNCTION(void, glGetProgramLocalParameterfvARB, (GLenum target, GLuint index, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetProgramivARB, (GLenum target, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetProgramStringARB, (GLenum target, GLenum pname, void *string))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsProgramARB, (GLuint program))
+#endif
+
+#ifdef GL_ARB_geometry_shader4
+FOUNDATION_GL_FUNCTION(void, glProgramParameteriARB, (GLuint program, GLenum pname, GLint value))
+FOUNDATION_GL_FUNCTION(void, glFramebufferTextureARB, (GLenum target, GLenum attachment, GLuint texture, GLint level))
+FOUNDATION_GL_FUNCTION(void, glFramebufferTextureLayerARB, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer))
+FOUNDATION_GL_FUNCTION(void, glFramebufferTextureFaceARB, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLenum face))
+#endif
+
+#ifdef GL_ARB_imaging
+FOUNDATION_GL_FUNCTION(void, glColorTable, (GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const void *table))
+FOUNDATION_GL_FUNCTION(void, glColorTableParameterfv, (GLenum target, GLenum pname, const GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glColorTableParameteriv, (GLenum target, GLenum pname, const GLint *params))
+FOUNDATION_GL_FUNCTION(void, glCopyColorTable, (GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width))
+FOUNDATION_GL_FUNCTION(void, glGetColorTable, (GLenum target, GLenum format, GLenum type, void *table))
+FOUNDATION_GL_FUNCTION(void, glGetColorTableParameterfv, (GLenum target, GLenum pname, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetColorTableParameteriv, (GLenum target, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glColorSubTable, (GLenum target, GLsizei start, GLsizei count, GLenum format, GLenum type, const void *data))
+FOUNDATION_GL_FUNCTION(void, glCopyColorSubTable, (GLenum target, GLsizei start, GLint x, GLint y, GLsizei width))
+FOUNDATION_GL_FUNCTION(void, glConvolutionFilter1D, (GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const void *image))
+FOUNDATION_GL_FUNCTION(void, glConvolutionFilter2D, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *image))
+FOUNDATION_GL_FUNCTION(void, glConvolutionParameterf, (GLenum target, GLenum pname, GLfloat params))
+FOUNDATION_GL_FUNCTION(void, glConvolutionParameterfv, (GLenum target, GLenum pname, const GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glConvolutionParameteri, (GLenum target, GLenum pname, GLint params))
+FOUNDATION_GL_FUNCTION(void, glConvolutionParameteriv, (GLenum target, GLenum pname, const GLint *params))
+FOUNDATION_GL_FUNCTION(void, glCopyConvolutionFilter1D, (GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width))
+FOUNDATION_GL_FUNCTION(void, glCopyConvolutionFilter2D, (GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height))
+FOUNDATION_GL_FUNCTION(void, glGetConvolutionFilter, (GLenum target, GLenum format, GLenum type, void *image))
+FOUNDATION_GL_FUNCTION(void, glGetConvolutionParameterfv, (GLenum target, GLenum pname, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetConvolutionParameteriv, (GLenum target, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetSeparableFilter, (GLenum target, GLenum format, GLenum type, void *row, void *column, void *span))
+FOUNDATION_GL_FUNCTION(void, glSeparableFilter2D, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *row, const void *column))
+FOUNDATION_GL_FUNCTION(void, glGetHistogram, (GLenum target, GLboolean reset, GLenum format, GLenum type, void *values))
+FOUNDATION_GL_FUNCTION(void, glGetHistogramParameterfv, (GLenum target, GLenum pname, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetHistogramParameteriv, (GLenum target, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetMinmax, (GLenum target, GLboolean reset, GLenum format, GLenum type, void *values))
+FOUNDATION_GL_FUNCTION(void, glGetMinmaxParameterfv, (GLenum target, GLenum pname, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetMinmaxParameteriv, (GLenum target, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glHistogram, (GLenum target, GLsizei width, GLenum internalformat, GLboolean sink))
+FOUNDATION_GL_FUNCTION(void, glMinmax, (GLenum target, GLenum internalformat, GLboolean sink))
+FOUNDATION_GL_FUNCTION(void, glResetHistogram, (GLenum target))
+FOUNDATION_GL_FUNCTION(void, glResetMinmax, (GLenum target))
+#endif
+
+#ifdef GL_ARB_indirect_parameters
+FOUNDATION_GL_FUNCTION(void, glMultiDrawArraysIndirectCountARB, (GLenum mode, GLintptr indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride))
+FOUNDATION_GL_FUNCTION(void, glMultiDrawElementsIndirectCountARB, (GLenum mode, GLenum type, GLintptr indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride))
+#endif
+
+#ifdef GL_ARB_instanced_arrays
+FOUNDATION_GL_FUNCTION(void, glVertexAttribDivisorARB, (GLuint index, GLuint divisor))
+#endif
+
+#ifdef GL_ARB_matrix_palette
+FOUNDATION_GL_FUNCTION(void, glCurrentPaletteMatrixARB, (GLint index))
+FOUNDATION_GL_FUNCTION(void, glMatrixIndexubvARB, (GLint size, const GLubyte *indices))
+FOUNDATION_GL_FUNCTION(void, glMatrixIndexusvARB, (GLint size, const GLushort *indices))
+FOUNDATION_GL_FUNCTION(void, glMatrixIndexuivARB, (GLint size, const GLuint *indices))
+FOUNDATION_GL_FUNCTION(void, glMatrixIndexPointerARB, (GLint size, GLenum type, GLsizei stride, const void *pointer))
+#endif
+
+#ifdef GL_ARB_multisample
+FOUNDATION_GL_FUNCTION(void, glSampleCoverageARB, (GLfloat value, GLboolean invert))
+#endif
+
+#ifdef GL_ARB_multitexture
+FOUNDATION_GL_FUNCTION(void, glActiveTextureARB, (GLenum texture))
+FOUNDATION_GL_FUNCTION(void, glClientActiveTextureARB, (GLenum texture))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord1dARB, (GLenum target, GLdouble s))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord1dvARB, (GLenum target, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord1fARB, (GLenum target, GLfloat s))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord1fvARB, (GLenum target, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord1iARB, (GLenum target, GLint s))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord1ivARB, (GLenum target, const GLint *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord1sARB, (GLenum target, GLshort s))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord1svARB, (GLenum target, const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord2dARB, (GLenum target, GLdouble s, GLdouble t))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord2dvARB, (GLenum target, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord2fARB, (GLenum target, GLfloat s, GLfloat t))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord2fvARB, (GLenum target, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord2iARB, (GLenum target, GLint s, GLint t))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord2ivARB, (GLenum target, const GLint *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord2sARB, (GLenum target, GLshort s, GLshort t))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord2svARB, (GLenum target, const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord3dARB, (GLenum target, GLdouble s, GLdouble t, GLdouble r))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord3dvARB, (GLenum target, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord3fARB, (GLenum target, GLfloat s, GLfloat t, GLfloat r))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord3fvARB, (GLenum target, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord3iARB, (GLenum target, GLint s, GLint t, GLint r))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord3ivARB, (GLenum target, const GLint *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord3sARB, (GLenum target, GLshort s, GLshort t, GLshort r))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord3svARB, (GLenum target, const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord4dARB, (GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord4dvARB, (GLenum target, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord4fARB, (GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord4fvARB, (GLenum target, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord4iARB, (GLenum target, GLint s, GLint t, GLint r, GLint q))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord4ivARB, (GLenum target, const GLint *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord4sARB, (GLenum target, GLshort s, GLshort t, GLshort r, GLshort q))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord4svARB, (GLenum target, const GLshort *v))
+#endif
+
+#ifdef GL_ARB_occlusion_query
+FOUNDATION_GL_FUNCTION(void, glGenQueriesARB, (GLsizei n, GLuint *ids))
+FOUNDATION_GL_FUNCTION(void, glDeleteQueriesARB, (GLsizei n, const GLuint *ids))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsQueryARB, (GLuint id))
+FOUNDATION_GL_FUNCTION(void, glBeginQueryARB, (GLenum target, GLuint id))
+FOUNDATION_GL_FUNCTION(void, glEndQueryARB, (GLenum target))
+FOUNDATION_GL_FUNCTION(void, glGetQueryivARB, (GLenum target, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetQueryObjectivARB, (GLuint id, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetQueryObjectuivARB, (GLuint id, GLenum pname, GLuint *params))
+#endif
+
+#ifdef GL_ARB_point_parameters
+FOUNDATION_GL_FUNCTION(void, glPointParameterfARB, (GLenum pname, GLfloat param))
+FOUNDATION_GL_FUNCTION(void, glPointParameterfvARB, (GLenum pname, const GLfloat *params))
+#endif
+
+#ifdef GL_ARB_robustness
+FOUNDATION_GL_FUNCTION(GLenum, glGetGraphicsResetStatusARB, (void))
+FOUNDATION_GL_FUNCTION(void, glGetnTexImageARB, (GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *img))
+FOUNDATION_GL_FUNCTION(void, glReadnPixelsARB, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data))
+FOUNDATION_GL_FUNCTION(void, glGetnCompressedTexImageARB, (GLenum target, GLint lod, GLsizei bufSize, void *img))
+FOUNDATION_GL_FUNCTION(void, glGetnUniformfvARB, (GLuint program, GLint location, GLsizei bufSize, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetnUniformivARB, (GLuint program, GLint location, GLsizei bufSize, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetnUniformuivARB, (GLuint program, GLint location, GLsizei bufSize, GLuint *params))
+FOUNDATION_GL_FUNCTION(void, glGetnUniformdvARB, (GLuint program, GLint location, GLsizei bufSize, GLdouble *params))
+FOUNDATION_GL_FUNCTION(void, glGetnMapdvARB, (GLenum target, GLenum query, GLsizei bufSize, GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glGetnMapfvARB, (GLenum target, GLenum query, GLsizei bufSize, GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glGetnMapivARB, (GLenum target, GLenum query, GLsizei bufSize, GLint *v))
+FOUNDATION_GL_FUNCTION(void, glGetnPixelMapfvARB, (GLenum map, GLsizei bufSize, GLfloat *values))
+FOUNDATION_GL_FUNCTION(void, glGetnPixelMapuivARB, (GLenum map, GLsizei bufSize, GLuint *values))
+FOUNDATION_GL_FUNCTION(void, glGetnPixelMapusvARB, (GLenum map, GLsizei bufSize, GLushort *values))
+FOUNDATION_GL_FUNCTION(void, glGetnPolygonStippleARB, (GLsizei bufSize, GLubyte *pattern))
+FOUNDATION_GL_FUNCTION(void, glGetnColorTableARB, (GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *table))
+FOUNDATION_GL_FUNCTION(void, glGetnConvolutionFilterARB, (GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *image))
+FOUNDATION_GL_FUNCTION(void, glGetnSeparableFilterARB, (GLenum target, GLenum format, GLenum type, GLsizei rowBufSize, void *row, GLsizei columnBufSize, void *column, void *span))
+FOUNDATION_GL_FUNCTION(void, glGetnHistogramARB, (GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values))
+FOUNDATION_GL_FUNCTION(void, glGetnMinmaxARB, (GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values))
+#endif
+
+#ifdef GL_ARB_sample_shading
+FOUNDATION_GL_FUNCTION(void, glMinSampleShadingARB, (GLfloat value))
+#endif
+
+#ifdef GL_ARB_shader_objects
+FOUNDATION_GL_FUNCTION(void, glDeleteObjectARB, (GLhandleARB obj))
+FOUNDATION_GL_FUNCTION(GLhandleARB, glGetHandleARB, (GLenum pname))
+FOUNDATION_GL_FUNCTION(void, glDetachObjectARB, (GLhandleARB containerObj, GLhandleARB attachedObj))
+FOUNDATION_GL_FUNCTION(GLhandleARB, glCreateShaderObjectARB, (GLenum shaderType))
+FOUNDATION_GL_FUNCTION(void, glShaderSourceARB, (GLhandleARB shaderObj, GLsizei count, const GLcharARB **string, const GLint *length))
+FOUNDATION_GL_FUNCTION(void, glCompileShaderARB, (GLhandleARB shaderObj))
+FOUNDATION_GL_FUNCTION(GLhandleARB, glCreateProgramObjectARB, (void))
+FOUNDATION_GL_FUNCTION(void, glAttachObjectARB, (GLhandleARB containerObj, GLhandleARB obj))
+FOUNDATION_GL_FUNCTION(void, glLinkProgramARB, (GLhandleARB programObj))
+FOUNDATION_GL_FUNCTION(void, glUseProgramObjectARB, (GLhandleARB programObj))
+FOUNDATION_GL_FUNCTION(void, glValidateProgramARB, (GLhandleARB programObj))
+FOUNDATION_GL_FUNCTION(void, glUniform1fARB, (GLint location, GLfloat v0))
+FOUNDATION_GL_FUNCTION(void, glUniform2fARB, (GLint location, GLfloat v0, GLfloat v1))
+FOUNDATION_GL_FUNCTION(void, glUniform3fARB, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2))
+FOUNDATION_GL_FUNCTION(void, glUniform4fARB, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3))
+FOUNDATION_GL_FUNCTION(void, glUniform1iARB, (GLint location, GLint v0))
+FOUNDATION_GL_FUNCTION(void, glUniform2iARB, (GLint location, GLint v0, GLint v1))
+FOUNDATION_GL_FUNCTION(void, glUniform3iARB, (GLint location, GLint v0, GLint v1, GLint v2))
+FOUNDATION_GL_FUNCTION(void, glUniform4iARB, (GLint location, GLint v0, GLint v1, GLint v2, GLint v3))
+FOUNDATION_GL_FUNCTION(void, glUniform1fvARB, (GLint location, GLsizei count, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glUniform2fvARB, (GLint location, GLsizei count, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glUniform3fvARB, (GLint location, GLsizei count, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glUniform4fvARB, (GLint location, GLsizei count, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glUniform1ivARB, (GLint location, GLsizei count, const GLint *value))
+FOUNDATION_GL_FUNCTION(void, glUniform2ivARB, (GLint location, GLsizei count, const GLint *value))
+FOUNDATION_GL_FUNCTION(void, glUniform3ivARB, (GLint location, GLsizei count, const GLint *value))
+FOUNDATION_GL_FUNCTION(void, glUniform4ivARB, (GLint location, GLsizei count, const GLint *value))
+FOUNDATION_GL_FUNCTION(void, glUniformMatrix2fvARB, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glUniformMatrix3fvARB, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glUniformMatrix4fvARB, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glGetObjectParameterfvARB, (GLhandleARB obj, GLenum pname, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetObjectParameterivARB, (GLhandleARB obj, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetInfoLogARB, (GLhandleARB obj, GLsizei maxLength, GLsizei *length, GLcharARB *infoLog))
+FOUNDATION_GL_FUNCTION(void, glGetAttachedObjectsARB, (GLhandleARB containerObj, GLsizei maxCount, GLsizei *count, GLhandleARB *obj))
+FOUNDATION_GL_FUNCTION(GLint, glGetUniformLocationARB, (GLhandleARB programObj, const GLcharARB *name))
+FOUNDATION_GL_FUNCTION(void, glGetActiveUniformARB, (GLhandleARB programObj, GLuint index, GLsizei maxLength, GLsizei *length, GLint *size, GLenum *type, GLcharARB *name))
+FOUNDATION_GL_FUNCTION(void, glGetUniformfvARB, (GLhandleARB programObj, GLint location, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetUniformivARB, (GLhandleARB programObj, GLint location, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetShaderSourceARB, (GLhandleARB obj, GLsizei maxLength, GLsizei *length, GLcharARB *source))
+#endif
+
+#ifdef GL_ARB_shading_language_include
+FOUNDATION_GL_FUNCTION(void, glNamedStringARB, (GLenum type, GLint namelen, const GLchar *name, GLint stringlen, const GLchar *string))
+FOUNDATION_GL_FUNCTION(void, glDeleteNamedStringARB, (GLint namelen, const GLchar *name))
+FOUNDATION_GL_FUNCTION(void, glCompileShaderIncludeARB, (GLuint shader, GLsizei count, const GLchar *const*path, const GLint *length))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsNamedStringARB, (GLint namelen, const GLchar *name))
+FOUNDATION_GL_FUNCTION(void, glGetNamedStringARB, (GLint namelen, const GLchar *name, GLsizei bufSize, GLint *stringlen, GLchar *string))
+FOUNDATION_GL_FUNCTION(void, glGetNamedStringivARB, (GLint namelen, const GLchar *name, GLenum pname, GLint *params))
+#endif
+
+#ifdef GL_ARB_sparse_texture
+FOUNDATION_GL_FUNCTION(void, glTexPageCommitmentARB, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLboolean resident))
+#endif
+
+#ifdef GL_ARB_texture_buffer_object
+FOUNDATION_GL_FUNCTION(void, glTexBufferARB, (GLenum target, GLenum internalformat, GLuint buffer))
+#endif
+
+#ifdef GL_ARB_texture_compression
+FOUNDATION_GL_FUNCTION(void, glCompressedTexImage3DARB, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data))
+FOUNDATION_GL_FUNCTION(void, glCompressedTexImage2DARB, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data))
+FOUNDATION_GL_FUNCTION(void, glCompressedTexImage1DARB, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data))
+FOUNDATION_GL_FUNCTION(void, glCompressedTexSubImage3DARB, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data))
+FOUNDATION_GL_FUNCTION(void, glCompressedTexSubImage2DARB, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data))
+FOUNDATION_GL_FUNCTION(void, glCompressedTexSubImage1DARB, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data))
+FOUNDATION_GL_FUNCTION(void, glGetCompressedTexImageARB, (GLenum target, GLint level, void *img))
+#endif
+
+#ifdef GL_ARB_transpose_matrix
+FOUNDATION_GL_FUNCTION(void, glLoadTransposeMatrixfARB, (const GLfloat *m))
+FOUNDATION_GL_FUNCTION(void, glLoadTransposeMatrixdARB, (const GLdouble *m))
+FOUNDATION_GL_FUNCTION(void, glMultTransposeMatrixfARB, (const GLfloat *m))
+FOUNDATION_GL_FUNCTION(void, glMultTransposeMatrixdARB, (const GLdouble *m))
+#endif
+
+#ifdef GL_ARB_vertex_blend
+FOUNDATION_GL_FUNCTION(void, glWeightbvARB, (GLint size, const GLbyte *weights))
+FOUNDATION_GL_FUNCTION(void, glWeightsvARB, (GLint size, const GLshort *weights))
+FOUNDATION_GL_FUNCTION(void, glWeightivARB, (GLint size, const GLint *weights))
+FOUNDATION_GL_FUNCTION(void, glWeightfvARB, (GLint size, const GLfloat *weights))
+FOUNDATION_GL_FUNCTION(void, glWeightdvARB, (GLint size, const GLdouble *weights))
+FOUNDATION_GL_FUNCTION(void, glWeightubvARB, (GLint size, const GLubyte *weights))
+FOUNDATION_GL_FUNCTION(void, glWeightusvARB, (GLint size, const GLushort *weights))
+FOUNDATION_GL_FUNCTION(void, glWeightuivARB, (GLint size, const GLuint *weights))
+FOUNDATION_GL_FUNCTION(void, glWeightPointerARB, (GLint size, GLenum type, GLsizei stride, const void *pointer))
+FOUNDATION_GL_FUNCTION(void, glVertexBlendARB, (GLint count))
+#endif
+
+#ifdef GL_ARB_vertex_buffer_object
+FOUNDATION_GL_FUNCTION(void, glBindBufferARB, (GLenum target, GLuint buffer))
+FOUNDATION_GL_FUNCTION(void, glDeleteBuffersARB, (GLsizei n, const GLuint *buffers))
+FOUNDATION_GL_FUNCTION(void, glGenBuffersARB, (GLsizei n, GLuint *buffers))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsBufferARB, (GLuint buffer))
+FOUNDATION_GL_FUNCTION(void, glBufferDataARB, (GLenum target, GLsizeiptrARB size, const void *data, GLenum usage))
+FOUNDATION_GL_FUNCTION(void, glBufferSubDataARB, (GLenum target, GLintptrARB offset, GLsizeiptrARB size, const void *data))
+FOUNDATION_GL_FUNCTION(void, glGetBufferSubDataARB, (GLenum target, GLintptrARB offset, GLsizeiptrARB size, void *data))
+FOUNDATION_GL_FUNCTION(void *, glMapBufferARB, (GLenum target, GLenum access))
+FOUNDATION_GL_FUNCTION(GLboolean, glUnmapBufferARB, (GLenum target))
+FOUNDATION_GL_FUNCTION(void, glGetBufferParameterivARB, (GLenum target, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetBufferPointervARB, (GLenum target, GLenum pname, void **params))
+#endif
+
+#ifdef GL_ARB_vertex_program
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib1dARB, (GLuint index, GLdouble x))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib1dvARB, (GLuint index, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib1fARB, (GLuint index, GLfloat x))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib1fvARB, (GLuint index, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib1sARB, (GLuint index, GLshort x))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib1svARB, (GLuint index, const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib2dARB, (GLuint index, GLdouble x, GLdouble y))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib2dvARB, (GLuint index, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib2fARB, (GLuint index, GLfloat x, GLfloat y))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib2fvARB, (GLuint index, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib2sARB, (GLuint index, GLshort x, GLshort y))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib2svARB, (GLuint index, const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib3dARB, (GLuint index, GLdouble x, GLdouble y, GLdouble z))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib3dvARB, (GLuint index, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib3fARB, (GLuint index, GLfloat x, GLfloat y, GLfloat z))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib3fvARB, (GLuint index, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib3sARB, (GLuint index, GLshort x, GLshort y, GLshort z))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib3svARB, (GLuint index, const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4NbvARB, (GLuint index, const GLbyte *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4NivARB, (GLuint index, const GLint *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4NsvARB, (GLuint index, const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4NubARB, (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4NubvARB, (GLuint index, const GLubyte *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4NuivARB, (GLuint index, const GLuint *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4NusvARB, (GLuint index, const GLushort *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4bvARB, (GLuint index, const GLbyte *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4dARB, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4dvARB, (GLuint index, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4fARB, (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4fvARB, (GLuint index, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4ivARB, (GLuint index, const GLint *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4sARB, (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4svARB, (GLuint index, const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4ubvARB, (GLuint index, const GLubyte *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4uivARB, (GLuint index, const GLuint *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4usvARB, (GLuint index, const GLushort *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribPointerARB, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer))
+FOUNDATION_GL_FUNCTION(void, glEnableVertexAttribArrayARB, (GLuint index))
+FOUNDATION_GL_FUNCTION(void, glDisableVertexAttribArrayARB, (GLuint index))
+FOUNDATION_GL_FUNCTION(void, glGetVertexAttribdvARB, (GLuint index, GLenum pname, GLdouble *params))
+FOUNDATION_GL_FUNCTION(void, glGetVertexAttribfvARB, (GLuint index, GLenum pname, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetVertexAttribivARB, (GLuint index, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetVertexAttribPointervARB, (GLuint index, GLenum pname, void **pointer))
+#endif
+
+#ifdef GL_ARB_vertex_shader
+FOUNDATION_GL_FUNCTION(void, glBindAttribLocationARB, (GLhandleARB programObj, GLuint index, const GLcharARB *name))
+FOUNDATION_GL_FUNCTION(void, glGetActiveAttribARB, (GLhandleARB programObj, GLuint index, GLsizei maxLength, GLsizei *length, GLint *size, GLenum *type, GLcharARB *name))
+FOUNDATION_GL_FUNCTION(GLint, glGetAttribLocationARB, (GLhandleARB programObj, const GLcharARB *name))
+#endif
+
+#ifdef GL_ARB_window_pos
+FOUNDATION_GL_FUNCTION(void, glWindowPos2dARB, (GLdouble x, GLdouble y))
+FOUNDATION_GL_FUNCTION(void, glWindowPos2dvARB, (const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glWindowPos2fARB, (GLfloat x, GLfloat y))
+FOUNDATION_GL_FUNCTION(void, glWindowPos2fvARB, (const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glWindowPos2iARB, (GLint x, GLint y))
+FOUNDATION_GL_FUNCTION(void, glWindowPos2ivARB, (const GLint *v))
+FOUNDATION_GL_FUNCTION(void, glWindowPos2sARB, (GLshort x, GLshort y))
+FOUNDATION_GL_FUNCTION(void, glWindowPos2svARB, (const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glWindowPos3dARB, (GLdouble x, GLdouble y, GLdouble z))
+FOUNDATION_GL_FUNCTION(void, glWindowPos3dvARB, (const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glWindowPos3fARB, (GLfloat x, GLfloat y, GLfloat z))
+FOUNDATION_GL_FUNCTION(void, glWindowPos3fvARB, (const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glWindowPos3iARB, (GLint x, GLint y, GLint z))
+FOUNDATION_GL_FUNCTION(void, glWindowPos3ivARB, (const GLint *v))
+FOUNDATION_GL_FUNCTION(void, glWindowPos3sARB, (GLshort x, GLshort y, GLshort z))
+FOUNDATION_GL_FUNCTION(void, glWindowPos3svARB, (const GLshort *v))
+#endif
+
+#ifdef GL_OES_byte_coordinates
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord1bOES, (GLenum texture, GLbyte s))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord1bvOES, (GLenum texture, const GLbyte *coords))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord2bOES, (GLenum texture, GLbyte s, GLbyte t))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord2bvOES, (GLenum texture, const GLbyte *coords))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord3bOES, (GLenum texture, GLbyte s, GLbyte t, GLbyte r))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord3bvOES, (GLenum texture, const GLbyte *coords))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord4bOES, (GLenum texture, GLbyte s, GLbyte t, GLbyte r, GLbyte q))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord4bvOES, (GLenum texture, const GLbyte *coords))
+FOUNDATION_GL_FUNCTION(void, glTexCoord1bOES, (GLbyte s))
+FOUNDATION_GL_FUNCTION(void, glTexCoord1bvOES, (const GLbyte *coords))
+FOUNDATION_GL_FUNCTION(void, glTexCoord2bOES, (GLbyte s, GLbyte t))
+FOUNDATION_GL_FUNCTION(void, glTexCoord2bvOES, (const GLbyte *coords))
+FOUNDATION_GL_FUNCTION(void, glTexCoord3bOES, (GLbyte s, GLbyte t, GLbyte r))
+FOUNDATION_GL_FUNCTION(void, glTexCoord3bvOES, (const GLbyte *coords))
+FOUNDATION_GL_FUNCTION(void, glTexCoord4bOES, (GLbyte s, GLbyte t, GLbyte r, GLbyte q))
+FOUNDATION_GL_FUNCTION(void, glTexCoord4bvOES, (const GLbyte *coords))
+FOUNDATION_GL_FUNCTION(void, glVertex2bOES, (GLbyte x))
+FOUNDATION_GL_FUNCTION(void, glVertex2bvOES, (const GLbyte *coords))
+FOUNDATION_GL_FUNCTION(void, glVertex3bOES, (GLbyte x, GLbyte y))
+FOUNDATION_GL_FUNCTION(void, glVertex3bvOES, (const GLbyte *coords))
+FOUNDATION_GL_FUNCTION(void, glVertex4bOES, (GLbyte x, GLbyte y, GLbyte z))
+FOUNDATION_GL_FUNCTION(void, glVertex4bvOES, (const GLbyte *coords))
+#endif
+
+#ifdef GL_OES_fixed_point
+FOUNDATION_GL_FUNCTION(void, glAlphaFuncxOES, (GLenum func, GLfixed ref))
+FOUNDATION_GL_FUNCTION(void, glClearColorxOES, (GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha))
+FOUNDATION_GL_FUNCTION(void, glClearDepthxOES, (GLfixed depth))
+FOUNDATION_GL_FUNCTION(void, glClipPlanexOES, (GLenum plane, const GLfixed *equation))
+FOUNDATION_GL_FUNCTION(void, glColor4xOES, (GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha))
+FOUNDATION_GL_FUNCTION(void, glDepthRangexOES, (GLfixed n, GLfixed f))
+FOUNDATION_GL_FUNCTION(void, glFogxOES, (GLenum pname, GLfixed param))
+FOUNDATION_GL_FUNCTION(void, glFogxvOES, (GLenum pname, const GLfixed *param))
+FOUNDATION_GL_FUNCTION(void, glFrustumxOES, (GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed n, GLfixed f))
+FOUNDATION_GL_FUNCTION(void, glGetClipPlanexOES, (GLenum plane, GLfixed *equation))
+FOUNDATION_GL_FUNCTION(void, glGetFixedvOES, (GLenum pname, GLfixed *params))
+FOUNDATION_GL_FUNCTION(void, glGetTexEnvxvOES, (GLenum target, GLenum pname, GLfixed *params))
+FOUNDATION_GL_FUNCTION(void, glGetTexParameterxvOES, (GLenum target, GLenum pname, GLfixed *params))
+FOUNDATION_GL_FUNCTION(void, glLightModelxOES, (GLenum pname, GLfixed param))
+FOUNDATION_GL_FUNCTION(void, glLightModelxvOES, (GLenum pname, const GLfixed *param))
+FOUNDATION_GL_FUNCTION(void, glLightxOES, (GLenum light, GLenum pname, GLfixed param))
+FOUNDATION_GL_FUNCTION(void, glLightxvOES, (GLenum light, GLenum pname, const GLfixed *params))
+FOUNDATION_GL_FUNCTION(void, glLineWidthxOES, (GLfixed width))
+FOUNDATION_GL_FUNCTION(void, glLoadMatrixxOES, (const GLfixed *m))
+FOUNDATION_GL_FUNCTION(void, glMaterialxOES, (GLenum face, GLenum pname, GLfixed param))
+FOUNDATION_GL_FUNCTION(void, glMaterialxvOES, (GLenum face, GLenum pname, const GLfixed *param))
+FOUNDATION_GL_FUNCTION(void, glMultMatrixxOES, (const GLfixed *m))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord4xOES, (GLenum texture, GLfixed s, GLfixed t, GLfixed r, GLfixed q))
+FOUNDATION_GL_FUNCTION(void, glNormal3xOES, (GLfixed nx, GLfixed ny, GLfixed nz))
+FOUNDATION_GL_FUNCTION(void, glOrthoxOES, (GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed n, GLfixed f))
+FOUNDATION_GL_FUNCTION(void, glPointParameterxvOES, (GLenum pname, const GLfixed *params))
+FOUNDATION_GL_FUNCTION(void, glPointSizexOES, (GLfixed size))
+FOUNDATION_GL_FUNCTION(void, glPolygonOffsetxOES, (GLfixed factor, GLfixed units))
+FOUNDATION_GL_FUNCTION(void, glRotatexOES, (GLfixed angle, GLfixed x, GLfixed y, GLfixed z))
+FOUNDATION_GL_FUNCTION(void, glSampleCoverageOES, (GLfixed value, GLboolean invert))
+FOUNDATION_GL_FUNCTION(void, glScalexOES, (GLfixed x, GLfixed y, GLfixed z))
+FOUNDATION_GL_FUNCTION(void, glTexEnvxOES, (GLenum target, GLenum pname, GLfixed param))
+FOUNDATION_GL_FUNCTION(void, glTexEnvxvOES, (GLenum target, GLenum pname, const GLfixed *params))
+FOUNDATION_GL_FUNCTION(void, glTexParameterxOES, (GLenum target, GLenum pname, GLfixed param))
+FOUNDATION_GL_FUNCTION(void, glTexParameterxvOES, (GLenum target, GLenum pname, const GLfixed *params))
+FOUNDATION_GL_FUNCTION(void, glTranslatexOES, (GLfixed x, GLfixed y, GLfixed z))
+FOUNDATION_GL_FUNCTION(void, glAccumxOES, (GLenum op, GLfixed value))
+FOUNDATION_GL_FUNCTION(void, glBitmapxOES, (GLsizei width, GLsizei height, GLfixed xorig, GLfixed yorig, GLfixed xmove, GLfixed ymove, const GLubyte *bitmap))
+FOUNDATION_GL_FUNCTION(void, glBlendColorxOES, (GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha))
+FOUNDATION_GL_FUNCTION(void, glClearAccumxOES, (GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha))
+FOUNDATION_GL_FUNCTION(void, glColor3xOES, (GLfixed red, GLfixed green, GLfixed blue))
+FOUNDATION_GL_FUNCTION(void, glColor3xvOES, (const GLfixed *components))
+FOUNDATION_GL_FUNCTION(void, glColor4xvOES, (const GLfixed *components))
+FOUNDATION_GL_FUNCTION(void, glConvolutionParameterxOES, (GLenum target, GLenum pname, GLfixed param))
+FOUNDATION_GL_FUNCTION(void, glConvolutionParameterxvOES, (GLenum target, GLenum pname, const GLfixed *params))
+FOUNDATION_GL_FUNCTION(void, glEvalCoord1xOES, (GLfixed u))
+FOUNDATION_GL_FUNCTION(void, glEvalCoord1xvOES, (const GLfixed *coords))
+FOUNDATION_GL_FUNCTION(void, glEvalCoord2xOES, (GLfixed u, GLfixed v))
+FOUNDATION_GL_FUNCTION(void, glEvalCoord2xvOES, (const GLfixed *coords))
+FOUNDATION_GL_FUNCTION(void, glFeedbackBufferxOES, (GLsizei n, GLenum type, const GLfixed *buffer))
+FOUNDATION_GL_FUNCTION(void, glGetConvolutionParameterxvOES, (GLenum target, GLenum pname, GLfixed *params))
+FOUNDATION_GL_FUNCTION(void, glGetHistogramParameterxvOES, (GLenum target, GLenum pname, GLfixed *params))
+FOUNDATION_GL_FUNCTION(void, glGetLightxOES, (GLenum light, GLenum pname, GLfixed *params))
+FOUNDATION_GL_FUNCTION(void, glGetMapxvOES, (GLenum target, GLenum query, GLfixed *v))
+FOUNDATION_GL_FUNCTION(void, glGetMaterialxOES, (GLenum face, GLenum pname, GLfixed param))
+FOUNDATION_GL_FUNCTION(void, glGetPixelMapxv, (GLenum map, GLint size, GLfixed *values))
+FOUNDATION_GL_FUNCTION(void, glGetTexGenxvOES, (GLenum coord, GLenum pname, GLfixed *params))
+FOUNDATION_GL_FUNCTION(void, glGetTexLevelParameterxvOES, (GLenum target, GLint level, GLenum pname, GLfixed *params))
+FOUNDATION_GL_FUNCTION(void, glIndexxOES, (GLfixed component))
+FOUNDATION_GL_FUNCTION(void, glIndexxvOES, (const GLfixed *component))
+FOUNDATION_GL_FUNCTION(void, glLoadTransposeMatrixxOES, (const GLfixed *m))
+FOUNDATION_GL_FUNCTION(void, glMap1xOES, (GLenum target, GLfixed u1, GLfixed u2, GLint stride, GLint order, GLfixed points))
+FOUNDATION_GL_FUNCTION(void, glMap2xOES, (GLenum target, GLfixed u1, GLfixed u2, GLint ustride, GLint uorder, GLfixed v1, GLfixed v2, GLint vstride, GLint vorder, GLfixed points))
+FOUNDATION_GL_FUNCTION(void, glMapGrid1xOES, (GLint n, GLfixed u1, GLfixed u2))
+FOUNDATION_GL_FUNCTION(void, glMapGrid2xOES, (GLint n, GLfixed u1, GLfixed u2, GLfixed v1, GLfixed v2))
+FOUNDATION_GL_FUNCTION(void, glMultTransposeMatrixxOES, (const GLfixed *m))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord1xOES, (GLenum texture, GLfixed s))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord1xvOES, (GLenum texture, const GLfixed *coords))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord2xOES, (GLenum texture, GLfixed s, GLfixed t))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord2xvOES, (GLenum texture, const GLfixed *coords))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord3xOES, (GLenum texture, GLfixed s, GLfixed t, GLfixed r))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord3xvOES, (GLenum texture, const GLfixed *coords))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord4xvOES, (GLenum texture, const GLfixed *coords))
+FOUNDATION_GL_FUNCTION(void, glNormal3xvOES, (const GLfixed *coords))
+FOUNDATION_GL_FUNCTION(void, glPassThroughxOES, (GLfixed token))
+FOUNDATION_GL_FUNCTION(void, glPixelMapx, (GLenum map, GLint size, const GLfixed *values))
+FOUNDATION_GL_FUNCTION(void, glPixelStorex, (GLenum pname, GLfixed param))
+FOUNDATION_GL_FUNCTION(void, glPixelTransferxOES, (GLenum pname, GLfixed param))
+FOUNDATION_GL_FUNCTION(void, glPixelZoomxOES, (GLfixed xfactor, GLfixed yfactor))
+FOUNDATION_GL_FUNCTION(void, glPrioritizeTexturesxOES, (GLsizei n, const GLuint *textures, const GLfixed *priorities))
+FOUNDATION_GL_FUNCTION(void, glRasterPos2xOES, (GLfixed x, GLfixed y))
+FOUNDATION_GL_FUNCTION(void, glRasterPos2xvOES, (const GLfixed *coords))
+FOUNDATION_GL_FUNCTION(void, glRasterPos3xOES, (GLfixed x, GLfixed y, GLfixed z))
+FOUNDATION_GL_FUNCTION(void, glRasterPos3xvOES, (const GLfixed *coords))
+FOUNDATION_GL_FUNCTION(void, glRasterPos4xOES, (GLfixed x, GLfixed y, GLfixed z, GLfixed w))
+FOUNDATION_GL_FUNCTION(void, glRasterPos4xvOES, (const GLfixed *coords))
+FOUNDATION_GL_FUNCTION(void, glRectxOES, (GLfixed x1, GLfixed y1, GLfixed x2, GLfixed y2))
+FOUNDATION_GL_FUNCTION(void, glRectxvOES, (const GLfixed *v1, const GLfixed *v2))
+FOUNDATION_GL_FUNCTION(void, glTexCoord1xOES, (GLfixed s))
+FOUNDATION_GL_FUNCTION(void, glTexCoord1xvOES, (const GLfixed *coords))
+FOUNDATION_GL_FUNCTION(void, glTexCoord2xOES, (GLfixed s, GLfixed t))
+FOUNDATION_GL_FUNCTION(void, glTexCoord2xvOES, (const GLfixed *coords))
+FOUNDATION_GL_FUNCTION(void, glTexCoord3xOES, (GLfixed s, GLfixed t, GLfixed r))
+FOUNDATION_GL_FUNCTION(void, glTexCoord3xvOES, (const GLfixed *coords))
+FOUNDATION_GL_FUNCTION(void, glTexCoord4xOES, (GLfixed s, GLfixed t, GLfixed r, GLfixed q))
+FOUNDATION_GL_FUNCTION(void, glTexCoord4xvOES, (const GLfixed *coords))
+FOUNDATION_GL_FUNCTION(void, glTexGenxOES, (GLenum coord, GLenum pname, GLfixed param))
+FOUNDATION_GL_FUNCTION(void, glTexGenxvOES, (GLenum coord, GLenum pname, const GLfixed *params))
+FOUNDATION_GL_FUNCTION(void, glVertex2xOES, (GLfixed x))
+FOUNDATION_GL_FUNCTION(void, glVertex2xvOES, (const GLfixed *coords))
+FOUNDATION_GL_FUNCTION(void, glVertex3xOES, (GLfixed x, GLfixed y))
+FOUNDATION_GL_FUNCTION(void, glVertex3xvOES, (const GLfixed *coords))
+FOUNDATION_GL_FUNCTION(void, glVertex4xOES, (GLfixed x, GLfixed y, GLfixed z))
+FOUNDATION_GL_FUNCTION(void, glVertex4xvOES, (const GLfixed *coords))
+#endif
+
+#ifdef GL_OES_query_matrix
+FOUNDATION_GL_FUNCTION(GLbitfield, glQueryMatrixxOES, (GLfixed *mantissa, GLint *exponent))
+#endif
+
+#ifdef GL_OES_single_precision
+FOUNDATION_GL_FUNCTION(void, glClearDepthfOES, (GLclampf depth))
+FOUNDATION_GL_FUNCTION(void, glClipPlanefOES, (GLenum plane, const GLfloat *equation))
+FOUNDATION_GL_FUNCTION(void, glDepthRangefOES, (GLclampf n, GLclampf f))
+FOUNDATION_GL_FUNCTION(void, glFrustumfOES, (GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n, GLfloat f))
+FOUNDATION_GL_FUNCTION(void, glGetClipPlanefOES, (GLenum plane, GLfloat *equation))
+FOUNDATION_GL_FUNCTION(void, glOrthofOES, (GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n, GLfloat f))
+#endif
+
+#ifdef GL_3DFX_tbuffer
+FOUNDATION_GL_FUNCTION(void, glTbufferMask3DFX, (GLuint mask))
+#endif
+
+#ifdef GL_AMD_debug_output
+FOUNDATION_GL_FUNCTION(void, glDebugMessageEnableAMD, (GLenum category, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled))
+FOUNDATION_GL_FUNCTION(void, glDebugMessageInsertAMD, (GLenum category, GLenum severity, GLuint id, GLsizei length, const GLchar *buf))
+FOUNDATION_GL_FUNCTION(void, glDebugMessageCallbackAMD, (GLDEBUGPROCAMD callback, void *userParam))
+FOUNDATION_GL_FUNCTION(GLuint, glGetDebugMessageLogAMD, (GLuint count, GLsizei bufsize, GLenum *categories, GLuint *severities, GLuint *ids, GLsizei *lengths, GLchar *message))
+#endif
+
+#ifdef GL_AMD_draw_buffers_blend
+FOUNDATION_GL_FUNCTION(void, glBlendFuncIndexedAMD, (GLuint buf, GLenum src, GLenum dst))
+FOUNDATION_GL_FUNCTION(void, glBlendFuncSeparateIndexedAMD, (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha))
+FOUNDATION_GL_FUNCTION(void, glBlendEquationIndexedAMD, (GLuint buf, GLenum mode))
+FOUNDATION_GL_FUNCTION(void, glBlendEquationSeparateIndexedAMD, (GLuint buf, GLenum modeRGB, GLenum modeAlpha))
+#endif
+
+#ifdef GL_AMD_interleaved_elements
+FOUNDATION_GL_FUNCTION(void, glVertexAttribParameteriAMD, (GLuint index, GLenum pname, GLint param))
+#endif
+
+#ifdef GL_AMD_multi_draw_indirect
+FOUNDATION_GL_FUNCTION(void, glMultiDrawArraysIndirectAMD, (GLenum mode, const void *indirect, GLsizei primcount, GLsizei stride))
+FOUNDATION_GL_FUNCTION(void, glMultiDrawElementsIndirectAMD, (GLenum mode, GLenum type, const void *indirect, GLsizei primcount, GLsizei stride))
+#endif
+
+#ifdef GL_AMD_name_gen_delete
+FOUNDATION_GL_FUNCTION(void, glGenNamesAMD, (GLenum identifier, GLuint num, GLuint *names))
+FOUNDATION_GL_FUNCTION(void, glDeleteNamesAMD, (GLenum identifier, GLuint num, const GLuint *names))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsNameAMD, (GLenum identifier, GLuint name))
+#endif
+
+#ifdef GL_AMD_performance_monitor
+FOUNDATION_GL_FUNCTION(void, glGetPerfMonitorGroupsAMD, (GLint *numGroups, GLsizei groupsSize, GLuint *groups))
+FOUNDATION_GL_FUNCTION(void, glGetPerfMonitorCountersAMD, (GLuint group, GLint *numCounters, GLint *maxActiveCounters, GLsizei counterSize, GLuint *counters))
+FOUNDATION_GL_FUNCTION(void, glGetPerfMonitorGroupStringAMD, (GLuint group, GLsizei bufSize, GLsizei *length, GLchar *groupString))
+FOUNDATION_GL_FUNCTION(void, glGetPerfMonitorCounterStringAMD, (GLuint group, GLuint counter, GLsizei bufSize, GLsizei *length, GLchar *counterString))
+FOUNDATION_GL_FUNCTION(void, glGetPerfMonitorCounterInfoAMD, (GLuint group, GLuint counter, GLenum pname, void *data))
+FOUNDATION_GL_FUNCTION(void, glGenPerfMonitorsAMD, (GLsizei n, GLuint *monitors))
+FOUNDATION_GL_FUNCTION(void, glDeletePerfMonitorsAMD, (GLsizei n, GLuint *monitors))
+FOUNDATION_GL_FUNCTION(void, glSelectPerfMonitorCountersAMD, (GLuint monitor, GLboolean enable, GLuint group, GLint numCounters, GLuint *counterList))
+FOUNDATION_GL_FUNCTION(void, glBeginPerfMonitorAMD, (GLuint monitor))
+FOUNDATION_GL_FUNCTION(void, glEndPerfMonitorAMD, (GLuint monitor))
+FOUNDATION_GL_FUNCTION(void, glGetPerfMonitorCounterDataAMD, (GLuint monitor, GLenum pname, GLsizei dataSize, GLuint *data, GLint *bytesWritten))
+#endif
+
+#ifdef GL_AMD_sample_positions
+FOUNDATION_GL_FUNCTION(void, glSetMultisamplefvAMD, (GLenum pname, GLuint index, const GLfloat *val))
+#endif
+
+#ifdef GL_AMD_sparse_texture
+FOUNDATION_GL_FUNCTION(void, glTexStorageSparseAMD, (GLenum target, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLsizei layers, GLbitfield flags))
+FOUNDATION_GL_FUNCTION(void, glTextureStorageSparseAMD, (GLuint texture, GLenum target, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLsizei layers, GLbitfield flags))
+#endif
+
+#ifdef GL_AMD_stencil_operation_extended
+FOUNDATION_GL_FUNCTION(void, glStencilOpValueAMD, (GLenum face, GLuint value))
+#endif
+
+#ifdef GL_AMD_vertex_shader_tessellator
+FOUNDATION_GL_FUNCTION(void, glTessellationFactorAMD, (GLfloat factor))
+FOUNDATION_GL_FUNCTION(void, glTessellationModeAMD, (GLenum mode))
+#endif
+
+#ifdef GL_APPLE_element_array
+FOUNDATION_GL_FUNCTION(void, glElementPointerAPPLE, (GLenum type, const void *pointer))
+FOUNDATION_GL_FUNCTION(void, glDrawElementArrayAPPLE, (GLenum mode, GLint first, GLsizei count))
+FOUNDATION_GL_FUNCTION(void, glDrawRangeElementArrayAPPLE, (GLenum mode, GLuint start, GLuint end, GLint first, GLsizei count))
+FOUNDATION_GL_FUNCTION(void, glMultiDrawElementArrayAPPLE, (GLenum mode, const GLint *first, const GLsizei *count, GLsizei primcount))
+FOUNDATION_GL_FUNCTION(void, glMultiDrawRangeElementArrayAPPLE, (GLenum mode, GLuint start, GLuint end, const GLint *first, const GLsizei *count, GLsizei primcount))
+#endif
+
+#ifdef GL_APPLE_fence
+FOUNDATION_GL_FUNCTION(void, glGenFencesAPPLE, (GLsizei n, GLuint *fences))
+FOUNDATION_GL_FUNCTION(void, glDeleteFencesAPPLE, (GLsizei n, const GLuint *fences))
+FOUNDATION_GL_FUNCTION(void, glSetFenceAPPLE, (GLuint fence))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsFenceAPPLE, (GLuint fence))
+FOUNDATION_GL_FUNCTION(GLboolean, glTestFenceAPPLE, (GLuint fence))
+FOUNDATION_GL_FUNCTION(void, glFinishFenceAPPLE, (GLuint fence))
+FOUNDATION_GL_FUNCTION(GLboolean, glTestObjectAPPLE, (GLenum object, GLuint name))
+FOUNDATION_GL_FUNCTION(void, glFinishObjectAPPLE, (GLenum object, GLint name))
+#endif
+
+#ifdef GL_APPLE_flush_buffer_range
+FOUNDATION_GL_FUNCTION(void, glBufferParameteriAPPLE, (GLenum target, GLenum pname, GLint param))
+FOUNDATION_GL_FUNCTION(void, glFlushMappedBufferRangeAPPLE, (GLenum target, GLintptr offset, GLsizeiptr size))
+#endif
+
+#ifdef GL_APPLE_object_purgeable
+FOUNDATION_GL_FUNCTION(GLenum, glObjectPurgeableAPPLE, (GLenum objectType, GLuint name, GLenum option))
+FOUNDATION_GL_FUNCTION(GLenum, glObjectUnpurgeableAPPLE, (GLenum objectType, GLuint name, GLenum option))
+FOUNDATION_GL_FUNCTION(void, glGetObjectParameterivAPPLE, (GLenum objectType, GLuint name, GLenum pname, GLint *params))
+#endif
+
+#ifdef GL_APPLE_texture_range
+FOUNDATION_GL_FUNCTION(void, glTextureRangeAPPLE, (GLenum target, GLsizei length, const void *pointer))
+FOUNDATION_GL_FUNCTION(void, glGetTexParameterPointervAPPLE, (GLenum target, GLenum pname, void **params))
+#endif
+
+#ifdef GL_APPLE_vertex_array_object
+FOUNDATION_GL_FUNCTION(void, glBindVertexArrayAPPLE, (GLuint array))
+FOUNDATION_GL_FUNCTION(void, glDeleteVertexArraysAPPLE, (GLsizei n, const GLuint *arrays))
+FOUNDATION_GL_FUNCTION(void, glGenVertexArraysAPPLE, (GLsizei n, GLuint *arrays))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsVertexArrayAPPLE, (GLuint array))
+#endif
+
+#ifdef GL_APPLE_vertex_array_range
+FOUNDATION_GL_FUNCTION(void, glVertexArrayRangeAPPLE, (GLsizei length, void *pointer))
+FOUNDATION_GL_FUNCTION(void, glFlushVertexArrayRangeAPPLE, (GLsizei length, void *pointer))
+FOUNDATION_GL_FUNCTION(void, glVertexArrayParameteriAPPLE, (GLenum pname, GLint param))
+#endif
+
+#ifdef GL_APPLE_vertex_program_evaluators
+FOUNDATION_GL_FUNCTION(void, glEnableVertexAttribAPPLE, (GLuint index, GLenum pname))
+FOUNDATION_GL_FUNCTION(void, glDisableVertexAttribAPPLE, (GLuint index, GLenum pname))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsVertexAttribEnabledAPPLE, (GLuint index, GLenum pname))
+FOUNDATION_GL_FUNCTION(void, glMapVertexAttrib1dAPPLE, (GLuint index, GLuint size, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points))
+FOUNDATION_GL_FUNCTION(void, glMapVertexAttrib1fAPPLE, (GLuint index, GLuint size, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat *points))
+FOUNDATION_GL_FUNCTION(void, glMapVertexAttrib2dAPPLE, (GLuint index, GLuint size, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble *points))
+FOUNDATION_GL_FUNCTION(void, glMapVertexAttrib2fAPPLE, (GLuint index, GLuint size, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat *points))
+#endif
+
+#ifdef GL_ATI_draw_buffers
+FOUNDATION_GL_FUNCTION(void, glDrawBuffersATI, (GLsizei n, const GLenum *bufs))
+#endif
+
+#ifdef GL_ATI_element_array
+FOUNDATION_GL_FUNCTION(void, glElementPointerATI, (GLenum type, const void *pointer))
+FOUNDATION_GL_FUNCTION(void, glDrawElementArrayATI, (GLenum mode, GLsizei count))
+FOUNDATION_GL_FUNCTION(void, glDrawRangeElementArrayATI, (GLenum mode, GLuint start, GLuint end, GLsizei count))
+#endif
+
+#ifdef GL_ATI_envmap_bumpmap
+FOUNDATION_GL_FUNCTION(void, glTexBumpParameterivATI, (GLenum pname, const GLint *param))
+FOUNDATION_GL_FUNCTION(void, glTexBumpParameterfvATI, (GLenum pname, const GLfloat *param))
+FOUNDATION_GL_FUNCTION(void, glGetTexBumpParameterivATI, (GLenum pname, GLint *param))
+FOUNDATION_GL_FUNCTION(void, glGetTexBumpParameterfvATI, (GLenum pname, GLfloat *param))
+#endif
+
+#ifdef GL_ATI_fragment_shader
+FOUNDATION_GL_FUNCTION(GLuint, glGenFragmentShadersATI, (GLuint range))
+FOUNDATION_GL_FUNCTION(void, glBindFragmentShaderATI, (GLuint id))
+FOUNDATION_GL_FUNCTION(void, glDeleteFragmentShaderATI, (GLuint id))
+FOUNDATION_GL_FUNCTION(void, glBeginFragmentShaderATI, (void))
+FOUNDATION_GL_FUNCTION(void, glEndFragmentShaderATI, (void))
+FOUNDATION_GL_FUNCTION(void, glPassTexCoordATI, (GLuint dst, GLuint coord, GLenum swizzle))
+FOUNDATION_GL_FUNCTION(void, glSampleMapATI, (GLuint dst, GLuint interp, GLenum swizzle))
+FOUNDATION_GL_FUNCTION(void, glColorFragmentOp1ATI, (GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod))
+FOUNDATION_GL_FUNCTION(void, glColorFragmentOp2ATI, (GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod))
+FOUNDATION_GL_FUNCTION(void, glColorFragmentOp3ATI, (GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod))
+FOUNDATION_GL_FUNCTION(void, glAlphaFragmentOp1ATI, (GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod))
+FOUNDATION_GL_FUNCTION(void, glAlphaFragmentOp2ATI, (GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod))
+FOUNDATION_GL_FUNCTION(void, glAlphaFragmentOp3ATI, (GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod))
+FOUNDATION_GL_FUNCTION(void, glSetFragmentShaderConstantATI, (GLuint dst, const GLfloat *value))
+#endif
+
+#ifdef GL_ATI_map_object_buffer
+FOUNDATION_GL_FUNCTION(void *, glMapObjectBufferATI, (GLuint buffer))
+FOUNDATION_GL_FUNCTION(void, glUnmapObjectBufferATI, (GLuint buffer))
+#endif
+
+#ifdef GL_ATI_pn_triangles
+FOUNDATION_GL_FUNCTION(void, glPNTrianglesiATI, (GLenum pname, GLint param))
+FOUNDATION_GL_FUNCTION(void, glPNTrianglesfATI, (GLenum pname, GLfloat param))
+#endif
+
+#ifdef GL_ATI_separate_stencil
+FOUNDATION_GL_FUNCTION(void, glStencilOpSeparateATI, (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass))
+FOUNDATION_GL_FUNCTION(void, glStencilFuncSeparateATI, (GLenum frontfunc, GLenum backfunc, GLint ref, GLuint mask))
+#endif
+
+#ifdef GL_ATI_vertex_array_object
+FOUNDATION_GL_FUNCTION(GLuint, glNewObjectBufferATI, (GLsizei size, const void *pointer, GLenum usage))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsObjectBufferATI, (GLuint buffer))
+FOUNDATION_GL_FUNCTION(void, glUpdateObjectBufferATI, (GLuint buffer, GLuint offset, GLsizei size, const void *pointer, GLenum preserve))
+FOUNDATION_GL_FUNCTION(void, glGetObjectBufferfvATI, (GLuint buffer, GLenum pname, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetObjectBufferivATI, (GLuint buffer, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glFreeObjectBufferATI, (GLuint buffer))
+FOUNDATION_GL_FUNCTION(void, glArrayObjectATI, (GLenum array, GLint size, GLenum type, GLsizei stride, GLuint buffer, GLuint offset))
+FOUNDATION_GL_FUNCTION(void, glGetArrayObjectfvATI, (GLenum array, GLenum pname, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetArrayObjectivATI, (GLenum array, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glVariantArrayObjectATI, (GLuint id, GLenum type, GLsizei stride, GLuint buffer, GLuint offset))
+FOUNDATION_GL_FUNCTION(void, glGetVariantArrayObjectfvATI, (GLuint id, GLenum pname, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetVariantArrayObjectivATI, (GLuint id, GLenum pname, GLint *params))
+#endif
+
+#ifdef GL_ATI_vertex_attrib_array_object
+FOUNDATION_GL_FUNCTION(void, glVertexAttribArrayObjectATI, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, GLuint buffer, GLuint offset))
+FOUNDATION_GL_FUNCTION(void, glGetVertexAttribArrayObjectfvATI, (GLuint index, GLenum pname, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetVertexAttribArrayObjectivATI, (GLuint index, GLenum pname, GLint *params))
+#endif
+
+#ifdef GL_ATI_vertex_streams
+FOUNDATION_GL_FUNCTION(void, glVertexStream1sATI, (GLenum stream, GLshort x))
+FOUNDATION_GL_FUNCTION(void, glVertexStream1svATI, (GLenum stream, const GLshort *coords))
+FOUNDATION_GL_FUNCTION(void, glVertexStream1iATI, (GLenum stream, GLint x))
+FOUNDATION_GL_FUNCTION(void, glVertexStream1ivATI, (GLenum stream, const GLint *coords))
+FOUNDATION_GL_FUNCTION(void, glVertexStream1fATI, (GLenum stream, GLfloat x))
+FOUNDATION_GL_FUNCTION(void, glVertexStream1fvATI, (GLenum stream, const GLfloat *coords))
+FOUNDATION_GL_FUNCTION(void, glVertexStream1dATI, (GLenum stream, GLdouble x))
+FOUNDATION_GL_FUNCTION(void, glVertexStream1dvATI, (GLenum stream, const GLdouble *coords))
+FOUNDATION_GL_FUNCTION(void, glVertexStream2sATI, (GLenum stream, GLshort x, GLshort y))
+FOUNDATION_GL_FUNCTION(void, glVertexStream2svATI, (GLenum stream, const GLshort *coords))
+FOUNDATION_GL_FUNCTION(void, glVertexStream2iATI, (GLenum stream, GLint x, GLint y))
+FOUNDATION_GL_FUNCTION(void, glVertexStream2ivATI, (GLenum stream, const GLint *coords))
+FOUNDATION_GL_FUNCTION(void, glVertexStream2fATI, (GLenum stream, GLfloat x, GLfloat y))
+FOUNDATION_GL_FUNCTION(void, glVertexStream2fvATI, (GLenum stream, const GLfloat *coords))
+FOUNDATION_GL_FUNCTION(void, glVertexStream2dATI, (GLenum stream, GLdouble x, GLdouble y))
+FOUNDATION_GL_FUNCTION(void, glVertexStream2dvATI, (GLenum stream, const GLdouble *coords))
+FOUNDATION_GL_FUNCTION(void, glVertexStream3sATI, (GLenum stream, GLshort x, GLshort y, GLshort z))
+FOUNDATION_GL_FUNCTION(void, glVertexStream3svATI, (GLenum stream, const GLshort *coords))
+FOUNDATION_GL_FUNCTION(void, glVertexStream3iATI, (GLenum stream, GLint x, GLint y, GLint z))
+FOUNDATION_GL_FUNCTION(void, glVertexStream3ivATI, (GLenum stream, const GLint *coords))
+FOUNDATION_GL_FUNCTION(void, glVertexStream3fATI, (GLenum stream, GLfloat x, GLfloat y, GLfloat z))
+FOUNDATION_GL_FUNCTION(void, glVertexStream3fvATI, (GLenum stream, const GLfloat *coords))
+FOUNDATION_GL_FUNCTION(void, glVertexStream3dATI, (GLenum stream, GLdouble x, GLdouble y, GLdouble z))
+FOUNDATION_GL_FUNCTION(void, glVertexStream3dvATI, (GLenum stream, const GLdouble *coords))
+FOUNDATION_GL_FUNCTION(void, glVertexStream4sATI, (GLenum stream, GLshort x, GLshort y, GLshort z, GLshort w))
+FOUNDATION_GL_FUNCTION(void, glVertexStream4svATI, (GLenum stream, const GLshort *coords))
+FOUNDATION_GL_FUNCTION(void, glVertexStream4iATI, (GLenum stream, GLint x, GLint y, GLint z, GLint w))
+FOUNDATION_GL_FUNCTION(void, glVertexStream4ivATI, (GLenum stream, const GLint *coords))
+FOUNDATION_GL_FUNCTION(void, glVertexStream4fATI, (GLenum stream, GLfloat x, GLfloat y, GLfloat z, GLfloat w))
+FOUNDATION_GL_FUNCTION(void, glVertexStream4fvATI, (GLenum stream, const GLfloat *coords))
+FOUNDATION_GL_FUNCTION(void, glVertexStream4dATI, (GLenum stream, GLdouble x, GLdouble y, GLdouble z, GLdouble w))
+FOUNDATION_GL_FUNCTION(void, glVertexStream4dvATI, (GLenum stream, const GLdouble *coords))
+FOUNDATION_GL_FUNCTION(void, glNormalStream3bATI, (GLenum stream, GLbyte nx, GLbyte ny, GLbyte nz))
+FOUNDATION_GL_FUNCTION(void, glNormalStream3bvATI, (GLenum stream, const GLbyte *coords))
+FOUNDATION_GL_FUNCTION(void, glNormalStream3sATI, (GLenum stream, GLshort nx, GLshort ny, GLshort nz))
+FOUNDATION_GL_FUNCTION(void, glNormalStream3svATI, (GLenum stream, const GLshort *coords))
+FOUNDATION_GL_FUNCTION(void, glNormalStream3iATI, (GLenum stream, GLint nx, GLint ny, GLint nz))
+FOUNDATION_GL_FUNCTION(void, glNormalStream3ivATI, (GLenum stream, const GLint *coords))
+FOUNDATION_GL_FUNCTION(void, glNormalStream3fATI, (GLenum stream, GLfloat nx, GLfloat ny, GLfloat nz))
+FOUNDATION_GL_FUNCTION(void, glNormalStream3fvATI, (GLenum stream, const GLfloat *coords))
+FOUNDATION_GL_FUNCTION(void, glNormalStream3dATI, (GLenum stream, GLdouble nx, GLdouble ny, GLdouble nz))
+FOUNDATION_GL_FUNCTION(void, glNormalStream3dvATI, (GLenum stream, const GLdouble *coords))
+FOUNDATION_GL_FUNCTION(void, glClientActiveVertexStreamATI, (GLenum stream))
+FOUNDATION_GL_FUNCTION(void, glVertexBlendEnviATI, (GLenum pname, GLint param))
+FOUNDATION_GL_FUNCTION(void, glVertexBlendEnvfATI, (GLenum pname, GLfloat param))
+#endif
+
+#ifdef GL_EXT_bindable_uniform
+FOUNDATION_GL_FUNCTION(void, glUniformBufferEXT, (GLuint program, GLint location, GLuint buffer))
+FOUNDATION_GL_FUNCTION(GLint, glGetUniformBufferSizeEXT, (GLuint program, GLint location))
+FOUNDATION_GL_FUNCTION(GLintptr, glGetUniformOffsetEXT, (GLuint program, GLint location))
+#endif
+
+#ifdef GL_EXT_blend_color
+FOUNDATION_GL_FUNCTION(void, glBlendColorEXT, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha))
+#endif
+
+#ifdef GL_EXT_blend_equation_separate
+FOUNDATION_GL_FUNCTION(void, glBlendEquationSeparateEXT, (GLenum modeRGB, GLenum modeAlpha))
+#endif
+
+#ifdef GL_EXT_blend_func_separate
+FOUNDATION_GL_FUNCTION(void, glBlendFuncSeparateEXT, (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha))
+#endif
+
+#ifdef GL_EXT_blend_minmax
+FOUNDATION_GL_FUNCTION(void, glBlendEquationEXT, (GLenum mode))
+#endif
+
+#ifdef GL_EXT_color_subtable
+FOUNDATION_GL_FUNCTION(void, glColorSubTableEXT, (GLenum target, GLsizei start, GLsizei count, GLenum format, GLenum type, const void *data))
+FOUNDATION_GL_FUNCTION(void, glCopyColorSubTableEXT, (GLenum target, GLsizei start, GLint x, GLint y, GLsizei width))
+#endif
+
+#ifdef GL_EXT_compiled_vertex_array
+FOUNDATION_GL_FUNCTION(void, glLockArraysEXT, (GLint first, GLsizei count))
+FOUNDATION_GL_FUNCTION(void, glUnlockArraysEXT, (void))
+#endif
+
+#ifdef GL_EXT_convolution
+FOUNDATION_GL_FUNCTION(void, glConvolutionFilter1DEXT, (GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const void *image))
+FOUNDATION_GL_FUNCTION(void, glConvolutionFilter2DEXT, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *image))
+FOUNDATION_GL_FUNCTION(void, glConvolutionParameterfEXT, (GLenum target, GLenum pname, GLfloat params))
+FOUNDATION_GL_FUNCTION(void, glConvolutionParameterfvEXT, (GLenum target, GLenum pname, const GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glConvolutionParameteriEXT, (GLenum target, GLenum pname, GLint params))
+FOUNDATION_GL_FUNCTION(void, glConvolutionParameterivEXT, (GLenum target, GLenum pname, const GLint *params))
+FOUNDATION_GL_FUNCTION(void, glCopyConvolutionFilter1DEXT, (GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width))
+FOUNDATION_GL_FUNCTION(void, glCopyConvolutionFilter2DEXT, (GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height))
+FOUNDATION_GL_FUNCTION(void, glGetConvolutionFilterEXT, (GLenum target, GLenum format, GLenum type, void *image))
+FOUNDATION_GL_FUNCTION(void, glGetConvolutionParameterfvEXT, (GLenum target, GLenum pname, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetConvolutionParameterivEXT, (GLenum target, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetSeparableFilterEXT, (GLenum target, GLenum format, GLenum type, void *row, void *column, void *span))
+FOUNDATION_GL_FUNCTION(void, glSeparableFilter2DEXT, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *row, const void *column))
+#endif
+
+#ifdef GL_EXT_coordinate_frame
+FOUNDATION_GL_FUNCTION(void, glTangent3bEXT, (GLbyte tx, GLbyte ty, GLbyte tz))
+FOUNDATION_GL_FUNCTION(void, glTangent3bvEXT, (const GLbyte *v))
+FOUNDATION_GL_FUNCTION(void, glTangent3dEXT, (GLdouble tx, GLdouble ty, GLdouble tz))
+FOUNDATION_GL_FUNCTION(void, glTangent3dvEXT, (const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glTangent3fEXT, (GLfloat tx, GLfloat ty, GLfloat tz))
+FOUNDATION_GL_FUNCTION(void, glTangent3fvEXT, (const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glTangent3iEXT, (GLint tx, GLint ty, GLint tz))
+FOUNDATION_GL_FUNCTION(void, glTangent3ivEXT, (const GLint *v))
+FOUNDATION_GL_FUNCTION(void, glTangent3sEXT, (GLshort tx, GLshort ty, GLshort tz))
+FOUNDATION_GL_FUNCTION(void, glTangent3svEXT, (const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glBinormal3bEXT, (GLbyte bx, GLbyte by, GLbyte bz))
+FOUNDATION_GL_FUNCTION(void, glBinormal3bvEXT, (const GLbyte *v))
+FOUNDATION_GL_FUNCTION(void, glBinormal3dEXT, (GLdouble bx, GLdouble by, GLdouble bz))
+FOUNDATION_GL_FUNCTION(void, glBinormal3dvEXT, (const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glBinormal3fEXT, (GLfloat bx, GLfloat by, GLfloat bz))
+FOUNDATION_GL_FUNCTION(void, glBinormal3fvEXT, (const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glBinormal3iEXT, (GLint bx, GLint by, GLint bz))
+FOUNDATION_GL_FUNCTION(void, glBinormal3ivEXT, (const GLint *v))
+FOUNDATION_GL_FUNCTION(void, glBinormal3sEXT, (GLshort bx, GLshort by, GLshort bz))
+FOUNDATION_GL_FUNCTION(void, glBinormal3svEXT, (const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glTangentPointerEXT, (GLenum type, GLsizei stride, const void *pointer))
+FOUNDATION_GL_FUNCTION(void, glBinormalPointerEXT, (GLenum type, GLsizei stride, const void *pointer))
+#endif
+
+#ifdef GL_EXT_copy_texture
+FOUNDATION_GL_FUNCTION(void, glCopyTexImage1DEXT, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border))
+FOUNDATION_GL_FUNCTION(void, glCopyTexImage2DEXT, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border))
+FOUNDATION_GL_FUNCTION(void, glCopyTexSubImage1DEXT, (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width))
+FOUNDATION_GL_FUNCTION(void, glCopyTexSubImage2DEXT, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height))
+FOUNDATION_GL_FUNCTION(void, glCopyTexSubImage3DEXT, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height))
+#endif
+
+#ifdef GL_EXT_cull_vertex
+FOUNDATION_GL_FUNCTION(void, glCullParameterdvEXT, (GLenum pname, GLdouble *params))
+FOUNDATION_GL_FUNCTION(void, glCullParameterfvEXT, (GLenum pname, GLfloat *params))
+#endif
+
+#ifdef GL_EXT_depth_bounds_test
+FOUNDATION_GL_FUNCTION(void, glDepthBoundsEXT, (GLclampd zmin, GLclampd zmax))
+#endif
+
+#ifdef GL_EXT_direct_state_access
+FOUNDATION_GL_FUNCTION(void, glMatrixLoadfEXT, (GLenum mode, const GLfloat *m))
+FOUNDATION_GL_FUNCTION(void, glMatrixLoaddEXT, (GLenum mode, const GLdouble *m))
+FOUNDATION_GL_FUNCTION(void, glMatrixMultfEXT, (GLenum mode, const GLfloat *m))
+FOUNDATION_GL_FUNCTION(void, glMatrixMultdEXT, (GLenum mode, const GLdouble *m))
+FOUNDATION_GL_FUNCTION(void, glMatrixLoadIdentityEXT, (GLenum mode))
+FOUNDATION_GL_FUNCTION(void, glMatrixRotatefEXT, (GLenum mode, GLfloat angle, GLfloat x, GLfloat y, GLfloat z))
+FOUNDATION_GL_FUNCTION(void, glMatrixRotatedEXT, (GLenum mode, GLdouble angle, GLdouble x, GLdouble y, GLdouble z))
+FOUNDATION_GL_FUNCTION(void, glMatrixScalefEXT, (GLenum mode, GLfloat x, GLfloat y, GLfloat z))
+FOUNDATION_GL_FUNCTION(void, glMatrixScaledEXT, (GLenum mode, GLdouble x, GLdouble y, GLdouble z))
+FOUNDATION_GL_FUNCTION(void, glMatrixTranslatefEXT, (GLenum mode, GLfloat x, GLfloat y, GLfloat z))
+FOUNDATION_GL_FUNCTION(void, glMatrixTranslatedEXT, (GLenum mode, GLdouble x, GLdouble y, GLdouble z))
+FOUNDATION_GL_FUNCTION(void, glMatrixFrustumEXT, (GLenum mode, GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar))
+FOUNDATION_GL_FUNCTION(void, glMatrixOrthoEXT, (GLenum mode, GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar))
+FOUNDATION_GL_FUNCTION(void, glMatrixPopEXT, (GLenum mode))
+FOUNDATION_GL_FUNCTION(void, glMatrixPushEXT, (GLenum mode))
+FOUNDATION_GL_FUNCTION(void, glClientAttribDefaultEXT, (GLbitfield mask))
+FOUNDATION_GL_FUNCTION(void, glPushClientAttribDefaultEXT, (GLbitfield mask))
+FOUNDATION_GL_FUNCTION(void, glTextureParameterfEXT, (GLuint texture, GLenum target, GLenum pname, GLfloat param))
+FOUNDATION_GL_FUNCTION(void, glTextureParameterfvEXT, (GLuint texture, GLenum target, GLenum pname, const GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glTextureParameteriEXT, (GLuint texture, GLenum target, GLenum pname, GLint param))
+FOUNDATION_GL_FUNCTION(void, glTextureParameterivEXT, (GLuint texture, GLenum target, GLenum pname, const GLint *params))
+FOUNDATION_GL_FUNCTION(void, glTextureImage1DEXT, (GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels))
+FOUNDATION_GL_FUNCTION(void, glTextureImage2DEXT, (GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels))
+FOUNDATION_GL_FUNCTION(void, glTextureSubImage1DEXT, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels))
+FOUNDATION_GL_FUNCTION(void, glTextureSubImage2DEXT, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels))
+FOUNDATION_GL_FUNCTION(void, glCopyTextureImage1DEXT, (GLuint texture, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border))
+FOUNDATION_GL_FUNCTION(void, glCopyTextureImage2DEXT, (GLuint texture, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border))
+FOUNDATION_GL_FUNCTION(void, glCopyTextureSubImage1DEXT, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width))
+FOUNDATION_GL_FUNCTION(void, glCopyTextureSubImage2DEXT, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height))
+FOUNDATION_GL_FUNCTION(void, glGetTextureImageEXT, (GLuint texture, GLenum target, GLint level, GLenum format, GLenum type, void *pixels))
+FOUNDATION_GL_FUNCTION(void, glGetTextureParameterfvEXT, (GLuint texture, GLenum target, GLenum pname, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetTextureParameterivEXT, (GLuint texture, GLenum target, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetTextureLevelParameterfvEXT, (GLuint texture, GLenum target, GLint level, GLenum pname, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetTextureLevelParameterivEXT, (GLuint texture, GLenum target, GLint level, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glTextureImage3DEXT, (GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels))
+FOUNDATION_GL_FUNCTION(void, glTextureSubImage3DEXT, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels))
+FOUNDATION_GL_FUNCTION(void, glCopyTextureSubImage3DEXT, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height))
+FOUNDATION_GL_FUNCTION(void, glBindMultiTextureEXT, (GLenum texunit, GLenum target, GLuint texture))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoordPointerEXT, (GLenum texunit, GLint size, GLenum type, GLsizei stride, const void *pointer))
+FOUNDATION_GL_FUNCTION(void, glMultiTexEnvfEXT, (GLenum texunit, GLenum target, GLenum pname, GLfloat param))
+FOUNDATION_GL_FUNCTION(void, glMultiTexEnvfvEXT, (GLenum texunit, GLenum target, GLenum pname, const GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glMultiTexEnviEXT, (GLenum texunit, GLenum target, GLenum pname, GLint param))
+FOUNDATION_GL_FUNCTION(void, glMultiTexEnvivEXT, (GLenum texunit, GLenum target, GLenum pname, const GLint *params))
+FOUNDATION_GL_FUNCTION(void, glMultiTexGendEXT, (GLenum texunit, GLenum coord, GLenum pname, GLdouble param))
+FOUNDATION_GL_FUNCTION(void, glMultiTexGendvEXT, (GLenum texunit, GLenum coord, GLenum pname, const GLdouble *params))
+FOUNDATION_GL_FUNCTION(void, glMultiTexGenfEXT, (GLenum texunit, GLenum coord, GLenum pname, GLfloat param))
+FOUNDATION_GL_FUNCTION(void, glMultiTexGenfvEXT, (GLenum texunit, GLenum coord, GLenum pname, const GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glMultiTexGeniEXT, (GLenum texunit, GLenum coord, GLenum pname, GLint param))
+FOUNDATION_GL_FUNCTION(void, glMultiTexGenivEXT, (GLenum texunit, GLenum coord, GLenum pname, const GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetMultiTexEnvfvEXT, (GLenum texunit, GLenum target, GLenum pname, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetMultiTexEnvivEXT, (GLenum texunit, GLenum target, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetMultiTexGendvEXT, (GLenum texunit, GLenum coord, GLenum pname, GLdouble *params))
+FOUNDATION_GL_FUNCTION(void, glGetMultiTexGenfvEXT, (GLenum texunit, GLenum coord, GLenum pname, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetMultiTexGenivEXT, (GLenum texunit, GLenum coord, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glMultiTexParameteriEXT, (GLenum texunit, GLenum target, GLenum pname, GLint param))
+FOUNDATION_GL_FUNCTION(void, glMultiTexParameterivEXT, (GLenum texunit, GLenum target, GLenum pname, const GLint *params))
+FOUNDATION_GL_FUNCTION(void, glMultiTexParameterfEXT, (GLenum texunit, GLenum target, GLenum pname, GLfloat param))
+FOUNDATION_GL_FUNCTION(void, glMultiTexParameterfvEXT, (GLenum texunit, GLenum target, GLenum pname, const GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glMultiTexImage1DEXT, (GLenum texunit, GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels))
+FOUNDATION_GL_FUNCTION(void, glMultiTexImage2DEXT, (GLenum texunit, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels))
+FOUNDATION_GL_FUNCTION(void, glMultiTexSubImage1DEXT, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels))
+FOUNDATION_GL_FUNCTION(void, glMultiTexSubImage2DEXT, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels))
+FOUNDATION_GL_FUNCTION(void, glCopyMultiTexImage1DEXT, (GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border))
+FOUNDATION_GL_FUNCTION(void, glCopyMultiTexImage2DEXT, (GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border))
+FOUNDATION_GL_FUNCTION(void, glCopyMultiTexSubImage1DEXT, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width))
+FOUNDATION_GL_FUNCTION(void, glCopyMultiTexSubImage2DEXT, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height))
+FOUNDATION_GL_FUNCTION(void, glGetMultiTexImageEXT, (GLenum texunit, GLenum target, GLint level, GLenum format, GLenum type, void *pixels))
+FOUNDATION_GL_FUNCTION(void, glGetMultiTexParameterfvEXT, (GLenum texunit, GLenum target, GLenum pname, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetMultiTexParameterivEXT, (GLenum texunit, GLenum target, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetMultiTexLevelParameterfvEXT, (GLenum texunit, GLenum target, GLint level, GLenum pname, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetMultiTexLevelParameterivEXT, (GLenum texunit, GLenum target, GLint level, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glMultiTexImage3DEXT, (GLenum texunit, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels))
+FOUNDATION_GL_FUNCTION(void, glMultiTexSubImage3DEXT, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels))
+FOUNDATION_GL_FUNCTION(void, glCopyMultiTexSubImage3DEXT, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height))
+FOUNDATION_GL_FUNCTION(void, glEnableClientStateIndexedEXT, (GLenum array, GLuint index))
+FOUNDATION_GL_FUNCTION(void, glDisableClientStateIndexedEXT, (GLenum array, GLuint index))
+FOUNDATION_GL_FUNCTION(void, glGetFloatIndexedvEXT, (GLenum target, GLuint index, GLfloat *data))
+FOUNDATION_GL_FUNCTION(void, glGetDoubleIndexedvEXT, (GLenum target, GLuint index, GLdouble *data))
+FOUNDATION_GL_FUNCTION(void, glGetPointerIndexedvEXT, (GLenum target, GLuint index, void **data))
+FOUNDATION_GL_FUNCTION(void, glEnableIndexedEXT, (GLenum target, GLuint index))
+FOUNDATION_GL_FUNCTION(void, glDisableIndexedEXT, (GLenum target, GLuint index))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsEnabledIndexedEXT, (GLenum target, GLuint index))
+FOUNDATION_GL_FUNCTION(void, glGetIntegerIndexedvEXT, (GLenum target, GLuint index, GLint *data))
+FOUNDATION_GL_FUNCTION(void, glGetBooleanIndexedvEXT, (GLenum target, GLuint index, GLboolean *data))
+FOUNDATION_GL_FUNCTION(void, glCompressedTextureImage3DEXT, (GLuint texture, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *bits))
+FOUNDATION_GL_FUNCTION(void, glCompressedTextureImage2DEXT, (GLuint texture, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *bits))
+FOUNDATION_GL_FUNCTION(void, glCompressedTextureImage1DEXT, (GLuint texture, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *bits))
+FOUNDATION_GL_FUNCTION(void, glCompressedTextureSubImage3DEXT, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *bits))
+FOUNDATION_GL_FUNCTION(void, glCompressedTextureSubImage2DEXT, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *bits))
+FOUNDATION_GL_FUNCTION(void, glCompressedTextureSubImage1DEXT, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *bits))
+FOUNDATION_GL_FUNCTION(void, glGetCompressedTextureImageEXT, (GLuint texture, GLenum target, GLint lod, void *img))
+FOUNDATION_GL_FUNCTION(void, glCompressedMultiTexImage3DEXT, (GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *bits))
+FOUNDATION_GL_FUNCTION(void, glCompressedMultiTexImage2DEXT, (GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *bits))
+FOUNDATION_GL_FUNCTION(void, glCompressedMultiTexImage1DEXT, (GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *bits))
+FOUNDATION_GL_FUNCTION(void, glCompressedMultiTexSubImage3DEXT, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *bits))
+FOUNDATION_GL_FUNCTION(void, glCompressedMultiTexSubImage2DEXT, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *bits))
+FOUNDATION_GL_FUNCTION(void, glCompressedMultiTexSubImage1DEXT, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *bits))
+FOUNDATION_GL_FUNCTION(void, glGetCompressedMultiTexImageEXT, (GLenum texunit, GLenum target, GLint lod, void *img))
+FOUNDATION_GL_FUNCTION(void, glMatrixLoadTransposefEXT, (GLenum mode, const GLfloat *m))
+FOUNDATION_GL_FUNCTION(void, glMatrixLoadTransposedEXT, (GLenum mode, const GLdouble *m))
+FOUNDATION_GL_FUNCTION(void, glMatrixMultTransposefEXT, (GLenum mode, const GLfloat *m))
+FOUNDATION_GL_FUNCTION(void, glMatrixMultTransposedEXT, (GLenum mode, const GLdouble *m))
+FOUNDATION_GL_FUNCTION(void, glNamedBufferDataEXT, (GLuint buffer, GLsizeiptr size, const void *data, GLenum usage))
+FOUNDATION_GL_FUNCTION(void, glNamedBufferSubDataEXT, (GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data))
+FOUNDATION_GL_FUNCTION(void *, glMapNamedBufferEXT, (GLuint buffer, GLenum access))
+FOUNDATION_GL_FUNCTION(GLboolean, glUnmapNamedBufferEXT, (GLuint buffer))
+FOUNDATION_GL_FUNCTION(void, glGetNamedBufferParameterivEXT, (GLuint buffer, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetNamedBufferPointervEXT, (GLuint buffer, GLenum pname, void **params))
+FOUNDATION_GL_FUNCTION(void, glGetNamedBufferSubDataEXT, (GLuint buffer, GLintptr offset, GLsizeiptr size, void *data))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform1fEXT, (GLuint program, GLint location, GLfloat v0))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform2fEXT, (GLuint program, GLint location, GLfloat v0, GLfloat v1))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform3fEXT, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform4fEXT, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform1iEXT, (GLuint program, GLint location, GLint v0))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform2iEXT, (GLuint program, GLint location, GLint v0, GLint v1))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform3iEXT, (GLuint program, GLint location, GLint v0, GLint v1, GLint v2))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform4iEXT, (GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform1fvEXT, (GLuint program, GLint location, GLsizei count, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform2fvEXT, (GLuint program, GLint location, GLsizei count, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform3fvEXT, (GLuint program, GLint location, GLsizei count, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform4fvEXT, (GLuint program, GLint location, GLsizei count, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform1ivEXT, (GLuint program, GLint location, GLsizei count, const GLint *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform2ivEXT, (GLuint program, GLint location, GLsizei count, const GLint *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform3ivEXT, (GLuint program, GLint location, GLsizei count, const GLint *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform4ivEXT, (GLuint program, GLint location, GLsizei count, const GLint *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix2fvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix3fvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix4fvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix2x3fvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix3x2fvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix2x4fvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix4x2fvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix3x4fvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix4x3fvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glTextureBufferEXT, (GLuint texture, GLenum target, GLenum internalformat, GLuint buffer))
+FOUNDATION_GL_FUNCTION(void, glMultiTexBufferEXT, (GLenum texunit, GLenum target, GLenum internalformat, GLuint buffer))
+FOUNDATION_GL_FUNCTION(void, glTextureParameterIivEXT, (GLuint texture, GLenum target, GLenum pname, const GLint *params))
+FOUNDATION_GL_FUNCTION(void, glTextureParameterIuivEXT, (GLuint texture, GLenum target, GLenum pname, const GLuint *params))
+FOUNDATION_GL_FUNCTION(void, glGetTextureParameterIivEXT, (GLuint texture, GLenum target, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetTextureParameterIuivEXT, (GLuint texture, GLenum target, GLenum pname, GLuint *params))
+FOUNDATION_GL_FUNCTION(void, glMultiTexParameterIivEXT, (GLenum texunit, GLenum target, GLenum pname, const GLint *params))
+FOUNDATION_GL_FUNCTION(void, glMultiTexParameterIuivEXT, (GLenum texunit, GLenum target, GLenum pname, const GLuint *params))
+FOUNDATION_GL_FUNCTION(void, glGetMultiTexParameterIivEXT, (GLenum texunit, GLenum target, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetMultiTexParameterIuivEXT, (GLenum texunit, GLenum target, GLenum pname, GLuint *params))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform1uiEXT, (GLuint program, GLint location, GLuint v0))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform2uiEXT, (GLuint program, GLint location, GLuint v0, GLuint v1))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform3uiEXT, (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform4uiEXT, (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform1uivEXT, (GLuint program, GLint location, GLsizei count, const GLuint *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform2uivEXT, (GLuint program, GLint location, GLsizei count, const GLuint *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform3uivEXT, (GLuint program, GLint location, GLsizei count, const GLuint *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform4uivEXT, (GLuint program, GLint location, GLsizei count, const GLuint *value))
+FOUNDATION_GL_FUNCTION(void, glNamedProgramLocalParameters4fvEXT, (GLuint program, GLenum target, GLuint index, GLsizei count, const GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glNamedProgramLocalParameterI4iEXT, (GLuint program, GLenum target, GLuint index, GLint x, GLint y, GLint z, GLint w))
+FOUNDATION_GL_FUNCTION(void, glNamedProgramLocalParameterI4ivEXT, (GLuint program, GLenum target, GLuint index, const GLint *params))
+FOUNDATION_GL_FUNCTION(void, glNamedProgramLocalParametersI4ivEXT, (GLuint program, GLenum target, GLuint index, GLsizei count, const GLint *params))
+FOUNDATION_GL_FUNCTION(void, glNamedProgramLocalParameterI4uiEXT, (GLuint program, GLenum target, GLuint index, GLuint x, GLuint y, GLuint z, GLuint w))
+FOUNDATION_GL_FUNCTION(void, glNamedProgramLocalParameterI4uivEXT, (GLuint program, GLenum target, GLuint index, const GLuint *params))
+FOUNDATION_GL_FUNCTION(void, glNamedProgramLocalParametersI4uivEXT, (GLuint program, GLenum target, GLuint index, GLsizei count, const GLuint *params))
+FOUNDATION_GL_FUNCTION(void, glGetNamedProgramLocalParameterIivEXT, (GLuint program, GLenum target, GLuint index, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetNamedProgramLocalParameterIuivEXT, (GLuint program, GLenum target, GLuint index, GLuint *params))
+FOUNDATION_GL_FUNCTION(void, glEnableClientStateiEXT, (GLenum array, GLuint index))
+FOUNDATION_GL_FUNCTION(void, glDisableClientStateiEXT, (GLenum array, GLuint index))
+FOUNDATION_GL_FUNCTION(void, glGetFloati_vEXT, (GLenum pname, GLuint index, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetDoublei_vEXT, (GLenum pname, GLuint index, GLdouble *params))
+FOUNDATION_GL_FUNCTION(void, glGetPointeri_vEXT, (GLenum pname, GLuint index, void **params))
+FOUNDATION_GL_FUNCTION(void, glNamedProgramStringEXT, (GLuint program, GLenum target, GLenum format, GLsizei len, const void *string))
+FOUNDATION_GL_FUNCTION(void, glNamedProgramLocalParameter4dEXT, (GLuint program, GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w))
+FOUNDATION_GL_FUNCTION(void, glNamedProgramLocalParameter4dvEXT, (GLuint program, GLenum target, GLuint index, const GLdouble *params))
+FOUNDATION_GL_FUNCTION(void, glNamedProgramLocalParameter4fEXT, (GLuint program, GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w))
+FOUNDATION_GL_FUNCTION(void, glNamedProgramLocalParameter4fvEXT, (GLuint program, GLenum target, GLuint index, const GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetNamedProgramLocalParameterdvEXT, (GLuint program, GLenum target, GLuint index, GLdouble *params))
+FOUNDATION_GL_FUNCTION(void, glGetNamedProgramLocalParameterfvEXT, (GLuint program, GLenum target, GLuint index, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetNamedProgramivEXT, (GLuint program, GLenum target, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetNamedProgramStringEXT, (GLuint program, GLenum target, GLenum pname, void *string))
+FOUNDATION_GL_FUNCTION(void, glNamedRenderbufferStorageEXT, (GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height))
+FOUNDATION_GL_FUNCTION(void, glGetNamedRenderbufferParameterivEXT, (GLuint renderbuffer, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glNamedRenderbufferStorageMultisampleEXT, (GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height))
+FOUNDATION_GL_FUNCTION(void, glNamedRenderbufferStorageMultisampleCoverageEXT, (GLuint renderbuffer, GLsizei coverageSamples, GLsizei colorSamples, GLenum internalformat, GLsizei width, GLsizei height))
+FOUNDATION_GL_FUNCTION(GLenum, glCheckNamedFramebufferStatusEXT, (GLuint framebuffer, GLenum target))
+FOUNDATION_GL_FUNCTION(void, glNamedFramebufferTexture1DEXT, (GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level))
+FOUNDATION_GL_FUNCTION(void, glNamedFramebufferTexture2DEXT, (GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level))
+FOUNDATION_GL_FUNCTION(void, glNamedFramebufferTexture3DEXT, (GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset))
+FOUNDATION_GL_FUNCTION(void, glNamedFramebufferRenderbufferEXT, (GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer))
+FOUNDATION_GL_FUNCTION(void, glGetNamedFramebufferAttachmentParameterivEXT, (GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGenerateTextureMipmapEXT, (GLuint texture, GLenum target))
+FOUNDATION_GL_FUNCTION(void, glGenerateMultiTexMipmapEXT, (GLenum texunit, GLenum target))
+FOUNDATION_GL_FUNCTION(void, glFramebufferDrawBufferEXT, (GLuint framebuffer, GLenum mode))
+FOUNDATION_GL_FUNCTION(void, glFramebufferDrawBuffersEXT, (GLuint framebuffer, GLsizei n, const GLenum *bufs))
+FOUNDATION_GL_FUNCTION(void, glFramebufferReadBufferEXT, (GLuint framebuffer, GLenum mode))
+FOUNDATION_GL_FUNCTION(void, glGetFramebufferParameterivEXT, (GLuint framebuffer, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glNamedCopyBufferSubDataEXT, (GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size))
+FOUNDATION_GL_FUNCTION(void, glNamedFramebufferTextureEXT, (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level))
+FOUNDATION_GL_FUNCTION(void, glNamedFramebufferTextureLayerEXT, (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer))
+FOUNDATION_GL_FUNCTION(void, glNamedFramebufferTextureFaceEXT, (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLenum face))
+FOUNDATION_GL_FUNCTION(void, glTextureRenderbufferEXT, (GLuint texture, GLenum target, GLuint renderbuffer))
+FOUNDATION_GL_FUNCTION(void, glMultiTexRenderbufferEXT, (GLenum texunit, GLenum target, GLuint renderbuffer))
+FOUNDATION_GL_FUNCTION(void, glVertexArrayVertexOffsetEXT, (GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset))
+FOUNDATION_GL_FUNCTION(void, glVertexArrayColorOffsetEXT, (GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset))
+FOUNDATION_GL_FUNCTION(void, glVertexArrayEdgeFlagOffsetEXT, (GLuint vaobj, GLuint buffer, GLsizei stride, GLintptr offset))
+FOUNDATION_GL_FUNCTION(void, glVertexArrayIndexOffsetEXT, (GLuint vaobj, GLuint buffer, GLenum type, GLsizei stride, GLintptr offset))
+FOUNDATION_GL_FUNCTION(void, glVertexArrayNormalOffsetEXT, (GLuint vaobj, GLuint buffer, GLenum type, GLsizei stride, GLintptr offset))
+FOUNDATION_GL_FUNCTION(void, glVertexArrayTexCoordOffsetEXT, (GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset))
+FOUNDATION_GL_FUNCTION(void, glVertexArrayMultiTexCoordOffsetEXT, (GLuint vaobj, GLuint buffer, GLenum texunit, GLint size, GLenum type, GLsizei stride, GLintptr offset))
+FOUNDATION_GL_FUNCTION(void, glVertexArrayFogCoordOffsetEXT, (GLuint vaobj, GLuint buffer, GLenum type, GLsizei stride, GLintptr offset))
+FOUNDATION_GL_FUNCTION(void, glVertexArraySecondaryColorOffsetEXT, (GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset))
+FOUNDATION_GL_FUNCTION(void, glVertexArrayVertexAttribOffsetEXT, (GLuint vaobj, GLuint buffer, GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, GLintptr offset))
+FOUNDATION_GL_FUNCTION(void, glVertexArrayVertexAttribIOffsetEXT, (GLuint vaobj, GLuint buffer, GLuint index, GLint size, GLenum type, GLsizei stride, GLintptr offset))
+FOUNDATION_GL_FUNCTION(void, glEnableVertexArrayEXT, (GLuint vaobj, GLenum array))
+FOUNDATION_GL_FUNCTION(void, glDisableVertexArrayEXT, (GLuint vaobj, GLenum array))
+FOUNDATION_GL_FUNCTION(void, glEnableVertexArrayAttribEXT, (GLuint vaobj, GLuint index))
+FOUNDATION_GL_FUNCTION(void, glDisableVertexArrayAttribEXT, (GLuint vaobj, GLuint index))
+FOUNDATION_GL_FUNCTION(void, glGetVertexArrayIntegervEXT, (GLuint vaobj, GLenum pname, GLint *param))
+FOUNDATION_GL_FUNCTION(void, glGetVertexArrayPointervEXT, (GLuint vaobj, GLenum pname, void **param))
+FOUNDATION_GL_FUNCTION(void, glGetVertexArrayIntegeri_vEXT, (GLuint vaobj, GLuint index, GLenum pname, GLint *param))
+FOUNDATION_GL_FUNCTION(void, glGetVertexArrayPointeri_vEXT, (GLuint vaobj, GLuint index, GLenum pname, void **param))
+FOUNDATION_GL_FUNCTION(void *, glMapNamedBufferRangeEXT, (GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access))
+FOUNDATION_GL_FUNCTION(void, glFlushMappedNamedBufferRangeEXT, (GLuint buffer, GLintptr offset, GLsizeiptr length))
+FOUNDATION_GL_FUNCTION(void, glNamedBufferStorageEXT, (GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags))
+FOUNDATION_GL_FUNCTION(void, glClearNamedBufferDataEXT, (GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data))
+FOUNDATION_GL_FUNCTION(void, glClearNamedBufferSubDataEXT, (GLuint buffer, GLenum internalformat, GLenum format, GLenum type, GLsizeiptr offset, GLsizeiptr size, const void *data))
+FOUNDATION_GL_FUNCTION(void, glNamedFramebufferParameteriEXT, (GLuint framebuffer, GLenum pname, GLint param))
+FOUNDATION_GL_FUNCTION(void, glGetNamedFramebufferParameterivEXT, (GLuint framebuffer, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform1dEXT, (GLuint program, GLint location, GLdouble x))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform2dEXT, (GLuint program, GLint location, GLdouble x, GLdouble y))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform3dEXT, (GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform4dEXT, (GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform1dvEXT, (GLuint program, GLint location, GLsizei count, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform2dvEXT, (GLuint program, GLint location, GLsizei count, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform3dvEXT, (GLuint program, GLint location, GLsizei count, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform4dvEXT, (GLuint program, GLint location, GLsizei count, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix2dvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix3dvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix4dvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix2x3dvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix2x4dvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix3x2dvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix3x4dvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix4x2dvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformMatrix4x3dvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value))
+FOUNDATION_GL_FUNCTION(void, glTextureBufferRangeEXT, (GLuint texture, GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size))
+FOUNDATION_GL_FUNCTION(void, glTextureStorage1DEXT, (GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width))
+FOUNDATION_GL_FUNCTION(void, glTextureStorage2DEXT, (GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height))
+FOUNDATION_GL_FUNCTION(void, glTextureStorage3DEXT, (GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth))
+FOUNDATION_GL_FUNCTION(void, glTextureStorage2DMultisampleEXT, (GLuint texture, GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations))
+FOUNDATION_GL_FUNCTION(void, glTextureStorage3DMultisampleEXT, (GLuint texture, GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations))
+FOUNDATION_GL_FUNCTION(void, glVertexArrayBindVertexBufferEXT, (GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride))
+FOUNDATION_GL_FUNCTION(void, glVertexArrayVertexAttribFormatEXT, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset))
+FOUNDATION_GL_FUNCTION(void, glVertexArrayVertexAttribIFormatEXT, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset))
+FOUNDATION_GL_FUNCTION(void, glVertexArrayVertexAttribLFormatEXT, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset))
+FOUNDATION_GL_FUNCTION(void, glVertexArrayVertexAttribBindingEXT, (GLuint vaobj, GLuint attribindex, GLuint bindingindex))
+FOUNDATION_GL_FUNCTION(void, glVertexArrayVertexBindingDivisorEXT, (GLuint vaobj, GLuint bindingindex, GLuint divisor))
+FOUNDATION_GL_FUNCTION(void, glVertexArrayVertexAttribLOffsetEXT, (GLuint vaobj, GLuint buffer, GLuint index, GLint size, GLenum type, GLsizei stride, GLintptr offset))
+FOUNDATION_GL_FUNCTION(void, glTexturePageCommitmentEXT, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLboolean resident))
+FOUNDATION_GL_FUNCTION(void, glVertexArrayVertexAttribDivisorEXT, (GLuint vaobj, GLuint index, GLuint divisor))
+#endif
+
+#ifdef GL_EXT_draw_buffers2
+FOUNDATION_GL_FUNCTION(void, glColorMaskIndexedEXT, (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a))
+#endif
+
+#ifdef GL_EXT_draw_instanced
+FOUNDATION_GL_FUNCTION(void, glDrawArraysInstancedEXT, (GLenum mode, GLint start, GLsizei count, GLsizei primcount))
+FOUNDATION_GL_FUNCTION(void, glDrawElementsInstancedEXT, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei primcount))
+#endif
+
+#ifdef GL_EXT_draw_range_elements
+FOUNDATION_GL_FUNCTION(void, glDrawRangeElementsEXT, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices))
+#endif
+
+#ifdef GL_EXT_fog_coord
+FOUNDATION_GL_FUNCTION(void, glFogCoordfEXT, (GLfloat coord))
+FOUNDATION_GL_FUNCTION(void, glFogCoordfvEXT, (const GLfloat *coord))
+FOUNDATION_GL_FUNCTION(void, glFogCoorddEXT, (GLdouble coord))
+FOUNDATION_GL_FUNCTION(void, glFogCoorddvEXT, (const GLdouble *coord))
+FOUNDATION_GL_FUNCTION(void, glFogCoordPointerEXT, (GLenum type, GLsizei stride, const void *pointer))
+#endif
+
+#ifdef GL_EXT_framebuffer_blit
+FOUNDATION_GL_FUNCTION(void, glBlitFramebufferEXT, (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter))
+#endif
+
+#ifdef GL_EXT_framebuffer_multisample
+FOUNDATION_GL_FUNCTION(void, glRenderbufferStorageMultisampleEXT, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height))
+#endif
+
+#ifdef GL_EXT_framebuffer_object
+FOUNDATION_GL_FUNCTION(GLboolean, glIsRenderbufferEXT, (GLuint renderbuffer))
+FOUNDATION_GL_FUNCTION(void, glBindRenderbufferEXT, (GLenum target, GLuint renderbuffer))
+FOUNDATION_GL_FUNCTION(void, glDeleteRenderbuffersEXT, (GLsizei n, const GLuint *renderbuffers))
+FOUNDATION_GL_FUNCTION(void, glGenRenderbuffersEXT, (GLsizei n, GLuint *renderbuffers))
+FOUNDATION_GL_FUNCTION(void, glRenderbufferStorageEXT, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height))
+FOUNDATION_GL_FUNCTION(void, glGetRenderbufferParameterivEXT, (GLenum target, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsFramebufferEXT, (GLuint framebuffer))
+FOUNDATION_GL_FUNCTION(void, glBindFramebufferEXT, (GLenum target, GLuint framebuffer))
+FOUNDATION_GL_FUNCTION(void, glDeleteFramebuffersEXT, (GLsizei n, const GLuint *framebuffers))
+FOUNDATION_GL_FUNCTION(void, glGenFramebuffersEXT, (GLsizei n, GLuint *framebuffers))
+FOUNDATION_GL_FUNCTION(GLenum, glCheckFramebufferStatusEXT, (GLenum target))
+FOUNDATION_GL_FUNCTION(void, glFramebufferTexture1DEXT, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level))
+FOUNDATION_GL_FUNCTION(void, glFramebufferTexture2DEXT, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level))
+FOUNDATION_GL_FUNCTION(void, glFramebufferTexture3DEXT, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset))
+FOUNDATION_GL_FUNCTION(void, glFramebufferRenderbufferEXT, (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer))
+FOUNDATION_GL_FUNCTION(void, glGetFramebufferAttachmentParameterivEXT, (GLenum target, GLenum attachment, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGenerateMipmapEXT, (GLenum target))
+#endif
+
+#ifdef GL_EXT_geometry_shader4
+FOUNDATION_GL_FUNCTION(void, glProgramParameteriEXT, (GLuint program, GLenum pname, GLint value))
+#endif
+
+#ifdef GL_EXT_gpu_program_parameters
+FOUNDATION_GL_FUNCTION(void, glProgramEnvParameters4fvEXT, (GLenum target, GLuint index, GLsizei count, const GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glProgramLocalParameters4fvEXT, (GLenum target, GLuint index, GLsizei count, const GLfloat *params))
+#endif
+
+#ifdef GL_EXT_gpu_shader4
+FOUNDATION_GL_FUNCTION(void, glGetUniformuivEXT, (GLuint program, GLint location, GLuint *params))
+FOUNDATION_GL_FUNCTION(void, glBindFragDataLocationEXT, (GLuint program, GLuint color, const GLchar *name))
+FOUNDATION_GL_FUNCTION(GLint, glGetFragDataLocationEXT, (GLuint program, const GLchar *name))
+FOUNDATION_GL_FUNCTION(void, glUniform1uiEXT, (GLint location, GLuint v0))
+FOUNDATION_GL_FUNCTION(void, glUniform2uiEXT, (GLint location, GLuint v0, GLuint v1))
+FOUNDATION_GL_FUNCTION(void, glUniform3uiEXT, (GLint location, GLuint v0, GLuint v1, GLuint v2))
+FOUNDATION_GL_FUNCTION(void, glUniform4uiEXT, (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3))
+FOUNDATION_GL_FUNCTION(void, glUniform1uivEXT, (GLint location, GLsizei count, const GLuint *value))
+FOUNDATION_GL_FUNCTION(void, glUniform2uivEXT, (GLint location, GLsizei count, const GLuint *value))
+FOUNDATION_GL_FUNCTION(void, glUniform3uivEXT, (GLint location, GLsizei count, const GLuint *value))
+FOUNDATION_GL_FUNCTION(void, glUniform4uivEXT, (GLint location, GLsizei count, const GLuint *value))
+#endif
+
+#ifdef GL_EXT_histogram
+FOUNDATION_GL_FUNCTION(void, glGetHistogramEXT, (GLenum target, GLboolean reset, GLenum format, GLenum type, void *values))
+FOUNDATION_GL_FUNCTION(void, glGetHistogramParameterfvEXT, (GLenum target, GLenum pname, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetHistogramParameterivEXT, (GLenum target, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetMinmaxEXT, (GLenum target, GLboolean reset, GLenum format, GLenum type, void *values))
+FOUNDATION_GL_FUNCTION(void, glGetMinmaxParameterfvEXT, (GLenum target, GLenum pname, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetMinmaxParameterivEXT, (GLenum target, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glHistogramEXT, (GLenum target, GLsizei width, GLenum internalformat, GLboolean sink))
+FOUNDATION_GL_FUNCTION(void, glMinmaxEXT, (GLenum target, GLenum internalformat, GLboolean sink))
+FOUNDATION_GL_FUNCTION(void, glResetHistogramEXT, (GLenum target))
+FOUNDATION_GL_FUNCTION(void, glResetMinmaxEXT, (GLenum target))
+#endif
+
+#ifdef GL_EXT_index_func
+FOUNDATION_GL_FUNCTION(void, glIndexFuncEXT, (GLenum func, GLclampf ref))
+#endif
+
+#ifdef GL_EXT_index_material
+FOUNDATION_GL_FUNCTION(void, glIndexMaterialEXT, (GLenum face, GLenum mode))
+#endif
+
+#ifdef GL_EXT_light_texture
+FOUNDATION_GL_FUNCTION(void, glApplyTextureEXT, (GLenum mode))
+FOUNDATION_GL_FUNCTION(void, glTextureLightEXT, (GLenum pname))
+FOUNDATION_GL_FUNCTION(void, glTextureMaterialEXT, (GLenum face, GLenum mode))
+#endif
+
+#ifdef GL_EXT_multi_draw_arrays
+FOUNDATION_GL_FUNCTION(void, glMultiDrawArraysEXT, (GLenum mode, const GLint *first, const GLsizei *count, GLsizei primcount))
+FOUNDATION_GL_FUNCTION(void, glMultiDrawElementsEXT, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei primcount))
+#endif
+
+#ifdef GL_EXT_multisample
+FOUNDATION_GL_FUNCTION(void, glSampleMaskEXT, (GLclampf value, GLboolean invert))
+FOUNDATION_GL_FUNCTION(void, glSamplePatternEXT, (GLenum pattern))
+#endif
+
+#ifdef GL_EXT_paletted_texture
+FOUNDATION_GL_FUNCTION(void, glColorTableEXT, (GLenum target, GLenum internalFormat, GLsizei width, GLenum format, GLenum type, const void *table))
+FOUNDATION_GL_FUNCTION(void, glGetColorTableEXT, (GLenum target, GLenum format, GLenum type, void *data))
+FOUNDATION_GL_FUNCTION(void, glGetColorTableParameterivEXT, (GLenum target, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetColorTableParameterfvEXT, (GLenum target, GLenum pname, GLfloat *params))
+#endif
+
+#ifdef GL_EXT_pixel_transform
+FOUNDATION_GL_FUNCTION(void, glPixelTransformParameteriEXT, (GLenum target, GLenum pname, GLint param))
+FOUNDATION_GL_FUNCTION(void, glPixelTransformParameterfEXT, (GLenum target, GLenum pname, GLfloat param))
+FOUNDATION_GL_FUNCTION(void, glPixelTransformParameterivEXT, (GLenum target, GLenum pname, const GLint *params))
+FOUNDATION_GL_FUNCTION(void, glPixelTransformParameterfvEXT, (GLenum target, GLenum pname, const GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetPixelTransformParameterivEXT, (GLenum target, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetPixelTransformParameterfvEXT, (GLenum target, GLenum pname, GLfloat *params))
+#endif
+
+#ifdef GL_EXT_point_parameters
+FOUNDATION_GL_FUNCTION(void, glPointParameterfEXT, (GLenum pname, GLfloat param))
+FOUNDATION_GL_FUNCTION(void, glPointParameterfvEXT, (GLenum pname, const GLfloat *params))
+#endif
+
+#ifdef GL_EXT_polygon_offset
+FOUNDATION_GL_FUNCTION(void, glPolygonOffsetEXT, (GLfloat factor, GLfloat bias))
+#endif
+
+#ifdef GL_EXT_provoking_vertex
+FOUNDATION_GL_FUNCTION(void, glProvokingVertexEXT, (GLenum mode))
+#endif
+
+#ifdef GL_EXT_secondary_color
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3bEXT, (GLbyte red, GLbyte green, GLbyte blue))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3bvEXT, (const GLbyte *v))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3dEXT, (GLdouble red, GLdouble green, GLdouble blue))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3dvEXT, (const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3fEXT, (GLfloat red, GLfloat green, GLfloat blue))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3fvEXT, (const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3iEXT, (GLint red, GLint green, GLint blue))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3ivEXT, (const GLint *v))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3sEXT, (GLshort red, GLshort green, GLshort blue))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3svEXT, (const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3ubEXT, (GLubyte red, GLubyte green, GLubyte blue))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3ubvEXT, (const GLubyte *v))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3uiEXT, (GLuint red, GLuint green, GLuint blue))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3uivEXT, (const GLuint *v))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3usEXT, (GLushort red, GLushort green, GLushort blue))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3usvEXT, (const GLushort *v))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColorPointerEXT, (GLint size, GLenum type, GLsizei stride, const void *pointer))
+#endif
+
+#ifdef GL_EXT_separate_shader_objects
+FOUNDATION_GL_FUNCTION(void, glUseShaderProgramEXT, (GLenum type, GLuint program))
+FOUNDATION_GL_FUNCTION(void, glActiveProgramEXT, (GLuint program))
+FOUNDATION_GL_FUNCTION(GLuint, glCreateShaderProgramEXT, (GLenum type, const GLchar *string))
+#endif
+
+#ifdef GL_EXT_shader_image_load_store
+FOUNDATION_GL_FUNCTION(void, glBindImageTextureEXT, (GLuint index, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLint format))
+FOUNDATION_GL_FUNCTION(void, glMemoryBarrierEXT, (GLbitfield barriers))
+#endif
+
+#ifdef GL_EXT_stencil_clear_tag
+FOUNDATION_GL_FUNCTION(void, glStencilClearTagEXT, (GLsizei stencilTagBits, GLuint stencilClearTag))
+#endif
+
+#ifdef GL_EXT_stencil_two_side
+FOUNDATION_GL_FUNCTION(void, glActiveStencilFaceEXT, (GLenum face))
+#endif
+
+#ifdef GL_EXT_subtexture
+FOUNDATION_GL_FUNCTION(void, glTexSubImage1DEXT, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels))
+FOUNDATION_GL_FUNCTION(void, glTexSubImage2DEXT, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels))
+#endif
+
+#ifdef GL_EXT_texture3D
+FOUNDATION_GL_FUNCTION(void, glTexImage3DEXT, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels))
+FOUNDATION_GL_FUNCTION(void, glTexSubImage3DEXT, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels))
+#endif
+
+#ifdef GL_EXT_texture_buffer_object
+FOUNDATION_GL_FUNCTION(void, glTexBufferEXT, (GLenum target, GLenum internalformat, GLuint buffer))
+#endif
+
+#ifdef GL_EXT_texture_integer
+FOUNDATION_GL_FUNCTION(void, glTexParameterIivEXT, (GLenum target, GLenum pname, const GLint *params))
+FOUNDATION_GL_FUNCTION(void, glTexParameterIuivEXT, (GLenum target, GLenum pname, const GLuint *params))
+FOUNDATION_GL_FUNCTION(void, glGetTexParameterIivEXT, (GLenum target, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetTexParameterIuivEXT, (GLenum target, GLenum pname, GLuint *params))
+FOUNDATION_GL_FUNCTION(void, glClearColorIiEXT, (GLint red, GLint green, GLint blue, GLint alpha))
+FOUNDATION_GL_FUNCTION(void, glClearColorIuiEXT, (GLuint red, GLuint green, GLuint blue, GLuint alpha))
+#endif
+
+#ifdef GL_EXT_texture_object
+FOUNDATION_GL_FUNCTION(GLboolean, glAreTexturesResidentEXT, (GLsizei n, const GLuint *textures, GLboolean *residences))
+FOUNDATION_GL_FUNCTION(void, glBindTextureEXT, (GLenum target, GLuint texture))
+FOUNDATION_GL_FUNCTION(void, glDeleteTexturesEXT, (GLsizei n, const GLuint *textures))
+FOUNDATION_GL_FUNCTION(void, glGenTexturesEXT, (GLsizei n, GLuint *textures))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsTextureEXT, (GLuint texture))
+FOUNDATION_GL_FUNCTION(void, glPrioritizeTexturesEXT, (GLsizei n, const GLuint *textures, const GLclampf *priorities))
+#endif
+
+#ifdef GL_EXT_texture_perturb_normal
+FOUNDATION_GL_FUNCTION(void, glTextureNormalEXT, (GLenum mode))
+#endif
+
+#ifdef GL_EXT_timer_query
+FOUNDATION_GL_FUNCTION(void, glGetQueryObjecti64vEXT, (GLuint id, GLenum pname, GLint64 *params))
+FOUNDATION_GL_FUNCTION(void, glGetQueryObjectui64vEXT, (GLuint id, GLenum pname, GLuint64 *params))
+#endif
+
+#ifdef GL_EXT_transform_feedback
+FOUNDATION_GL_FUNCTION(void, glBeginTransformFeedbackEXT, (GLenum primitiveMode))
+FOUNDATION_GL_FUNCTION(void, glEndTransformFeedbackEXT, (void))
+FOUNDATION_GL_FUNCTION(void, glBindBufferRangeEXT, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size))
+FOUNDATION_GL_FUNCTION(void, glBindBufferOffsetEXT, (GLenum target, GLuint index, GLuint buffer, GLintptr offset))
+FOUNDATION_GL_FUNCTION(void, glBindBufferBaseEXT, (GLenum target, GLuint index, GLuint buffer))
+FOUNDATION_GL_FUNCTION(void, glTransformFeedbackVaryingsEXT, (GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode))
+FOUNDATION_GL_FUNCTION(void, glGetTransformFeedbackVaryingEXT, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name))
+#endif
+
+#ifdef GL_EXT_vertex_array
+FOUNDATION_GL_FUNCTION(void, glArrayElementEXT, (GLint i))
+FOUNDATION_GL_FUNCTION(void, glColorPointerEXT, (GLint size, GLenum type, GLsizei stride, GLsizei count, const void *pointer))
+FOUNDATION_GL_FUNCTION(void, glDrawArraysEXT, (GLenum mode, GLint first, GLsizei count))
+FOUNDATION_GL_FUNCTION(void, glEdgeFlagPointerEXT, (GLsizei stride, GLsizei count, const GLboolean *pointer))
+FOUNDATION_GL_FUNCTION(void, glGetPointervEXT, (GLenum pname, void **params))
+FOUNDATION_GL_FUNCTION(void, glIndexPointerEXT, (GLenum type, GLsizei stride, GLsizei count, const void *pointer))
+FOUNDATION_GL_FUNCTION(void, glNormalPointerEXT, (GLenum type, GLsizei stride, GLsizei count, const void *pointer))
+FOUNDATION_GL_FUNCTION(void, glTexCoordPointerEXT, (GLint size, GLenum type, GLsizei stride, GLsizei count, const void *pointer))
+FOUNDATION_GL_FUNCTION(void, glVertexPointerEXT, (GLint size, GLenum type, GLsizei stride, GLsizei count, const void *pointer))
+#endif
+
+#ifdef GL_EXT_vertex_attrib_64bit
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL1dEXT, (GLuint index, GLdouble x))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL2dEXT, (GLuint index, GLdouble x, GLdouble y))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL3dEXT, (GLuint index, GLdouble x, GLdouble y, GLdouble z))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL4dEXT, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL1dvEXT, (GLuint index, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL2dvEXT, (GLuint index, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL3dvEXT, (GLuint index, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL4dvEXT, (GLuint index, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribLPointerEXT, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer))
+FOUNDATION_GL_FUNCTION(void, glGetVertexAttribLdvEXT, (GLuint index, GLenum pname, GLdouble *params))
+#endif
+
+#ifdef GL_EXT_vertex_shader
+FOUNDATION_GL_FUNCTION(void, glBeginVertexShaderEXT, (void))
+FOUNDATION_GL_FUNCTION(void, glEndVertexShaderEXT, (void))
+FOUNDATION_GL_FUNCTION(void, glBindVertexShaderEXT, (GLuint id))
+FOUNDATION_GL_FUNCTION(GLuint, glGenVertexShadersEXT, (GLuint range))
+FOUNDATION_GL_FUNCTION(void, glDeleteVertexShaderEXT, (GLuint id))
+FOUNDATION_GL_FUNCTION(void, glShaderOp1EXT, (GLenum op, GLuint res, GLuint arg1))
+FOUNDATION_GL_FUNCTION(void, glShaderOp2EXT, (GLenum op, GLuint res, GLuint arg1, GLuint arg2))
+FOUNDATION_GL_FUNCTION(void, glShaderOp3EXT, (GLenum op, GLuint res, GLuint arg1, GLuint arg2, GLuint arg3))
+FOUNDATION_GL_FUNCTION(void, glSwizzleEXT, (GLuint res, GLuint in, GLenum outX, GLenum outY, GLenum outZ, GLenum outW))
+FOUNDATION_GL_FUNCTION(void, glWriteMaskEXT, (GLuint res, GLuint in, GLenum outX, GLenum outY, GLenum outZ, GLenum outW))
+FOUNDATION_GL_FUNCTION(void, glInsertComponentEXT, (GLuint res, GLuint src, GLuint num))
+FOUNDATION_GL_FUNCTION(void, glExtractComponentEXT, (GLuint res, GLuint src, GLuint num))
+FOUNDATION_GL_FUNCTION(GLuint, glGenSymbolsEXT, (GLenum datatype, GLenum storagetype, GLenum range, GLuint components))
+FOUNDATION_GL_FUNCTION(void, glSetInvariantEXT, (GLuint id, GLenum type, const void *addr))
+FOUNDATION_GL_FUNCTION(void, glSetLocalConstantEXT, (GLuint id, GLenum type, const void *addr))
+FOUNDATION_GL_FUNCTION(void, glVariantbvEXT, (GLuint id, const GLbyte *addr))
+FOUNDATION_GL_FUNCTION(void, glVariantsvEXT, (GLuint id, const GLshort *addr))
+FOUNDATION_GL_FUNCTION(void, glVariantivEXT, (GLuint id, const GLint *addr))
+FOUNDATION_GL_FUNCTION(void, glVariantfvEXT, (GLuint id, const GLfloat *addr))
+FOUNDATION_GL_FUNCTION(void, glVariantdvEXT, (GLuint id, const GLdouble *addr))
+FOUNDATION_GL_FUNCTION(void, glVariantubvEXT, (GLuint id, const GLubyte *addr))
+FOUNDATION_GL_FUNCTION(void, glVariantusvEXT, (GLuint id, const GLushort *addr))
+FOUNDATION_GL_FUNCTION(void, glVariantuivEXT, (GLuint id, const GLuint *addr))
+FOUNDATION_GL_FUNCTION(void, glVariantPointerEXT, (GLuint id, GLenum type, GLuint stride, const void *addr))
+FOUNDATION_GL_FUNCTION(void, glEnableVariantClientStateEXT, (GLuint id))
+FOUNDATION_GL_FUNCTION(void, glDisableVariantClientStateEXT, (GLuint id))
+FOUNDATION_GL_FUNCTION(GLuint, glBindLightParameterEXT, (GLenum light, GLenum value))
+FOUNDATION_GL_FUNCTION(GLuint, glBindMaterialParameterEXT, (GLenum face, GLenum value))
+FOUNDATION_GL_FUNCTION(GLuint, glBindTexGenParameterEXT, (GLenum unit, GLenum coord, GLenum value))
+FOUNDATION_GL_FUNCTION(GLuint, glBindTextureUnitParameterEXT, (GLenum unit, GLenum value))
+FOUNDATION_GL_FUNCTION(GLuint, glBindParameterEXT, (GLenum value))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsVariantEnabledEXT, (GLuint id, GLenum cap))
+FOUNDATION_GL_FUNCTION(void, glGetVariantBooleanvEXT, (GLuint id, GLenum value, GLboolean *data))
+FOUNDATION_GL_FUNCTION(void, glGetVariantIntegervEXT, (GLuint id, GLenum value, GLint *data))
+FOUNDATION_GL_FUNCTION(void, glGetVariantFloatvEXT, (GLuint id, GLenum value, GLfloat *data))
+FOUNDATION_GL_FUNCTION(void, glGetVariantPointervEXT, (GLuint id, GLenum value, void **data))
+FOUNDATION_GL_FUNCTION(void, glGetInvariantBooleanvEXT, (GLuint id, GLenum value, GLboolean *data))
+FOUNDATION_GL_FUNCTION(void, glGetInvariantIntegervEXT, (GLuint id, GLenum value, GLint *data))
+FOUNDATION_GL_FUNCTION(void, glGetInvariantFloatvEXT, (GLuint id, GLenum value, GLfloat *data))
+FOUNDATION_GL_FUNCTION(void, glGetLocalConstantBooleanvEXT, (GLuint id, GLenum value, GLboolean *data))
+FOUNDATION_GL_FUNCTION(void, glGetLocalConstantIntegervEXT, (GLuint id, GLenum value, GLint *data))
+FOUNDATION_GL_FUNCTION(void, glGetLocalConstantFloatvEXT, (GLuint id, GLenum value, GLfloat *data))
+#endif
+
+#ifdef GL_EXT_vertex_weighting
+FOUNDATION_GL_FUNCTION(void, glVertexWeightfEXT, (GLfloat weight))
+FOUNDATION_GL_FUNCTION(void, glVertexWeightfvEXT, (const GLfloat *weight))
+FOUNDATION_GL_FUNCTION(void, glVertexWeightPointerEXT, (GLint size, GLenum type, GLsizei stride, const void *pointer))
+#endif
+
+#ifdef GL_EXT_x11_sync_object
+FOUNDATION_GL_FUNCTION(GLsync, glImportSyncEXT, (GLenum external_sync_type, GLintptr external_sync, GLbitfield flags))
+#endif
+
+#ifdef GL_GREMEDY_frame_terminator
+FOUNDATION_GL_FUNCTION(void, glFrameTerminatorGREMEDY, (void))
+#endif
+
+#ifdef GL_GREMEDY_string_marker
+FOUNDATION_GL_FUNCTION(void, glStringMarkerGREMEDY, (GLsizei len, const void *string))
+#endif
+
+#ifdef GL_HP_image_transform
+FOUNDATION_GL_FUNCTION(void, glImageTransformParameteriHP, (GLenum target, GLenum pname, GLint param))
+FOUNDATION_GL_FUNCTION(void, glImageTransformParameterfHP, (GLenum target, GLenum pname, GLfloat param))
+FOUNDATION_GL_FUNCTION(void, glImageTransformParameterivHP, (GLenum target, GLenum pname, const GLint *params))
+FOUNDATION_GL_FUNCTION(void, glImageTransformParameterfvHP, (GLenum target, GLenum pname, const GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetImageTransformParameterivHP, (GLenum target, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetImageTransformParameterfvHP, (GLenum target, GLenum pname, GLfloat *params))
+#endif
+
+#ifdef GL_IBM_multimode_draw_arrays
+FOUNDATION_GL_FUNCTION(void, glMultiModeDrawArraysIBM, (const GLenum *mode, const GLint *first, const GLsizei *count, GLsizei primcount, GLint modestride))
+FOUNDATION_GL_FUNCTION(void, glMultiModeDrawElementsIBM, (const GLenum *mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei primcount, GLint modestride))
+#endif
+
+#ifdef GL_IBM_static_data
+FOUNDATION_GL_FUNCTION(void, glFlushStaticDataIBM, (GLenum target))
+#endif
+
+#ifdef GL_IBM_vertex_array_lists
+FOUNDATION_GL_FUNCTION(void, glColorPointerListIBM, (GLint size, GLenum type, GLint stride, const void **pointer, GLint ptrstride))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColorPointerListIBM, (GLint size, GLenum type, GLint stride, const void **pointer, GLint ptrstride))
+FOUNDATION_GL_FUNCTION(void, glEdgeFlagPointerListIBM, (GLint stride, const GLboolean **pointer, GLint ptrstride))
+FOUNDATION_GL_FUNCTION(void, glFogCoordPointerListIBM, (GLenum type, GLint stride, const void **pointer, GLint ptrstride))
+FOUNDATION_GL_FUNCTION(void, glIndexPointerListIBM, (GLenum type, GLint stride, const void **pointer, GLint ptrstride))
+FOUNDATION_GL_FUNCTION(void, glNormalPointerListIBM, (GLenum type, GLint stride, const void **pointer, GLint ptrstride))
+FOUNDATION_GL_FUNCTION(void, glTexCoordPointerListIBM, (GLint size, GLenum type, GLint stride, const void **pointer, GLint ptrstride))
+FOUNDATION_GL_FUNCTION(void, glVertexPointerListIBM, (GLint size, GLenum type, GLint stride, const void **pointer, GLint ptrstride))
+#endif
+
+#ifdef GL_INGR_blend_func_separate
+FOUNDATION_GL_FUNCTION(void, glBlendFuncSeparateINGR, (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha))
+#endif
+
+#ifdef GL_INTEL_map_texture
+FOUNDATION_GL_FUNCTION(void, glSyncTextureINTEL, (GLuint texture))
+FOUNDATION_GL_FUNCTION(void, glUnmapTexture2DINTEL, (GLuint texture, GLint level))
+FOUNDATION_GL_FUNCTION(void *, glMapTexture2DINTEL, (GLuint texture, GLint level, GLbitfield access, GLint *stride, GLenum *layout))
+#endif
+
+#ifdef GL_INTEL_parallel_arrays
+FOUNDATION_GL_FUNCTION(void, glVertexPointervINTEL, (GLint size, GLenum type, const void **pointer))
+FOUNDATION_GL_FUNCTION(void, glNormalPointervINTEL, (GLenum type, const void **pointer))
+FOUNDATION_GL_FUNCTION(void, glColorPointervINTEL, (GLint size, GLenum type, const void **pointer))
+FOUNDATION_GL_FUNCTION(void, glTexCoordPointervINTEL, (GLint size, GLenum type, const void **pointer))
+#endif
+
+#ifdef GL_MESA_resize_buffers
+FOUNDATION_GL_FUNCTION(void, glResizeBuffersMESA, (void))
+#endif
+
+#ifdef GL_MESA_window_pos
+FOUNDATION_GL_FUNCTION(void, glWindowPos2dMESA, (GLdouble x, GLdouble y))
+FOUNDATION_GL_FUNCTION(void, glWindowPos2dvMESA, (const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glWindowPos2fMESA, (GLfloat x, GLfloat y))
+FOUNDATION_GL_FUNCTION(void, glWindowPos2fvMESA, (const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glWindowPos2iMESA, (GLint x, GLint y))
+FOUNDATION_GL_FUNCTION(void, glWindowPos2ivMESA, (const GLint *v))
+FOUNDATION_GL_FUNCTION(void, glWindowPos2sMESA, (GLshort x, GLshort y))
+FOUNDATION_GL_FUNCTION(void, glWindowPos2svMESA, (const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glWindowPos3dMESA, (GLdouble x, GLdouble y, GLdouble z))
+FOUNDATION_GL_FUNCTION(void, glWindowPos3dvMESA, (const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glWindowPos3fMESA, (GLfloat x, GLfloat y, GLfloat z))
+FOUNDATION_GL_FUNCTION(void, glWindowPos3fvMESA, (const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glWindowPos3iMESA, (GLint x, GLint y, GLint z))
+FOUNDATION_GL_FUNCTION(void, glWindowPos3ivMESA, (const GLint *v))
+FOUNDATION_GL_FUNCTION(void, glWindowPos3sMESA, (GLshort x, GLshort y, GLshort z))
+FOUNDATION_GL_FUNCTION(void, glWindowPos3svMESA, (const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glWindowPos4dMESA, (GLdouble x, GLdouble y, GLdouble z, GLdouble w))
+FOUNDATION_GL_FUNCTION(void, glWindowPos4dvMESA, (const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glWindowPos4fMESA, (GLfloat x, GLfloat y, GLfloat z, GLfloat w))
+FOUNDATION_GL_FUNCTION(void, glWindowPos4fvMESA, (const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glWindowPos4iMESA, (GLint x, GLint y, GLint z, GLint w))
+FOUNDATION_GL_FUNCTION(void, glWindowPos4ivMESA, (const GLint *v))
+FOUNDATION_GL_FUNCTION(void, glWindowPos4sMESA, (GLshort x, GLshort y, GLshort z, GLshort w))
+FOUNDATION_GL_FUNCTION(void, glWindowPos4svMESA, (const GLshort *v))
+#endif
+
+#ifdef GL_NVX_conditional_render
+FOUNDATION_GL_FUNCTION(void, glBeginConditionalRenderNVX, (GLuint id))
+FOUNDATION_GL_FUNCTION(void, glEndConditionalRenderNVX, (void))
+#endif
+
+#ifdef GL_NV_bindless_multi_draw_indirect
+FOUNDATION_GL_FUNCTION(void, glMultiDrawArraysIndirectBindlessNV, (GLenum mode, const void *indirect, GLsizei drawCount, GLsizei stride, GLint vertexBufferCount))
+FOUNDATION_GL_FUNCTION(void, glMultiDrawElementsIndirectBindlessNV, (GLenum mode, GLenum type, const void *indirect, GLsizei drawCount, GLsizei stride, GLint vertexBufferCount))
+#endif
+
+#ifdef GL_NV_bindless_texture
+FOUNDATION_GL_FUNCTION(GLuint64, glGetTextureHandleNV, (GLuint texture))
+FOUNDATION_GL_FUNCTION(GLuint64, glGetTextureSamplerHandleNV, (GLuint texture, GLuint sampler))
+FOUNDATION_GL_FUNCTION(void, glMakeTextureHandleResidentNV, (GLuint64 handle))
+FOUNDATION_GL_FUNCTION(void, glMakeTextureHandleNonResidentNV, (GLuint64 handle))
+FOUNDATION_GL_FUNCTION(GLuint64, glGetImageHandleNV, (GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum format))
+FOUNDATION_GL_FUNCTION(void, glMakeImageHandleResidentNV, (GLuint64 handle, GLenum access))
+FOUNDATION_GL_FUNCTION(void, glMakeImageHandleNonResidentNV, (GLuint64 handle))
+FOUNDATION_GL_FUNCTION(void, glUniformHandleui64NV, (GLint location, GLuint64 value))
+FOUNDATION_GL_FUNCTION(void, glUniformHandleui64vNV, (GLint location, GLsizei count, const GLuint64 *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformHandleui64NV, (GLuint program, GLint location, GLuint64 value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformHandleui64vNV, (GLuint program, GLint location, GLsizei count, const GLuint64 *values))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsTextureHandleResidentNV, (GLuint64 handle))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsImageHandleResidentNV, (GLuint64 handle))
+#endif
+
+#ifdef GL_NV_blend_equation_advanced
+FOUNDATION_GL_FUNCTION(void, glBlendParameteriNV, (GLenum pname, GLint value))
+FOUNDATION_GL_FUNCTION(void, glBlendBarrierNV, (void))
+#endif
+
+#ifdef GL_NV_conditional_render
+FOUNDATION_GL_FUNCTION(void, glBeginConditionalRenderNV, (GLuint id, GLenum mode))
+FOUNDATION_GL_FUNCTION(void, glEndConditionalRenderNV, (void))
+#endif
+
+#ifdef GL_NV_copy_image
+FOUNDATION_GL_FUNCTION(void, glCopyImageSubDataNV, (GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei width, GLsizei height, GLsizei depth))
+#endif
+
+#ifdef GL_NV_depth_buffer_float
+FOUNDATION_GL_FUNCTION(void, glDepthRangedNV, (GLdouble zNear, GLdouble zFar))
+FOUNDATION_GL_FUNCTION(void, glClearDepthdNV, (GLdouble depth))
+FOUNDATION_GL_FUNCTION(void, glDepthBoundsdNV, (GLdouble zmin, GLdouble zmax))
+#endif
+
+#ifdef GL_NV_draw_texture
+FOUNDATION_GL_FUNCTION(void, glDrawTextureNV, (GLuint texture, GLuint sampler, GLfloat x0, GLfloat y0, GLfloat x1, GLfloat y1, GLfloat z, GLfloat s0, GLfloat t0, GLfloat s1, GLfloat t1))
+#endif
+
+#ifdef GL_NV_evaluators
+FOUNDATION_GL_FUNCTION(void, glMapControlPointsNV, (GLenum target, GLuint index, GLenum type, GLsizei ustride, GLsizei vstride, GLint uorder, GLint vorder, GLboolean packed, const void *points))
+FOUNDATION_GL_FUNCTION(void, glMapParameterivNV, (GLenum target, GLenum pname, const GLint *params))
+FOUNDATION_GL_FUNCTION(void, glMapParameterfvNV, (GLenum target, GLenum pname, const GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetMapControlPointsNV, (GLenum target, GLuint index, GLenum type, GLsizei ustride, GLsizei vstride, GLboolean packed, void *points))
+FOUNDATION_GL_FUNCTION(void, glGetMapParameterivNV, (GLenum target, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetMapParameterfvNV, (GLenum target, GLenum pname, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetMapAttribParameterivNV, (GLenum target, GLuint index, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetMapAttribParameterfvNV, (GLenum target, GLuint index, GLenum pname, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glEvalMapsNV, (GLenum target, GLenum mode))
+#endif
+
+#ifdef GL_NV_explicit_multisample
+FOUNDATION_GL_FUNCTION(void, glGetMultisamplefvNV, (GLenum pname, GLuint index, GLfloat *val))
+FOUNDATION_GL_FUNCTION(void, glSampleMaskIndexedNV, (GLuint index, GLbitfield mask))
+FOUNDATION_GL_FUNCTION(void, glTexRenderbufferNV, (GLenum target, GLuint renderbuffer))
+#endif
+
+#ifdef GL_NV_fence
+FOUNDATION_GL_FUNCTION(void, glDeleteFencesNV, (GLsizei n, const GLuint *fences))
+FOUNDATION_GL_FUNCTION(void, glGenFencesNV, (GLsizei n, GLuint *fences))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsFenceNV, (GLuint fence))
+FOUNDATION_GL_FUNCTION(GLboolean, glTestFenceNV, (GLuint fence))
+FOUNDATION_GL_FUNCTION(void, glGetFenceivNV, (GLuint fence, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glFinishFenceNV, (GLuint fence))
+FOUNDATION_GL_FUNCTION(void, glSetFenceNV, (GLuint fence, GLenum condition))
+#endif
+
+#ifdef GL_NV_fragment_program
+FOUNDATION_GL_FUNCTION(void, glProgramNamedParameter4fNV, (GLuint id, GLsizei len, const GLubyte *name, GLfloat x, GLfloat y, GLfloat z, GLfloat w))
+FOUNDATION_GL_FUNCTION(void, glProgramNamedParameter4fvNV, (GLuint id, GLsizei len, const GLubyte *name, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glProgramNamedParameter4dNV, (GLuint id, GLsizei len, const GLubyte *name, GLdouble x, GLdouble y, GLdouble z, GLdouble w))
+FOUNDATION_GL_FUNCTION(void, glProgramNamedParameter4dvNV, (GLuint id, GLsizei len, const GLubyte *name, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glGetProgramNamedParameterfvNV, (GLuint id, GLsizei len, const GLubyte *name, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetProgramNamedParameterdvNV, (GLuint id, GLsizei len, const GLubyte *name, GLdouble *params))
+#endif
+
+#ifdef GL_NV_framebuffer_multisample_coverage
+FOUNDATION_GL_FUNCTION(void, glRenderbufferStorageMultisampleCoverageNV, (GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLenum internalformat, GLsizei width, GLsizei height))
+#endif
+
+#ifdef GL_NV_geometry_program4
+FOUNDATION_GL_FUNCTION(void, glProgramVertexLimitNV, (GLenum target, GLint limit))
+FOUNDATION_GL_FUNCTION(void, glFramebufferTextureEXT, (GLenum target, GLenum attachment, GLuint texture, GLint level))
+FOUNDATION_GL_FUNCTION(void, glFramebufferTextureLayerEXT, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer))
+FOUNDATION_GL_FUNCTION(void, glFramebufferTextureFaceEXT, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLenum face))
+#endif
+
+#ifdef GL_NV_gpu_program4
+FOUNDATION_GL_FUNCTION(void, glProgramLocalParameterI4iNV, (GLenum target, GLuint index, GLint x, GLint y, GLint z, GLint w))
+FOUNDATION_GL_FUNCTION(void, glProgramLocalParameterI4ivNV, (GLenum target, GLuint index, const GLint *params))
+FOUNDATION_GL_FUNCTION(void, glProgramLocalParametersI4ivNV, (GLenum target, GLuint index, GLsizei count, const GLint *params))
+FOUNDATION_GL_FUNCTION(void, glProgramLocalParameterI4uiNV, (GLenum target, GLuint index, GLuint x, GLuint y, GLuint z, GLuint w))
+FOUNDATION_GL_FUNCTION(void, glProgramLocalParameterI4uivNV, (GLenum target, GLuint index, const GLuint *params))
+FOUNDATION_GL_FUNCTION(void, glProgramLocalParametersI4uivNV, (GLenum target, GLuint index, GLsizei count, const GLuint *params))
+FOUNDATION_GL_FUNCTION(void, glProgramEnvParameterI4iNV, (GLenum target, GLuint index, GLint x, GLint y, GLint z, GLint w))
+FOUNDATION_GL_FUNCTION(void, glProgramEnvParameterI4ivNV, (GLenum target, GLuint index, const GLint *params))
+FOUNDATION_GL_FUNCTION(void, glProgramEnvParametersI4ivNV, (GLenum target, GLuint index, GLsizei count, const GLint *params))
+FOUNDATION_GL_FUNCTION(void, glProgramEnvParameterI4uiNV, (GLenum target, GLuint index, GLuint x, GLuint y, GLuint z, GLuint w))
+FOUNDATION_GL_FUNCTION(void, glProgramEnvParameterI4uivNV, (GLenum target, GLuint index, const GLuint *params))
+FOUNDATION_GL_FUNCTION(void, glProgramEnvParametersI4uivNV, (GLenum target, GLuint index, GLsizei count, const GLuint *params))
+FOUNDATION_GL_FUNCTION(void, glGetProgramLocalParameterIivNV, (GLenum target, GLuint index, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetProgramLocalParameterIuivNV, (GLenum target, GLuint index, GLuint *params))
+FOUNDATION_GL_FUNCTION(void, glGetProgramEnvParameterIivNV, (GLenum target, GLuint index, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetProgramEnvParameterIuivNV, (GLenum target, GLuint index, GLuint *params))
+#endif
+
+#ifdef GL_NV_gpu_program5
+FOUNDATION_GL_FUNCTION(void, glProgramSubroutineParametersuivNV, (GLenum target, GLsizei count, const GLuint *params))
+FOUNDATION_GL_FUNCTION(void, glGetProgramSubroutineParameteruivNV, (GLenum target, GLuint index, GLuint *param))
+#endif
+
+#ifdef GL_NV_gpu_shader5
+FOUNDATION_GL_FUNCTION(void, glUniform1i64NV, (GLint location, GLint64EXT x))
+FOUNDATION_GL_FUNCTION(void, glUniform2i64NV, (GLint location, GLint64EXT x, GLint64EXT y))
+FOUNDATION_GL_FUNCTION(void, glUniform3i64NV, (GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z))
+FOUNDATION_GL_FUNCTION(void, glUniform4i64NV, (GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z, GLint64EXT w))
+FOUNDATION_GL_FUNCTION(void, glUniform1i64vNV, (GLint location, GLsizei count, const GLint64EXT *value))
+FOUNDATION_GL_FUNCTION(void, glUniform2i64vNV, (GLint location, GLsizei count, const GLint64EXT *value))
+FOUNDATION_GL_FUNCTION(void, glUniform3i64vNV, (GLint location, GLsizei count, const GLint64EXT *value))
+FOUNDATION_GL_FUNCTION(void, glUniform4i64vNV, (GLint location, GLsizei count, const GLint64EXT *value))
+FOUNDATION_GL_FUNCTION(void, glUniform1ui64NV, (GLint location, GLuint64EXT x))
+FOUNDATION_GL_FUNCTION(void, glUniform2ui64NV, (GLint location, GLuint64EXT x, GLuint64EXT y))
+FOUNDATION_GL_FUNCTION(void, glUniform3ui64NV, (GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z))
+FOUNDATION_GL_FUNCTION(void, glUniform4ui64NV, (GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z, GLuint64EXT w))
+FOUNDATION_GL_FUNCTION(void, glUniform1ui64vNV, (GLint location, GLsizei count, const GLuint64EXT *value))
+FOUNDATION_GL_FUNCTION(void, glUniform2ui64vNV, (GLint location, GLsizei count, const GLuint64EXT *value))
+FOUNDATION_GL_FUNCTION(void, glUniform3ui64vNV, (GLint location, GLsizei count, const GLuint64EXT *value))
+FOUNDATION_GL_FUNCTION(void, glUniform4ui64vNV, (GLint location, GLsizei count, const GLuint64EXT *value))
+FOUNDATION_GL_FUNCTION(void, glGetUniformi64vNV, (GLuint program, GLint location, GLint64EXT *params))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform1i64NV, (GLuint program, GLint location, GLint64EXT x))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform2i64NV, (GLuint program, GLint location, GLint64EXT x, GLint64EXT y))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform3i64NV, (GLuint program, GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform4i64NV, (GLuint program, GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z, GLint64EXT w))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform1i64vNV, (GLuint program, GLint location, GLsizei count, const GLint64EXT *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform2i64vNV, (GLuint program, GLint location, GLsizei count, const GLint64EXT *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform3i64vNV, (GLuint program, GLint location, GLsizei count, const GLint64EXT *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform4i64vNV, (GLuint program, GLint location, GLsizei count, const GLint64EXT *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform1ui64NV, (GLuint program, GLint location, GLuint64EXT x))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform2ui64NV, (GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform3ui64NV, (GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform4ui64NV, (GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z, GLuint64EXT w))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform1ui64vNV, (GLuint program, GLint location, GLsizei count, const GLuint64EXT *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform2ui64vNV, (GLuint program, GLint location, GLsizei count, const GLuint64EXT *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform3ui64vNV, (GLuint program, GLint location, GLsizei count, const GLuint64EXT *value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniform4ui64vNV, (GLuint program, GLint location, GLsizei count, const GLuint64EXT *value))
+#endif
+
+#ifdef GL_NV_half_float
+FOUNDATION_GL_FUNCTION(void, glVertex2hNV, (GLhalfNV x, GLhalfNV y))
+FOUNDATION_GL_FUNCTION(void, glVertex2hvNV, (const GLhalfNV *v))
+FOUNDATION_GL_FUNCTION(void, glVertex3hNV, (GLhalfNV x, GLhalfNV y, GLhalfNV z))
+FOUNDATION_GL_FUNCTION(void, glVertex3hvNV, (const GLhalfNV *v))
+FOUNDATION_GL_FUNCTION(void, glVertex4hNV, (GLhalfNV x, GLhalfNV y, GLhalfNV z, GLhalfNV w))
+FOUNDATION_GL_FUNCTION(void, glVertex4hvNV, (const GLhalfNV *v))
+FOUNDATION_GL_FUNCTION(void, glNormal3hNV, (GLhalfNV nx, GLhalfNV ny, GLhalfNV nz))
+FOUNDATION_GL_FUNCTION(void, glNormal3hvNV, (const GLhalfNV *v))
+FOUNDATION_GL_FUNCTION(void, glColor3hNV, (GLhalfNV red, GLhalfNV green, GLhalfNV blue))
+FOUNDATION_GL_FUNCTION(void, glColor3hvNV, (const GLhalfNV *v))
+FOUNDATION_GL_FUNCTION(void, glColor4hNV, (GLhalfNV red, GLhalfNV green, GLhalfNV blue, GLhalfNV alpha))
+FOUNDATION_GL_FUNCTION(void, glColor4hvNV, (const GLhalfNV *v))
+FOUNDATION_GL_FUNCTION(void, glTexCoord1hNV, (GLhalfNV s))
+FOUNDATION_GL_FUNCTION(void, glTexCoord1hvNV, (const GLhalfNV *v))
+FOUNDATION_GL_FUNCTION(void, glTexCoord2hNV, (GLhalfNV s, GLhalfNV t))
+FOUNDATION_GL_FUNCTION(void, glTexCoord2hvNV, (const GLhalfNV *v))
+FOUNDATION_GL_FUNCTION(void, glTexCoord3hNV, (GLhalfNV s, GLhalfNV t, GLhalfNV r))
+FOUNDATION_GL_FUNCTION(void, glTexCoord3hvNV, (const GLhalfNV *v))
+FOUNDATION_GL_FUNCTION(void, glTexCoord4hNV, (GLhalfNV s, GLhalfNV t, GLhalfNV r, GLhalfNV q))
+FOUNDATION_GL_FUNCTION(void, glTexCoord4hvNV, (const GLhalfNV *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord1hNV, (GLenum target, GLhalfNV s))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord1hvNV, (GLenum target, const GLhalfNV *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord2hNV, (GLenum target, GLhalfNV s, GLhalfNV t))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord2hvNV, (GLenum target, const GLhalfNV *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord3hNV, (GLenum target, GLhalfNV s, GLhalfNV t, GLhalfNV r))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord3hvNV, (GLenum target, const GLhalfNV *v))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord4hNV, (GLenum target, GLhalfNV s, GLhalfNV t, GLhalfNV r, GLhalfNV q))
+FOUNDATION_GL_FUNCTION(void, glMultiTexCoord4hvNV, (GLenum target, const GLhalfNV *v))
+FOUNDATION_GL_FUNCTION(void, glFogCoordhNV, (GLhalfNV fog))
+FOUNDATION_GL_FUNCTION(void, glFogCoordhvNV, (const GLhalfNV *fog))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3hNV, (GLhalfNV red, GLhalfNV green, GLhalfNV blue))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColor3hvNV, (const GLhalfNV *v))
+FOUNDATION_GL_FUNCTION(void, glVertexWeighthNV, (GLhalfNV weight))
+FOUNDATION_GL_FUNCTION(void, glVertexWeighthvNV, (const GLhalfNV *weight))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib1hNV, (GLuint index, GLhalfNV x))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib1hvNV, (GLuint index, const GLhalfNV *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib2hNV, (GLuint index, GLhalfNV x, GLhalfNV y))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib2hvNV, (GLuint index, const GLhalfNV *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib3hNV, (GLuint index, GLhalfNV x, GLhalfNV y, GLhalfNV z))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib3hvNV, (GLuint index, const GLhalfNV *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4hNV, (GLuint index, GLhalfNV x, GLhalfNV y, GLhalfNV z, GLhalfNV w))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4hvNV, (GLuint index, const GLhalfNV *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribs1hvNV, (GLuint index, GLsizei n, const GLhalfNV *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribs2hvNV, (GLuint index, GLsizei n, const GLhalfNV *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribs3hvNV, (GLuint index, GLsizei n, const GLhalfNV *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribs4hvNV, (GLuint index, GLsizei n, const GLhalfNV *v))
+#endif
+
+#ifdef GL_NV_occlusion_query
+FOUNDATION_GL_FUNCTION(void, glGenOcclusionQueriesNV, (GLsizei n, GLuint *ids))
+FOUNDATION_GL_FUNCTION(void, glDeleteOcclusionQueriesNV, (GLsizei n, const GLuint *ids))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsOcclusionQueryNV, (GLuint id))
+FOUNDATION_GL_FUNCTION(void, glBeginOcclusionQueryNV, (GLuint id))
+FOUNDATION_GL_FUNCTION(void, glEndOcclusionQueryNV, (void))
+FOUNDATION_GL_FUNCTION(void, glGetOcclusionQueryivNV, (GLuint id, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetOcclusionQueryuivNV, (GLuint id, GLenum pname, GLuint *params))
+#endif
+
+#ifdef GL_NV_parameter_buffer_object
+FOUNDATION_GL_FUNCTION(void, glProgramBufferParametersfvNV, (GLenum target, GLuint bindingIndex, GLuint wordIndex, GLsizei count, const GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glProgramBufferParametersIivNV, (GLenum target, GLuint bindingIndex, GLuint wordIndex, GLsizei count, const GLint *params))
+FOUNDATION_GL_FUNCTION(void, glProgramBufferParametersIuivNV, (GLenum target, GLuint bindingIndex, GLuint wordIndex, GLsizei count, const GLuint *params))
+#endif
+
+#ifdef GL_NV_path_rendering
+FOUNDATION_GL_FUNCTION(GLuint, glGenPathsNV, (GLsizei range))
+FOUNDATION_GL_FUNCTION(void, glDeletePathsNV, (GLuint path, GLsizei range))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsPathNV, (GLuint path))
+FOUNDATION_GL_FUNCTION(void, glPathCommandsNV, (GLuint path, GLsizei numCommands, const GLubyte *commands, GLsizei numCoords, GLenum coordType, const void *coords))
+FOUNDATION_GL_FUNCTION(void, glPathCoordsNV, (GLuint path, GLsizei numCoords, GLenum coordType, const void *coords))
+FOUNDATION_GL_FUNCTION(void, glPathSubCommandsNV, (GLuint path, GLsizei commandStart, GLsizei commandsToDelete, GLsizei numCommands, const GLubyte *commands, GLsizei numCoords, GLenum coordType, const void *coords))
+FOUNDATION_GL_FUNCTION(void, glPathSubCoordsNV, (GLuint path, GLsizei coordStart, GLsizei numCoords, GLenum coordType, const void *coords))
+FOUNDATION_GL_FUNCTION(void, glPathStringNV, (GLuint path, GLenum format, GLsizei length, const void *pathString))
+FOUNDATION_GL_FUNCTION(void, glPathGlyphsNV, (GLuint firstPathName, GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLsizei numGlyphs, GLenum type, const void *charcodes, GLenum handleMissingGlyphs, GLuint pathParameterTemplate, GLfloat emScale))
+FOUNDATION_GL_FUNCTION(void, glPathGlyphRangeNV, (GLuint firstPathName, GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLuint firstGlyph, GLsizei numGlyphs, GLenum handleMissingGlyphs, GLuint pathParameterTemplate, GLfloat emScale))
+FOUNDATION_GL_FUNCTION(void, glWeightPathsNV, (GLuint resultPath, GLsizei numPaths, const GLuint *paths, const GLfloat *weights))
+FOUNDATION_GL_FUNCTION(void, glCopyPathNV, (GLuint resultPath, GLuint srcPath))
+FOUNDATION_GL_FUNCTION(void, glInterpolatePathsNV, (GLuint resultPath, GLuint pathA, GLuint pathB, GLfloat weight))
+FOUNDATION_GL_FUNCTION(void, glTransformPathNV, (GLuint resultPath, GLuint srcPath, GLenum transformType, const GLfloat *transformValues))
+FOUNDATION_GL_FUNCTION(void, glPathParameterivNV, (GLuint path, GLenum pname, const GLint *value))
+FOUNDATION_GL_FUNCTION(void, glPathParameteriNV, (GLuint path, GLenum pname, GLint value))
+FOUNDATION_GL_FUNCTION(void, glPathParameterfvNV, (GLuint path, GLenum pname, const GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glPathParameterfNV, (GLuint path, GLenum pname, GLfloat value))
+FOUNDATION_GL_FUNCTION(void, glPathDashArrayNV, (GLuint path, GLsizei dashCount, const GLfloat *dashArray))
+FOUNDATION_GL_FUNCTION(void, glPathStencilFuncNV, (GLenum func, GLint ref, GLuint mask))
+FOUNDATION_GL_FUNCTION(void, glPathStencilDepthOffsetNV, (GLfloat factor, GLfloat units))
+FOUNDATION_GL_FUNCTION(void, glStencilFillPathNV, (GLuint path, GLenum fillMode, GLuint mask))
+FOUNDATION_GL_FUNCTION(void, glStencilStrokePathNV, (GLuint path, GLint reference, GLuint mask))
+FOUNDATION_GL_FUNCTION(void, glStencilFillPathInstancedNV, (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum fillMode, GLuint mask, GLenum transformType, const GLfloat *transformValues))
+FOUNDATION_GL_FUNCTION(void, glStencilStrokePathInstancedNV, (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLint reference, GLuint mask, GLenum transformType, const GLfloat *transformValues))
+FOUNDATION_GL_FUNCTION(void, glPathCoverDepthFuncNV, (GLenum func))
+FOUNDATION_GL_FUNCTION(void, glPathColorGenNV, (GLenum color, GLenum genMode, GLenum colorFormat, const GLfloat *coeffs))
+FOUNDATION_GL_FUNCTION(void, glPathTexGenNV, (GLenum texCoordSet, GLenum genMode, GLint components, const GLfloat *coeffs))
+FOUNDATION_GL_FUNCTION(void, glPathFogGenNV, (GLenum genMode))
+FOUNDATION_GL_FUNCTION(void, glCoverFillPathNV, (GLuint path, GLenum coverMode))
+FOUNDATION_GL_FUNCTION(void, glCoverStrokePathNV, (GLuint path, GLenum coverMode))
+FOUNDATION_GL_FUNCTION(void, glCoverFillPathInstancedNV, (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum coverMode, GLenum transformType, const GLfloat *transformValues))
+FOUNDATION_GL_FUNCTION(void, glCoverStrokePathInstancedNV, (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum coverMode, GLenum transformType, const GLfloat *transformValues))
+FOUNDATION_GL_FUNCTION(void, glGetPathParameterivNV, (GLuint path, GLenum pname, GLint *value))
+FOUNDATION_GL_FUNCTION(void, glGetPathParameterfvNV, (GLuint path, GLenum pname, GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glGetPathCommandsNV, (GLuint path, GLubyte *commands))
+FOUNDATION_GL_FUNCTION(void, glGetPathCoordsNV, (GLuint path, GLfloat *coords))
+FOUNDATION_GL_FUNCTION(void, glGetPathDashArrayNV, (GLuint path, GLfloat *dashArray))
+FOUNDATION_GL_FUNCTION(void, glGetPathMetricsNV, (GLbitfield metricQueryMask, GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLsizei stride, GLfloat *metrics))
+FOUNDATION_GL_FUNCTION(void, glGetPathMetricRangeNV, (GLbitfield metricQueryMask, GLuint firstPathName, GLsizei numPaths, GLsizei stride, GLfloat *metrics))
+FOUNDATION_GL_FUNCTION(void, glGetPathSpacingNV, (GLenum pathListMode, GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLfloat advanceScale, GLfloat kerningScale, GLenum transformType, GLfloat *returnedSpacing))
+FOUNDATION_GL_FUNCTION(void, glGetPathColorGenivNV, (GLenum color, GLenum pname, GLint *value))
+FOUNDATION_GL_FUNCTION(void, glGetPathColorGenfvNV, (GLenum color, GLenum pname, GLfloat *value))
+FOUNDATION_GL_FUNCTION(void, glGetPathTexGenivNV, (GLenum texCoordSet, GLenum pname, GLint *value))
+FOUNDATION_GL_FUNCTION(void, glGetPathTexGenfvNV, (GLenum texCoordSet, GLenum pname, GLfloat *value))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsPointInFillPathNV, (GLuint path, GLuint mask, GLfloat x, GLfloat y))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsPointInStrokePathNV, (GLuint path, GLfloat x, GLfloat y))
+FOUNDATION_GL_FUNCTION(GLfloat, glGetPathLengthNV, (GLuint path, GLsizei startSegment, GLsizei numSegments))
+FOUNDATION_GL_FUNCTION(GLboolean, glPointAlongPathNV, (GLuint path, GLsizei startSegment, GLsizei numSegments, GLfloat distance, GLfloat *x, GLfloat *y, GLfloat *tangentX, GLfloat *tangentY))
+#endif
+
+#ifdef GL_NV_pixel_data_range
+FOUNDATION_GL_FUNCTION(void, glPixelDataRangeNV, (GLenum target, GLsizei length, const void *pointer))
+FOUNDATION_GL_FUNCTION(void, glFlushPixelDataRangeNV, (GLenum target))
+#endif
+
+#ifdef GL_NV_point_sprite
+FOUNDATION_GL_FUNCTION(void, glPointParameteriNV, (GLenum pname, GLint param))
+FOUNDATION_GL_FUNCTION(void, glPointParameterivNV, (GLenum pname, const GLint *params))
+#endif
+
+#ifdef GL_NV_present_video
+FOUNDATION_GL_FUNCTION(void, glPresentFrameKeyedNV, (GLuint video_slot, GLuint64EXT minPresentTime, GLuint beginPresentTimeId, GLuint presentDurationId, GLenum type, GLenum target0, GLuint fill0, GLuint key0, GLenum target1, GLuint fill1, GLuint key1))
+FOUNDATION_GL_FUNCTION(void, glPresentFrameDualFillNV, (GLuint video_slot, GLuint64EXT minPresentTime, GLuint beginPresentTimeId, GLuint presentDurationId, GLenum type, GLenum target0, GLuint fill0, GLenum target1, GLuint fill1, GLenum target2, GLuint fill2, GLenum target3, GLuint fill3))
+FOUNDATION_GL_FUNCTION(void, glGetVideoivNV, (GLuint video_slot, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetVideouivNV, (GLuint video_slot, GLenum pname, GLuint *params))
+FOUNDATION_GL_FUNCTION(void, glGetVideoi64vNV, (GLuint video_slot, GLenum pname, GLint64EXT *params))
+FOUNDATION_GL_FUNCTION(void, glGetVideoui64vNV, (GLuint video_slot, GLenum pname, GLuint64EXT *params))
+#endif
+
+#ifdef GL_NV_primitive_restart
+FOUNDATION_GL_FUNCTION(void, glPrimitiveRestartNV, (void))
+FOUNDATION_GL_FUNCTION(void, glPrimitiveRestartIndexNV, (GLuint index))
+#endif
+
+#ifdef GL_NV_register_combiners
+FOUNDATION_GL_FUNCTION(void, glCombinerParameterfvNV, (GLenum pname, const GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glCombinerParameterfNV, (GLenum pname, GLfloat param))
+FOUNDATION_GL_FUNCTION(void, glCombinerParameterivNV, (GLenum pname, const GLint *params))
+FOUNDATION_GL_FUNCTION(void, glCombinerParameteriNV, (GLenum pname, GLint param))
+FOUNDATION_GL_FUNCTION(void, glCombinerInputNV, (GLenum stage, GLenum portion, GLenum variable, GLenum input, GLenum mapping, GLenum componentUsage))
+FOUNDATION_GL_FUNCTION(void, glCombinerOutputNV, (GLenum stage, GLenum portion, GLenum abOutput, GLenum cdOutput, GLenum sumOutput, GLenum scale, GLenum bias, GLboolean abDotProduct, GLboolean cdDotProduct, GLboolean muxSum))
+FOUNDATION_GL_FUNCTION(void, glFinalCombinerInputNV, (GLenum variable, GLenum input, GLenum mapping, GLenum componentUsage))
+FOUNDATION_GL_FUNCTION(void, glGetCombinerInputParameterfvNV, (GLenum stage, GLenum portion, GLenum variable, GLenum pname, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetCombinerInputParameterivNV, (GLenum stage, GLenum portion, GLenum variable, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetCombinerOutputParameterfvNV, (GLenum stage, GLenum portion, GLenum pname, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetCombinerOutputParameterivNV, (GLenum stage, GLenum portion, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetFinalCombinerInputParameterfvNV, (GLenum variable, GLenum pname, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetFinalCombinerInputParameterivNV, (GLenum variable, GLenum pname, GLint *params))
+#endif
+
+#ifdef GL_NV_register_combiners2
+FOUNDATION_GL_FUNCTION(void, glCombinerStageParameterfvNV, (GLenum stage, GLenum pname, const GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetCombinerStageParameterfvNV, (GLenum stage, GLenum pname, GLfloat *params))
+#endif
+
+#ifdef GL_NV_shader_buffer_load
+FOUNDATION_GL_FUNCTION(void, glMakeBufferResidentNV, (GLenum target, GLenum access))
+FOUNDATION_GL_FUNCTION(void, glMakeBufferNonResidentNV, (GLenum target))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsBufferResidentNV, (GLenum target))
+FOUNDATION_GL_FUNCTION(void, glMakeNamedBufferResidentNV, (GLuint buffer, GLenum access))
+FOUNDATION_GL_FUNCTION(void, glMakeNamedBufferNonResidentNV, (GLuint buffer))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsNamedBufferResidentNV, (GLuint buffer))
+FOUNDATION_GL_FUNCTION(void, glGetBufferParameterui64vNV, (GLenum target, GLenum pname, GLuint64EXT *params))
+FOUNDATION_GL_FUNCTION(void, glGetNamedBufferParameterui64vNV, (GLuint buffer, GLenum pname, GLuint64EXT *params))
+FOUNDATION_GL_FUNCTION(void, glGetIntegerui64vNV, (GLenum value, GLuint64EXT *result))
+FOUNDATION_GL_FUNCTION(void, glUniformui64NV, (GLint location, GLuint64EXT value))
+FOUNDATION_GL_FUNCTION(void, glUniformui64vNV, (GLint location, GLsizei count, const GLuint64EXT *value))
+FOUNDATION_GL_FUNCTION(void, glGetUniformui64vNV, (GLuint program, GLint location, GLuint64EXT *params))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformui64NV, (GLuint program, GLint location, GLuint64EXT value))
+FOUNDATION_GL_FUNCTION(void, glProgramUniformui64vNV, (GLuint program, GLint location, GLsizei count, const GLuint64EXT *value))
+#endif
+
+#ifdef GL_NV_texture_barrier
+FOUNDATION_GL_FUNCTION(void, glTextureBarrierNV, (void))
+#endif
+
+#ifdef GL_NV_texture_multisample
+FOUNDATION_GL_FUNCTION(void, glTexImage2DMultisampleCoverageNV, (GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations))
+FOUNDATION_GL_FUNCTION(void, glTexImage3DMultisampleCoverageNV, (GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations))
+FOUNDATION_GL_FUNCTION(void, glTextureImage2DMultisampleNV, (GLuint texture, GLenum target, GLsizei samples, GLint internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations))
+FOUNDATION_GL_FUNCTION(void, glTextureImage3DMultisampleNV, (GLuint texture, GLenum target, GLsizei samples, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations))
+FOUNDATION_GL_FUNCTION(void, glTextureImage2DMultisampleCoverageNV, (GLuint texture, GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations))
+FOUNDATION_GL_FUNCTION(void, glTextureImage3DMultisampleCoverageNV, (GLuint texture, GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations))
+#endif
+
+#ifdef GL_NV_transform_feedback
+FOUNDATION_GL_FUNCTION(void, glBeginTransformFeedbackNV, (GLenum primitiveMode))
+FOUNDATION_GL_FUNCTION(void, glEndTransformFeedbackNV, (void))
+FOUNDATION_GL_FUNCTION(void, glTransformFeedbackAttribsNV, (GLuint count, const GLint *attribs, GLenum bufferMode))
+FOUNDATION_GL_FUNCTION(void, glBindBufferRangeNV, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size))
+FOUNDATION_GL_FUNCTION(void, glBindBufferOffsetNV, (GLenum target, GLuint index, GLuint buffer, GLintptr offset))
+FOUNDATION_GL_FUNCTION(void, glBindBufferBaseNV, (GLenum target, GLuint index, GLuint buffer))
+FOUNDATION_GL_FUNCTION(void, glTransformFeedbackVaryingsNV, (GLuint program, GLsizei count, const GLint *locations, GLenum bufferMode))
+FOUNDATION_GL_FUNCTION(void, glActiveVaryingNV, (GLuint program, const GLchar *name))
+FOUNDATION_GL_FUNCTION(GLint, glGetVaryingLocationNV, (GLuint program, const GLchar *name))
+FOUNDATION_GL_FUNCTION(void, glGetActiveVaryingNV, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name))
+FOUNDATION_GL_FUNCTION(void, glGetTransformFeedbackVaryingNV, (GLuint program, GLuint index, GLint *location))
+FOUNDATION_GL_FUNCTION(void, glTransformFeedbackStreamAttribsNV, (GLsizei count, const GLint *attribs, GLsizei nbuffers, const GLint *bufstreams, GLenum bufferMode))
+#endif
+
+#ifdef GL_NV_transform_feedback2
+FOUNDATION_GL_FUNCTION(void, glBindTransformFeedbackNV, (GLenum target, GLuint id))
+FOUNDATION_GL_FUNCTION(void, glDeleteTransformFeedbacksNV, (GLsizei n, const GLuint *ids))
+FOUNDATION_GL_FUNCTION(void, glGenTransformFeedbacksNV, (GLsizei n, GLuint *ids))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsTransformFeedbackNV, (GLuint id))
+FOUNDATION_GL_FUNCTION(void, glPauseTransformFeedbackNV, (void))
+FOUNDATION_GL_FUNCTION(void, glResumeTransformFeedbackNV, (void))
+FOUNDATION_GL_FUNCTION(void, glDrawTransformFeedbackNV, (GLenum mode, GLuint id))
+#endif
+
+#ifdef GL_NV_vdpau_interop
+FOUNDATION_GL_FUNCTION(void, glVDPAUInitNV, (const void *vdpDevice, const void *getProcAddress))
+FOUNDATION_GL_FUNCTION(void, glVDPAUFiniNV, (void))
+FOUNDATION_GL_FUNCTION(GLvdpauSurfaceNV, glVDPAURegisterVideoSurfaceNV, (const void *vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint *textureNames))
+FOUNDATION_GL_FUNCTION(GLvdpauSurfaceNV, glVDPAURegisterOutputSurfaceNV, (const void *vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint *textureNames))
+FOUNDATION_GL_FUNCTION(void, glVDPAUIsSurfaceNV, (GLvdpauSurfaceNV surface))
+FOUNDATION_GL_FUNCTION(void, glVDPAUUnregisterSurfaceNV, (GLvdpauSurfaceNV surface))
+FOUNDATION_GL_FUNCTION(void, glVDPAUGetSurfaceivNV, (GLvdpauSurfaceNV surface, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values))
+FOUNDATION_GL_FUNCTION(void, glVDPAUSurfaceAccessNV, (GLvdpauSurfaceNV surface, GLenum access))
+FOUNDATION_GL_FUNCTION(void, glVDPAUMapSurfacesNV, (GLsizei numSurfaces, const GLvdpauSurfaceNV *surfaces))
+FOUNDATION_GL_FUNCTION(void, glVDPAUUnmapSurfacesNV, (GLsizei numSurface, const GLvdpauSurfaceNV *surfaces))
+#endif
+
+#ifdef GL_NV_vertex_array_range
+FOUNDATION_GL_FUNCTION(void, glFlushVertexArrayRangeNV, (void))
+FOUNDATION_GL_FUNCTION(void, glVertexArrayRangeNV, (GLsizei length, const void *pointer))
+#endif
+
+#ifdef GL_NV_vertex_attrib_integer_64bit
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL1i64NV, (GLuint index, GLint64EXT x))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL2i64NV, (GLuint index, GLint64EXT x, GLint64EXT y))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL3i64NV, (GLuint index, GLint64EXT x, GLint64EXT y, GLint64EXT z))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL4i64NV, (GLuint index, GLint64EXT x, GLint64EXT y, GLint64EXT z, GLint64EXT w))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL1i64vNV, (GLuint index, const GLint64EXT *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL2i64vNV, (GLuint index, const GLint64EXT *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL3i64vNV, (GLuint index, const GLint64EXT *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL4i64vNV, (GLuint index, const GLint64EXT *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL1ui64NV, (GLuint index, GLuint64EXT x))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL2ui64NV, (GLuint index, GLuint64EXT x, GLuint64EXT y))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL3ui64NV, (GLuint index, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL4ui64NV, (GLuint index, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z, GLuint64EXT w))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL1ui64vNV, (GLuint index, const GLuint64EXT *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL2ui64vNV, (GLuint index, const GLuint64EXT *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL3ui64vNV, (GLuint index, const GLuint64EXT *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribL4ui64vNV, (GLuint index, const GLuint64EXT *v))
+FOUNDATION_GL_FUNCTION(void, glGetVertexAttribLi64vNV, (GLuint index, GLenum pname, GLint64EXT *params))
+FOUNDATION_GL_FUNCTION(void, glGetVertexAttribLui64vNV, (GLuint index, GLenum pname, GLuint64EXT *params))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribLFormatNV, (GLuint index, GLint size, GLenum type, GLsizei stride))
+#endif
+
+#ifdef GL_NV_vertex_buffer_unified_memory
+FOUNDATION_GL_FUNCTION(void, glBufferAddressRangeNV, (GLenum pname, GLuint index, GLuint64EXT address, GLsizeiptr length))
+FOUNDATION_GL_FUNCTION(void, glVertexFormatNV, (GLint size, GLenum type, GLsizei stride))
+FOUNDATION_GL_FUNCTION(void, glNormalFormatNV, (GLenum type, GLsizei stride))
+FOUNDATION_GL_FUNCTION(void, glColorFormatNV, (GLint size, GLenum type, GLsizei stride))
+FOUNDATION_GL_FUNCTION(void, glIndexFormatNV, (GLenum type, GLsizei stride))
+FOUNDATION_GL_FUNCTION(void, glTexCoordFormatNV, (GLint size, GLenum type, GLsizei stride))
+FOUNDATION_GL_FUNCTION(void, glEdgeFlagFormatNV, (GLsizei stride))
+FOUNDATION_GL_FUNCTION(void, glSecondaryColorFormatNV, (GLint size, GLenum type, GLsizei stride))
+FOUNDATION_GL_FUNCTION(void, glFogCoordFormatNV, (GLenum type, GLsizei stride))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribFormatNV, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribIFormatNV, (GLuint index, GLint size, GLenum type, GLsizei stride))
+FOUNDATION_GL_FUNCTION(void, glGetIntegerui64i_vNV, (GLenum value, GLuint index, GLuint64EXT *result))
+#endif
+
+#ifdef GL_NV_vertex_program
+FOUNDATION_GL_FUNCTION(GLboolean, glAreProgramsResidentNV, (GLsizei n, const GLuint *programs, GLboolean *residences))
+FOUNDATION_GL_FUNCTION(void, glBindProgramNV, (GLenum target, GLuint id))
+FOUNDATION_GL_FUNCTION(void, glDeleteProgramsNV, (GLsizei n, const GLuint *programs))
+FOUNDATION_GL_FUNCTION(void, glExecuteProgramNV, (GLenum target, GLuint id, const GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGenProgramsNV, (GLsizei n, GLuint *programs))
+FOUNDATION_GL_FUNCTION(void, glGetProgramParameterdvNV, (GLenum target, GLuint index, GLenum pname, GLdouble *params))
+FOUNDATION_GL_FUNCTION(void, glGetProgramParameterfvNV, (GLenum target, GLuint index, GLenum pname, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetProgramivNV, (GLuint id, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetProgramStringNV, (GLuint id, GLenum pname, GLubyte *program))
+FOUNDATION_GL_FUNCTION(void, glGetTrackMatrixivNV, (GLenum target, GLuint address, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetVertexAttribdvNV, (GLuint index, GLenum pname, GLdouble *params))
+FOUNDATION_GL_FUNCTION(void, glGetVertexAttribfvNV, (GLuint index, GLenum pname, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetVertexAttribivNV, (GLuint index, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetVertexAttribPointervNV, (GLuint index, GLenum pname, void **pointer))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsProgramNV, (GLuint id))
+FOUNDATION_GL_FUNCTION(void, glLoadProgramNV, (GLenum target, GLuint id, GLsizei len, const GLubyte *program))
+FOUNDATION_GL_FUNCTION(void, glProgramParameter4dNV, (GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w))
+FOUNDATION_GL_FUNCTION(void, glProgramParameter4dvNV, (GLenum target, GLuint index, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glProgramParameter4fNV, (GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w))
+FOUNDATION_GL_FUNCTION(void, glProgramParameter4fvNV, (GLenum target, GLuint index, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glProgramParameters4dvNV, (GLenum target, GLuint index, GLsizei count, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glProgramParameters4fvNV, (GLenum target, GLuint index, GLsizei count, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glRequestResidentProgramsNV, (GLsizei n, const GLuint *programs))
+FOUNDATION_GL_FUNCTION(void, glTrackMatrixNV, (GLenum target, GLuint address, GLenum matrix, GLenum transform))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribPointerNV, (GLuint index, GLint fsize, GLenum type, GLsizei stride, const void *pointer))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib1dNV, (GLuint index, GLdouble x))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib1dvNV, (GLuint index, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib1fNV, (GLuint index, GLfloat x))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib1fvNV, (GLuint index, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib1sNV, (GLuint index, GLshort x))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib1svNV, (GLuint index, const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib2dNV, (GLuint index, GLdouble x, GLdouble y))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib2dvNV, (GLuint index, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib2fNV, (GLuint index, GLfloat x, GLfloat y))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib2fvNV, (GLuint index, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib2sNV, (GLuint index, GLshort x, GLshort y))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib2svNV, (GLuint index, const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib3dNV, (GLuint index, GLdouble x, GLdouble y, GLdouble z))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib3dvNV, (GLuint index, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib3fNV, (GLuint index, GLfloat x, GLfloat y, GLfloat z))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib3fvNV, (GLuint index, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib3sNV, (GLuint index, GLshort x, GLshort y, GLshort z))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib3svNV, (GLuint index, const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4dNV, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4dvNV, (GLuint index, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4fNV, (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4fvNV, (GLuint index, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4sNV, (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4svNV, (GLuint index, const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4ubNV, (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w))
+FOUNDATION_GL_FUNCTION(void, glVertexAttrib4ubvNV, (GLuint index, const GLubyte *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribs1dvNV, (GLuint index, GLsizei count, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribs1fvNV, (GLuint index, GLsizei count, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribs1svNV, (GLuint index, GLsizei count, const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribs2dvNV, (GLuint index, GLsizei count, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribs2fvNV, (GLuint index, GLsizei count, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribs2svNV, (GLuint index, GLsizei count, const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribs3dvNV, (GLuint index, GLsizei count, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribs3fvNV, (GLuint index, GLsizei count, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribs3svNV, (GLuint index, GLsizei count, const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribs4dvNV, (GLuint index, GLsizei count, const GLdouble *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribs4fvNV, (GLuint index, GLsizei count, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribs4svNV, (GLuint index, GLsizei count, const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribs4ubvNV, (GLuint index, GLsizei count, const GLubyte *v))
+#endif
+
+#ifdef GL_NV_vertex_program4
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI1iEXT, (GLuint index, GLint x))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI2iEXT, (GLuint index, GLint x, GLint y))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI3iEXT, (GLuint index, GLint x, GLint y, GLint z))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI4iEXT, (GLuint index, GLint x, GLint y, GLint z, GLint w))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI1uiEXT, (GLuint index, GLuint x))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI2uiEXT, (GLuint index, GLuint x, GLuint y))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI3uiEXT, (GLuint index, GLuint x, GLuint y, GLuint z))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI4uiEXT, (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI1ivEXT, (GLuint index, const GLint *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI2ivEXT, (GLuint index, const GLint *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI3ivEXT, (GLuint index, const GLint *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI4ivEXT, (GLuint index, const GLint *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI1uivEXT, (GLuint index, const GLuint *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI2uivEXT, (GLuint index, const GLuint *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI3uivEXT, (GLuint index, const GLuint *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI4uivEXT, (GLuint index, const GLuint *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI4bvEXT, (GLuint index, const GLbyte *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI4svEXT, (GLuint index, const GLshort *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI4ubvEXT, (GLuint index, const GLubyte *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribI4usvEXT, (GLuint index, const GLushort *v))
+FOUNDATION_GL_FUNCTION(void, glVertexAttribIPointerEXT, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer))
+FOUNDATION_GL_FUNCTION(void, glGetVertexAttribIivEXT, (GLuint index, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetVertexAttribIuivEXT, (GLuint index, GLenum pname, GLuint *params))
+#endif
+
+#ifdef GL_NV_video_capture
+FOUNDATION_GL_FUNCTION(void, glBeginVideoCaptureNV, (GLuint video_capture_slot))
+FOUNDATION_GL_FUNCTION(void, glBindVideoCaptureStreamBufferNV, (GLuint video_capture_slot, GLuint stream, GLenum frame_region, GLintptrARB offset))
+FOUNDATION_GL_FUNCTION(void, glBindVideoCaptureStreamTextureNV, (GLuint video_capture_slot, GLuint stream, GLenum frame_region, GLenum target, GLuint texture))
+FOUNDATION_GL_FUNCTION(void, glEndVideoCaptureNV, (GLuint video_capture_slot))
+FOUNDATION_GL_FUNCTION(void, glGetVideoCaptureivNV, (GLuint video_capture_slot, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetVideoCaptureStreamivNV, (GLuint video_capture_slot, GLuint stream, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetVideoCaptureStreamfvNV, (GLuint video_capture_slot, GLuint stream, GLenum pname, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetVideoCaptureStreamdvNV, (GLuint video_capture_slot, GLuint stream, GLenum pname, GLdouble *params))
+FOUNDATION_GL_FUNCTION(GLenum, glVideoCaptureNV, (GLuint video_capture_slot, GLuint *sequence_num, GLuint64EXT *capture_time))
+FOUNDATION_GL_FUNCTION(void, glVideoCaptureStreamParameterivNV, (GLuint video_capture_slot, GLuint stream, GLenum pname, const GLint *params))
+FOUNDATION_GL_FUNCTION(void, glVideoCaptureStreamParameterfvNV, (GLuint video_capture_slot, GLuint stream, GLenum pname, const GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glVideoCaptureStreamParameterdvNV, (GLuint video_capture_slot, GLuint stream, GLenum pname, const GLdouble *params))
+#endif
+
+#ifdef GL_PGI_misc_hints
+FOUNDATION_GL_FUNCTION(void, glHintPGI, (GLenum target, GLint mode))
+#endif
+
+#ifdef GL_SGIS_detail_texture
+FOUNDATION_GL_FUNCTION(void, glDetailTexFuncSGIS, (GLenum target, GLsizei n, const GLfloat *points))
+FOUNDATION_GL_FUNCTION(void, glGetDetailTexFuncSGIS, (GLenum target, GLfloat *points))
+#endif
+
+#ifdef GL_SGIS_fog_function
+FOUNDATION_GL_FUNCTION(void, glFogFuncSGIS, (GLsizei n, const GLfloat *points))
+FOUNDATION_GL_FUNCTION(void, glGetFogFuncSGIS, (GLfloat *points))
+#endif
+
+#ifdef GL_SGIS_multisample
+FOUNDATION_GL_FUNCTION(void, glSampleMaskSGIS, (GLclampf value, GLboolean invert))
+FOUNDATION_GL_FUNCTION(void, glSamplePatternSGIS, (GLenum pattern))
+#endif
+
+#ifdef GL_SGIS_pixel_texture
+FOUNDATION_GL_FUNCTION(void, glPixelTexGenParameteriSGIS, (GLenum pname, GLint param))
+FOUNDATION_GL_FUNCTION(void, glPixelTexGenParameterivSGIS, (GLenum pname, const GLint *params))
+FOUNDATION_GL_FUNCTION(void, glPixelTexGenParameterfSGIS, (GLenum pname, GLfloat param))
+FOUNDATION_GL_FUNCTION(void, glPixelTexGenParameterfvSGIS, (GLenum pname, const GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetPixelTexGenParameterivSGIS, (GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetPixelTexGenParameterfvSGIS, (GLenum pname, GLfloat *params))
+#endif
+
+#ifdef GL_SGIS_point_parameters
+FOUNDATION_GL_FUNCTION(void, glPointParameterfSGIS, (GLenum pname, GLfloat param))
+FOUNDATION_GL_FUNCTION(void, glPointParameterfvSGIS, (GLenum pname, const GLfloat *params))
+#endif
+
+#ifdef GL_SGIS_sharpen_texture
+FOUNDATION_GL_FUNCTION(void, glSharpenTexFuncSGIS, (GLenum target, GLsizei n, const GLfloat *points))
+FOUNDATION_GL_FUNCTION(void, glGetSharpenTexFuncSGIS, (GLenum target, GLfloat *points))
+#endif
+
+#ifdef GL_SGIS_texture4D
+FOUNDATION_GL_FUNCTION(void, glTexImage4DSGIS, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLsizei size4d, GLint border, GLenum format, GLenum type, const void *pixels))
+FOUNDATION_GL_FUNCTION(void, glTexSubImage4DSGIS, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint woffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei size4d, GLenum format, GLenum type, const void *pixels))
+#endif
+
+#ifdef GL_SGIS_texture_color_mask
+FOUNDATION_GL_FUNCTION(void, glTextureColorMaskSGIS, (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha))
+#endif
+
+#ifdef GL_SGIS_texture_filter4
+FOUNDATION_GL_FUNCTION(void, glGetTexFilterFuncSGIS, (GLenum target, GLenum filter, GLfloat *weights))
+FOUNDATION_GL_FUNCTION(void, glTexFilterFuncSGIS, (GLenum target, GLenum filter, GLsizei n, const GLfloat *weights))
+#endif
+
+#ifdef GL_SGIX_async
+FOUNDATION_GL_FUNCTION(void, glAsyncMarkerSGIX, (GLuint marker))
+FOUNDATION_GL_FUNCTION(GLint, glFinishAsyncSGIX, (GLuint *markerp))
+FOUNDATION_GL_FUNCTION(GLint, glPollAsyncSGIX, (GLuint *markerp))
+FOUNDATION_GL_FUNCTION(GLuint, glGenAsyncMarkersSGIX, (GLsizei range))
+FOUNDATION_GL_FUNCTION(void, glDeleteAsyncMarkersSGIX, (GLuint marker, GLsizei range))
+FOUNDATION_GL_FUNCTION(GLboolean, glIsAsyncMarkerSGIX, (GLuint marker))
+#endif
+
+#ifdef GL_SGIX_flush_raster
+FOUNDATION_GL_FUNCTION(void, glFlushRasterSGIX, (void))
+#endif
+
+#ifdef GL_SGIX_fragment_lighting
+FOUNDATION_GL_FUNCTION(void, glFragmentColorMaterialSGIX, (GLenum face, GLenum mode))
+FOUNDATION_GL_FUNCTION(void, glFragmentLightfSGIX, (GLenum light, GLenum pname, GLfloat param))
+FOUNDATION_GL_FUNCTION(void, glFragmentLightfvSGIX, (GLenum light, GLenum pname, const GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glFragmentLightiSGIX, (GLenum light, GLenum pname, GLint param))
+FOUNDATION_GL_FUNCTION(void, glFragmentLightivSGIX, (GLenum light, GLenum pname, const GLint *params))
+FOUNDATION_GL_FUNCTION(void, glFragmentLightModelfSGIX, (GLenum pname, GLfloat param))
+FOUNDATION_GL_FUNCTION(void, glFragmentLightModelfvSGIX, (GLenum pname, const GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glFragmentLightModeliSGIX, (GLenum pname, GLint param))
+FOUNDATION_GL_FUNCTION(void, glFragmentLightModelivSGIX, (GLenum pname, const GLint *params))
+FOUNDATION_GL_FUNCTION(void, glFragmentMaterialfSGIX, (GLenum face, GLenum pname, GLfloat param))
+FOUNDATION_GL_FUNCTION(void, glFragmentMaterialfvSGIX, (GLenum face, GLenum pname, const GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glFragmentMaterialiSGIX, (GLenum face, GLenum pname, GLint param))
+FOUNDATION_GL_FUNCTION(void, glFragmentMaterialivSGIX, (GLenum face, GLenum pname, const GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetFragmentLightfvSGIX, (GLenum light, GLenum pname, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetFragmentLightivSGIX, (GLenum light, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glGetFragmentMaterialfvSGIX, (GLenum face, GLenum pname, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetFragmentMaterialivSGIX, (GLenum face, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glLightEnviSGIX, (GLenum pname, GLint param))
+#endif
+
+#ifdef GL_SGIX_framezoom
+FOUNDATION_GL_FUNCTION(void, glFrameZoomSGIX, (GLint factor))
+#endif
+
+#ifdef GL_SGIX_igloo_interface
+FOUNDATION_GL_FUNCTION(void, glIglooInterfaceSGIX, (GLenum pname, const void *params))
+#endif
+
+#ifdef GL_SGIX_instruments
+FOUNDATION_GL_FUNCTION(GLint, glGetInstrumentsSGIX, (void))
+FOUNDATION_GL_FUNCTION(void, glInstrumentsBufferSGIX, (GLsizei size, GLint *buffer))
+FOUNDATION_GL_FUNCTION(GLint, glPollInstrumentsSGIX, (GLint *marker_p))
+FOUNDATION_GL_FUNCTION(void, glReadInstrumentsSGIX, (GLint marker))
+FOUNDATION_GL_FUNCTION(void, glStartInstrumentsSGIX, (void))
+FOUNDATION_GL_FUNCTION(void, glStopInstrumentsSGIX, (GLint marker))
+#endif
+
+#ifdef GL_SGIX_list_priority
+FOUNDATION_GL_FUNCTION(void, glGetListParameterfvSGIX, (GLuint list, GLenum pname, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetListParameterivSGIX, (GLuint list, GLenum pname, GLint *params))
+FOUNDATION_GL_FUNCTION(void, glListParameterfSGIX, (GLuint list, GLenum pname, GLfloat param))
+FOUNDATION_GL_FUNCTION(void, glListParameterfvSGIX, (GLuint list, GLenum pname, const GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glListParameteriSGIX, (GLuint list, GLenum pname, GLint param))
+FOUNDATION_GL_FUNCTION(void, glListParameterivSGIX, (GLuint list, GLenum pname, const GLint *params))
+#endif
+
+#ifdef GL_SGIX_pixel_texture
+FOUNDATION_GL_FUNCTION(void, glPixelTexGenSGIX, (GLenum mode))
+#endif
+
+#ifdef GL_SGIX_polynomial_ffd
+FOUNDATION_GL_FUNCTION(void, glDeformationMap3dSGIX, (GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, GLdouble w1, GLdouble w2, GLint wstride, GLint worder, const GLdouble *points))
+FOUNDATION_GL_FUNCTION(void, glDeformationMap3fSGIX, (GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, GLfloat w1, GLfloat w2, GLint wstride, GLint worder, const GLfloat *points))
+FOUNDATION_GL_FUNCTION(void, glDeformSGIX, (GLbitfield mask))
+FOUNDATION_GL_FUNCTION(void, glLoadIdentityDeformationMapSGIX, (GLbitfield mask))
+#endif
+
+#ifdef GL_SGIX_reference_plane
+FOUNDATION_GL_FUNCTION(void, glReferencePlaneSGIX, (const GLdouble *equation))
+#endif
+
+#ifdef GL_SGIX_sprite
+FOUNDATION_GL_FUNCTION(void, glSpriteParameterfSGIX, (GLenum pname, GLfloat param))
+FOUNDATION_GL_FUNCTION(void, glSpriteParameterfvSGIX, (GLenum pname, const GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glSpriteParameteriSGIX, (GLenum pname, GLint param))
+FOUNDATION_GL_FUNCTION(void, glSpriteParameterivSGIX, (GLenum pname, const GLint *params))
+#endif
+
+#ifdef GL_SGIX_tag_sample_buffer
+FOUNDATION_GL_FUNCTION(void, glTagSampleBufferSGIX, (void))
+#endif
+
+#ifdef GL_SGI_color_table
+FOUNDATION_GL_FUNCTION(void, glColorTableSGI, (GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const void *table))
+FOUNDATION_GL_FUNCTION(void, glColorTableParameterfvSGI, (GLenum target, GLenum pname, const GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glColorTableParameterivSGI, (GLenum target, GLenum pname, const GLint *params))
+FOUNDATION_GL_FUNCTION(void, glCopyColorTableSGI, (GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width))
+FOUNDATION_GL_FUNCTION(void, glGetColorTableSGI, (GLenum target, GLenum format, GLenum type, void *table))
+FOUNDATION_GL_FUNCTION(void, glGetColorTableParameterfvSGI, (GLenum target, GLenum pname, GLfloat *params))
+FOUNDATION_GL_FUNCTION(void, glGetColorTableParameterivSGI, (GLenum target, GLenum pname, GLint *params))
+#endif
+
+#ifdef GL_SUNX_constant_data
+FOUNDATION_GL_FUNCTION(void, glFinishTextureSUNX, (void))
+#endif
+
+#ifdef GL_SUN_global_alpha
+FOUNDATION_GL_FUNCTION(void, glGlobalAlphaFactorbSUN, (GLbyte factor))
+FOUNDATION_GL_FUNCTION(void, glGlobalAlphaFactorsSUN, (GLshort factor))
+FOUNDATION_GL_FUNCTION(void, glGlobalAlphaFactoriSUN, (GLint factor))
+FOUNDATION_GL_FUNCTION(void, glGlobalAlphaFactorfSUN, (GLfloat factor))
+FOUNDATION_GL_FUNCTION(void, glGlobalAlphaFactordSUN, (GLdouble factor))
+FOUNDATION_GL_FUNCTION(void, glGlobalAlphaFactorubSUN, (GLubyte factor))
+FOUNDATION_GL_FUNCTION(void, glGlobalAlphaFactorusSUN, (GLushort factor))
+FOUNDATION_GL_FUNCTION(void, glGlobalAlphaFactoruiSUN, (GLuint factor))
+#endif
+
+#ifdef GL_SUN_mesh_array
+FOUNDATION_GL_FUNCTION(void, glDrawMeshArraysSUN, (GLenum mode, GLint first, GLsizei count, GLsizei width))
+#endif
+
+#ifdef GL_SUN_triangle_list
+FOUNDATION_GL_FUNCTION(void, glReplacementCodeuiSUN, (GLuint code))
+FOUNDATION_GL_FUNCTION(void, glReplacementCodeusSUN, (GLushort code))
+FOUNDATION_GL_FUNCTION(void, glReplacementCodeubSUN, (GLubyte code))
+FOUNDATION_GL_FUNCTION(void, glReplacementCodeuivSUN, (const GLuint *code))
+FOUNDATION_GL_FUNCTION(void, glReplacementCodeusvSUN, (const GLushort *code))
+FOUNDATION_GL_FUNCTION(void, glReplacementCodeubvSUN, (const GLubyte *code))
+FOUNDATION_GL_FUNCTION(void, glReplacementCodePointerSUN, (GLenum type, GLsizei stride, const void **pointer))
+#endif
+
+#ifdef GL_SUN_vertex
+FOUNDATION_GL_FUNCTION(void, glColor4ubVertex2fSUN, (GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y))
+FOUNDATION_GL_FUNCTION(void, glColor4ubVertex2fvSUN, (const GLubyte *c, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glColor4ubVertex3fSUN, (GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y, GLfloat z))
+FOUNDATION_GL_FUNCTION(void, glColor4ubVertex3fvSUN, (const GLubyte *c, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glColor3fVertex3fSUN, (GLfloat r, GLfloat g, GLfloat b, GLfloat x, GLfloat y, GLfloat z))
+FOUNDATION_GL_FUNCTION(void, glColor3fVertex3fvSUN, (const GLfloat *c, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glNormal3fVertex3fSUN, (GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z))
+FOUNDATION_GL_FUNCTION(void, glNormal3fVertex3fvSUN, (const GLfloat *n, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glColor4fNormal3fVertex3fSUN, (GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z))
+FOUNDATION_GL_FUNCTION(void, glColor4fNormal3fVertex3fvSUN, (const GLfloat *c, const GLfloat *n, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glTexCoord2fVertex3fSUN, (GLfloat s, GLfloat t, GLfloat x, GLfloat y, GLfloat z))
+FOUNDATION_GL_FUNCTION(void, glTexCoord2fVertex3fvSUN, (const GLfloat *tc, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glTexCoord4fVertex4fSUN, (GLfloat s, GLfloat t, GLfloat p, GLfloat q, GLfloat x, GLfloat y, GLfloat z, GLfloat w))
+FOUNDATION_GL_FUNCTION(void, glTexCoord4fVertex4fvSUN, (const GLfloat *tc, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glTexCoord2fColor4ubVertex3fSUN, (GLfloat s, GLfloat t, GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y, GLfloat z))
+FOUNDATION_GL_FUNCTION(void, glTexCoord2fColor4ubVertex3fvSUN, (const GLfloat *tc, const GLubyte *c, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glTexCoord2fColor3fVertex3fSUN, (GLfloat s, GLfloat t, GLfloat r, GLfloat g, GLfloat b, GLfloat x, GLfloat y, GLfloat z))
+FOUNDATION_GL_FUNCTION(void, glTexCoord2fColor3fVertex3fvSUN, (const GLfloat *tc, const GLfloat *c, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glTexCoord2fNormal3fVertex3fSUN, (GLfloat s, GLfloat t, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z))
+FOUNDATION_GL_FUNCTION(void, glTexCoord2fNormal3fVertex3fvSUN, (const GLfloat *tc, const GLfloat *n, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glTexCoord2fColor4fNormal3fVertex3fSUN, (GLfloat s, GLfloat t, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z))
+FOUNDATION_GL_FUNCTION(void, glTexCoord2fColor4fNormal3fVertex3fvSUN, (const GLfloat *tc, const GLfloat *c, const GLfloat *n, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glTexCoord4fColor4fNormal3fVertex4fSUN, (GLfloat s, GLfloat t, GLfloat p, GLfloat q, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z, GLfloat w))
+FOUNDATION_GL_FUNCTION(void, glTexCoord4fColor4fNormal3fVertex4fvSUN, (const GLfloat *tc, const GLfloat *c, const GLfloat *n, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glReplacementCodeuiVertex3fSUN, (GLuint rc, GLfloat x, GLfloat y, GLfloat z))
+FOUNDATION_GL_FUNCTION(void, glReplacementCodeuiVertex3fvSUN, (const GLuint *rc, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glReplacementCodeuiColor4ubVertex3fSUN, (GLuint rc, GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y, GLfloat z))
+FOUNDATION_GL_FUNCTION(void, glReplacementCodeuiColor4ubVertex3fvSUN, (const GLuint *rc, const GLubyte *c, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glReplacementCodeuiColor3fVertex3fSUN, (GLuint rc, GLfloat r, GLfloat g, GLfloat b, GLfloat x, GLfloat y, GLfloat z))
+FOUNDATION_GL_FUNCTION(void, glReplacementCodeuiColor3fVertex3fvSUN, (const GLuint *rc, const GLfloat *c, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glReplacementCodeuiNormal3fVertex3fSUN, (GLuint rc, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z))
+FOUNDATION_GL_FUNCTION(void, glReplacementCodeuiNormal3fVertex3fvSUN, (const GLuint *rc, const GLfloat *n, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glReplacementCodeuiColor4fNormal3fVertex3fSUN, (GLuint rc, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z))
+FOUNDATION_GL_FUNCTION(void, glReplacementCodeuiColor4fNormal3fVertex3fvSUN, (const GLuint *rc, const GLfloat *c, const GLfloat *n, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glReplacementCodeuiTexCoord2fVertex3fSUN, (GLuint rc, GLfloat s, GLfloat t, GLfloat x, GLfloat y, GLfloat z))
+FOUNDATION_GL_FUNCTION(void, glReplacementCodeuiTexCoord2fVertex3fvSUN, (const GLuint *rc, const GLfloat *tc, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN, (GLuint rc, GLfloat s, GLfloat t, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z))
+FOUNDATION_GL_FUNCTION(void, glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN, (const GLuint *rc, const GLfloat *tc, const GLfloat *n, const GLfloat *v))
+FOUNDATION_GL_FUNCTION(void, glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN, (GLuint rc, GLfloat s, GLfloat t, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z))
+FOUNDATION_GL_FUNCTION(void, glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN, (const GLuint *rc, const GLfloat *tc, const GLfloat *c, const GLfloat *n, const GLfloat *v))
+#endif
+
+#if defined(__linux__)
+#ifdef GLX_VERSION_1_3
+FOUNDATION_GL_FUNCTION(GLXFBConfig *, glXGetFBConfigs, (Display *dpy, int screen, int *nelements))
+FOUNDATION_GL_FUNCTION(GLXFBConfig *, glXChooseFBConfig, (Display *dpy, int screen, const int *attrib_list, int *nelements))
+FOUNDATION_GL_FUNCTION(int, glXGetFBConfigAttrib, (Display *dpy, GLXFBConfig config, int attribute, int *value))
+FOUNDATION_GL_FUNCTION(XVisualInfo *, glXGetVisualFromFBConfig, (Display *dpy, GLXFBConfig config))
+FOUNDATION_GL_FUNCTION(GLXWindow, glXCreateWindow, (Display *dpy, GLXFBConfig config, Window win, const int *attrib_list))
+FOUNDATION_GL_FUNCTION(void, glXDestroyWindow, (Display *dpy, GLXWindow win))
+FOUNDATION_GL_FUNCTION(GLXPixmap, glXCreatePixmap, (Display *dpy, GLXFBConfig config, Pixmap pixmap, const int *attrib_list))
+FOUNDATION_GL_FUNCTION(void, glXDestroyPixmap, (Display *dpy, GLXPixmap pixmap))
+FOUNDATION_GL_FUNCTION(GLXPbuffer, glXCreatePbuffer, (Display *dpy, GLXFBConfig config, const int *attrib_list))
+FOUNDATION_GL_FUNCTION(void, glXDestroyPbuffer, (Display *dpy, GLXPbuffer pbuf))
+FOUNDATION_GL_FUNCTION(void, glXQueryDrawable, (Display *dpy, GLXDrawable draw, int attribute, unsigned int *value))
+FOUNDATION_GL_FUNCTION(GLXContext, glXCreateNewContext, (Display *dpy, GLXFBConfig config, int render_type, GLXContext share_list, Bool direct))
+FOUNDATION_GL_FUNCTION(Bool, glXMakeContextCurrent, (Display *dpy, GLXDrawable draw, GLXDrawable read, GLXContext ctx))
+FOUNDATION_GL_FUNCTION(GLXDrawable, glXGetCurrentReadDrawable, (void))
+FOUNDATION_GL_FUNCTION(int, glXQueryContext, (Display *dpy, GLXContext ctx, int attribute, int *value))
+FOUNDATION_GL_FUNCTION(void, glXSelectEvent, (Display *dpy, GLXDrawable draw, unsigned long event_mask))
+FOUNDATION_GL_FUNCTION(void, glXGetSelectedEvent, (Display *dpy, GLXDrawable draw, unsigned long *event_mask))
+#endif
+
+#ifdef GLX_VERSION_1_4
+FOUNDATION_GL_FUNCTION(__GLXextFuncPtr, glXGetProcAddress, (const GLubyte *procName))
+#endif
+
+#ifdef GLX_ARB_create_context
+FOUNDATION_GL_FUNCTION(GLXContext, glXCreateContextAttribsARB, (Display *dpy, GLXFBConfig config, GLXContext share_context, Bool direct, const int *attrib_list))
+#endif
+
+#ifdef GLX_ARB_get_proc_address
+FOUNDATION_GL_FUNCTION(__GLXextFuncPtr, glXGetProcAddressARB, (const GLubyte *procName))
+#endif
+
+#ifdef GLX_EXT_import_context
+FOUNDATION_GL_FUNCTION(Display *, glXGetCurrentDisplayEXT, (void))
+FOUNDATION_GL_FUNCTION(int, glXQueryContextInfoEXT, (Display *dpy, GLXContext context, int attribute, int *value))
+FOUNDATION_GL_FUNCTION(GLXContextID, glXGetContextIDEXT, (const GLXContext context))
+FOUNDATION_GL_FUNCTION(GLXContext, glXImportContextEXT, (Display *dpy, GLXContextID contextID))
+FOUNDATION_GL_FUNCTION(void, glXFreeContextEXT, (Display *dpy, GLXContext context))
+#endif
+
+#ifdef GLX_EXT_swap_control
+FOUNDATION_GL_FUNCTION(void, glXSwapIntervalEXT, (Display *dpy, GLXDrawable drawable, int interval))
+#endif
+
+#ifdef GLX_EXT_texture_from_pixmap
+FOUNDATION_GL_FUNCTION(void, glXBindTexImageEXT, (Display *dpy, GLXDrawable drawable, int buffer, const int *attrib_list))
+FOUNDATION_GL_FUNCTION(void, glXReleaseTexImageEXT, (Display *dpy, GLXDrawable drawable, int buffer))
+#endif
+
+#ifdef GLX_MESA_agp_offset
+FOUNDATION_GL_FUNCTION(unsigned int, glXGetAGPOffsetMESA, (const void *pointer))
+#endif
+
+#ifdef GLX_MESA_copy_sub_buffer
+FOUNDATION_GL_FUNCTION(void, glXCopySubBufferMESA, (Display *dpy, GLXDrawable drawable, int x, int y, int width, int height))
+#endif
+
+#ifdef GLX_MESA_pixmap_colormap
+FOUNDATION_GL_FUNCTION(GLXPixmap, glXCreateGLXPixmapMESA, (Display *dpy, XVisualInfo *visual, Pixmap pixmap, Colormap cmap))
+#endif
+
+#ifdef GLX_MESA_release_buffers
+FOUNDATION_GL_FUNCTION(Bool, glXReleaseBuffersMESA, (Display *dpy, GLXDrawable drawable))
+#endif
+
+#ifdef GLX_MESA_set_3dfx_mode
+FOUNDATION_GL_FUNCTION(Bool, glXSet3DfxModeMESA, (int mode))
+#endif
+
+#ifdef GLX_NV_copy_image
+FOUNDATION_GL_FUNCTION(void, glXCopyImageSubDataNV, (Display *dpy, GLXContext srcCtx, GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLXContext dstCtx, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei width, GLsizei height, GLsizei depth))
+#endif
+
+#ifdef GLX_NV_present_video
+FOUNDATION_GL_FUNCTION(unsigned int *, glXEnumerateVideoDevicesNV, (Display *dpy, int screen, int *nelements))
+FOUNDATION_GL_FUNCTION(int, glXBindVideoDeviceNV, (Display *dpy, unsigned int video_slot, unsigned int video_device, const int *attrib_list))
+#endif
+
+#ifdef GLX_NV_swap_group
+FOUNDATION_GL_FUNCTION(Bool, glXJoinSwapGroupNV, (Display *dpy, GLXDrawable drawable, GLuint group))
+FOUNDATION_GL_FUNCTION(Bool, glXBindSwapBarrierNV, (Display *dpy, GLuint group, GLuint barrier))
+FOUNDATION_GL_FUNCTION(Bool, glXQuerySwapGroupNV, (Display *dpy, GLXDrawable drawable, GLuint *group, GLuint *barrier))
+FOUNDATION_GL_FUNCTION(Bool, glXQueryMaxSwapGroupsNV, (Display *dpy, int screen, GLuint *maxGroups, GLuint *maxBarriers))
+FOUNDATION_GL_FUNCTION(Bool, glXQueryFrameCountNV, (Display *dpy, int screen, GLuint *count))
+FOUNDATION_GL_FUNCTION(Bool, glXResetFrameCountNV, (Display *dpy, int screen))
+#endif
+
+#ifdef GLX_NV_video_capture
+FOUNDATION_GL_FUNCTION(int, glXBindVideoCaptureDeviceNV, (Display *dpy, unsigned int video_capture_slot, GLXVideoCaptureDeviceNV device))
+FOUNDATION_GL_FUNCTION(GLXVideoCaptureDeviceNV *, glXEnumerateVideoCaptureDevicesNV, (Display *dpy, int screen, int *nelements))
+FOUNDATION_GL_FUNCTION(void, glXLockVideoCaptureDeviceNV, (Display *dpy, GLXVideoCaptureDeviceNV device))
+FOUNDATION_GL_FUNCTION(int, glXQueryVideoCaptureDeviceNV, (Display *dpy, GLXVideoCaptureDeviceNV device, int attribute, int *value))
+FOUNDATION_GL_FUNCTION(void, glXReleaseVideoCaptureDeviceNV, (Display *dpy, GLXVideoCaptureDeviceNV device))
+#endif
+
+#ifdef GLX_NV_video_output
+FOUNDATION_GL_FUNCTION(int, glXGetVideoDeviceNV, (Display *dpy, int screen, int numVideoDevices, GLXVideoDeviceNV *pVideoDevice))
+FOUNDATION_GL_FUNCTION(int, glXReleaseVideoDeviceNV, (Display *dpy, int screen, GLXVideoDeviceNV VideoDevice))
+FOUNDATION_GL_FUNCTION(int, glXBindVideoImageNV, (Display *dpy, GLXVideoDeviceNV VideoDevice, GLXPbuffer pbuf, int iVideoBuffer))
+FOUNDATION_GL_FUNCTION(int, glXReleaseVideoImageNV, (Display *dpy, GLXPbuffer pbuf))
+FOUNDATION_GL_FUNCTION(int, glXSendPbufferToVideoNV, (Display *dpy, GLXPbuffer pbuf, int iBufferType, unsigned long *pulCounterPbuffer, GLboolean bBlock))
+FOUNDATION_GL_FUNCTION(int, glXGetVideoInfoNV, (Display *dpy, int screen, GLXVideoDeviceNV VideoDevice, unsigned long *pulCounterOutputPbuffer, unsigned long *pulCounterOutputVideo))
+#endif
+
+#ifdef GLX_OML_sync_control
+FOUNDATION_GL_FUNCTION(Bool, glXGetSyncValuesOML, (Display *dpy, GLXDrawable drawable, int64_t *ust, int64_t *msc, int64_t *sbc))
+FOUNDATION_GL_FUNCTION(Bool, glXGetMscRateOML, (Display *dpy, GLXDrawable drawable, int32_t *numerator, int32_t *denominator))
+FOUNDATION_GL_FUNCTION(int64_t, glXSwapBuffersMscOML, (Display *dpy, GLXDrawable drawable, int64_t target_msc, int64_t divisor, int64_t remainder))
+FOUNDATION_GL_FUNCTION(Bool, glXWaitForMscOML, (Display *dpy, GLXDrawable drawable, int64_t target_msc, int64_t divisor, int64_t remainder, int64_t *ust, int64_t *msc, int64_t *sbc))
+FOUNDATION_GL_FUNCTION(Bool, glXWaitForSbcOML, (Display *dpy, GLXDrawable drawable, int64_t target_sbc, int64_t *ust, int64_t *msc, int64_t *sbc))
+#endif
+
+#ifdef GLX_SGIX_fbconfig
+FOUNDATION_GL_FUNCTION(int, glXGetFBConfigAttribSGIX, (Display *dpy, GLXFBConfigSGIX config, int attribute, int *value))
+FOUNDATION_GL_FUNCTION(GLXFBConfigSGIX *, glXChooseFBConfigSGIX, (Display *dpy, int screen, int *attrib_list, int *nelements))
+FOUNDATION_GL_FUNCTION(GLXPixmap, glXCreateGLXPixmapWithConfigSGIX, (Display *dpy, GLXFBConfigSGIX config, Pixmap pixmap))
+FOUNDATION_GL_FUNCTION(GLXContext, glXCreateContextWithConfigSGIX, (Display *dpy, GLXFBConfigSGIX config, int render_type, GLXContext share_list, Bool direct))
+FOUNDATION_GL_FUNCTION(XVisualInfo *, glXGetVisualFromFBConfigSGIX, (Display *dpy, GLXFBConfigSGIX config))
+FOUNDATION_GL_FUNCTION(GLXFBConfigSGIX, glXGetFBConfigFromVisualSGIX, (Display *dpy, XVisualInfo *vis))
+#endif
+
+#ifdef GLX_SGIX_hyperpipe
+FOUNDATION_GL_FUNCTION(GLXHyperpipeNetworkSGIX *, glXQueryHyperpipeNetworkSGIX, (Display *dpy, int *npipes))
+FOUNDATION_GL_FUNCTION(int, glXHyperpipeConfigSGIX, (Display *dpy, int networkId, int npipes, GLXHyperpipeConfigSGIX *cfg, int *hpId))
+FOUNDATION_GL_FUNCTION(GLXHyperpipeConfigSGIX *, glXQueryHyperpipeConfigSGIX, (Display *dpy, int hpId, int *npipes))
+FOUNDATION_GL_FUNCTION(int, glXDestroyHyperpipeConfigSGIX, (Display *dpy, int hpId))
+FOUNDATION_GL_FUNCTION(int, glXBindHyperpipeSGIX, (Display *dpy, int hpId))
+FOUNDATION_GL_FUNCTION(int, glXQueryHyperpipeBestAttribSGIX, (Display *dpy, int timeSlice, int attrib, int size, void *attribList, void *returnAttribList))
+FOUNDATION_GL_FUNCTION(int, glXHyperpipeAttribSGIX, (Display *dpy, int timeSlice, int attrib, int size, void *attribList))
+FOUNDATION_GL_FUNCTION(int, glXQueryHyperpipeAttribSGIX, (Display *dpy, int timeSlice, int attrib, int size, void *returnAttribList))
+#endif
+
+#ifdef GLX_SGIX_pbuffer
+FOUNDATION_GL_FUNCTION(GLXPbufferSGIX, glXCreateGLXPbufferSGIX, (Display *dpy, GLXFBConfigSGIX config, unsigned int width, unsigned int height, int *attrib_list))
+FOUNDATION_GL_FUNCTION(void, glXDestroyGLXPbufferSGIX, (Display *dpy, GLXPbufferSGIX pbuf))
+FOUNDATION_GL_FUNCTION(int, glXQueryGLXPbufferSGIX, (Display *dpy, GLXPbufferSGIX pbuf, int attribute, unsigned int *value))
+FOUNDATION_GL_FUNCTION(void, glXSelectEventSGIX, (Display *dpy, GLXDrawable drawable, unsigned long mask))
+FOUNDATION_GL_FUNCTION(void, glXGetSelectedEventSGIX, (Display *dpy, GLXDrawable drawable, unsigned long *mask))
+#endif
+
+#ifdef GLX_SGIX_swap_barrier
+FOUNDATION_GL_FUNCTION(void, glXBindSwapBarrierSGIX, (Display *dpy, GLXDrawable drawable, int barrier))
+FOUNDATION_GL_FUNCTION(Bool, glXQueryMaxSwapBarriersSGIX, (Display *dpy, int screen, int *max))
+#endif
+
+#ifdef GLX_SGIX_swap_group
+FOUNDATION_GL_FUNCTION(void, glXJoinSwapGroupSGIX, (Display *dpy, GLXDrawable drawable, GLXDrawable member))
+#endif
+
+#ifdef GLX_SGIX_video_resize
+FOUNDATION_GL_FUNCTION(int, glXBindChannelToWindowSGIX, (Display *display, int screen, int channel, Window window))
+FOUNDATION_GL_FUNCTION(int, glXChannelRectSGIX, (Display *display, int screen, int channel, int x, int y, int w, int h))
+FOUNDATION_GL_FUNCTION(int, glXQueryChannelRectSGIX, (Display *display, int screen, int channel, int *dx, int *dy, int *dw, int *dh))
+FOUNDATION_GL_FUNCTION(int, glXQueryChannelDeltasSGIX, (Display *display, int screen, int channel, int *x, int *y, int *w, int *h))
+FOUNDATION_GL_FUNCTION(int, glXChannelRectSyncSGIX, (Display *display, int screen, int channel, GLenum synctype))
+#endif
+
+#ifdef GLX_SGI_cushion
+FOUNDATION_GL_FUNCTION(void, glXCushionSGI, (Display *dpy, Window window, float cushion))
+#endif
+
+#ifdef GLX_SGI_make_current_read
+FOUNDATION_GL_FUNCTION(Bool, glXMakeCurrentReadSGI, (Display *dpy, GLXDrawable draw, GLXDrawable read, GLXContext ctx))
+FOUNDATION_GL_FUNCTION(GLXDrawable, glXGetCurrentReadDrawableSGI, (void))
+#endif
+
+#ifdef GLX_SGI_swap_control
+FOUNDATION_GL_FUNCTION(int, glXSwapIntervalSGI, (int interval))
+#endif
+
+#ifdef GLX_SGI_video_sync
+FOUNDATION_GL_FUNCTION(int, glXGetVideoSyncSGI, (unsigned int *count))
+FOUNDATION_GL_FUNCTION(int, glXWaitVideoSyncSGI, (int divisor, int remainder, unsigned int *count))
+#endif
+
+#ifdef GLX_SUN_get_transparent_index
+FOUNDATION_GL_FUNCTION(Status, glXGetTransparentIndexSUN, (Display *dpy, Window overlay, Window underlay, long *pTransparentIndex))
+#endif
+#endif
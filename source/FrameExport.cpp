@@ -0,0 +1,567 @@
+/**********************************************************************************************//**
+ * @file	WindowAPI\FrameExport.cpp
+ *
+ * @brief	Implements the shared memory frame exporter and reader classes.
+ **************************************************************************************************/
+
+#include "FrameExport.h"
+#include <cstring>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <limits.h>
+#else
+#include <thread>
+#include <chrono>
+#endif
+
+//the pixels of each slot start on a page boundary
+static const GLuint64 FrameExportAlignment = 4096;
+
+/**********************************************************************************************//**
+ * @fn	static GLuint64 AlignFrameExport(GLuint64 Size)
+ *
+ * @brief	Rounds a size up to the next page.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Size	The size in bytes.
+ *
+ * @return	The rounded size.
+ **************************************************************************************************/
+
+static GLuint64 AlignFrameExport(GLuint64 Size)
+{
+	return (Size + FrameExportAlignment - 1) & ~(FrameExportAlignment - 1);
+}
+
+/**********************************************************************************************//**
+ * @fn	FrameExporter::FrameExporter()
+ *
+ * @brief	Default constructor.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+FrameExporter::FrameExporter()
+{
+	Header = nullptr;
+	BlockSize = 0;
+	FrameCount = 0;
+	DroppedFrames = 0;
+#if defined(_WIN32) || defined(_WIN64)
+	Mapping = nullptr;
+#endif
+}
+
+/**********************************************************************************************//**
+ * @fn	FrameExporter::~FrameExporter()
+ *
+ * @brief	Destructor.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+FrameExporter::~FrameExporter()
+{
+	Destroy();
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FrameExporter::Create(const char* Name, GLuint MaxWidth, GLuint MaxHeight)
+ *
+ * @brief	Creates the shared block. on Linux this is POSIX shared memory under /Name, on
+ * 			Windows a paging file backed mapping under Local\Name. an old block under the name
+ * 			is unlinked and replaced on Linux. on Windows it fails while the old one is open.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Name	 	The name readers attach with.
+ * @param	MaxWidth 	The widest frame that will be published.
+ * @param	MaxHeight	The tallest frame that will be published.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FrameExporter::Create(const char* Name, GLuint MaxWidth, GLuint MaxHeight)
+{
+	if(!IsValidString(Name) || MaxWidth == 0 || MaxHeight == 0)
+	{
+		PrintErrorMessage(ERROR_FRAMEEXPORT);
+		return FOUNDATION_ERROR;
+	}
+
+	Destroy();
+
+	GLuint64 HeaderSize = AlignFrameExport(sizeof(FFrameExportHeader));
+	GLuint64 SlotSize = AlignFrameExport((GLuint64)MaxWidth * MaxHeight * 4);
+	BlockSize = HeaderSize + (SlotSize * FRAMEEXPORT_SLOTS);
+	void* Block = nullptr;
+
+#if defined(_WIN32) || defined(_WIN64)
+	this->Name = std::string("Local\\") + Name;
+	Mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+		(DWORD)(BlockSize >> 32), (DWORD)(BlockSize & 0xFFFFFFFF), this->Name.c_str());
+
+	//someone else's live block must not be written over
+	if(Mapping && GetLastError() == ERROR_ALREADY_EXISTS)
+	{
+		CloseHandle(Mapping);
+		Mapping = nullptr;
+	}
+
+	Block = Mapping ? MapViewOfFile(Mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0) : nullptr;
+#else
+	std::string SharedName = std::string("/") + Name;
+	//a block left under this name may still be mapped by readers, so it is unlinked rather than truncated
+	//under them. they keep the old block and anyone attaching from now on gets the new one
+	shm_unlink(SharedName.c_str());
+	GLint Descriptor = shm_open(SharedName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+
+	if(Descriptor >= 0)
+	{
+		this->Name = SharedName;
+
+		if(ftruncate(Descriptor, BlockSize) == 0)
+		{
+			Block = mmap(nullptr, BlockSize, PROT_READ | PROT_WRITE, MAP_SHARED, Descriptor, 0);
+			Block = (Block == MAP_FAILED) ? nullptr : Block;
+		}
+
+		//the mapping keeps the memory alive
+		close(Descriptor);
+	}
+#endif
+
+	if(!Block)
+	{
+		Destroy();
+		PrintErrorMessage(ERROR_FRAMEEXPORT);
+		return FOUNDATION_ERROR;
+	}
+
+	Header = new(Block) FFrameExportHeader();
+	Header->MaxWidth = MaxWidth;
+	Header->MaxHeight = MaxHeight;
+	Header->Published.store(0, std::memory_order_relaxed);
+	Header->LatestFrame.store(0, std::memory_order_relaxed);
+
+	for(GLuint Iter = 0; Iter < FRAMEEXPORT_SLOTS; Iter++)
+	{
+		Header->Slots[Iter].Sequence.store(0, std::memory_order_relaxed);
+		Header->Slots[Iter].FrameNumber = 0;
+		Header->Slots[Iter].Width = 0;
+		Header->Slots[Iter].Height = 0;
+		Header->Slots[Iter].Timestamp = 0;
+		Header->Slots[Iter].Offset = HeaderSize + (SlotSize * Iter);
+	}
+
+	Header->Version = FRAMEEXPORT_VERSION;
+	//readers check the magic last so they never see a half made header
+	std::atomic_thread_fence(std::memory_order_release);
+	Header->Magic = FRAMEEXPORT_MAGIC;
+
+	FrameCount = 0;
+	DroppedFrames = 0;
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FrameExporter::Destroy()
+ *
+ * @brief	Unmaps the shared block and removes its name.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void FrameExporter::Destroy()
+{
+#if defined(_WIN32) || defined(_WIN64)
+	if(Header)
+	{
+		UnmapViewOfFile(Header);
+	}
+
+	if(Mapping)
+	{
+		CloseHandle(Mapping);
+		Mapping = nullptr;
+	}
+#else
+	if(Header)
+	{
+		munmap(Header, BlockSize);
+	}
+
+	if(!Name.empty())
+	{
+		shm_unlink(Name.c_str());
+	}
+#endif
+
+	Header = nullptr;
+	BlockSize = 0;
+	Name.clear();
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FrameExporter::Publish(const GLubyte* Pixels, GLuint Width, GLuint Height)
+ *
+ * @brief	Copies a frame into the next slot of the ring and wakes every waiting reader. the
+ * 			slot's sequence is odd while it is written, so a reader that was still on the
+ * 			frame that used to be there can tell it was overwritten.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Pixels	The RGBA pixels of the frame.
+ * @param	Width 	The width of the frame.
+ * @param	Height	The height of the frame.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FrameExporter::Publish(const GLubyte* Pixels, GLuint Width, GLuint Height)
+{
+	if(!Header || !Pixels)
+	{
+		return FOUNDATION_ERROR;
+	}
+
+	if(Width > Header->MaxWidth || Height > Header->MaxHeight)
+	{
+		DroppedFrames++;
+		return FOUNDATION_ERROR;
+	}
+
+	FrameCount++;
+	FFrameExportSlot& Slot = Header->Slots[FrameCount % FRAMEEXPORT_SLOTS];
+	GLuint64 Sequence = Slot.Sequence.load(std::memory_order_relaxed);
+
+	Slot.Sequence.store(Sequence + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	memcpy((GLubyte*)Header + Slot.Offset, Pixels, (size_t)Width * Height * 4);
+	Slot.FrameNumber = FrameCount;
+	Slot.Width = Width;
+	Slot.Height = Height;
+	Slot.Timestamp = GetMonotonicTime();
+
+	Slot.Sequence.store(Sequence + 2, std::memory_order_release);
+	Header->LatestFrame.store(FrameCount, std::memory_order_release);
+	Header->Published.fetch_add(1, std::memory_order_release);
+
+#if defined(__linux__)
+	//the block is shared between processes so this can't be a private futex
+	syscall(SYS_futex, (GLuint*)&Header->Published, FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#endif
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLuint64 FrameExporter::GetPublishedFrames()
+ *
+ * @brief	Gets how many frames have been published since the block was created.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	The published frame count.
+ **************************************************************************************************/
+
+GLuint64 FrameExporter::GetPublishedFrames()
+{
+	return FrameCount;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLuint64 FrameExporter::GetDroppedFrames()
+ *
+ * @brief	Gets how many frames were dropped for being bigger than a slot.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	The dropped frame count.
+ **************************************************************************************************/
+
+GLuint64 FrameExporter::GetDroppedFrames()
+{
+	return DroppedFrames;
+}
+
+/**********************************************************************************************//**
+ * @fn	FrameExportReader::FrameExportReader()
+ *
+ * @brief	Default constructor.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+FrameExportReader::FrameExportReader()
+{
+	Header = nullptr;
+	BlockSize = 0;
+	LastFrame = 0;
+	CurrentSlot = nullptr;
+	CurrentSequence = 0;
+#if defined(_WIN32) || defined(_WIN64)
+	Mapping = nullptr;
+#endif
+}
+
+/**********************************************************************************************//**
+ * @fn	FrameExportReader::~FrameExportReader()
+ *
+ * @brief	Destructor.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+FrameExportReader::~FrameExportReader()
+{
+	Detach();
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FrameExportReader::Attach(const char* Name)
+ *
+ * @brief	Maps the block a FrameExporter created under the given name, read only.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Name	The name the exporter was created with.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FrameExportReader::Attach(const char* Name)
+{
+	if(!IsValidString(Name))
+	{
+		PrintErrorMessage(ERROR_FRAMEEXPORT);
+		return FOUNDATION_ERROR;
+	}
+
+	Detach();
+	void* Block = nullptr;
+
+#if defined(_WIN32) || defined(_WIN64)
+	Mapping = OpenFileMappingA(FILE_MAP_READ, GL_FALSE, (std::string("Local\\") + Name).c_str());
+	Block = Mapping ? MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+
+	if(Block)
+	{
+		MEMORY_BASIC_INFORMATION Information;
+		VirtualQuery(Block, &Information, sizeof(Information));
+		BlockSize = Information.RegionSize;
+	}
+#else
+	GLint Descriptor = shm_open((std::string("/") + Name).c_str(), O_RDONLY, 0);
+
+	if(Descriptor >= 0)
+	{
+		struct stat FileInfo;
+
+		if(fstat(Descriptor, &FileInfo) == 0 && (GLuint64)FileInfo.st_size >= sizeof(FFrameExportHeader))
+		{
+			BlockSize = FileInfo.st_size;
+			Block = mmap(nullptr, BlockSize, PROT_READ, MAP_SHARED, Descriptor, 0);
+			Block = (Block == MAP_FAILED) ? nullptr : Block;
+		}
+
+		close(Descriptor);
+	}
+#endif
+
+	Header = (FFrameExportHeader*)Block;
+
+	if(!Header || BlockSize < sizeof(FFrameExportHeader) || Header->Magic != FRAMEEXPORT_MAGIC || Header->Version != FRAMEEXPORT_VERSION)
+	{
+		Detach();
+		PrintErrorMessage(ERROR_FRAMEEXPORT);
+		return FOUNDATION_ERROR;
+	}
+
+	std::atomic_thread_fence(std::memory_order_acquire);
+	LastFrame = 0;
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FrameExportReader::Detach()
+ *
+ * @brief	Unmaps the block.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void FrameExportReader::Detach()
+{
+#if defined(_WIN32) || defined(_WIN64)
+	if(Header)
+	{
+		UnmapViewOfFile(Header);
+	}
+
+	if(Mapping)
+	{
+		CloseHandle(Mapping);
+		Mapping = nullptr;
+	}
+#else
+	if(Header)
+	{
+		munmap(Header, BlockSize);
+	}
+#endif
+
+	Header = nullptr;
+	BlockSize = 0;
+	CurrentSlot = nullptr;
+}
+
+/**********************************************************************************************//**
+ * @fn	const GLubyte* FrameExportReader::AcquireFrame(GLdouble Timeout, GLuint& Width,
+ * 		GLuint& Height, GLuint64& FrameNumber)
+ *
+ * @brief	Gets the newest frame in place if it is newer than the last one acquired, waiting up
+ * 			to Timeout seconds for one. frames in between are skipped, a reader that can't keep
+ * 			up only ever sees the latest.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Timeout			   	How long to wait for a new frame, in seconds. 0 to not wait.
+ * @param [in,out]	Width	   	The width of the frame.
+ * @param [in,out]	Height	   	The height of the frame.
+ * @param [in,out]	FrameNumber	Which frame this is, counting from 1.
+ *
+ * @return	The RGBA pixels of the frame, rows from the bottom up. null if there is no new frame
+ * 			or the slot describes pixels outside the block.
+ **************************************************************************************************/
+
+const GLubyte* FrameExportReader::AcquireFrame(GLdouble Timeout, GLuint& Width, GLuint& Height, GLuint64& FrameNumber)
+{
+	if(!Header)
+	{
+		PrintErrorMessage(ERROR_FRAMEEXPORT);
+		return nullptr;
+	}
+
+	GLuint Published = Header->Published.load(std::memory_order_acquire);
+	GLuint64 Latest = Header->LatestFrame.load(std::memory_order_acquire);
+
+	if(Latest <= LastFrame && Timeout > 0)
+	{
+		WaitForPublish(Published, Timeout);
+		Latest = Header->LatestFrame.load(std::memory_order_acquire);
+	}
+
+	if(Latest <= LastFrame)
+	{
+		return nullptr;
+	}
+
+	FFrameExportSlot* Slot = &Header->Slots[Latest % FRAMEEXPORT_SLOTS];
+	GLuint64 Sequence = Slot->Sequence.load(std::memory_order_acquire);
+
+	//the exporter has already lapped the ring and is writing over it
+	if(Sequence % 2 == 1 || Slot->FrameNumber != Latest)
+	{
+		return nullptr;
+	}
+
+	//the block is written by another process, so nothing in it is trusted to stay inside the mapping
+	GLuint FrameWidth = Slot->Width;
+	GLuint FrameHeight = Slot->Height;
+	GLuint64 Offset = Slot->Offset;
+
+	if(Offset < sizeof(FFrameExportHeader) || Offset > BlockSize ||
+		(GLuint64)FrameWidth * FrameHeight > (BlockSize - Offset) / 4)
+	{
+		PrintErrorMessage(ERROR_FRAMEEXPORT);
+		return nullptr;
+	}
+
+	Width = FrameWidth;
+	Height = FrameHeight;
+	FrameNumber = Latest;
+	LastFrame = Latest;
+	CurrentSlot = Slot;
+	CurrentSequence = Sequence;
+	return (const GLubyte*)Header + Offset;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FrameExportReader::ReleaseFrame()
+ *
+ * @brief	Finishes reading the acquired frame.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	false if the exporter started overwriting the frame while it was being read, in
+ * 			which case whatever was read may be torn.
+ **************************************************************************************************/
+
+GLboolean FrameExportReader::ReleaseFrame()
+{
+	if(!CurrentSlot)
+	{
+		return GL_FALSE;
+	}
+
+	std::atomic_thread_fence(std::memory_order_acquire);
+	GLboolean Intact = (CurrentSlot->Sequence.load(std::memory_order_relaxed) == CurrentSequence);
+	CurrentSlot = nullptr;
+	return Intact;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FrameExportReader::WaitForPublish(GLuint Expected, GLdouble Timeout)
+ *
+ * @brief	Blocks until the publish counter is no longer Expected or the timeout runs out. on
+ * 			Linux this sleeps on the counter as a futex. Windows can't wait on an address in
+ * 			another process so it checks every millisecond instead.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Expected	The publish counter the caller last saw.
+ * @param	Timeout 	The longest to wait, in seconds.
+ **************************************************************************************************/
+
+void FrameExportReader::WaitForPublish(GLuint Expected, GLdouble Timeout)
+{
+	GLdouble Deadline = GetMonotonicTime() + Timeout;
+	GLdouble Remaining = Timeout;
+
+	while(Remaining > 0 && Header->Published.load(std::memory_order_acquire) == Expected)
+	{
+#if defined(__linux__)
+		timespec Wait;
+		Wait.tv_sec = (time_t)Remaining;
+		Wait.tv_nsec = (long)((Remaining - (GLdouble)Wait.tv_sec) * 1e9);
+		syscall(SYS_futex, (GLuint*)&Header->Published, FUTEX_WAIT, Expected, &Wait, nullptr, 0);
+#else
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+#endif
+		Remaining = Deadline - GetMonotonicTime();
+	}
+}
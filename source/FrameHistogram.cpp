@@ -0,0 +1,194 @@
+/**********************************************************************************************//**
+ * @file	WindowAPI\FrameHistogram.cpp
+ *
+ * @brief	Implements the frame histogram class.
+ **************************************************************************************************/
+
+#include "FrameHistogram.h"
+#include <limits.h>
+
+/**********************************************************************************************//**
+ * @fn	FrameHistogram::FrameHistogram()
+ *
+ * @brief	Default constructor.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+FrameHistogram::FrameHistogram()
+{
+	Reset();
+}
+
+/**********************************************************************************************//**
+ * @fn	void FrameHistogram::Record(GLdouble Seconds, GLdouble Deadline)
+ *
+ * @brief	Records a sample.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Seconds 	The sample in seconds.
+ * @param	Deadline	The deadline the sample should have been under. 0 for no deadline.
+ **************************************************************************************************/
+
+void FrameHistogram::Record(GLdouble Seconds, GLdouble Deadline)
+{
+	GLuint64 Microseconds = (Seconds > 0) ? (GLuint64)(Seconds * 1e6) : 0;
+	GLuint64 Current = 0;
+
+	Buckets[GetBucket(Microseconds)].fetch_add(1, std::memory_order_relaxed);
+	Total.fetch_add(Microseconds, std::memory_order_relaxed);
+
+	Current = Min.load(std::memory_order_relaxed);
+	while(Microseconds < Current && !Min.compare_exchange_weak(Current, Microseconds, std::memory_order_relaxed));
+
+	Current = Max.load(std::memory_order_relaxed);
+	while(Microseconds > Current && !Max.compare_exchange_weak(Current, Microseconds, std::memory_order_relaxed));
+
+	if(Deadline > 0 && Seconds > Deadline)
+	{
+		MissedDeadlines.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+/**********************************************************************************************//**
+ * @fn	FFrameStatistics FrameHistogram::GetStatistics()
+ *
+ * @brief	Summarizes everything recorded since the last reset. percentiles are accurate to
+ * 			the width of their bucket and clamped to the real min and max.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	The statistics.
+ **************************************************************************************************/
+
+FFrameStatistics FrameHistogram::GetStatistics()
+{
+	FFrameStatistics Statistics;
+	GLuint64 Snapshot[FRAMEHISTOGRAM_BUCKETS];
+	GLuint64 Samples = 0;
+
+	for(GLuint Bucket = 0; Bucket < FRAMEHISTOGRAM_BUCKETS; Bucket++)
+	{
+		Snapshot[Bucket] = Buckets[Bucket].load(std::memory_order_relaxed);
+		Samples += Snapshot[Bucket];
+	}
+
+	if(Samples == 0)
+	{
+		return Statistics;
+	}
+
+	GLdouble MinValue = (GLdouble)Min.load(std::memory_order_relaxed);
+	GLdouble MaxValue = (GLdouble)Max.load(std::memory_order_relaxed);
+	GLdouble Percentiles[3] = { 0.50, 0.95, 0.99 };
+	GLdouble* Results[3] = { &Statistics.P50, &Statistics.P95, &Statistics.P99 };
+	GLuint64 Seen = 0;
+	GLuint CurrentPercentile = 0;
+
+	for(GLuint Bucket = 0; Bucket < FRAMEHISTOGRAM_BUCKETS && CurrentPercentile < 3; Bucket++)
+	{
+		Seen += Snapshot[Bucket];
+
+		while(CurrentPercentile < 3 && Seen >= (GLuint64)(Percentiles[CurrentPercentile] * Samples + 0.5) && Seen > 0)
+		{
+			GLdouble Value = GetBucketValue(Bucket);
+			Value = (Value < MinValue) ? MinValue : Value;
+			Value = (Value > MaxValue) ? MaxValue : Value;
+			*Results[CurrentPercentile++] = Value * 1e-6;
+		}
+	}
+
+	Statistics.Count = Samples;
+	Statistics.Min = MinValue * 1e-6;
+	Statistics.Max = MaxValue * 1e-6;
+	Statistics.Mean = ((GLdouble)Total.load(std::memory_order_relaxed) / Samples) * 1e-6;
+	Statistics.MissedDeadlines = MissedDeadlines.load(std::memory_order_relaxed);
+	return Statistics;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FrameHistogram::Reset()
+ *
+ * @brief	Forgets everything recorded so far.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void FrameHistogram::Reset()
+{
+	for(GLuint Bucket = 0; Bucket < FRAMEHISTOGRAM_BUCKETS; Bucket++)
+	{
+		Buckets[Bucket].store(0, std::memory_order_relaxed);
+	}
+
+	Total.store(0, std::memory_order_relaxed);
+	Min.store(ULLONG_MAX, std::memory_order_relaxed);
+	Max.store(0, std::memory_order_relaxed);
+	MissedDeadlines.store(0, std::memory_order_relaxed);
+}
+
+/**********************************************************************************************//**
+ * @fn	GLuint FrameHistogram::GetBucket(GLuint64 Microseconds)
+ *
+ * @brief	Gets which bucket a sample falls in.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Microseconds	The sample in microseconds.
+ *
+ * @return	The bucket index.
+ **************************************************************************************************/
+
+GLuint FrameHistogram::GetBucket(GLuint64 Microseconds)
+{
+	if(Microseconds < FRAMEHISTOGRAM_SUBBUCKETS)
+	{
+		return (GLuint)Microseconds;
+	}
+
+	//find the highest set bit. at least 4 since the value is 16 or more
+	GLuint Exponent = 0;
+
+	for(GLuint64 Value = Microseconds; Value > 1; Value >>= 1)
+	{
+		Exponent++;
+	}
+
+	GLuint Bucket = ((Exponent - 3) * FRAMEHISTOGRAM_SUBBUCKETS) +
+		(GLuint)((Microseconds >> (Exponent - 4)) & (FRAMEHISTOGRAM_SUBBUCKETS - 1));
+
+	return (Bucket < FRAMEHISTOGRAM_BUCKETS) ? Bucket : FRAMEHISTOGRAM_BUCKETS - 1;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLdouble FrameHistogram::GetBucketValue(GLuint Bucket)
+ *
+ * @brief	Gets the value in the middle of a bucket.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Bucket	The bucket index.
+ *
+ * @return	The middle of the bucket in microseconds.
+ **************************************************************************************************/
+
+GLdouble FrameHistogram::GetBucketValue(GLuint Bucket)
+{
+	if(Bucket < FRAMEHISTOGRAM_SUBBUCKETS)
+	{
+		return Bucket + 0.5;
+	}
+
+	GLuint Exponent = (Bucket / FRAMEHISTOGRAM_SUBBUCKETS) + 3;
+	GLdouble Width = (GLdouble)(1ULL << (Exponent - 4));
+	GLdouble Start = (GLdouble)(FRAMEHISTOGRAM_SUBBUCKETS + (Bucket % FRAMEHISTOGRAM_SUBBUCKETS)) * Width;
+
+	return Start + (Width * 0.5);
+}
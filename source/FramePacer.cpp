@@ -0,0 +1,316 @@
+/**********************************************************************************************//**
+ * @file	WindowAPI\FramePacer.cpp
+ *
+ * @brief	Implements the frame pacer class.
+ **************************************************************************************************/
+
+#include "FramePacer.h"
+#include <math.h>
+#include <thread>
+#include <chrono>
+
+/**********************************************************************************************//**
+ * @fn	FramePacer::FramePacer(GLdouble TargetFPS)
+ *
+ * @brief	Constructor.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	TargetFPS	The frame rate to cap to. 0 for uncapped.
+ **************************************************************************************************/
+
+FramePacer::FramePacer(GLdouble TargetFPS)
+{
+	TargetFrameTime = 0;
+	//sleeping tends to overshoot by up to a millisecond or so
+	SpinThreshold = 0.002;
+	VBlankTime = 0;
+	VBlankPeriod = 0;
+	SetTargetFPS(TargetFPS);
+	Reset();
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FramePacer::SetTargetFPS(GLdouble TargetFPS)
+ *
+ * @brief	Sets the frame rate to cap to.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	TargetFPS	The frame rate to cap to. 0 for uncapped.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FramePacer::SetTargetFPS(GLdouble TargetFPS)
+{
+	if(TargetFPS < 0)
+	{
+		PrintErrorMessage(ERROR_INVALIDFRAMERATE);
+		return FOUNDATION_ERROR;
+	}
+
+	TargetFrameTime = (TargetFPS > 0) ? 1.0 / TargetFPS : 0;
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLdouble FramePacer::GetTargetFPS()
+ *
+ * @brief	Gets the frame rate the pacer caps to.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	The target frame rate. 0 if uncapped.
+ **************************************************************************************************/
+
+GLdouble FramePacer::GetTargetFPS()
+{
+	return (TargetFrameTime > 0) ? 1.0 / TargetFrameTime : 0;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FramePacer::SetSpinThreshold(GLdouble Seconds)
+ *
+ * @brief	Sets how long before a deadline the pacer stops sleeping and starts spinning.
+ * 			larger values are more accurate but burn more CPU.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Seconds	The spin threshold in seconds.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FramePacer::SetSpinThreshold(GLdouble Seconds)
+{
+	if(Seconds < 0)
+	{
+		PrintErrorMessage(ERROR_INVALIDFRAMERATE);
+		return FOUNDATION_ERROR;
+	}
+
+	SpinThreshold = Seconds;
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FramePacer::WaitForNextFrame()
+ *
+ * @brief	Blocks until the next frame is due. deadlines advance by a fixed interval rather
+ * 			than from whenever the last frame happened to finish so the rate doesn't drift, but
+ * 			if the application falls more than a frame behind the schedule restarts instead of
+ * 			rushing out frames to catch up. with vblank information the interval is rounded to
+ * 			whole refreshes and the deadline is moved onto the closest refresh.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void FramePacer::WaitForNextFrame()
+{
+	if(TargetFrameTime <= 0)
+	{
+		return;
+	}
+
+	GLdouble Now = GetMonotonicTime();
+	GLdouble Interval = TargetFrameTime;
+	GLdouble Margin = 0;
+
+	if(VBlankPeriod > 0)
+	{
+		Interval = VBlankPeriod * fmax(1.0, floor((TargetFrameTime / VBlankPeriod) + 0.5));
+		//submit a little before the refresh so the swap can still make it
+		Margin = fmin(SpinThreshold, VBlankPeriod * 0.25);
+	}
+
+	NextFrameTime = (NextFrameTime > 0) ? NextFrameTime + Interval : Now;
+
+	if(NextFrameTime < Now - Interval)
+	{
+		NextFrameTime = Now;
+	}
+
+	if(VBlankTime > 0 && VBlankPeriod > 0)
+	{
+		NextFrameTime = VBlankTime + (VBlankPeriod * floor(((NextFrameTime - VBlankTime) / VBlankPeriod) + 0.5));
+	}
+
+	WaitUntil(NextFrameTime - Margin);
+}
+
+/**********************************************************************************************//**
+ * @fn	void FramePacer::FrameFinished()
+ *
+ * @brief	Records that a frame was just presented.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void FramePacer::FrameFinished()
+{
+	GLdouble Now = GetMonotonicTime();
+
+	if(LastPresentTime > 0)
+	{
+		FrameTimes[FrameTimeIndex] = Now - LastPresentTime;
+		FrameTimeIndex = (FrameTimeIndex + 1) % FRAMEPACER_HISTORY;
+
+		if(FrameTimeCount < FRAMEPACER_HISTORY)
+		{
+			FrameTimeCount++;
+		}
+	}
+
+	LastPresentTime = Now;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FramePacer::SetVBlank(GLdouble Time, GLdouble Period)
+ *
+ * @brief	Tells the pacer when the display last refreshed and its refresh period.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Time  	When the display last refreshed according to GetMonotonicTime. 0 if unknown.
+ * @param	Period	How long a refresh takes in seconds. 0 if unknown.
+ **************************************************************************************************/
+
+void FramePacer::SetVBlank(GLdouble Time, GLdouble Period)
+{
+	VBlankTime = Time;
+	VBlankPeriod = Period;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLdouble FramePacer::GetLastFrameTime()
+ *
+ * @brief	Gets the time between the last two frames.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	The last frame time in seconds. 0 if fewer than two frames have been presented.
+ **************************************************************************************************/
+
+GLdouble FramePacer::GetLastFrameTime()
+{
+	if(FrameTimeCount == 0)
+	{
+		return 0;
+	}
+
+	return FrameTimes[(FrameTimeIndex + FRAMEPACER_HISTORY - 1) % FRAMEPACER_HISTORY];
+}
+
+/**********************************************************************************************//**
+ * @fn	GLdouble FramePacer::GetAverageFrameTime()
+ *
+ * @brief	Gets the average time between frames over the recent history.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	The average frame time in seconds.
+ **************************************************************************************************/
+
+GLdouble FramePacer::GetAverageFrameTime()
+{
+	if(FrameTimeCount == 0)
+	{
+		return 0;
+	}
+
+	GLdouble Total = 0;
+
+	for(GLuint Iter = 0; Iter < FrameTimeCount; Iter++)
+	{
+		Total += FrameTimes[Iter];
+	}
+
+	return Total / FrameTimeCount;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLdouble FramePacer::GetJitter()
+ *
+ * @brief	Gets the standard deviation of the time between frames over the recent history.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	The frame time jitter in seconds.
+ **************************************************************************************************/
+
+GLdouble FramePacer::GetJitter()
+{
+	if(FrameTimeCount < 2)
+	{
+		return 0;
+	}
+
+	GLdouble Average = GetAverageFrameTime();
+	GLdouble Variance = 0;
+
+	for(GLuint Iter = 0; Iter < FrameTimeCount; Iter++)
+	{
+		Variance += (FrameTimes[Iter] - Average) * (FrameTimes[Iter] - Average);
+	}
+
+	return sqrt(Variance / FrameTimeCount);
+}
+
+/**********************************************************************************************//**
+ * @fn	void FramePacer::Reset()
+ *
+ * @brief	Forgets the frame history and the current deadline.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void FramePacer::Reset()
+{
+	NextFrameTime = 0;
+	LastPresentTime = 0;
+	FrameTimeIndex = 0;
+	FrameTimeCount = 0;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FramePacer::WaitUntil(GLdouble Deadline)
+ *
+ * @brief	Sleeps until shortly before the deadline then spins the rest of the way.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Deadline	When to return according to GetMonotonicTime.
+ **************************************************************************************************/
+
+void FramePacer::WaitUntil(GLdouble Deadline)
+{
+	GLdouble Remaining = Deadline - GetMonotonicTime();
+
+	while(Remaining > 0)
+	{
+		if(Remaining > SpinThreshold)
+		{
+			std::this_thread::sleep_for(std::chrono::duration<GLdouble>(Remaining - SpinThreshold));
+		}
+
+		else
+		{
+			std::this_thread::yield();
+		}
+
+		Remaining = Deadline - GetMonotonicTime();
+	}
+}
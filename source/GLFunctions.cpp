@@ -0,0 +1,215 @@
+/**********************************************************************************************//**
+ * @file	WindowAPI\GLFunctions.cpp
+ *
+ * @brief	Implements the OpenGL function dispatch table.
+ **************************************************************************************************/
+
+#include "GLFunctions.h"
+#include <mutex>
+
+FOUNDATION_THREADLOCAL FGLFunctions* FGLFunctions::Current = nullptr;
+
+//an index for every entry in the table so the trampolines can find their names
+enum
+{
+#define FOUNDATION_GL_FUNCTION(Return, Name, Parameters) GLFUNCTION_##Name,
+#include "dependencies/glfunctionlist.h"
+#undef FOUNDATION_GL_FUNCTION
+	GLFUNCTION_COUNT
+};
+
+static const char* const FunctionNames[GLFUNCTION_COUNT] =
+{
+#define FOUNDATION_GL_FUNCTION(Return, Name, Parameters) #Name,
+#include "dependencies/glfunctionlist.h"
+#undef FOUNDATION_GL_FUNCTION
+};
+
+static std::mutex SlotLock;
+static FGLFunctions* SlotTables[GLFUNCTIONS_MAXTABLES] = {}; /**< the table that owns each set of trampolines */
+
+/**
+* stands in for an entry until it is first called. it resolves the real function and forwards the
+* call. the function is only written back into the table that owns the trampoline, and only when 
+* that table's renderer is current, since the address belongs to the driver of the current context.
+* with a table of the wrong renderer current the call is still forwarded but nothing is stored. 
+* each slot gets its own thin set of trampolines so they know which table they were called through
+*/
+template<typename Type, Type FGLFunctions::*Entry, GLuint Index>
+struct FTrampoline;
+
+template<typename Return, typename... Arguments, Return (APIENTRY *FGLFunctions::*Entry)(Arguments...), GLuint Index>
+struct FTrampoline<Return (APIENTRY *)(Arguments...), Entry, Index>
+{
+	static Return Forward(GLuint Slot, Arguments... Values)
+	{
+		typedef Return (APIENTRY *Function)(Arguments...);
+		Function Resolved = (Function)FGLFunctions::Resolve(FunctionNames[Index]);
+
+		if(!FGLFunctions::Current || !Resolved)
+		{
+			PrintErrorMessage(ERROR_GLFUNCTIONNOTFOUND);
+			return Return();
+		}
+
+		if(Slot < GLFUNCTIONS_MAXTABLES && SlotTables[Slot] == FGLFunctions::Current)
+		{
+			FGLFunctions::Current->*Entry = Resolved;
+		}
+
+		return Resolved(Values...);
+	}
+
+	template<GLuint Slot>
+	static Return APIENTRY Call(Arguments... Values)
+	{
+		return Forward(Slot, Values...);
+	}
+};
+
+//point every entry of the table at the trampolines of the given slot
+template<GLuint Slot>
+static void BindTrampolines(FGLFunctions* Table)
+{
+#define FOUNDATION_GL_FUNCTION(Return, Name, Parameters) \
+	Table->Name = &FTrampoline<decltype(Table->Name), &FGLFunctions::Name, GLFUNCTION_##Name>::template Call<Slot>;
+#include "dependencies/glfunctionlist.h"
+#undef FOUNDATION_GL_FUNCTION
+}
+
+//turns the runtime slot into the template argument BindTrampolines needs
+template<GLuint Slot>
+struct FTrampolineBinder
+{
+	static void Bind(FGLFunctions* Table)
+	{
+		if(Table->Slot == Slot)
+		{
+			BindTrampolines<Slot>(Table);
+			return;
+		}
+
+		FTrampolineBinder<Slot + 1>::Bind(Table);
+	}
+};
+
+template<>
+struct FTrampolineBinder<GLFUNCTIONS_MAXTABLES>
+{
+	static void Bind(FGLFunctions* Table)
+	{
+		BindTrampolines<GLFUNCTIONS_MAXTABLES>(Table);
+	}
+};
+
+/**********************************************************************************************//**
+ * @fn	FGLFunctions::FGLFunctions()
+ *
+ * @brief	Constructor. takes a free slot and points every entry at that slot's trampolines so
+ * 			nothing is looked up yet.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+FGLFunctions::FGLFunctions() :
+	Loaded(GL_FALSE),
+	Slot(GLFUNCTIONS_MAXTABLES)
+{
+	{
+		std::lock_guard<std::mutex> Guard(SlotLock);
+
+		for(GLuint Iter = 0; Iter < GLFUNCTIONS_MAXTABLES; Iter++)
+		{
+			if(!SlotTables[Iter])
+			{
+				SlotTables[Iter] = this;
+				Slot = Iter;
+				break;
+			}
+		}
+	}
+
+	FTrampolineBinder<0>::Bind(this);
+}
+
+/**********************************************************************************************//**
+ * @fn	FGLFunctions::~FGLFunctions()
+ *
+ * @brief	Destructor. frees the slot for the next table.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+FGLFunctions::~FGLFunctions()
+{
+	std::lock_guard<std::mutex> Guard(SlotLock);
+
+	if(Slot < GLFUNCTIONS_MAXTABLES)
+	{
+		SlotTables[Slot] = nullptr;
+	}
+}
+
+/**********************************************************************************************//**
+ * @fn	void FGLFunctions::Load()
+ *
+ * @brief	Resolves every entry in bulk. entries that can't be found keep their trampoline so
+ * 			calling them reports an error instead of crashing. must be called with a context of
+ * 			this table's renderer current.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void FGLFunctions::Load()
+{
+	if(Loaded)
+	{
+		return;
+	}
+
+	void* Function = nullptr;
+
+#define FOUNDATION_GL_FUNCTION(Return, Name, Parameters) \
+	if((Function = Resolve(#Name)) != nullptr) \
+	{ \
+		Name = (decltype(Name))Function; \
+	}
+#include "dependencies/glfunctionlist.h"
+#undef FOUNDATION_GL_FUNCTION
+
+	Loaded = GL_TRUE;
+}
+
+/**********************************************************************************************//**
+ * @fn	void* FGLFunctions::Resolve(const char* Name)
+ *
+ * @brief	Looks up a function of the current context.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Name	The name of the function.
+ *
+ * @return	null if it can't be found, else the function.
+ **************************************************************************************************/
+
+void* FGLFunctions::Resolve(const char* Name)
+{
+#if defined(_WIN32) || defined(_WIN64)
+	void* Function = (void*)wglGetProcAddress(Name);
+
+	//some drivers hand back small values instead of null on failure
+	if(Function == (void*)1 || Function == (void*)2 || Function == (void*)3 || Function == (void*)-1)
+	{
+		return nullptr;
+	}
+
+	return Function;
+#else
+	//the table has a member of the same name
+	return (void*)::glXGetProcAddress((const GLubyte*)Name);
+#endif
+}
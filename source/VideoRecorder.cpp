@@ -0,0 +1,479 @@
+/**********************************************************************************************//**
+ * @file	WindowAPI\VideoRecorder.cpp
+ *
+ * @brief	Implements the Y4M video recorder class.
+ **************************************************************************************************/
+
+#include "VideoRecorder.h"
+#include <cstring>
+
+/*frames are converted with the full range BT.601 matrix in 8.8 fixed point, which is what
+C420jpeg in the stream header tells players to expect*/
+
+/**********************************************************************************************//**
+ * @fn	VideoRecorder::VideoRecorder()
+ *
+ * @brief	Default constructor.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+VideoRecorder::VideoRecorder()
+{
+	File = nullptr;
+	Width = 0;
+	Height = 0;
+	FrameSize = 0;
+	PendingDrops = 0;
+	Submitted.store(0);
+	Written.store(0);
+	DroppedFrames.store(0);
+	Running.store(GL_FALSE);
+	WriteFailed.store(GL_FALSE);
+}
+
+/**********************************************************************************************//**
+ * @fn	VideoRecorder::~VideoRecorder()
+ *
+ * @brief	Destructor.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+VideoRecorder::~VideoRecorder()
+{
+	Stop();
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean VideoRecorder::Start(const char* FileName, GLuint Width, GLuint Height, GLuint FramesPerSecond)
+ *
+ * @brief	Creates the file, writes the stream header, sets aside the frame ring and starts the
+ * 			writer thread. 4:2:0 needs an even size so an odd width or height loses its last
+ * 			column or row.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	FileName	   	The file to record to. overwritten if it exists.
+ * @param	Width		   	The width of the frames that will be submitted.
+ * @param	Height		   	The height of the frames that will be submitted.
+ * @param	FramesPerSecond	The frame rate written in the stream header.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean VideoRecorder::Start(const char* FileName, GLuint Width, GLuint Height, GLuint FramesPerSecond)
+{
+	if(!IsValidString(FileName) || Width < 2 || Height < 2 || FramesPerSecond == 0)
+	{
+		PrintErrorMessage(ERROR_VIDEORECORDER);
+		return FOUNDATION_ERROR;
+	}
+
+	Stop();
+
+	File = fopen(FileName, "wb");
+
+	if(!File)
+	{
+		PrintErrorMessage(ERROR_VIDEORECORDER);
+		return FOUNDATION_ERROR;
+	}
+
+	this->Width = Width & ~1u;
+	this->Height = Height & ~1u;
+	FrameSize = ((GLuint64)this->Width * this->Height * 3) / 2;
+	fprintf(File, "YUV4MPEG2 W%u H%u F%u:1 Ip A1:1 C420jpeg\n", this->Width, this->Height, FramesPerSecond);
+
+	for(GLuint Iter = 0; Iter < VIDEORECORDER_QUEUE; Iter++)
+	{
+		Frames[Iter].resize((size_t)FrameSize);
+		DropsBefore[Iter] = 0;
+	}
+
+	PendingDrops = 0;
+	Submitted.store(0);
+	Written.store(0);
+	DroppedFrames.store(0);
+	WriteFailed.store(GL_FALSE);
+	ConvertTimes.Reset();
+	WriteTimes.Reset();
+	Running.store(GL_TRUE);
+	Writer = std::thread(&VideoRecorder::WriterLoop, this);
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	void VideoRecorder::Stop()
+ *
+ * @brief	Lets the writer thread finish every queued frame, fills in the frames dropped after
+ * 			the last one, then closes the file.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void VideoRecorder::Stop()
+{
+	if(!File)
+	{
+		return;
+	}
+
+	Running.store(GL_FALSE);
+
+	{
+		std::lock_guard<std::mutex> Lock(WakeLock);
+	}
+
+	WakeWriter.notify_one();
+
+	if(Writer.joinable())
+	{
+		Writer.join();
+	}
+
+	GLuint64 Last = Written.load();
+
+	for(; PendingDrops > 0 && Last > 0; PendingDrops--)
+	{
+		WriteFrame(Frames[(Last - 1) % VIDEORECORDER_QUEUE]);
+	}
+
+	PendingDrops = 0;
+	fclose(File);
+	File = nullptr;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean VideoRecorder::GetIsRecording()
+ *
+ * @brief	Gets whether a recording is in progress.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean VideoRecorder::GetIsRecording()
+{
+	return (File != nullptr);
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean VideoRecorder::SubmitFrame(const GLubyte* Pixels, GLuint Width, GLuint Height)
+ *
+ * @brief	Converts a frame into the next free buffer of the ring and wakes the writer thread.
+ * 			if the writer hasn't freed a buffer yet the frame is dropped rather than waited on,
+ * 			and the writer repeats the frame before it in its place. the buffer of the last 
+ * 			written frame is never reused while it may still be repeated. rows are flipped on
+ * 			the way since Y4M stores them from the top down.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Pixels	The RGBA pixels of the frame, rows from the bottom up.
+ * @param	Width 	The width of the frame.
+ * @param	Height	The height of the frame.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean VideoRecorder::SubmitFrame(const GLubyte* Pixels, GLuint Width, GLuint Height)
+{
+	if(!File || !Pixels)
+	{
+		return FOUNDATION_ERROR;
+	}
+
+	GLuint64 Queued = Submitted.load(std::memory_order_relaxed);
+
+	if((Width & ~1u) != this->Width || (Height & ~1u) != this->Height || WriteFailed.load(std::memory_order_relaxed) ||
+		Queued - Written.load(std::memory_order_acquire) >= VIDEORECORDER_QUEUE - 1)
+	{
+		DroppedFrames.fetch_add(1, std::memory_order_relaxed);
+		PendingDrops++;
+		return FOUNDATION_ERROR;
+	}
+
+	GLdouble Start = GetMonotonicTime();
+	GLubyte* Luma = Frames[Queued % VIDEORECORDER_QUEUE].data();
+	GLubyte* ChromaU = Luma + ((size_t)this->Width * this->Height);
+	GLubyte* ChromaV = ChromaU + ((size_t)this->Width * this->Height) / 4;
+	size_t Stride = (size_t)Width * 4;
+
+	for(GLuint Row = 0; Row < this->Height; Row += 2)
+	{
+		const GLubyte* Top = Pixels + (Stride * (Height - 1 - Row));
+
+		ConvertRowPair(Top, Top - Stride, Luma + ((size_t)this->Width * Row), Luma + ((size_t)this->Width * (Row + 1)),
+			ChromaU + ((size_t)(this->Width / 2) * (Row / 2)), ChromaV + ((size_t)(this->Width / 2) * (Row / 2)), this->Width);
+	}
+
+	ConvertTimes.Record(GetMonotonicTime() - Start);
+	DropsBefore[Queued % VIDEORECORDER_QUEUE] = PendingDrops;
+	PendingDrops = 0;
+	Submitted.store(Queued + 1, std::memory_order_release);
+
+	//only ever held for as long as the writer takes to check whether it should sleep
+	{
+		std::lock_guard<std::mutex> Lock(WakeLock);
+	}
+
+	WakeWriter.notify_one();
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLuint64 VideoRecorder::GetWrittenFrames()
+ *
+ * @brief	Gets how many frames have been written to disk.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	The number of written frames.
+ **************************************************************************************************/
+
+GLuint64 VideoRecorder::GetWrittenFrames()
+{
+	return Written.load(std::memory_order_relaxed);
+}
+
+/**********************************************************************************************//**
+ * @fn	GLuint64 VideoRecorder::GetDroppedFrames()
+ *
+ * @brief	Gets how many frames were dropped because the queue was full, the frame was the
+ * 			wrong size or a write had failed. each one was written as a copy of the frame
+ * 			before it.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	The number of dropped frames.
+ **************************************************************************************************/
+
+GLuint64 VideoRecorder::GetDroppedFrames()
+{
+	return DroppedFrames.load(std::memory_order_relaxed);
+}
+
+/**********************************************************************************************//**
+ * @fn	FFrameStatistics VideoRecorder::GetConvertStatistics()
+ *
+ * @brief	Gets statistics on how long each frame took to convert on the submitting thread.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	The convert statistics.
+ **************************************************************************************************/
+
+FFrameStatistics VideoRecorder::GetConvertStatistics()
+{
+	return ConvertTimes.GetStatistics();
+}
+
+/**********************************************************************************************//**
+ * @fn	FFrameStatistics VideoRecorder::GetWriteStatistics()
+ *
+ * @brief	Gets statistics on how long each frame took to write on the writer thread.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	The write statistics.
+ **************************************************************************************************/
+
+FFrameStatistics VideoRecorder::GetWriteStatistics()
+{
+	return WriteTimes.GetStatistics();
+}
+
+/**********************************************************************************************//**
+ * @fn	void VideoRecorder::WriterLoop()
+ *
+ * @brief	Writes queued frames in order, sleeping while the queue is empty. the frames dropped
+ * 			right before a frame are written first as copies of the previous one(or of the frame
+ * 			itself if nothing came before it). once told to stop it keeps going until every 
+ * 			queued frame is written.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void VideoRecorder::WriterLoop()
+{
+	while(true)
+	{
+		GLuint64 Next = Written.load(std::memory_order_relaxed);
+
+		if(Next < Submitted.load(std::memory_order_acquire))
+		{
+			GLdouble Start = GetMonotonicTime();
+			GLuint64 Slot = Next % VIDEORECORDER_QUEUE;
+			GLuint64 Previous = (Next > 0) ? (Next - 1) % VIDEORECORDER_QUEUE : Slot;
+
+			for(GLuint64 Iter = 0; Iter < DropsBefore[Slot]; Iter++)
+			{
+				WriteFrame(Frames[Previous]);
+			}
+
+			WriteFrame(Frames[Slot]);
+			WriteTimes.Record(GetMonotonicTime() - Start);
+			Written.store(Next + 1, std::memory_order_release);
+			continue;
+		}
+
+		if(!Running.load())
+		{
+			break;
+		}
+
+		std::unique_lock<std::mutex> Lock(WakeLock);
+		WakeWriter.wait(Lock, [this]
+		{
+			return !Running.load() || Written.load(std::memory_order_relaxed) < Submitted.load(std::memory_order_acquire);
+		});
+	}
+
+	fflush(File);
+}
+
+/**********************************************************************************************//**
+ * @fn	void VideoRecorder::WriteFrame(const std::vector<GLubyte>& Frame)
+ *
+ * @brief	Writes a converted frame with its header. does nothing once a write has failed.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Frame	The converted frame.
+ **************************************************************************************************/
+
+void VideoRecorder::WriteFrame(const std::vector<GLubyte>& Frame)
+{
+	static const char FrameHeader[] = "FRAME\n";
+
+	if(!WriteFailed.load(std::memory_order_relaxed) &&
+		(fwrite(FrameHeader, 1, sizeof(FrameHeader) - 1, File) != sizeof(FrameHeader) - 1 ||
+		fwrite(Frame.data(), 1, (size_t)FrameSize, File) != (size_t)FrameSize))
+	{
+		WriteFailed.store(GL_TRUE, std::memory_order_relaxed);
+	}
+}
+
+/**********************************************************************************************//**
+ * @fn	void VideoRecorder::ConvertRowPair(const GLubyte* Top, const GLubyte* Bottom, GLubyte* TopLuma, GLubyte* BottomLuma, GLubyte* ChromaU, GLubyte* ChromaV, GLuint Width)
+ *
+ * @brief	Converts two rows of RGBA into two rows of luma and one row of each chroma plane,
+ * 			with chroma taken from the average of each 2x2 block. with SSE2 eight pixels of
+ * 			each row are done at a time and the leftovers are done one by one.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Top		  	The upper RGBA row.
+ * @param	Bottom	  	The lower RGBA row.
+ * @param	TopLuma   	Where the luma of the upper row goes.
+ * @param	BottomLuma	Where the luma of the lower row goes.
+ * @param	ChromaU   	Where the blue difference row goes. Width / 2 bytes.
+ * @param	ChromaV   	Where the red difference row goes. Width / 2 bytes.
+ * @param	Width	  	The width of the rows in pixels. must be even.
+ **************************************************************************************************/
+
+void VideoRecorder::ConvertRowPair(const GLubyte* Top, const GLubyte* Bottom, GLubyte* TopLuma, GLubyte* BottomLuma,
+	GLubyte* ChromaU, GLubyte* ChromaV, GLuint Width)
+{
+	GLuint Column = 0;
+
+#if defined(FOUNDATION_SSE2)
+	const __m128i ChannelMask = _mm_set1_epi32(0xFF);
+	const __m128i LumaR = _mm_set1_epi16(77);
+	const __m128i LumaG = _mm_set1_epi16(150);
+	const __m128i LumaB = _mm_set1_epi16(29);
+	const __m128i URed = _mm_set1_epi16(-43);
+	const __m128i UGreen = _mm_set1_epi16(-85);
+	const __m128i VGreen = _mm_set1_epi16(-107);
+	const __m128i VBlue = _mm_set1_epi16(-21);
+	const __m128i Half = _mm_set1_epi16(128);
+	const __m128i Ones = _mm_set1_epi16(1);
+	const __m128i Two = _mm_set1_epi32(2);
+
+	for(; Column + 8 <= Width; Column += 8)
+	{
+		__m128i Red[2], Green[2], Blue[2];
+		const GLubyte* Rows[2] = { Top + (Column * 4), Bottom + (Column * 4) };
+		GLubyte* Lumas[2] = { TopLuma + Column, BottomLuma + Column };
+
+		for(GLuint Row = 0; Row < 2; Row++)
+		{
+			//pixels are RGBA in memory so each 32 bit lane holds R in its lowest byte
+			__m128i Low = _mm_loadu_si128((const __m128i*)Rows[Row]);
+			__m128i High = _mm_loadu_si128((const __m128i*)(Rows[Row] + 16));
+
+			Red[Row] = _mm_packs_epi32(_mm_and_si128(Low, ChannelMask), _mm_and_si128(High, ChannelMask));
+			Green[Row] = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(Low, 8), ChannelMask),
+				_mm_and_si128(_mm_srli_epi32(High, 8), ChannelMask));
+			Blue[Row] = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(Low, 16), ChannelMask),
+				_mm_and_si128(_mm_srli_epi32(High, 16), ChannelMask));
+
+			//at most 255 * 256 + 128 so this fits when the lanes are treated as unsigned
+			__m128i Luma = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(Red[Row], LumaR), _mm_mullo_epi16(Green[Row], LumaG)),
+				_mm_add_epi16(_mm_mullo_epi16(Blue[Row], LumaB), Half));
+			Luma = _mm_srli_epi16(Luma, 8);
+			_mm_storel_epi64((__m128i*)Lumas[Row], _mm_packus_epi16(Luma, Luma));
+		}
+
+		//sum each 2x2 block then round to its average
+		__m128i AverageRed = _mm_srli_epi32(_mm_add_epi32(_mm_madd_epi16(_mm_add_epi16(Red[0], Red[1]), Ones), Two), 2);
+		__m128i AverageGreen = _mm_srli_epi32(_mm_add_epi32(_mm_madd_epi16(_mm_add_epi16(Green[0], Green[1]), Ones), Two), 2);
+		__m128i AverageBlue = _mm_srli_epi32(_mm_add_epi32(_mm_madd_epi16(_mm_add_epi16(Blue[0], Blue[1]), Ones), Two), 2);
+		AverageRed = _mm_packs_epi32(AverageRed, AverageRed);
+		AverageGreen = _mm_packs_epi32(AverageGreen, AverageGreen);
+		AverageBlue = _mm_packs_epi32(AverageBlue, AverageBlue);
+
+		//both sums stay within +-32640, and the saturating add keeps the rounding from wrapping
+		__m128i U = _mm_add_epi16(_mm_mullo_epi16(AverageRed, URed), _mm_mullo_epi16(AverageGreen, UGreen));
+		U = _mm_adds_epi16(_mm_add_epi16(U, _mm_slli_epi16(AverageBlue, 7)), Half);
+		U = _mm_add_epi16(_mm_srai_epi16(U, 8), Half);
+
+		__m128i V = _mm_add_epi16(_mm_mullo_epi16(AverageGreen, VGreen), _mm_mullo_epi16(AverageBlue, VBlue));
+		V = _mm_adds_epi16(_mm_add_epi16(V, _mm_slli_epi16(AverageRed, 7)), Half);
+		V = _mm_add_epi16(_mm_srai_epi16(V, 8), Half);
+
+		GLint PackedU = _mm_cvtsi128_si32(_mm_packus_epi16(U, U));
+		GLint PackedV = _mm_cvtsi128_si32(_mm_packus_epi16(V, V));
+		memcpy(ChromaU + (Column / 2), &PackedU, 4);
+		memcpy(ChromaV + (Column / 2), &PackedV, 4);
+	}
+#endif
+
+	for(; Column < Width; Column += 2)
+	{
+		GLint Red = 0, Green = 0, Blue = 0;
+		const GLubyte* Block[4] = { Top + (Column * 4), Top + (Column * 4) + 4, Bottom + (Column * 4), Bottom + (Column * 4) + 4 };
+		GLubyte* Lumas[4] = { TopLuma + Column, TopLuma + Column + 1, BottomLuma + Column, BottomLuma + Column + 1 };
+
+		for(GLuint Iter = 0; Iter < 4; Iter++)
+		{
+			*Lumas[Iter] = (GLubyte)(((77 * Block[Iter][0]) + (150 * Block[Iter][1]) + (29 * Block[Iter][2]) + 128) >> 8);
+			Red += Block[Iter][0];
+			Green += Block[Iter][1];
+			Blue += Block[Iter][2];
+		}
+
+		Red = (Red + 2) >> 2;
+		Green = (Green + 2) >> 2;
+		Blue = (Blue + 2) >> 2;
+
+		GLint U = (((-43 * Red) - (85 * Green) + (128 * Blue) + 128) >> 8) + 128;
+		GLint V = (((128 * Red) - (107 * Green) - (21 * Blue) + 128) >> 8) + 128;
+		ChromaU[Column / 2] = (GLubyte)((U > 255) ? 255 : U);
+		ChromaV[Column / 2] = (GLubyte)((V > 255) ? 255 : V);
+	}
+}
@@ -0,0 +1,824 @@
+/**********************************************************************************************//**
+ * @file	WindowAPI\VirtualWindow.cpp
+ *
+ * @brief	Implements the virtual window class.
+ **************************************************************************************************/
+
+#include "VirtualWindow.h"
+#include "Window.h"
+#include <algorithm>
+
+/**********************************************************************************************//**
+ * @fn	FVirtualWindow::FVirtualWindow(const char* WindowName, GLuint Width, GLuint Height, GLuint X,
+ * 		GLuint Y)
+ *
+ * @brief	Constructor.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	WindowName	The name of the panel.
+ * @param	Width	  	The width of the panel.
+ * @param	Height	  	The height of the panel.
+ * @param	X		  	The left edge of the panel in the host.
+ * @param	Y		  	The top edge of the panel in the host.
+ **************************************************************************************************/
+
+FVirtualWindow::FVirtualWindow(const char* WindowName, GLuint Width, GLuint Height, GLuint X, GLuint Y)
+{
+	Name = IsValidString(WindowName) ? WindowName : "";
+	Host = nullptr;
+	Resolution[0] = Width;
+	Resolution[1] = Height;
+	Position[0] = X;
+	Position[1] = Y;
+	MousePosition[0] = MousePosition[1] = 0;
+	Minimized = GL_FALSE;
+	InFocus = GL_FALSE;
+	Drawn = GL_FALSE;
+	Framebuffer = 0;
+	Colour = 0;
+	DepthStencil = 0;
+	FramebufferSize[0] = FramebufferSize[1] = 0;
+	CompositedArea = FDamageRect();
+
+	KeyEvent = nullptr;
+	MouseButtonEvent = nullptr;
+	MouseWheelEvent = nullptr;
+	MouseMoveEvent = nullptr;
+	FocusEvent = nullptr;
+
+	for(GLuint Iterator = 0; Iterator < KEY_LAST; Iterator++)
+	{
+		Keys[Iterator] = KEYSTATE_UP;
+	}
+
+	for(GLuint Iterator = 0; Iterator < MOUSE_LAST; Iterator++)
+	{
+		MouseButton[Iterator] = MOUSE_BUTTONUP;
+	}
+}
+
+/**********************************************************************************************//**
+ * @fn	FVirtualWindow::~FVirtualWindow()
+ *
+ * @brief	Destructor.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+FVirtualWindow::~FVirtualWindow()
+{
+	if(Host)
+	{
+		Shutdown();
+	}
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FVirtualWindow::Initialize(FWindow* Host)
+ *
+ * @brief	Puts the panel in a host window, on top of its other panels. the framebuffer is
+ * 			made the first time the panel is drawn.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param [in,out]	Host	The window the panel lives in.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FVirtualWindow::Initialize(FWindow* Host)
+{
+	if(!Host || !Host->Initialized || Host->ContextCreation == CONTEXTCREATION_SOFTWARE)
+	{
+		PrintErrorMessage(ERROR_VIRTUALWINDOW);
+		return FOUNDATION_ERROR;
+	}
+
+	if(this->Host)
+	{
+		Shutdown();
+	}
+
+	this->Host = Host;
+	Host->VirtualWindows.push_back(this);
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FVirtualWindow::Shutdown()
+ *
+ * @brief	Takes the panel out of its host and deletes its framebuffer.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FVirtualWindow::Shutdown()
+{
+	if(!Host)
+	{
+		PrintErrorMessage(ERROR_VIRTUALWINDOW);
+		return FOUNDATION_ERROR;
+	}
+
+	if(Framebuffer && Host->ContextCreated)
+	{
+		Host->BindContext();
+		DestroyFramebuffer();
+	}
+
+	Focus(GL_FALSE);
+
+	if(Host->PointerVirtualWindow == this)
+	{
+		Host->PointerVirtualWindow = nullptr;
+	}
+
+	//whatever the host draws there next has to reach the screen even with a partial present
+	Host->AddDamage(CompositedArea);
+	CompositedArea = FDamageRect();
+	Host->VirtualWindows.erase(std::remove(Host->VirtualWindows.begin(), Host->VirtualWindows.end(), this),
+		Host->VirtualWindows.end());
+	Host = nullptr;
+	Framebuffer = Colour = DepthStencil = 0;
+	Drawn = GL_FALSE;
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	FWindow* FVirtualWindow::GetHost()
+ *
+ * @brief	Gets the window the panel lives in.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	null if the panel isn't initialized, else the host window.
+ **************************************************************************************************/
+
+FWindow* FVirtualWindow::GetHost()
+{
+	return Host;
+}
+
+/**********************************************************************************************//**
+ * @fn	const char* FVirtualWindow::GetWindowName()
+ *
+ * @brief	Gets the name of the panel.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	The name of the panel.
+ **************************************************************************************************/
+
+const char* FVirtualWindow::GetWindowName()
+{
+	return Name.c_str();
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FVirtualWindow::GetResolution(GLuint& Width, GLuint& Height)
+ *
+ * @brief	Gets the resolution of the panel.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param [out]	Width 	The width of the panel.
+ * @param [out]	Height	The height of the panel.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FVirtualWindow::GetResolution(GLuint& Width, GLuint& Height)
+{
+	Width = Resolution[0];
+	Height = Resolution[1];
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLuint* FVirtualWindow::GetResolution()
+ *
+ * @brief	Gets the resolution of the panel.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	The width and height of the panel.
+ **************************************************************************************************/
+
+GLuint* FVirtualWindow::GetResolution()
+{
+	return Resolution;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FVirtualWindow::SetResolution(GLuint Width, GLuint Height)
+ *
+ * @brief	Sets the resolution of the panel. the framebuffer is remade the next time the panel
+ * 			is drawn and the panel isn't shown until then.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Width 	The new width.
+ * @param	Height	The new height.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FVirtualWindow::SetResolution(GLuint Width, GLuint Height)
+{
+	if(Width == 0 || Height == 0)
+	{
+		PrintErrorMessage(ERROR_INVALIDRESOLUTION);
+		return FOUNDATION_ERROR;
+	}
+
+	if(Width != Resolution[0] || Height != Resolution[1])
+	{
+		Resolution[0] = Width;
+		Resolution[1] = Height;
+		Drawn = GL_FALSE;
+	}
+
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FVirtualWindow::GetPosition(GLuint& X, GLuint& Y)
+ *
+ * @brief	Gets the position of the panel within the host.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param [out]	X	The left edge of the panel.
+ * @param [out]	Y	The top edge of the panel.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FVirtualWindow::GetPosition(GLuint& X, GLuint& Y)
+{
+	X = Position[0];
+	Y = Position[1];
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLuint* FVirtualWindow::GetPosition()
+ *
+ * @brief	Gets the position of the panel within the host.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	The left and top edges of the panel.
+ **************************************************************************************************/
+
+GLuint* FVirtualWindow::GetPosition()
+{
+	return Position;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FVirtualWindow::SetPosition(GLuint X, GLuint Y)
+ *
+ * @brief	Moves the panel within the host. nothing has to be redrawn.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	X	The new left edge.
+ * @param	Y	The new top edge.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FVirtualWindow::SetPosition(GLuint X, GLuint Y)
+{
+	Position[0] = X;
+	Position[1] = Y;
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FVirtualWindow::GetMousePosition(GLuint& X, GLuint& Y)
+ *
+ * @brief	Gets the last mouse position routed to the panel, relative to the panel.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param [out]	X	The horizontal position of the mouse.
+ * @param [out]	Y	The vertical position of the mouse.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FVirtualWindow::GetMousePosition(GLuint& X, GLuint& Y)
+{
+	X = MousePosition[0];
+	Y = MousePosition[1];
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLuint* FVirtualWindow::GetMousePosition()
+ *
+ * @brief	Gets the last mouse position routed to the panel, relative to the panel.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	The position of the mouse.
+ **************************************************************************************************/
+
+GLuint* FVirtualWindow::GetMousePosition()
+{
+	return MousePosition;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FVirtualWindow::GetKeyState(GLuint Key)
+ *
+ * @brief	Gets the state of a key as the panel has seen it. keys pressed while the panel
+ * 			wasn't in focus aren't seen.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Key	The key.
+ *
+ * @return	KEYSTATE_DOWN or KEYSTATE_UP.
+ **************************************************************************************************/
+
+GLboolean FVirtualWindow::GetKeyState(GLuint Key)
+{
+	return Keys[Key];
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FVirtualWindow::Minimize(GLboolean NewState)
+ *
+ * @brief	Hides or shows the panel. a hidden panel loses focus.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	NewState	true to hide the panel, false to show it.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FVirtualWindow::Minimize(GLboolean NewState)
+{
+	Minimized = NewState;
+
+	if(Minimized)
+	{
+		Focus(GL_FALSE);
+	}
+
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FVirtualWindow::GetIsMinimized()
+ *
+ * @brief	Gets whether the panel is hidden.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FVirtualWindow::GetIsMinimized()
+{
+	return Minimized;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FVirtualWindow::GetInFocus()
+ *
+ * @brief	Gets whether the panel gets the host's key events.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FVirtualWindow::GetInFocus()
+{
+	return InFocus;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FVirtualWindow::Focus(GLboolean NewState)
+ *
+ * @brief	Gives the panel the host's key events, taking them from any other panel, or gives
+ * 			them back to the host.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	NewState	true to focus the panel.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FVirtualWindow::Focus(GLboolean NewState)
+{
+	if(!Host)
+	{
+		PrintErrorMessage(ERROR_VIRTUALWINDOW);
+		return FOUNDATION_ERROR;
+	}
+
+	if(NewState == InFocus || (NewState && Minimized))
+	{
+		return FOUNDATION_OKAY;
+	}
+
+	if(NewState && Host->FocusedVirtualWindow)
+	{
+		Host->FocusedVirtualWindow->Focus(GL_FALSE);
+	}
+
+	InFocus = NewState;
+	Host->FocusedVirtualWindow = InFocus ? this : nullptr;
+
+	if(IsValidFocusEvent(FocusEvent))
+	{
+		FocusEvent(InFocus);
+	}
+
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FVirtualWindow::Raise()
+ *
+ * @brief	Puts the panel on top of the other panels of the host, both for drawing and for
+ * 			receiving the mouse.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FVirtualWindow::Raise()
+{
+	if(!Host)
+	{
+		PrintErrorMessage(ERROR_VIRTUALWINDOW);
+		return FOUNDATION_ERROR;
+	}
+
+	std::vector<FVirtualWindow*>& Panels = Host->VirtualWindows;
+	std::vector<FVirtualWindow*>::iterator Current = std::find(Panels.begin(), Panels.end(), this);
+	std::rotate(Current, Current + 1, Panels.end());
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FVirtualWindow::MakeCurrentContext()
+ *
+ * @brief	Makes the host's context current and binds the panel's framebuffer with a viewport
+ * 			covering the panel. the framebuffer is remade if the panel was resized. only the
+ * 			context is bound, since the host's MakeCurrentContext would start timing a new 
+ * 			frame and bind the host's render target halfway through the host's frame.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FVirtualWindow::MakeCurrentContext()
+{
+	if(!Host)
+	{
+		PrintErrorMessage(ERROR_VIRTUALWINDOW);
+		return FOUNDATION_ERROR;
+	}
+
+	//lazily created host contexts are finished here like the host would
+	if(!Host->ContextCreated)
+	{
+		Host->InitializeGL();
+	}
+
+	if(!Host->ContextCreated)
+	{
+		PrintErrorMessage(ERROR_VIRTUALWINDOW);
+		return FOUNDATION_ERROR;
+	}
+
+	Host->BindContext();
+
+	if((!Framebuffer || FramebufferSize[0] != Resolution[0] || FramebufferSize[1] != Resolution[1]) &&
+		!CreateFramebuffer())
+	{
+		return FOUNDATION_ERROR;
+	}
+
+	Host->GLFunctions->glBindFramebuffer(GL_FRAMEBUFFER, Framebuffer);
+	glViewport(0, 0, Resolution[0], Resolution[1]);
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FVirtualWindow::SwapDrawBuffers()
+ *
+ * @brief	Finishes drawing the panel. nothing is presented here, the host copies the panel
+ * 			into its back buffer at its own swap. the host's framebuffer(its dynamic resolution
+ * 			target if it has one) and viewport are bound again so the host can keep drawing.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FVirtualWindow::SwapDrawBuffers()
+{
+	if(!Host || !Framebuffer)
+	{
+		PrintErrorMessage(ERROR_VIRTUALWINDOW);
+		return FOUNDATION_ERROR;
+	}
+
+	Drawn = GL_TRUE;
+	Host->BindContext();
+
+	if(Host->DynamicResolutionEnabled && Host->RenderFramebuffer)
+	{
+		Host->GLFunctions->glBindFramebuffer(GL_FRAMEBUFFER, Host->RenderFramebuffer);
+		glViewport(0, 0, Host->RenderResolution[0], Host->RenderResolution[1]);
+	}
+
+	else
+	{
+		Host->GLFunctions->glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		glViewport(0, 0, Host->Resolution[0], Host->Resolution[1]);
+	}
+
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLuint FVirtualWindow::GetColourTexture()
+ *
+ * @brief	Gets the texture the panel is drawn into, e.g. to show the panel somewhere else too.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	The colour texture. 0 if the panel hasn't been drawn yet.
+ **************************************************************************************************/
+
+GLuint FVirtualWindow::GetColourTexture()
+{
+	return Colour;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FVirtualWindow::SetOnKeyEvent(OnKeyEvent OnKey)
+ *
+ * @brief	Sets the callback for key events while the panel is in focus.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	OnKey	The on key event.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FVirtualWindow::SetOnKeyEvent(OnKeyEvent OnKey)
+{
+	if(IsValidKeyEvent(OnKey))
+	{
+		KeyEvent = OnKey;
+		return FOUNDATION_OKAY;
+	}
+
+	PrintErrorMessage(ERROR_INVALIDEVENT);
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FVirtualWindow::SetOnMouseButtonEvent(OnMouseButtonEvent OnMouseButton)
+ *
+ * @brief	Sets the callback for mouse buttons pressed on the panel. the release goes to the
+ * 			same panel even if the mouse has left it.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	OnMouseButton	The on mouse button event.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FVirtualWindow::SetOnMouseButtonEvent(OnMouseButtonEvent OnMouseButton)
+{
+	if(IsValidKeyEvent(OnMouseButton))
+	{
+		MouseButtonEvent = OnMouseButton;
+		return FOUNDATION_OKAY;
+	}
+
+	PrintErrorMessage(ERROR_INVALIDEVENT);
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FVirtualWindow::SetOnMouseWheelEvent(OnMouseWheelEvent OnMouseWheel)
+ *
+ * @brief	Sets the callback for the mouse wheel turning over the panel.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	OnMouseWheel	The on mouse wheel event.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FVirtualWindow::SetOnMouseWheelEvent(OnMouseWheelEvent OnMouseWheel)
+{
+	if(IsValidMouseWheelEvent(OnMouseWheel))
+	{
+		MouseWheelEvent = OnMouseWheel;
+		return FOUNDATION_OKAY;
+	}
+
+	PrintErrorMessage(ERROR_INVALIDEVENT);
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FVirtualWindow::SetOnMouseMove(OnMouseMoveEvent OnMouseMove)
+ *
+ * @brief	Sets the callback for the mouse moving over the panel, or anywhere while a button
+ * 			pressed on the panel is held.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	OnMouseMove	The on mouse move event.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FVirtualWindow::SetOnMouseMove(OnMouseMoveEvent OnMouseMove)
+{
+	if(IsValidMouseMoveEvent(OnMouseMove))
+	{
+		MouseMoveEvent = OnMouseMove;
+		return FOUNDATION_OKAY;
+	}
+
+	PrintErrorMessage(ERROR_INVALIDEVENT);
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FVirtualWindow::SetOnFocus(OnFocusEvent OnFocus)
+ *
+ * @brief	Sets the callback for the panel gaining or losing focus.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	OnFocus	The on focus event.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FVirtualWindow::SetOnFocus(OnFocusEvent OnFocus)
+{
+	if(IsValidFocusEvent(OnFocus))
+	{
+		FocusEvent = OnFocus;
+		return FOUNDATION_OKAY;
+	}
+
+	PrintErrorMessage(ERROR_INVALIDEVENT);
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FVirtualWindow::CreateFramebuffer()
+ *
+ * @brief	Remakes the framebuffer at the panel's resolution. the host's context has to be
+ * 			current.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FVirtualWindow::CreateFramebuffer()
+{
+	FGLFunctions* Functions = Host->GLFunctions;
+	GLint MajorVersion = 0;
+	glGetIntegerv(GL_MAJOR_VERSION, &MajorVersion);
+
+	if(!Functions || (MajorVersion < 3 && !Host->HasGLExtension("GL_ARB_framebuffer_object")))
+	{
+		PrintErrorMessage(ERROR_NOFRAMEBUFFEROBJECT);
+		return FOUNDATION_ERROR;
+	}
+
+	DestroyFramebuffer();
+
+	glGenTextures(1, &Colour);
+	glBindTexture(GL_TEXTURE_2D, Colour);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, Resolution[0], Resolution[1], 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	Functions->glGenRenderbuffers(1, &DepthStencil);
+	Functions->glBindRenderbuffer(GL_RENDERBUFFER, DepthStencil);
+	Functions->glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, Resolution[0], Resolution[1]);
+	Functions->glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+	Functions->glGenFramebuffers(1, &Framebuffer);
+	Functions->glBindFramebuffer(GL_FRAMEBUFFER, Framebuffer);
+	Functions->glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, Colour, 0);
+	Functions->glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, DepthStencil);
+
+	if(Functions->glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+	{
+		PrintErrorMessage(ERROR_NOFRAMEBUFFEROBJECT);
+		Functions->glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		DestroyFramebuffer();
+		return FOUNDATION_ERROR;
+	}
+
+	FramebufferSize[0] = Resolution[0];
+	FramebufferSize[1] = Resolution[1];
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FVirtualWindow::DestroyFramebuffer()
+ *
+ * @brief	Deletes the framebuffer. the host's context has to be current.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void FVirtualWindow::DestroyFramebuffer()
+{
+	if(Framebuffer)
+	{
+		Host->GLFunctions->glDeleteFramebuffers(1, &Framebuffer);
+		Host->GLFunctions->glDeleteRenderbuffers(1, &DepthStencil);
+		glDeleteTextures(1, &Colour);
+	}
+
+	Framebuffer = 0;
+	Colour = 0;
+	DepthStencil = 0;
+	FramebufferSize[0] = FramebufferSize[1] = 0;
+	Drawn = GL_FALSE;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FVirtualWindow::Contains(GLint X, GLint Y)
+ *
+ * @brief	Gets whether a point in host coordinates is on the panel.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	X	The horizontal position in the host.
+ * @param	Y	The vertical position in the host.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FVirtualWindow::Contains(GLint X, GLint Y)
+{
+	return (X >= (GLint)Position[0] && Y >= (GLint)Position[1] &&
+		X < (GLint)(Position[0] + Resolution[0]) && Y < (GLint)(Position[1] + Resolution[1]));
+}
@@ -10,6 +10,17 @@
 
 #if defined(__linux__)
 #include <cstring>
+#include <math.h>
+#include <algorithm>
+#endif
+
+#if defined(_WIN32) || defined(_WIN64)
+FOUNDATION_THREADLOCAL HDC FWindow::CurrentDeviceContext = nullptr;
+FOUNDATION_THREADLOCAL HGLRC FWindow::CurrentRenderingContext = nullptr;
+#else
+FOUNDATION_THREADLOCAL Display* FWindow::CurrentDisplay = nullptr;
+FOUNDATION_THREADLOCAL GLXDrawable FWindow::CurrentDrawable = None;
+FOUNDATION_THREADLOCAL GLXContext FWindow::CurrentContext = nullptr;
 #endif
 
 /**********************************************************************************************//**
@@ -57,8 +68,107 @@ FWindow::FWindow(const char*  WindowName,
 	InitializeEvents();
 
 	CurrentState = WINDOWSTATE_NORMAL;
+	LowLatencyMode = GL_FALSE;
+	DisplayModeChanged = GL_FALSE;
+	Initialized = GL_FALSE;
 	ContextCreated = GL_FALSE;
-	IsCurrentContext = GL_FALSE;
+	ContextCreation = CONTEXTCREATION_IMMEDIATE;
+	InitializeTime = 0;
+	TimeToFirstMap = 0;
+	TimeToFirstFrame = 0;
+	ShareWindow = nullptr;
+	ShareMode = CONTEXTSHARE_NONE;
+	Extensions = nullptr;
+	GLFunctions = nullptr;
+	Pacer = nullptr;
+	LastSwapTime = 0;
+	FrameDeadline = 0;
+	GPUTimingEnabled = GL_FALSE;
+	GPUQueryCount = 0;
+	LastGPUFrameTime = 0;
+	DynamicResolutionEnabled = GL_FALSE;
+	RenderScale = 1.0;
+	MinRenderScale = 1.0;
+	MaxRenderScale = 1.0;
+	TargetRenderTime = 0;
+	SmoothedRenderTime = 0;
+	PacerWaitTime = 0;
+	RenderFramebuffer = 0;
+	RenderColour = 0;
+	RenderDepthStencil = 0;
+	RenderTargetSize[0] = RenderTargetSize[1] = 0;
+	RenderResolution[0] = RenderResolution[1] = 0;
+	CaptureEvent = nullptr;
+	ContinuousCapture = GL_FALSE;
+	CaptureHead = 0;
+	CapturePending = 0;
+	DroppedCaptures = 0;
+	Exporter = nullptr;
+	Recorder = nullptr;
+	SwapCount = 0;
+	FocusedVirtualWindow = nullptr;
+	PointerVirtualWindow = nullptr;
+	MirrorSource = nullptr;
+	MirrorKeepAspect = GL_TRUE;
+	MirrorReadFramebuffer = 0;
+	MirrorReadFence = nullptr;
+	MirrorReadSlot = 0;
+	MirrorHead = 0;
+	MirrorSize[0] = MirrorSize[1] = 0;
+
+	for(GLuint Iter = 0; Iter < MIRROR_BUFFERS; Iter++)
+	{
+		MirrorFramebuffers[Iter] = 0;
+		MirrorTextures[Iter] = 0;
+		MirrorFences[Iter] = nullptr;
+	}
+	GPUQueryHead = 0;
+	GPUQueryPending = 0;
+	GPUFrameOpen = GL_FALSE;
+	GPUResolveMarked = GL_FALSE;
+	DynamicResolutionTiming = GL_FALSE;
+	CPUFrameStart = 0;
+	MaxFramesInFlight = 0;
+	FrameStartTime = 0;
+	PendingDamageCount = 0;
+	DamageHistoryHead = 0;
+	LastSwapWasPartial = GL_FALSE;
+	//drivers start with vertical sync on
+	CurrentSwapInterval = 1;
+	FrameFenceHead = 0;
+	FrameFencePending = 0;
+	SoftwarePixels = nullptr;
+	SoftwareSize[0] = SoftwareSize[1] = 0;
+	SoftwareStride = 0;
+	SoftwareFormat = SOFTWAREFORMAT_RGBA;
+	SoftwareStaged = GL_FALSE;
+
+#if defined(__linux__)
+	Context = 0;
+	SurfaceImage = nullptr;
+	SurfaceSegment.shmid = -1;
+	SurfaceSegment.shmaddr = nullptr;
+	SurfaceGC = 0;
+	SurfaceBusy = GL_FALSE;
+	OMLSyncControlSupported = GL_FALSE;
+	RefreshPeriod = 0;
+	CopySubBufferSupported = GL_FALSE;
+	BufferAgeSupported = GL_FALSE;
+	SyncCounter = None;
+	SyncRequestPending = GL_FALSE;
+	SyncResizeApplied = GL_FALSE;
+	FrameCounter = None;
+	ModeSwitchedCrtc = 0;
+	FrameCounterValue = 0;
+	FrameSyncValue = 0;
+	FrameSyncPending = GL_FALSE;
+#else
+	GLRenderingContextHandle = nullptr;
+	SurfaceDeviceContext = nullptr;
+	SurfaceBitmap = nullptr;
+	SurfaceOldBitmap = nullptr;
+	SurfaceBits = nullptr;
+#endif
 }
 
 /**********************************************************************************************//**
@@ -88,14 +198,51 @@ FWindow::~FWindow()
 
 GLboolean FWindow::Shutdown()
 {
-	if(ContextCreated)
+	if(Initialized)
 	{
-		
+		//the panels' framebuffers go with the context
+		while(!VirtualWindows.empty())
+		{
+			VirtualWindows.back()->Shutdown();
+		}
+
+		if(MirrorSource)
+		{
+			SetMirrorSource(nullptr);
+		}
+
+		while(!MirrorWindows.empty())
+		{
+			MirrorWindows.back()->SetMirrorSource(nullptr);
+		}
+
+		if(GPUTimingEnabled)
+		{
+			DisableGPUTiming();
+		}
+
+		if(MaxFramesInFlight > 0)
+		{
+			SetMaxFramesInFlight(0);
+		}
+
+		if(DynamicResolutionEnabled)
+		{
+			DisableDynamicResolution();
+		}
+
+		DestroyCaptures();
+		DisableFrameExport();
+		StopRecording();
+		DestroySoftwareSurface();
+		RestoreDisplayMode();
+
 #if defined (_WIN32) || defined(_WIN64)
 		Windows_Shutdown();
 #else
 		Linux_Shutdown();
 #endif
+		Initialized = GL_FALSE;
 		ContextCreated = GL_FALSE;
 		return FOUNDATION_OKAY;
 	}
@@ -117,6 +264,7 @@ GLboolean FWindow::Shutdown()
 
 GLboolean FWindow::Initialize()
 {
+	InitializeTime = GetMonotonicTime();
 #if defined(_WIN32) || defined(_WIN64)
 	return Windows_Initialize();
 #else
@@ -160,6 +308,7 @@ void FWindow::InitializeEvents()
 //	RestoredEvent = nullptr;
 	MovedEvent = nullptr;
 	MouseMoveEvent = nullptr;
+	LateLatchEvent = nullptr;
 }
 
 /**********************************************************************************************//**
@@ -201,342 +350,336 @@ GLboolean FWindow::InitializeGL()
 }
 
 /**********************************************************************************************//**
- * @fn	GLboolean FWindow::SwapDrawBuffers()
- *
- * @brief	Swap draw buffers.
- *
- * @author	Ziyad
- * @date	29/11/2014
- *
- * @return	A GLboolean.
- **************************************************************************************************/
-
-GLboolean FWindow::SwapDrawBuffers()
-{
-	if(ContextCreated)
-	{
-#if defined(_WIN32) || (_WIN64)
-		SwapBuffers(DeviceContextHandle);
-#else
-		glXSwapBuffers(WindowManager::GetDisplay(), WindowHandle);
-#endif
-		return FOUNDATION_OKAY;
-	}
-
-	PrintErrorMessage(ERROR_NOCONTEXT);
-	return FOUNDATION_ERROR;
-}
-
-/**********************************************************************************************//**
- * @fn	GLboolean FWindow::SetSwapInterval(GLint SwapSetting)
+ * @fn	GLboolean FWindow::SetContextAttributes(const FContextAttributes& Attributes)
  *
- * @brief	Sets swap interval(V-sync).
+ * @brief	Sets the attributes of the OpenGL context to be created for this window.
  *
  * @author	Ziyad
- * @date	29/11/2014
+ * @date	18/10/2026
  *
- * @param	SwapSetting	The swap setting.
+ * @param	Attributes	The requested context attributes.
  *
- * @return	A GLboolean.
+ * @return	A GLboolean. fails if the context has already been created.
  **************************************************************************************************/
 
-GLboolean FWindow::SetSwapInterval(GLint SwapSetting)
+GLboolean FWindow::SetContextAttributes(const FContextAttributes& Attributes)
 {
-	if(ContextCreated)
+	if(!ContextCreated)
 	{
-	CurrentSwapInterval = SwapSetting;
-#if defined(_WIN32) || defined(_WIN64)
-	Windows_VerticalSync(SwapSetting);
-#else
-	Linux_VerticalSync(SwapSetting);
-#endif
-
-	return FOUNDATION_OKAY;
+		ContextAttributes = Attributes;
+		return FOUNDATION_OKAY;
 	}
 
-	PrintErrorMessage(ERROR_NOCONTEXT);
+	PrintErrorMessage(ERROR_EXISTINGCONTEXT);
 	return FOUNDATION_ERROR;
 }
 
 /**********************************************************************************************//**
- * @fn	GLuint FWindow::GetCurrentState()
+ * @fn	const FContextAttributes& FWindow::GetContextAttributes()
  *
- * @brief	Gets current state.
+ * @brief	Gets the context attributes. once the context is created the version, profile,
+ * 			flags, NoError and FlushOnRelease fields reflect what the driver actually granted.
  *
  * @author	Ziyad
- * @date	29/11/2014
+ * @date	18/10/2026
  *
- * @return	The current state.
+ * @return	The context attributes.
  **************************************************************************************************/
 
-GLuint FWindow::GetCurrentState()
+const FContextAttributes& FWindow::GetContextAttributes()
 {
-	return CurrentState;
+	return ContextAttributes;
 }
 
 /**********************************************************************************************//**
- * @fn	GLboolean FWindow::SetCurrentState(GLuint NewState)
+ * @fn	GLboolean FWindow::ShareContext(FWindow* SourceWindow, GLuint NewShareMode)
  *
- * @brief	Sets the current state of the window.
+ * @brief	Shares OpenGL resources with another initialized window. with CONTEXTSHARE_GROUP this window 
+ * 			creates its own context in the share group of the source window, so textures, buffers
+ * 			and shaders only need to be uploaded once. with CONTEXTSHARE_SINGLE no context is 
+ * 			created at all and the context of the source window is made current against this 
+ * 			window's drawable instead. this window then also uses the frame buffer configuration of 
+ * 			the source window so that the two stay compatible.
  *
  * @author	Ziyad
- * @date	29/11/2014
+ * @date	18/10/2026
  *
- * @param	NewState	new state of the window.
+ * @param [in]	SourceWindow	The already initialized window to share with.
+ * @param	NewShareMode		CONTEXTSHARE_NONE, CONTEXTSHARE_GROUP or CONTEXTSHARE_SINGLE.
  *
  * @return	A GLboolean.
  **************************************************************************************************/
 
-GLboolean FWindow::SetCurrentState(GLuint NewState)
+GLboolean FWindow::ShareContext(FWindow* SourceWindow, GLuint NewShareMode)
 {
-	/**
-	* first we restore the window to make moving from state to state as easy as possible
-	*/
-
-	if(ContextCreated)
+	if(Initialized)
 	{
+		PrintErrorMessage(ERROR_EXISTINGCONTEXT);
+		return FOUNDATION_ERROR;
+	}
 
-	Restore();
-
-	switch(NewState)
+	if(NewShareMode == CONTEXTSHARE_NONE)
 	{
-		case WINDOWSTATE_MAXIMIZED:
-			{
-				Maximize(GL_TRUE);
-				break;
-			}
-
-		case WINDOWSTATE_MINIMIZED:
-			{
-				Minimize(GL_TRUE);
-				break;
-			}
-
-			case WINDOWSTATE_FULLSCREEN:
-			{
-				FullScreen(GL_FALSE);
-				break;
-			}
-
-			default:
-			{
-				break;
-			}
+		ShareWindow = nullptr;
+		ShareMode = CONTEXTSHARE_NONE;
+		return FOUNDATION_OKAY;
 	}
+
+	if(SourceWindow != nullptr && SourceWindow != this && SourceWindow->Initialized &&
+		(NewShareMode == CONTEXTSHARE_GROUP || NewShareMode == CONTEXTSHARE_SINGLE))
+	{
+		ShareWindow = SourceWindow;
+		ShareMode = NewShareMode;
+		return FOUNDATION_OKAY;
 	}
 
-	PrintErrorMessage(ERROR_NOCONTEXT);
+	PrintErrorMessage(ERROR_INVALIDSHARECONTEXT);
 	return FOUNDATION_ERROR;
 }
 
 /**********************************************************************************************//**
- * @fn	GLboolean FWindow::GetIsFullScreen()
+ * @fn	GLuint FWindow::GetContextShareMode()
  *
- * @brief	returns whether the window is in full screen mode.
+ * @brief	Gets how this window shares its OpenGL context.
  *
  * @author	Ziyad
- * @date	29/11/2014
+ * @date	18/10/2026
  *
- * @return	Whether the window is currently in full screen mode.
+ * @return	CONTEXTSHARE_NONE, CONTEXTSHARE_GROUP or CONTEXTSHARE_SINGLE.
  **************************************************************************************************/
 
-GLboolean FWindow::GetIsFullScreen()
+GLuint FWindow::GetContextShareMode()
 {
-	if(ContextCreated)
-	{
-		return (CurrentState == WINDOWSTATE_FULLSCREEN);
-	}
-
-	PrintErrorMessage(ERROR_NOCONTEXT);
-	return FOUNDATION_ERROR;
+	return ShareMode;
 }
 
 /**********************************************************************************************//**
- * @fn	GLboolean FWindow::FullScreen(GLboolean ShouldBeFullscreen)
+ * @fn	GLboolean FWindow::SetContextCreation(GLuint CreationMode)
  *
- * @brief	toggle the full screen mode for the window.
+ * @brief	Sets when the OpenGL context of this window is created. by default the context is 
+ * 			created as part of Initialize. with CONTEXTCREATION_LAZY the window is created and 
+ * 			mapped straight away and the context is only created the first time the window is made
+ * 			current. CONTEXTCREATION_BACKGROUND starts creating the context on a worker thread 
+ * 			instead and the first MakeCurrentContext waits for it to finish. CONTEXTCREATION_SOFTWARE
+ * 			never creates a context and gives the window a CPU pixel buffer instead.
  *
  * @author	Ziyad
- * @date	29/11/2014
+ * @date	18/10/2026
  *
- * @param	ShouldBeFullscreen	whether the window should be in full screen mode.
+ * @param	CreationMode	CONTEXTCREATION_IMMEDIATE, _LAZY, _BACKGROUND or _SOFTWARE.
  *
  * @return	A GLboolean.
  **************************************************************************************************/
 
-GLboolean FWindow::FullScreen(GLboolean ShouldBeFullscreen)
+GLboolean FWindow::SetContextCreation(GLuint CreationMode)
 {
-	if(ContextCreated)
+	if(Initialized)
 	{
-		if (ShouldBeFullscreen)
-		{
-			CurrentState = WINDOWSTATE_FULLSCREEN;
-		}
-
-		else
-		{
-			CurrentState = WINDOWSTATE_NORMAL;
-		}
-
-#if defined(_WIN32) || defined(_WIN64)
-		Windows_FullScreen();
-#else
-		Linux_FullScreen(ShouldBeFullscreen);
-#endif
-
-		return FOUNDATION_OKAY;
+		PrintErrorMessage(ERROR_ALREADYINITIALIZED);
+		return FOUNDATION_ERROR;
 	}
 
-	PrintErrorMessage(ERROR_NOCONTEXT);
+	ContextCreation = CreationMode;
 	return FOUNDATION_OKAY;
 }
 
 /**********************************************************************************************//**
- * @fn	GLboolean FWindow::GetIsMinimized()
+ * @fn	GLdouble FWindow::GetTimeToFirstMap()
  *
- * @brief	Gets whether the window is minimized.
+ * @brief	Gets how long after Initialize was called the window was first mapped.
  *
  * @author	Ziyad
- * @date	29/11/2014
+ * @date	18/10/2026
  *
- * @return	whether the window is currently minimized.
+ * @return	The time in seconds or 0 if the window hasn't been mapped yet.
  **************************************************************************************************/
 
-GLboolean FWindow::GetIsMinimized()
+GLdouble FWindow::GetTimeToFirstMap()
 {
-	return (CurrentState == WINDOWSTATE_MINIMIZED);
+	return TimeToFirstMap;
 }
 
 /**********************************************************************************************//**
- * @fn	GLboolean FWindow::Minimize(GLboolean NewState)
+ * @fn	GLdouble FWindow::GetTimeToFirstFrame()
  *
- * @brief	set the window to be minimized depending on NewState.
+ * @brief	Gets how long after Initialize was called the first frame was presented.
  *
  * @author	Ziyad
- * @date	29/11/2014
- *
- * @param	NewState	whether the window should be minimized.
+ * @date	18/10/2026
  *
- * @return	A GLboolean.
+ * @return	The time in seconds or 0 if no frame has been presented yet.
  **************************************************************************************************/
 
-GLboolean FWindow::Minimize(GLboolean NewState)
+GLdouble FWindow::GetTimeToFirstFrame()
 {
-	if(ContextCreated)
-	{
-		if(NewState)
-		{
-			CurrentState = WINDOWSTATE_MINIMIZED;
-		}
-
-		else
-		{
-			CurrentState = WINDOWSTATE_NORMAL;
-		}
-
-#if defined(_WIN32) || defined(_WIN64)
-	 	Windows_Minimize();
-#else
-	 	Linux_Minimize(NewState);
-#endif
-
-	 	return FOUNDATION_OKAY;
-	}	
-
-	return FOUNDATION_ERROR;
+	return TimeToFirstFrame;
 }
 
 /**********************************************************************************************//**
- * @fn	GLboolean FWindow::GetIsMaximized()
+ * @fn	GLboolean FWindow::SwapDrawBuffers()
  *
- * @brief	Gets whether the window is maximized.
+ * @brief	Swap draw buffers.
  *
  * @author	Ziyad
  * @date	29/11/2014
  *
- * @return	whether the window is currently minimized.
+ * @return	A GLboolean.
  **************************************************************************************************/
 
-GLboolean FWindow::GetIsMaximized()
+GLboolean FWindow::SwapDrawBuffers()
 {
-	return (CurrentState == WINDOWSTATE_MAXIMIZED) ;
+	return SwapDrawBuffers(nullptr, 0);
 }
 
 /**********************************************************************************************//**
- * @fn	GLboolean FWindow::Maximize(GLboolean NewState)
+ * @fn	GLboolean FWindow::SwapDrawBuffers(const FDamageRect* Rects, GLuint NumRects)
  *
- * @brief	Maximizes the window depending on New state.
+ * @brief	Presents only the given rectangles and any pending damage where the platform
+ * 			supports it(GLX_MESA_copy_sub_buffer), so static parts of the window cost nothing.
+ * 			the copy isn't tied to the refresh, so this is only done with vertical sync off.
+ * 			otherwise the whole window is swapped.
  *
  * @author	Ziyad
- * @date	29/11/2014
+ * @date	18/10/2026
  *
- * @param	NewState	Whether to minimize the window.
+ * @param	Rects   	The rectangles that changed this frame. null presents the whole window.
+ * @param	NumRects	How many rectangles there are.
  *
  * @return	A GLboolean.
  **************************************************************************************************/
 
-GLboolean FWindow::Maximize(GLboolean NewState)
+GLboolean FWindow::SwapDrawBuffers(const FDamageRect* Rects, GLuint NumRects)
 {
+	if(ContextCreation == CONTEXTCREATION_SOFTWARE)
+	{
+		return SwapSoftwareSurface(Rects, NumRects);
+	}
+
 	if(ContextCreated)
 	{
-		if(NewState)
+		if(LateLatchEvent)
 		{
-			CurrentState = WINDOWSTATE_MAXIMIZED;
-		}
+			GLboolean InputChanged = LatchInput();
+			GLdouble LatchTime = GetMonotonicTime();
 
-		else
-		{
-			CurrentState = WINDOWSTATE_NORMAL;
+			BindContext();
+			LateLatchEvent(MousePosition[0], MousePosition[1]);
+			LateLatchGains.Record((InputChanged && FrameStartTime > 0) ? LatchTime - FrameStartTime : 0);
 		}
 
-#if defined(_WIN32) || defined(_WIN64)
-		 Windows_Maximize();
-#else
-	 	Linux_Maximize(NewState);
-#endif
-		 return FOUNDATION_OKAY;
-	}
-	PrintErrorMessage(ERROR_NOCONTEXT);	
-	return FOUNDATION_ERROR;
-}
+		GLdouble RenderEnd = 0;
 
-/**********************************************************************************************//**
- * @fn	GLboolean FWindow::Restore()
- *
- * @brief	Restores the window to its default setting.
- *
- * @author	Ziyad
- * @date	29/11/2014
- *
- * @return	A GLboolean.
- **************************************************************************************************/
+		if(DynamicResolutionEnabled)
+		{
+			ResolveRenderTarget();
+			//the render scale only changes what was drawn up to here
+			MarkGPUResolve();
+			RenderEnd = GetMonotonicTime();
+		}
 
-GLboolean FWindow::Restore()
-{
-	if (ContextCreated)
-	{
-		switch (CurrentState)
+		if(MirrorSource)
 		{
-		case WINDOWSTATE_MAXIMIZED:
+			DrawMirror();
+		}
+
+		if(!VirtualWindows.empty())
 		{
-			Maximize(GL_FALSE);
-			break;
+			CompositeVirtualWindows();
 		}
 
-		case WINDOWSTATE_FULLSCREEN:
+		RunSwapHooks(SWAPHOOK_PRE, 0, 0);
+		//the frame ends here on both clocks, before the readbacks, the pacer and the swap
+		EndGPUTiming();
+
+		if(CaptureEvent || Exporter || Recorder || CapturePending > 0)
 		{
-			FullScreen(GL_FALSE);
-			break;
+			ProcessCaptures();
 		}
+
+		if(!MirrorWindows.empty())
+		{
+			UpdateMirrorTexture();
 		}
 
-		CurrentState = WINDOWSTATE_NORMAL;
-#if defined(_WIN32) || defined(_WIN64)
-		Windows_Restore();
+		//everything above is part of the frame, so only the present itself waits for the pacer
+		if(Pacer)
+		{
+#if defined(__linux__)
+			GLdouble VBlankTime = 0, VBlankPeriod = 0;
+
+			if(Linux_GetVBlank(VBlankTime, VBlankPeriod))
+			{
+				Pacer->SetVBlank(VBlankTime, VBlankPeriod);
+			}
+#endif
+			GLdouble WaitStart = GetMonotonicTime();
+			Pacer->WaitForNextFrame();
+			PacerWaitTime = GetMonotonicTime() - WaitStart;
+		}
+
+		GLdouble SwapStart = GetMonotonicTime();
+#if defined(_WIN32) || (_WIN64)
+		SwapBuffers(DeviceContextHandle);
+		LastSwapWasPartial = GL_FALSE;
 #else
-		Linux_Restore();
+		Linux_PresentBuffers(Rects, NumRects);
 #endif
+		GLdouble SwapEnd = GetMonotonicTime();
+		RecordDamage(Rects, NumRects);
+		RunSwapHooks(SWAPHOOK_POST, SwapStart, SwapEnd);
+		SwapCount++;
+		GLdouble Deadline = FrameDeadline;
+
+		if(Deadline == 0 && Pacer && Pacer->GetTargetFPS() > 0)
+		{
+			Deadline = 1.5 / Pacer->GetTargetFPS();
+		}
+
+		SwapTimes.Record(SwapEnd - SwapStart);
+
+		if(LastSwapTime > 0)
+		{
+			FrameIntervals.Record(SwapEnd - LastSwapTime, Deadline);
+		}
+
+		if(DynamicResolutionEnabled && !GPUTimingEnabled)
+		{
+			//without timer queries the CPU time up to the resolve stands in. EndGPUTiming feeds the GPU time otherwise
+			UpdateRenderScale((RenderEnd > 0 && FrameStartTime > 0) ? RenderEnd - FrameStartTime : 0);
+		}
+
+		LastSwapTime = SwapEnd;
+
+		if(TimeToFirstFrame == 0)
+		{
+			TimeToFirstFrame = SwapEnd - InitializeTime;
+		}
+
+		if(Pacer)
+		{
+			Pacer->FrameFinished();
+		}
+
+		if(MaxFramesInFlight > 0)
+		{
+			LimitFramesInFlight();
+		}
+
+		//applications that never switch contexts only call MakeCurrentContext once
+		FrameStartTime = GetIsCurrentContext() ? SwapEnd : 0;
 
+		if(DynamicResolutionEnabled)
+		{
+			BeginRenderTarget();
+		}
+
+		//the next frame is timed from here, so the swap and the wait for the pacer aren't part of it
+		if(GPUTimingEnabled && FrameStartTime > 0)
+		{
+			BeginGPUTiming();
+		}
+
+		PacerWaitTime = 0;
 		return FOUNDATION_OKAY;
 	}
 
@@ -545,782 +688,3883 @@ GLboolean FWindow::Restore()
 }
 
 /**********************************************************************************************//**
- * @fn	GLboolean FWindow::GetResolution(GLuint& Width, GLuint& Height)
+ * @fn	GLboolean FWindow::SetFramePacer(FramePacer* NewPacer)
  *
- * @brief	Gets the resolution of the window by setting width and height.
+ * @brief	Attaches a frame pacer to this window. SwapDrawBuffers then waits until the pacer
+ * 			says the next frame is due. each window can have its own pacer so background windows
+ * 			can run slower than the main one.
  *
  * @author	Ziyad
- * @date	29/11/2014
+ * @date	18/10/2026
  *
- * @param [in,out]	Width 	The width.
- * @param [in,out]	Height	The height.
+ * @param [in,out]	NewPacer	The pacer to attach. null to detach the current one.
  *
- * @return	The resolution.
+ * @return	A GLboolean.
  **************************************************************************************************/
 
-GLboolean FWindow::GetResolution(GLuint& Width, GLuint& Height)
+GLboolean FWindow::SetFramePacer(FramePacer* NewPacer)
 {
-	if (ContextCreated)
+	Pacer = NewPacer;
+
+	if(Pacer)
 	{
-		Width = Resolution[0];
-		Height = Resolution[1];
-		return FOUNDATION_OKAY;
+		Pacer->Reset();
 	}
 
-	PrintErrorMessage(ERROR_NOCONTEXT);
-	return FOUNDATION_ERROR;
+	return FOUNDATION_OKAY;
 }
 
 /**********************************************************************************************//**
- * @fn	GLuint* FWindow::GetResolution()
+ * @fn	FramePacer* FWindow::GetFramePacer()
  *
- * @brief	Gets the resolution of the window.
+ * @brief	Gets the frame pacer attached to this window.
  *
  * @author	Ziyad
- * @date	29/11/2014
+ * @date	18/10/2026
  *
- * @return	null if it fails, else the resolution as an array. Resolution[0] always returns the
- *  width and Resolution[1] always returns the Height.
+ * @return	null if there is no pacer attached, else the frame pacer.
  **************************************************************************************************/
 
-GLuint* FWindow::GetResolution()
+FramePacer* FWindow::GetFramePacer()
 {
-	return Resolution;
+	return Pacer;
 }
 
 /**********************************************************************************************//**
- * @fn	void FWindow::SetResolution(GLuint Width, GLuint Height)
+ * @fn	FFrameStatistics FWindow::GetSwapTimeStatistics()
  *
- * @brief	Sets the resolution of the window.
+ * @brief	Gets statistics on how much CPU time SwapDrawBuffers took, not counting time spent
+ * 			waiting on the frame pacer.
  *
  * @author	Ziyad
- * @date	29/11/2014
+ * @date	18/10/2026
  *
- * @param	Width 	The new width of the window.
- * @param	Height	The new height of the window.
+ * @return	The swap time statistics.
  **************************************************************************************************/
 
-GLboolean FWindow::SetResolution(GLuint Width, GLuint Height)
+FFrameStatistics FWindow::GetSwapTimeStatistics()
 {
-	if (ContextCreated)
-	{
-		if(Width > 0 && Height > 0)
-		{
-			Resolution[0] = Width;
-			Resolution[1] = Height;
+	return SwapTimes.GetStatistics();
+}
 
-#if defined(_WIN32) || defined(_WIN64)
-			Windows_SetResolution(Resolution[0], Resolution[1]);
-#else
-			Linux_SetResolution(Width, Height);	
-#endif
-			glViewport(0, 0, Resolution[0], Resolution[1]);
+/**********************************************************************************************//**
+ * @fn	FFrameStatistics FWindow::GetFrameIntervalStatistics()
+ *
+ * @brief	Gets statistics on the time between calls to SwapDrawBuffers, including how many 
+ * 			frames missed their deadline.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	The frame interval statistics.
+ **************************************************************************************************/
 
-			return FOUNDATION_OKAY;
-		}
+FFrameStatistics FWindow::GetFrameIntervalStatistics()
+{
+	return FrameIntervals.GetStatistics();
+}
 
-		else
-		{
-			PrintErrorMessage(ERROR_INVALIDRESOLUTION);
-			return FOUNDATION_ERROR;
-		}
-	}  
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::ResetFrameStatistics()
+ *
+ * @brief	Forgets the frame statistics gathered so far.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
 
-		PrintErrorMessage(ERROR_NOCONTEXT);
-		return FOUNDATION_ERROR;
+GLboolean FWindow::ResetFrameStatistics()
+{
+	SwapTimes.Reset();
+	FrameIntervals.Reset();
+	PresentLatencies.Reset();
+	return FOUNDATION_OKAY;
 }
 
 /**********************************************************************************************//**
- * @fn	void FWindow::GetMousePosition(GLuint& X, GLuint& Y)
+ * @fn	GLboolean FWindow::SetFrameDeadline(GLdouble Seconds)
  *
- * @brief	Gets mouse position relative to the window coordinates by setting X and Y.
+ * @brief	Sets how long a frame may take before it counts as a missed deadline.
  *
  * @author	Ziyad
- * @date	29/11/2014
+ * @date	18/10/2026
  *
- * @param [in,out]	X	The X position of the mouse.
- * @param [in,out]	Y	The Y position of the mouse.
+ * @param	Seconds	The deadline in seconds. 0 to use the frame pacer's target.
+ *
+ * @return	A GLboolean.
  **************************************************************************************************/
 
-GLboolean FWindow::GetMousePosition(GLuint& X, GLuint& Y)
+GLboolean FWindow::SetFrameDeadline(GLdouble Seconds)
 {
-	if (ContextCreated)
+	if(Seconds < 0)
 	{
-		X = MousePosition[0];
-		Y = MousePosition[1];   /**< . */
-		return FOUNDATION_OKAY;
+		PrintErrorMessage(ERROR_INVALIDFRAMERATE);
+		return FOUNDATION_ERROR;
 	}
 
-	PrintErrorMessage(ERROR_NOCONTEXT);
-	return FOUNDATION_ERROR;
+	FrameDeadline = Seconds;
+	return FOUNDATION_OKAY;
 }
 
 /**********************************************************************************************//**
- * @fn	GLuint* FWindow::GetMousePosition()
+ * @fn	GLboolean FWindow::EnableGPUTiming(GLuint QueryCount)
  *
- * @brief	Gets mouse position relative to the window as an array.
+ * @brief	Starts timing frames on the GPU using a ring of GL_ARB_timer_query timestamps. a
+ * 			frame is timed from the first MakeCurrentContext after a swap (or from the top of the
+ * 			next frame if the context is still current) to the next SwapDrawBuffers, before it
+ * 			waits on the pacer or swaps. results are only read once the driver says they are available so
+ * 			the pipeline never stalls. if every slot in the ring is still waiting the frame is
+ * 			not timed.
  *
  * @author	Ziyad
- * @date	29/11/2014
+ * @date	18/10/2026
  *
- * @return	null if it fails, else the mouse position. MousePosition[0] always returns the X and
- *  MousePosition[1] always returns the Y.
+ * @param	QueryCount	How many frames can be waiting on results at once.
+ *
+ * @return	A GLboolean.
  **************************************************************************************************/
 
-GLuint* FWindow::GetMousePosition()
+GLboolean FWindow::EnableGPUTiming(GLuint QueryCount /* = 4 */)
 {
-	if (ContextCreated)
+	if(!ContextCreated)
 	{
-		return MousePosition;
+		PrintErrorMessage(ERROR_NOCONTEXT);
+		return FOUNDATION_ERROR;
 	}
 
-	PrintErrorMessage(ERROR_NOCONTEXT);
-	return nullptr;
+	if(!HasGLExtension("GL_ARB_timer_query"))
+	{
+		PrintErrorMessage(ERROR_NOTIMERQUERY);
+		return FOUNDATION_ERROR;
+	}
+
+	if(GPUTimingEnabled)
+	{
+		DisableGPUTiming();
+	}
+
+	QueryCount = (QueryCount < 2) ? 2 : QueryCount;
+	QueryCount = (QueryCount > GPUTIMING_MAXQUERIES) ? GPUTIMING_MAXQUERIES : QueryCount;
+
+	BindContext();
+	GLFunctions->glGenQueries(QueryCount * 3, GPUQueries);
+	GPUQueryCount = QueryCount;
+	GPUQueryHead = 0;
+	GPUQueryPending = 0;
+	GPUFrameOpen = GL_FALSE;
+	GPUResolveMarked = GL_FALSE;
+	GPUTimingEnabled = GL_TRUE;
+	DynamicResolutionTiming = GL_FALSE;
+	return FOUNDATION_OKAY;
 }
 
 /**********************************************************************************************//**
- * @fn	void FWindow::SetMousePosition(GLuint X, GLuint Y)
+ * @fn	GLboolean FWindow::DisableGPUTiming()
  *
- * @brief	Sets mouse position.
+ * @brief	Stops timing frames on the GPU and deletes the timer queries. results that were
+ * 			still pending are dropped.
  *
  * @author	Ziyad
- * @date	29/11/2014
+ * @date	18/10/2026
  *
- * @param	X	The new X position of the mouse relative to the window coordinates.
- * @param	Y	The new Y position of the mouse relative to the window coordinates.
+ * @return	A GLboolean.
  **************************************************************************************************/
 
-GLboolean FWindow::SetMousePosition(GLuint X, GLuint Y)
+GLboolean FWindow::DisableGPUTiming()
 {
-	if (ContextCreated)
-	{ 
-		MousePosition[0] = X;
-		MousePosition[1] = Y;
-#if defined(_WIN32) || defined(_WIN64)
-		Windows_SetMousePosition(X, Y);
-#else
-		Linux_SetMousePosition(X, Y);
-#endif
-		return FOUNDATION_OKAY;
+	if(GPUTimingEnabled)
+	{
+		BindContext();
+		GLFunctions->glDeleteQueries(GPUQueryCount * 3, GPUQueries);
+		GPUTimingEnabled = GL_FALSE;
+		GPUFrameOpen = GL_FALSE;
+		GPUQueryPending = 0;
+		DynamicResolutionTiming = GL_FALSE;
 	}
 
-	PrintErrorMessage(ERROR_NOCONTEXT);
-	return FOUNDATION_ERROR;
+	return FOUNDATION_OKAY;
 }
 
 /**********************************************************************************************//**
- * @fn	void FWindow::GetPosition(GLuint& X, GLuint& Y)
+ * @fn	FFrameStatistics FWindow::GetGPUTimeStatistics()
  *
- * @brief	Gets a position.
+ * @brief	Gets statistics on how long frames took on the GPU.
  *
  * @author	Ziyad
- * @date	29/11/2014
+ * @date	18/10/2026
  *
- * @param [in,out]	X	The X coordinate of the window position relative to screen coordinates.
- * @param [in,out]	Y	The Y coordinates of the window position relative to screen coordinates.
+ * @return	The GPU time statistics.
  **************************************************************************************************/
 
-GLboolean FWindow::GetPosition(GLuint& X, GLuint& Y)
+FFrameStatistics FWindow::GetGPUTimeStatistics()
 {
-	if (ContextCreated)
-	{
-		X = Position[0];
-		Y = Position[1];
-
-		return FOUNDATION_OKAY;
-	}
-
-	PrintErrorMessage(ERROR_NOCONTEXT);
-	return FOUNDATION_ERROR;
+	return GPUFrameTimes.GetStatistics();
 }
 
 /**********************************************************************************************//**
- * @fn	GLuint* FWindow::GetPosition()
+ * @fn	FFrameStatistics FWindow::GetCPUTimeStatistics()
  *
- * @brief	Gets the position.
+ * @brief	Gets statistics on the CPU time between the first MakeCurrentContext of a frame and
+ * 			SwapDrawBuffers. only recorded while GPU timing is on so the two line up.
  *
  * @author	Ziyad
- * @date	29/11/2014
+ * @date	18/10/2026
  *
- * @return	null if it fails, else the position. Position[0] always returns the X coordinate of
- *  the window relative to screen coordinates and Position[1] always returns the Y coordinates of
- *  the window.
+ * @return	The CPU time statistics.
  **************************************************************************************************/
 
-GLuint* FWindow::GetPosition()
+FFrameStatistics FWindow::GetCPUTimeStatistics()
 {
-	return Position;
+	return CPUFrameTimes.GetStatistics();
 }
 
 /**********************************************************************************************//**
- * @fn	void FWindow::SetPosition(GLuint X, GLuint Y)
+ * @fn	void FWindow::BeginGPUTiming()
  *
- * @brief	Sets a position.
+ * @brief	Issues the start timestamp of a frame unless the frame is already being timed or 
+ * 			every slot in the ring is still waiting on results. the context must be current.
  *
  * @author	Ziyad
- * @date	29/11/2014
- *
- * @param	X	The new X coordinate of the window position relative to screen coordinates.
- * @param	Y	The new Y coordinate of the window position relative to screen coordinates.
+ * @date	18/10/2026
  **************************************************************************************************/
 
-GLboolean FWindow::SetPosition(GLuint X, GLuint Y)
+void FWindow::BeginGPUTiming()
 {
-	if (ContextCreated)
+	if(GPUTimingEnabled && !GPUFrameOpen && GPUQueryPending < GPUQueryCount)
 	{
-		Position[0] = X;
-		Position[1] = Y;
-#if defined(_WIN32) || defined(_WIN64)
-		Windows_SetPosition(Position[0], Position[1]);
-#else
-		Linux_SetPosition(X, Y);
-#endif
+		GLFunctions->glQueryCounter(GPUQueries[GPUQueryHead * 3], GL_TIMESTAMP);
+		CPUFrameStart = GetMonotonicTime();
+		GPUFrameOpen = GL_TRUE;
+		GPUResolveMarked = GL_FALSE;
 	}
-
-	PrintErrorMessage(ERROR_NOCONTEXT);
-	return FOUNDATION_ERROR;
 }
 
 /**********************************************************************************************//**
- * @fn	const char* FWindow::GetWindowName()
+ * @fn	void FWindow::MarkGPUResolve()
  *
- * @brief	Gets window name.
+ * @brief	Issues the timestamp for the end of rendering, i.e. right after the render target is
+ * 			resolved. what comes after it(mirrors, panels, swap hooks) isn't affected by the 
+ * 			render scale so it isn't part of the render time.
  *
  * @author	Ziyad
- * @date	29/11/2014
- *
- * @return	null if it fails, else the window name.
+ * @date	18/10/2026
  **************************************************************************************************/
 
-const char* FWindow::GetWindowName()
+void FWindow::MarkGPUResolve()
 {
-	if (ContextCreated)
+	if(GPUFrameOpen && !GPUResolveMarked)
 	{
-		return Name;
+		GLFunctions->glQueryCounter(GPUQueries[(GPUQueryHead * 3) + 1], GL_TIMESTAMP);
+		GPUResolveMarked = GL_TRUE;
 	}
-
-	PrintErrorMessage(ERROR_NOCONTEXT);
-	return nullptr;
 }
 
 /**********************************************************************************************//**
- * @fn	void FWindow::SetTitleBar(const char* NewTitle)
+ * @fn	void FWindow::EndGPUTiming()
  *
- * @brief	Sets title bar.
+ * @brief	Issues the end timestamp of the current frame then reads back every finished frame,
+ * 			oldest first, stopping at the first one the GPU hasn't finished yet. with dynamic
+ * 			resolution on, each frame's render time picks the next render scale.
  *
  * @author	Ziyad
- * @date	29/11/2014
- *
- * @param	NewTitle	The new title bar of the window.
+ * @date	18/10/2026
  **************************************************************************************************/
 
-GLboolean FWindow::SetTitleBar(const char* NewTitle)
+void FWindow::EndGPUTiming()
 {
-	if (ContextCreated)
+	if(!GPUTimingEnabled)
 	{
-		if(NewTitle != nullptr)
+		return;
+	}
+
+	BindContext();
+
+	if(GPUFrameOpen)
+	{
+		//frames that weren't resolved end their render time here
+		MarkGPUResolve();
+		GLFunctions->glQueryCounter(GPUQueries[(GPUQueryHead * 3) + 2], GL_TIMESTAMP);
+		CPUFrameTimes.Record(GetMonotonicTime() - CPUFrameStart);
+		GPUQueryHead = (GPUQueryHead + 1) % GPUQueryCount;
+		GPUQueryPending++;
+		GPUFrameOpen = GL_FALSE;
+	}
+
+	while(GPUQueryPending > 0)
+	{
+		GLuint Oldest = (GPUQueryHead + GPUQueryCount - GPUQueryPending) % GPUQueryCount;
+		GLint Available = GL_FALSE;
+		GLFunctions->glGetQueryObjectiv(GPUQueries[(Oldest * 3) + 2], GL_QUERY_RESULT_AVAILABLE, &Available);
+
+		if(!Available)
 		{
-#if defined(_WIN32) || defined(_WIN64)
-			Windows_SetTitleBar(NewTitle);
-#else
-			Linux_SetTitleBar(NewTitle);
-#endif
-			return FOUNDATION_OKAY;
+			break;
 		}
 
-		else
+		GLuint64 Start = 0, Resolved = 0, End = 0;
+		GLFunctions->glGetQueryObjectui64v(GPUQueries[Oldest * 3], GL_QUERY_RESULT, &Start);
+		GLFunctions->glGetQueryObjectui64v(GPUQueries[(Oldest * 3) + 1], GL_QUERY_RESULT, &Resolved);
+		GLFunctions->glGetQueryObjectui64v(GPUQueries[(Oldest * 3) + 2], GL_QUERY_RESULT, &End);
+		LastGPUFrameTime = (End > Start) ? (GLdouble)(End - Start) * 1e-9 : 0;
+		GPUFrameTimes.Record(LastGPUFrameTime);
+		GPUQueryPending--;
+
+		if(DynamicResolutionEnabled)
 		{
-			PrintErrorMessage(ERROR_INVALIDTITLEBAR);
-			return FOUNDATION_ERROR;
+			UpdateRenderScale((Resolved > Start) ? (GLdouble)(Resolved - Start) * 1e-9 : 0);
 		}
 	}
-
-	PrintErrorMessage(ERROR_NOCONTEXT);
-	return FOUNDATION_ERROR;
 }
 
-GLboolean FWindow::SetIcon(const char* Icon, GLuint Width, GLuint Height)
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::SetMaxFramesInFlight(GLuint MaxFrames)
+ *
+ * @brief	Limits how many frames may be queued ahead of the GPU. a fence is inserted after
+ * 			every swap and before frame k + MaxFrames starts, SwapDrawBuffers waits on the fence
+ * 			of frame k. this trades a little throughput for lower and more predictable latency.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	MaxFrames	The most frames that may be in flight. 0 removes the limit.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FWindow::SetMaxFramesInFlight(GLuint MaxFrames)
 {
-	if (ContextCreated)
+	if(!ContextCreated)
 	{
-#if defined(_WIN32) || defined(_WIN64)
-		Windows_SetIcon(Icon, Width, Height);
-#else
-		Linux_SetIcon(Icon, Width, Height);
-#endif
-		return FOUNDATION_OKAY;
-	}
-	return FOUNDATION_ERROR;
+		PrintErrorMessage(ERROR_NOCONTEXT);
+		return FOUNDATION_ERROR;
+	}
+
+	if(MaxFrames > 0 && !HasGLExtension("GL_ARB_sync"))
+	{
+		PrintErrorMessage(ERROR_NOFENCESYNC);
+		return FOUNDATION_ERROR;
+	}
+
+	BindContext();
+
+	//fences from the old limit are simply dropped
+	while(FrameFencePending > 0)
+	{
+		GLuint Oldest = (FrameFenceHead + FRAMESINFLIGHT_MAX - FrameFencePending) % FRAMESINFLIGHT_MAX;
+		GLFunctions->glDeleteSync(FrameFences[Oldest]);
+		FrameFencePending--;
+	}
+
+	MaxFramesInFlight = (MaxFrames > FRAMESINFLIGHT_MAX) ? FRAMESINFLIGHT_MAX : MaxFrames;
+	FrameFenceHead = 0;
+	return FOUNDATION_OKAY;
 }
 
-GLboolean FWindow::SetStyle(GLuint WindowType)
+/**********************************************************************************************//**
+ * @fn	GLuint FWindow::GetMaxFramesInFlight()
+ *
+ * @brief	Gets how many frames may be queued ahead of the GPU.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	The most frames that may be in flight. 0 if there is no limit.
+ **************************************************************************************************/
+
+GLuint FWindow::GetMaxFramesInFlight()
+{
+	return MaxFramesInFlight;
+}
+
+/**********************************************************************************************//**
+ * @fn	FFrameStatistics FWindow::GetFenceWaitStatistics()
+ *
+ * @brief	Gets statistics on how long SwapDrawBuffers waited for the GPU to catch up.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	The fence wait statistics.
+ **************************************************************************************************/
+
+FFrameStatistics FWindow::GetFenceWaitStatistics()
 {
-	if (ContextCreated)
+	return FenceWaitTimes.GetStatistics();
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::LimitFramesInFlight()
+ *
+ * @brief	Fences the frame that was just swapped then waits on the oldest fences until fewer
+ * 			than MaxFramesInFlight frames are left in flight.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void FWindow::LimitFramesInFlight()
+{
+	BindContext();
+
+	FrameFences[FrameFenceHead] = GLFunctions->glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	FrameFenceHead = (FrameFenceHead + 1) % FRAMESINFLIGHT_MAX;
+	FrameFencePending++;
+
+	while(FrameFencePending >= MaxFramesInFlight)
 	{
-#if defined(_WIN32) || defined(_WIN64)
-		Windows_SetStyle(WindowType);
-#else
-		Linux_SetStyle(WindowType);
-#endif
-		PrintErrorMessage(ERROR_NOCONTEXT);
-		return FOUNDATION_OKAY;
-	}
+		GLuint Oldest = (FrameFenceHead + FRAMESINFLIGHT_MAX - FrameFencePending) % FRAMESINFLIGHT_MAX;
+		GLdouble WaitStart = GetMonotonicTime();
 
-	return FOUNDATION_ERROR;
+		//give up after a second so a hung GPU can't hang the application inside the driver
+		GLFunctions->glClientWaitSync(FrameFences[Oldest], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+
+		FenceWaitTimes.Record(GetMonotonicTime() - WaitStart);
+		GLFunctions->glDeleteSync(FrameFences[Oldest]);
+		FrameFencePending--;
+	}
 }
 
 /**********************************************************************************************//**
- * @fn	GLboolean FWindow::MakeCurrentContext()
+ * @fn	GLboolean FWindow::AddDamage(const FDamageRect& Rect)
  *
- * @brief	Makes the window be the current OpenGL context to be drawn to. NOTE: Does not change
- *  the IsCurrentContext variable foe other windows.
+ * @brief	Marks part of the window as changed. once there are too many rectangles they are 
+ * 			merged into their bounds.
  *
  * @author	Ziyad
- * @date	29/11/2014
+ * @date	18/10/2026
+ *
+ * @param	Rect	The rectangle that changed, in window coordinates.
  *
  * @return	A GLboolean.
  **************************************************************************************************/
 
-GLboolean FWindow::MakeCurrentContext()
+GLboolean FWindow::AddDamage(const FDamageRect& Rect)
 {
-	if(ContextCreated)
+	if(Rect.IsEmpty())
 	{
-		IsCurrentContext = true;
-#if defined(_WIN32) || defined(_WIN64)
-		wglMakeCurrent(DeviceContextHandle, GLRenderingContextHandle);
-#else
-		glXMakeCurrent(WindowManager::GetDisplay(), WindowHandle, Context);
-#endif
 		return FOUNDATION_OKAY;
 	}
 
-	PrintErrorMessage(ERROR_NOCONTEXT);
-	return FOUNDATION_ERROR;
+	if(PendingDamageCount < DAMAGE_MAXRECTS)
+	{
+		PendingDamage[PendingDamageCount++] = Rect;
+		return FOUNDATION_OKAY;
+	}
+
+	for(GLuint Iter = 1; Iter < PendingDamageCount; Iter++)
+	{
+		PendingDamage[0] = PendingDamage[0].Union(PendingDamage[Iter]);
+	}
+
+	PendingDamage[0] = PendingDamage[0].Union(Rect);
+	PendingDamageCount = 1;
+	return FOUNDATION_OKAY;
 }
 
 /**********************************************************************************************//**
- * @fn	GLboolean FWindow::GetIsCurrentContext()
+ * @fn	GLuint FWindow::GetBufferAge()
  *
- * @brief	Gets is current context.
+ * @brief	Gets how many frames old the contents of the back buffer are, using GLX_EXT_buffer_age.
+ * 			after a partial present the back buffer still holds the last frame so this is 1.
  *
  * @author	Ziyad
- * @date	3/01/2015
+ * @date	18/10/2026
  *
- * @return	The is current context.
+ * @return	The buffer age. 0 if unknown.
  **************************************************************************************************/
 
-GLboolean FWindow::GetIsCurrentContext()
+GLuint FWindow::GetBufferAge()
 {
-	if(ContextCreated)
+	if(!ContextCreated && !SoftwarePixels)
+	{
+		PrintErrorMessage(ERROR_NOCONTEXT);
+		return 0;
+	}
+
+	if(LastSwapWasPartial)
 	{
-		return IsCurrentContext;
+		return 1;
 	}
-	PrintErrorMessage(ERROR_NOCONTEXT);
-	return GL_FALSE;
+
+#if defined(__linux__)
+	if(BufferAgeSupported && ContextCreated)
+	{
+		GLuint Age = 0;
+		//the drawable has to be current to query its age
+		BindContext();
+		glXQueryDrawable(WindowManager::GetDisplay(), WindowHandle, GLX_BACK_BUFFER_AGE_EXT, &Age);
+		return Age;
+	}
+#endif
+
+	return 0;
 }
 
 /**********************************************************************************************//**
- * @fn	GLboolean FWindow::GetContextHasBeenCreated()
+ * @fn	FDamageRect FWindow::GetRepaintBounds()
  *
- * @brief	Gets context has been created.
+ * @brief	Gets the area that has to be redrawn for the back buffer to be up to date: the
+ * 			pending damage plus whatever changed in the frames the back buffer missed. the 
+ * 			whole window if the buffer age is unknown or older than the history.
  *
  * @author	Ziyad
- * @date	3/01/2015
+ * @date	18/10/2026
  *
- * @return	The context has been created.
+ * @return	The bounds of the area to redraw.
  **************************************************************************************************/
 
-GLboolean FWindow::GetContextHasBeenCreated()
+FDamageRect FWindow::GetRepaintBounds()
 {
-	return ContextCreated;
+	FDamageRect WholeWindow(0, 0, Resolution[0], Resolution[1]);
+	GLuint Age = GetBufferAge();
+
+	if(Age == 0 || Age > DAMAGE_HISTORY)
+	{
+		return WholeWindow;
+	}
+
+	FDamageRect Bounds;
+
+	for(GLuint Iter = 0; Iter < PendingDamageCount; Iter++)
+	{
+		Bounds = Bounds.Union(PendingDamage[Iter]);
+	}
+
+	for(GLuint Iter = 1; Iter < Age; Iter++)
+	{
+		Bounds = Bounds.Union(DamageHistory[(DamageHistoryHead + DAMAGE_HISTORY - Iter) % DAMAGE_HISTORY]);
+	}
+
+	return Bounds;
 }
 
 /**********************************************************************************************//**
- * @fn	void FWindow::InitGLExtensions()
+ * @fn	void FWindow::RecordDamage(const FDamageRect* Rects, GLuint NumRects)
  *
- * @brief	Initializes the OpenGL extensions for this window.
+ * @brief	Remembers the bounds of what changed in the frame that was just presented and clears
+ * 			the pending damage. a frame with no damage at all counts as the whole window.
  *
  * @author	Ziyad
- * @date	29/11/2014
+ * @date	18/10/2026
+ *
+ * @param	Rects   	The rectangles that were presented. null for the whole window.
+ * @param	NumRects	How many rectangles there are.
  **************************************************************************************************/
 
-void FWindow::InitGLExtensions()
+void FWindow::RecordDamage(const FDamageRect* Rects, GLuint NumRects)
+{
+	FDamageRect Bounds;
+
+	for(GLuint Iter = 0; Rects && Iter < NumRects; Iter++)
+	{
+		Bounds = Bounds.Union(Rects[Iter]);
+	}
+
+	for(GLuint Iter = 0; Iter < PendingDamageCount; Iter++)
+	{
+		Bounds = Bounds.Union(PendingDamage[Iter]);
+	}
+
+	if(Bounds.IsEmpty())
+	{
+		Bounds = FDamageRect(0, 0, Resolution[0], Resolution[1]);
+	}
+
+	DamageHistory[DamageHistoryHead] = Bounds;
+	DamageHistoryHead = (DamageHistoryHead + 1) % DAMAGE_HISTORY;
+	PendingDamageCount = 0;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::ResetDamage()
+ *
+ * @brief	Marks the whole window as damaged and fills the history with the whole window, so 
+ * 			nothing from the buffers before a resize is trusted whatever age the driver reports.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void FWindow::ResetDamage()
+{
+	FDamageRect WholeWindow(0, 0, Resolution[0], Resolution[1]);
+
+	for(GLuint Iter = 0; Iter < DAMAGE_HISTORY; Iter++)
+	{
+		DamageHistory[Iter] = WholeWindow;
+	}
+
+	PendingDamageCount = 0;
+	AddDamage(WholeWindow);
+	//the back buffer no longer holds the last frame
+	LastSwapWasPartial = GL_FALSE;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLubyte* FWindow::GetSoftwareSurface(GLuint& Width, GLuint& Height, GLuint& Stride)
+ *
+ * @brief	Gets the CPU pixel buffer of a window created with CONTEXTCREATION_SOFTWARE. if the
+ * 			window was resized since the last call the buffer is replaced with a blank one at
+ * 			the new size. when the buffer is the platform's image itself this waits for the 
+ * 			last present to be done reading it.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param [out]	Width 	The width of the surface.
+ * @param [out]	Height	The height of the surface.
+ * @param [out]	Stride	How many bytes apart the rows are.
+ *
+ * @return	null if the window has no software surface, else the pixels.
+ **************************************************************************************************/
+
+GLubyte* FWindow::GetSoftwareSurface(GLuint& Width, GLuint& Height, GLuint& Stride)
 {
+	if(!Initialized || ContextCreation != CONTEXTCREATION_SOFTWARE)
+	{
+		PrintErrorMessage(ERROR_NOSOFTWARESURFACE);
+		return nullptr;
+	}
+
+	if((!SoftwarePixels || SoftwareSize[0] != Resolution[0] || SoftwareSize[1] != Resolution[1]) &&
+		!CreateSoftwareSurface())
+	{
+		return nullptr;
+	}
+
+	//the application is about to draw into what the last present may still be reading
+	if(!SoftwareStaged)
+	{
 #if defined(_WIN32) || defined(_WIN64)
-	Windows_InitGLExtensions();
+		GdiFlush();
 #else
-	Linux_InitGLExtensions();
+		if(SurfaceBusy)
+		{
+			XSync(WindowManager::GetDisplay(), False);
+			SurfaceBusy = GL_FALSE;
+		}
 #endif
+	}
+
+	Width = SoftwareSize[0];
+	Height = SoftwareSize[1];
+	Stride = SoftwareStride;
+	return SoftwarePixels;
 }
 
 /**********************************************************************************************//**
- * @fn	GLboolean FWindow::PrintOpenGLVersion()
+ * @fn	GLuint FWindow::GetSoftwareSurfaceFormat()
  *
- * @brief	Print open gl version.
+ * @brief	Gets the byte order of the software surface's pixels.
  *
  * @author	Ziyad
- * @date	3/01/2015
+ * @date	18/10/2026
+ *
+ * @return	SOFTWAREFORMAT_RGBA or SOFTWAREFORMAT_BGRA.
+ **************************************************************************************************/
+
+GLuint FWindow::GetSoftwareSurfaceFormat()
+{
+	return SoftwareFormat;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::SwapSoftwareSurface(const FDamageRect* Rects, GLuint NumRects)
+ *
+ * @brief	Presents the software surface. only the given rectangles and pending damage(e.g.
+ * 			exposed areas) are converted and sent, or the whole surface if there are none. the
+ * 			surface is never discarded so the buffer age is always 1 afterwards.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Rects   	The rectangles that changed this frame. null presents the whole window.
+ * @param	NumRects	How many rectangles there are.
  *
  * @return	A GLboolean.
  **************************************************************************************************/
 
-GLboolean FWindow::PrintOpenGLVersion()
+GLboolean FWindow::SwapSoftwareSurface(const FDamageRect* Rects, GLuint NumRects)
 {
-	if(ContextCreated)
+	if(!SoftwarePixels)
 	{
-		printf("%s\n", glGetString(GL_VERSION));
-		return FOUNDATION_OKAY;
+		PrintErrorMessage(ERROR_NOSOFTWARESURFACE);
+		return FOUNDATION_ERROR;
 	}
 
-	PrintErrorMessage(ERROR_NOCONTEXT);
-	return FOUNDATION_ERROR;
+	//the contents didn't survive a resize so everything has to go
+	if(SoftwareSize[0] != Resolution[0] || SoftwareSize[1] != Resolution[1])
+	{
+		Rects = nullptr;
+		NumRects = 0;
+		PendingDamageCount = 0;
+	}
+
+	RunSwapHooks(SWAPHOOK_PRE, 0, 0);
+
+	if(Pacer)
+	{
+		GLdouble WaitStart = GetMonotonicTime();
+		Pacer->WaitForNextFrame();
+		PacerWaitTime = GetMonotonicTime() - WaitStart;
+	}
+
+	GLdouble SwapStart = GetMonotonicTime();
+#if defined(_WIN32) || defined(_WIN64)
+	Windows_PresentSoftwareSurface(Rects, NumRects);
+#else
+	Linux_PresentSoftwareSurface(Rects, NumRects);
+#endif
+	GLdouble SwapEnd = GetMonotonicTime();
+	RecordDamage(Rects, NumRects);
+	LastSwapWasPartial = GL_TRUE;
+	RunSwapHooks(SWAPHOOK_POST, SwapStart, SwapEnd);
+	SwapCount++;
+
+	GLdouble Deadline = FrameDeadline;
+
+	if(Deadline == 0 && Pacer && Pacer->GetTargetFPS() > 0)
+	{
+		Deadline = 1.5 / Pacer->GetTargetFPS();
+	}
+
+	SwapTimes.Record(SwapEnd - SwapStart);
+
+	if(LastSwapTime > 0)
+	{
+		FrameIntervals.Record(SwapEnd - LastSwapTime, Deadline);
+	}
+
+	LastSwapTime = SwapEnd;
+
+	if(TimeToFirstFrame == 0)
+	{
+		TimeToFirstFrame = SwapEnd - InitializeTime;
+	}
+
+	if(Pacer)
+	{
+		Pacer->FrameFinished();
+	}
+
+	PacerWaitTime = 0;
+	return FOUNDATION_OKAY;
 }
 
-const char* FWindow::GetOpenGLVersion()
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::CreateSoftwareSurface()
+ *
+ * @brief	Creates the software surface at the window's resolution, replacing any old one. the
+ * 			platform hands out its own image when it is 32 bit RGBA or BGRA in the host's byte
+ * 			order, so presenting never touches the pixels. for any other layout the application
+ * 			draws into an RGBA copy that is converted into the image on every present.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FWindow::CreateSoftwareSurface()
 {
-	if(ContextCreated)
+	DestroySoftwareSurface();
+
+	SoftwareSize[0] = (Resolution[0] > 0) ? Resolution[0] : 1;
+	SoftwareSize[1] = (Resolution[1] > 0) ? Resolution[1] : 1;
+	SoftwareStride = SoftwareSize[0] * 4;
+	SoftwareFormat = SOFTWAREFORMAT_RGBA;
+	SoftwareStaged = GL_FALSE;
+	LastSwapWasPartial = GL_FALSE;
+
+	//sets SoftwarePixels if the application can draw straight into the platform's image
+#if defined(_WIN32) || defined(_WIN64)
+	GLboolean Created = Windows_CreateSoftwareSurface();
+#else
+	GLboolean Created = Linux_CreateSoftwareSurface();
+#endif
+
+	if(!Created)
 	{
-		return (const char*)glGetString(GL_VERSION);
+#if defined(_WIN32) || defined(_WIN64)
+		Windows_DestroySoftwareSurface();
+#else
+		Linux_DestroySoftwareSurface();
+#endif
+		SoftwarePixels = nullptr;
+		SoftwareSize[0] = SoftwareSize[1] = 0;
+		PrintErrorMessage(ERROR_NOSOFTWARESURFACE);
+		return FOUNDATION_ERROR;
 	}
-	PrintErrorMessage(ERROR_NOCONTEXT);
-	return nullptr;
+
+	if(!SoftwarePixels)
+	{
+		SoftwarePixels = new GLubyte[(size_t)SoftwareStride * SoftwareSize[1]]();
+		SoftwareFormat = SOFTWAREFORMAT_RGBA;
+		SoftwareStaged = GL_TRUE;
+	}
+
+	return FOUNDATION_OKAY;
 }
 
-GLboolean FWindow::PrintOpenGLExtensions()
+/**********************************************************************************************//**
+ * @fn	void FWindow::DestroySoftwareSurface()
+ *
+ * @brief	Destroys the software surface if there is one.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void FWindow::DestroySoftwareSurface()
 {
-	if(ContextCreated)
+	if(!SoftwarePixels)
 	{
-		printf("%s \n", (const char*)glGetString(GL_EXTENSIONS));
-		return FOUNDATION_OKAY;
+		return;
 	}
 
-		PrintErrorMessage(ERROR_NOCONTEXT);
-		return FOUNDATION_ERROR;
+#if defined(_WIN32) || defined(_WIN64)
+	Windows_DestroySoftwareSurface();
+#else
+	Linux_DestroySoftwareSurface();
+#endif
+
+	if(SoftwareStaged)
+	{
+		delete[] SoftwarePixels;
+	}
+
+	SoftwarePixels = nullptr;
+	SoftwareStaged = GL_FALSE;
+	SoftwareSize[0] = SoftwareSize[1] = 0;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::ConvertSoftwareRow(const GLubyte* Source, GLuint* Destination, GLuint Width, GLuint RedShift, GLuint GreenShift, GLuint BlueShift)
+ *
+ * @brief	Converts a row of RGBA pixels into the 32 bit layout of the window, with each 8 bit
+ * 			channel moved to its bit offset. with SSE2 four pixels are done at a time.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Source	   	The RGBA pixels.
+ * @param	Destination	Where the converted pixels go.
+ * @param	Width	   	How many pixels to convert.
+ * @param	RedShift   	The bit offset of the red channel.
+ * @param	GreenShift 	The bit offset of the green channel.
+ * @param	BlueShift  	The bit offset of the blue channel.
+ **************************************************************************************************/
+
+void FWindow::ConvertSoftwareRow(const GLubyte* Source, GLuint* Destination, GLuint Width,
+	GLuint RedShift, GLuint GreenShift, GLuint BlueShift)
+{
+	GLuint Pixel = 0;
+
+#if defined(FOUNDATION_SSE2)
+	const __m128i ChannelMask = _mm_set1_epi32(0xFF);
+	const __m128i Red = _mm_cvtsi32_si128(RedShift);
+	const __m128i Green = _mm_cvtsi32_si128(GreenShift);
+	const __m128i Blue = _mm_cvtsi32_si128(BlueShift);
+
+	for(; Pixel + 4 <= Width; Pixel += 4)
+	{
+		//pixels are RGBA in memory so each 32 bit lane holds R in its lowest byte
+		__m128i Pixels = _mm_loadu_si128((const __m128i*)(Source + (Pixel * 4)));
+		__m128i Result = _mm_sll_epi32(_mm_and_si128(Pixels, ChannelMask), Red);
+		Result = _mm_or_si128(Result, _mm_sll_epi32(_mm_and_si128(_mm_srli_epi32(Pixels, 8), ChannelMask), Green));
+		Result = _mm_or_si128(Result, _mm_sll_epi32(_mm_and_si128(_mm_srli_epi32(Pixels, 16), ChannelMask), Blue));
+		_mm_storeu_si128((__m128i*)(Destination + Pixel), Result);
+	}
+#endif
+
+	for(; Pixel < Width; Pixel++)
+	{
+		const GLubyte* Channels = Source + (Pixel * 4);
+		Destination[Pixel] = ((GLuint)Channels[0] << RedShift) | ((GLuint)Channels[1] << GreenShift) |
+			((GLuint)Channels[2] << BlueShift);
+	}
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::SetSwapInterval(GLint SwapSetting)
+ *
+ * @brief	Sets swap interval(V-sync).
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @param	SwapSetting	The swap setting.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FWindow::SetSwapInterval(GLint SwapSetting)
+{
+	if(ContextCreated)
+	{
+	CurrentSwapInterval = SwapSetting;
+#if defined(_WIN32) || defined(_WIN64)
+	Windows_VerticalSync(SwapSetting);
+#else
+	Linux_VerticalSync(SwapSetting);
+#endif
+
+	return FOUNDATION_OKAY;
+	}
+
+	PrintErrorMessage(ERROR_NOCONTEXT);
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLuint FWindow::GetCurrentState()
+ *
+ * @brief	Gets current state.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @return	The current state.
+ **************************************************************************************************/
+
+GLuint FWindow::GetCurrentState()
+{
+	return CurrentState;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::SetCurrentState(GLuint NewState)
+ *
+ * @brief	Sets the current state of the window.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @param	NewState	new state of the window.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FWindow::SetCurrentState(GLuint NewState)
+{
+	/**
+	* first we restore the window to make moving from state to state as easy as possible
+	*/
+
+	if(Initialized)
+	{
+
+	Restore();
+
+	switch(NewState)
+	{
+		case WINDOWSTATE_MAXIMIZED:
+			{
+				Maximize(GL_TRUE);
+				break;
+			}
+
+		case WINDOWSTATE_MINIMIZED:
+			{
+				Minimize(GL_TRUE);
+				break;
+			}
+
+			case WINDOWSTATE_FULLSCREEN:
+			{
+				FullScreen(GL_FALSE);
+				break;
+			}
+
+			default:
+			{
+				break;
+			}
+	}
+	}
+
+	PrintErrorMessage(ERROR_NOCONTEXT);
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::GetIsFullScreen()
+ *
+ * @brief	returns whether the window is in full screen mode.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @return	Whether the window is currently in full screen mode.
+ **************************************************************************************************/
+
+GLboolean FWindow::GetIsFullScreen()
+{
+	if(Initialized)
+	{
+		return (CurrentState == WINDOWSTATE_FULLSCREEN);
+	}
+
+	PrintErrorMessage(ERROR_NOCONTEXT);
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::FullScreen(GLboolean ShouldBeFullscreen)
+ *
+ * @brief	toggle the full screen mode for the window.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @param	ShouldBeFullscreen	whether the window should be in full screen mode.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FWindow::FullScreen(GLboolean ShouldBeFullscreen)
+{
+	if(Initialized)
+	{
+		if(!ShouldBeFullscreen)
+		{
+			RestoreDisplayMode();
+		}
+
+		if (ShouldBeFullscreen)
+		{
+			CurrentState = WINDOWSTATE_FULLSCREEN;
+		}
+
+		else
+		{
+			CurrentState = WINDOWSTATE_NORMAL;
+		}
+
+#if defined(_WIN32) || defined(_WIN64)
+		Windows_FullScreen();
+#else
+		Linux_FullScreen(ShouldBeFullscreen);
+#endif
+
+		return FOUNDATION_OKAY;
+	}
+
+	PrintErrorMessage(ERROR_NOCONTEXT);
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::SetLowLatencyMode(GLboolean NewState)
+ *
+ * @brief	Toggles low latency mode. on Linux a low latency window asks the compositor to 
+ * 			unredirect it(_NET_WM_BYPASS_COMPOSITOR) even when it isn't full screen. Windows
+ * 			decides whether to bypass composition on its own.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	NewState	Whether the window should be in low latency mode.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FWindow::SetLowLatencyMode(GLboolean NewState)
+{
+	LowLatencyMode = NewState;
+
+	if(Initialized)
+	{
+#if defined(__linux__)
+		Linux_UpdateCompositorBypass();
+#endif
+	}
+
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::GetLowLatencyMode()
+ *
+ * @brief	Gets whether the window is in low latency mode.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	Whether the window is in low latency mode.
+ **************************************************************************************************/
+
+GLboolean FWindow::GetLowLatencyMode()
+{
+	return LowLatencyMode;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::GetIsBypassingCompositor()
+ *
+ * @brief	Gets whether the window currently asks the compositor to be bypassed, as stored on 
+ * 			the X server. always false on Windows.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	Whether the window is asking to bypass the compositor.
+ **************************************************************************************************/
+
+GLboolean FWindow::GetIsBypassingCompositor()
+{
+	if(Initialized)
+	{
+#if defined(__linux__)
+		return Linux_GetIsBypassingCompositor();
+#else
+		return GL_FALSE;
+#endif
+	}
+
+	PrintErrorMessage(ERROR_NOTINITIALIZED);
+	return GL_FALSE;
+}
+
+/**********************************************************************************************//**
+ * @fn	std::list<FDisplayMode> FWindow::GetDisplayModes()
+ *
+ * @brief	Gets the modes the display the window is on supports, along with their refresh rates.
+ * 			on Linux this is the output of the CRTC the window is on and needs XRandR 1.3.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	The display modes. empty if they can't be listed.
+ **************************************************************************************************/
+
+std::list<FDisplayMode> FWindow::GetDisplayModes()
+{
+	if(Initialized)
+	{
+#if defined(_WIN32) || defined(_WIN64)
+		return Windows_GetDisplayModes();
+#else
+		return Linux_GetDisplayModes();
+#endif
+	}
+
+	PrintErrorMessage(ERROR_NOTINITIALIZED);
+	return std::list<FDisplayMode>();
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::ExclusiveFullScreen(GLuint Width, GLuint Height, GLdouble RefreshRate)
+ *
+ * @brief	Switches the display the window is on to the given resolution and covers it with the
+ * 			window. useful when the GPU can't fill the native resolution fast enough. of the 
+ * 			matching modes the one closest to RefreshRate is used, or the fastest if it is 0. 
+ * 			the original mode is restored by FullScreen(false), Shutdown, and when the process 
+ * 			exits or crashes.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Width	   	The horizontal resolution to switch to.
+ * @param	Height	   	The vertical resolution to switch to.
+ * @param	RefreshRate	The refresh rate to aim for. 0 for the fastest.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FWindow::ExclusiveFullScreen(GLuint Width, GLuint Height, GLdouble RefreshRate)
+{
+	if(!Initialized)
+	{
+		PrintErrorMessage(ERROR_NOTINITIALIZED);
+		return FOUNDATION_ERROR;
+	}
+
+	std::list<FDisplayMode> Modes = GetDisplayModes();
+	const FDisplayMode* BestMode = nullptr;
+
+	for(auto& Mode : Modes)
+	{
+		if(Mode.Width != Width || Mode.Height != Height)
+		{
+			continue;
+		}
+
+		if(!BestMode || (RefreshRate > 0 ? 
+			fabs(Mode.RefreshRate - RefreshRate) < fabs(BestMode->RefreshRate - RefreshRate) :
+			Mode.RefreshRate > BestMode->RefreshRate))
+		{
+			BestMode = &Mode;
+		}
+	}
+
+	if(!BestMode)
+	{
+		PrintErrorMessage(ERROR_INVALIDDISPLAYMODE);
+		return FOUNDATION_ERROR;
+	}
+
+#if defined(_WIN32) || defined(_WIN64)
+	if(!Windows_SetDisplayMode(*BestMode))
+#else
+	if(!Linux_SetDisplayMode(*BestMode))
+#endif
+	{
+		return FOUNDATION_ERROR;
+	}
+
+	DisplayModeChanged = GL_TRUE;
+	CurrentState = WINDOWSTATE_FULLSCREEN;
+
+#if defined(__linux__)
+	Linux_FullScreen(GL_TRUE);
+#endif
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::GetIsExclusiveFullScreen()
+ *
+ * @brief	Gets whether the window has switched the display mode.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	Whether the window is in exclusive full screen.
+ **************************************************************************************************/
+
+GLboolean FWindow::GetIsExclusiveFullScreen()
+{
+	return DisplayModeChanged;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::RestoreDisplayMode()
+ *
+ * @brief	Puts the display back to the mode it had before ExclusiveFullScreen, if it was changed.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void FWindow::RestoreDisplayMode()
+{
+	if(!DisplayModeChanged)
+	{
+		return;
+	}
+
+#if defined(_WIN32) || defined(_WIN64)
+	Windows_RestoreDisplayMode();
+#else
+	Linux_RestoreDisplayMode();
+#endif
+	DisplayModeChanged = GL_FALSE;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::GetIsMinimized()
+ *
+ * @brief	Gets whether the window is minimized.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @return	whether the window is currently minimized.
+ **************************************************************************************************/
+
+GLboolean FWindow::GetIsMinimized()
+{
+	return (CurrentState == WINDOWSTATE_MINIMIZED);
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::Minimize(GLboolean NewState)
+ *
+ * @brief	set the window to be minimized depending on NewState.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @param	NewState	whether the window should be minimized.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FWindow::Minimize(GLboolean NewState)
+{
+	if(Initialized)
+	{
+		if(NewState)
+		{
+			CurrentState = WINDOWSTATE_MINIMIZED;
+		}
+
+		else
+		{
+			CurrentState = WINDOWSTATE_NORMAL;
+		}
+
+#if defined(_WIN32) || defined(_WIN64)
+	 	Windows_Minimize();
+#else
+	 	Linux_Minimize(NewState);
+#endif
+
+	 	return FOUNDATION_OKAY;
+	}	
+
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::GetIsMaximized()
+ *
+ * @brief	Gets whether the window is maximized.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @return	whether the window is currently minimized.
+ **************************************************************************************************/
+
+GLboolean FWindow::GetIsMaximized()
+{
+	return (CurrentState == WINDOWSTATE_MAXIMIZED) ;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::Maximize(GLboolean NewState)
+ *
+ * @brief	Maximizes the window depending on New state.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @param	NewState	Whether to minimize the window.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FWindow::Maximize(GLboolean NewState)
+{
+	if(Initialized)
+	{
+		if(NewState)
+		{
+			CurrentState = WINDOWSTATE_MAXIMIZED;
+		}
+
+		else
+		{
+			CurrentState = WINDOWSTATE_NORMAL;
+		}
+
+#if defined(_WIN32) || defined(_WIN64)
+		 Windows_Maximize();
+#else
+	 	Linux_Maximize(NewState);
+#endif
+		 return FOUNDATION_OKAY;
+	}
+	PrintErrorMessage(ERROR_NOCONTEXT);	
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::Restore()
+ *
+ * @brief	Restores the window to its default setting.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FWindow::Restore()
+{
+	if (Initialized)
+	{
+		switch (CurrentState)
+		{
+		case WINDOWSTATE_MAXIMIZED:
+		{
+			Maximize(GL_FALSE);
+			break;
+		}
+
+		case WINDOWSTATE_FULLSCREEN:
+		{
+			FullScreen(GL_FALSE);
+			break;
+		}
+		}
+
+		CurrentState = WINDOWSTATE_NORMAL;
+#if defined(_WIN32) || defined(_WIN64)
+		Windows_Restore();
+#else
+		Linux_Restore();
+#endif
+
+		return FOUNDATION_OKAY;
+	}
+
+	PrintErrorMessage(ERROR_NOCONTEXT);
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::GetResolution(GLuint& Width, GLuint& Height)
+ *
+ * @brief	Gets the resolution of the window by setting width and height.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @param [in,out]	Width 	The width.
+ * @param [in,out]	Height	The height.
+ *
+ * @return	The resolution.
+ **************************************************************************************************/
+
+GLboolean FWindow::GetResolution(GLuint& Width, GLuint& Height)
+{
+	if (Initialized)
+	{
+		Width = Resolution[0];
+		Height = Resolution[1];
+		return FOUNDATION_OKAY;
+	}
+
+	PrintErrorMessage(ERROR_NOCONTEXT);
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLuint* FWindow::GetResolution()
+ *
+ * @brief	Gets the resolution of the window.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @return	null if it fails, else the resolution as an array. Resolution[0] always returns the
+ *  width and Resolution[1] always returns the Height.
+ **************************************************************************************************/
+
+GLuint* FWindow::GetResolution()
+{
+	return Resolution;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::SetResolution(GLuint Width, GLuint Height)
+ *
+ * @brief	Sets the resolution of the window.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @param	Width 	The new width of the window.
+ * @param	Height	The new height of the window.
+ **************************************************************************************************/
+
+GLboolean FWindow::SetResolution(GLuint Width, GLuint Height)
+{
+	if (Initialized)
+	{
+		if(Width > 0 && Height > 0)
+		{
+			Resolution[0] = Width;
+			Resolution[1] = Height;
+
+#if defined(_WIN32) || defined(_WIN64)
+			Windows_SetResolution(Resolution[0], Resolution[1]);
+#else
+			Linux_SetResolution(Width, Height);	
+#endif
+			if(ContextCreated)
+			{
+				glViewport(0, 0, Resolution[0], Resolution[1]);
+			}
+
+			ResetDamage();
+
+			return FOUNDATION_OKAY;
+		}
+
+		else
+		{
+			PrintErrorMessage(ERROR_INVALIDRESOLUTION);
+			return FOUNDATION_ERROR;
+		}
+	}  
+
+		PrintErrorMessage(ERROR_NOCONTEXT);
+		return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::GetMousePosition(GLuint& X, GLuint& Y)
+ *
+ * @brief	Gets mouse position relative to the window coordinates by setting X and Y.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @param [in,out]	X	The X position of the mouse.
+ * @param [in,out]	Y	The Y position of the mouse.
+ **************************************************************************************************/
+
+GLboolean FWindow::GetMousePosition(GLuint& X, GLuint& Y)
+{
+	if (Initialized)
+	{
+		X = MousePosition[0];
+		Y = MousePosition[1];   /**< . */
+		return FOUNDATION_OKAY;
+	}
+
+	PrintErrorMessage(ERROR_NOCONTEXT);
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLuint* FWindow::GetMousePosition()
+ *
+ * @brief	Gets mouse position relative to the window as an array.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @return	null if it fails, else the mouse position. MousePosition[0] always returns the X and
+ *  MousePosition[1] always returns the Y.
+ **************************************************************************************************/
+
+GLuint* FWindow::GetMousePosition()
+{
+	if (Initialized)
+	{
+		return MousePosition;
+	}
+
+	PrintErrorMessage(ERROR_NOCONTEXT);
+	return nullptr;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::SetMousePosition(GLuint X, GLuint Y)
+ *
+ * @brief	Sets mouse position.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @param	X	The new X position of the mouse relative to the window coordinates.
+ * @param	Y	The new Y position of the mouse relative to the window coordinates.
+ **************************************************************************************************/
+
+GLboolean FWindow::SetMousePosition(GLuint X, GLuint Y)
+{
+	if (Initialized)
+	{ 
+		MousePosition[0] = X;
+		MousePosition[1] = Y;
+#if defined(_WIN32) || defined(_WIN64)
+		Windows_SetMousePosition(X, Y);
+#else
+		Linux_SetMousePosition(X, Y);
+#endif
+		return FOUNDATION_OKAY;
+	}
+
+	PrintErrorMessage(ERROR_NOCONTEXT);
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::GetPosition(GLuint& X, GLuint& Y)
+ *
+ * @brief	Gets a position.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @param [in,out]	X	The X coordinate of the window position relative to screen coordinates.
+ * @param [in,out]	Y	The Y coordinates of the window position relative to screen coordinates.
+ **************************************************************************************************/
+
+GLboolean FWindow::GetPosition(GLuint& X, GLuint& Y)
+{
+	if (Initialized)
+	{
+		X = Position[0];
+		Y = Position[1];
+
+		return FOUNDATION_OKAY;
+	}
+
+	PrintErrorMessage(ERROR_NOCONTEXT);
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLuint* FWindow::GetPosition()
+ *
+ * @brief	Gets the position.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @return	null if it fails, else the position. Position[0] always returns the X coordinate of
+ *  the window relative to screen coordinates and Position[1] always returns the Y coordinates of
+ *  the window.
+ **************************************************************************************************/
+
+GLuint* FWindow::GetPosition()
+{
+	return Position;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::SetPosition(GLuint X, GLuint Y)
+ *
+ * @brief	Sets a position.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @param	X	The new X coordinate of the window position relative to screen coordinates.
+ * @param	Y	The new Y coordinate of the window position relative to screen coordinates.
+ **************************************************************************************************/
+
+GLboolean FWindow::SetPosition(GLuint X, GLuint Y)
+{
+	if (Initialized)
+	{
+		Position[0] = X;
+		Position[1] = Y;
+#if defined(_WIN32) || defined(_WIN64)
+		Windows_SetPosition(Position[0], Position[1]);
+#else
+		Linux_SetPosition(X, Y);
+#endif
+	}
+
+	PrintErrorMessage(ERROR_NOCONTEXT);
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	const char* FWindow::GetWindowName()
+ *
+ * @brief	Gets window name.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @return	null if it fails, else the window name.
+ **************************************************************************************************/
+
+const char* FWindow::GetWindowName()
+{
+	if (Initialized)
+	{
+		return Name;
+	}
+
+	PrintErrorMessage(ERROR_NOCONTEXT);
+	return nullptr;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::SetTitleBar(const char* NewTitle)
+ *
+ * @brief	Sets title bar.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @param	NewTitle	The new title bar of the window.
+ **************************************************************************************************/
+
+GLboolean FWindow::SetTitleBar(const char* NewTitle)
+{
+	if (Initialized)
+	{
+		if(NewTitle != nullptr)
+		{
+#if defined(_WIN32) || defined(_WIN64)
+			Windows_SetTitleBar(NewTitle);
+#else
+			Linux_SetTitleBar(NewTitle);
+#endif
+			return FOUNDATION_OKAY;
+		}
+
+		else
+		{
+			PrintErrorMessage(ERROR_INVALIDTITLEBAR);
+			return FOUNDATION_ERROR;
+		}
+	}
+
+	PrintErrorMessage(ERROR_NOCONTEXT);
+	return FOUNDATION_ERROR;
+}
+
+GLboolean FWindow::SetIcon(const char* Icon, GLuint Width, GLuint Height)
+{
+	if (Initialized)
+	{
+#if defined(_WIN32) || defined(_WIN64)
+		Windows_SetIcon(Icon, Width, Height);
+#else
+		Linux_SetIcon(Icon, Width, Height);
+#endif
+		return FOUNDATION_OKAY;
+	}
+	return FOUNDATION_ERROR;
+}
+
+GLboolean FWindow::SetStyle(GLuint WindowType)
+{
+	if (Initialized)
+	{
+#if defined(_WIN32) || defined(_WIN64)
+		Windows_SetStyle(WindowType);
+#else
+		Linux_SetStyle(WindowType);
+#endif
+		PrintErrorMessage(ERROR_NOCONTEXT);
+		return FOUNDATION_OKAY;
+	}
+
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::MakeCurrentContext()
+ *
+ * @brief	Makes the window be the current OpenGL context to be drawn to. the context that is
+ * 			current on each thread is cached so calling this every frame for a window that is
+ * 			already current costs nothing.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FWindow::MakeCurrentContext()
+{
+	//contexts that are created lazily or in the background get finished here
+	if(Initialized && !ContextCreated && ContextCreation != CONTEXTCREATION_SOFTWARE)
+	{
+		InitializeGL();
+	}
+
+	if(ContextCreated)
+	{
+		BindContext();
+
+		if(FrameStartTime == 0)
+		{
+			FrameStartTime = GetMonotonicTime();
+		}
+
+		BeginGPUTiming();
+		return FOUNDATION_OKAY;
+	}
+
+	PrintErrorMessage(ERROR_NOCONTEXT);
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::GetIsCurrentContext()
+ *
+ * @brief	Gets whether this window is the current context on the calling thread.
+ *
+ * @author	Ziyad
+ * @date	3/01/2015
+ *
+ * @return	The is current context.
+ **************************************************************************************************/
+
+GLboolean FWindow::GetIsCurrentContext()
+{
+	if(ContextCreated)
+	{
+#if defined(_WIN32) || defined(_WIN64)
+		return (CurrentDeviceContext == DeviceContextHandle &&
+			CurrentRenderingContext == GLRenderingContextHandle);
+#else
+		return (CurrentDisplay == WindowManager::GetDisplay() &&
+			CurrentDrawable == WindowHandle && CurrentContext == Context);
+#endif
+	}
+	PrintErrorMessage(ERROR_NOCONTEXT);
+	return GL_FALSE;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::BindContext()
+ *
+ * @brief	Makes the context of this window current on the calling thread. only calls into the
+ * 			driver (and counts a context switch) if it isn't current already.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void FWindow::BindContext()
+{
+	//the trampolines resolve into the table of whichever context is current
+	FGLFunctions::Current = GLFunctions;
+
+#if defined(_WIN32) || defined(_WIN64)
+	if(CurrentDeviceContext != DeviceContextHandle ||
+		CurrentRenderingContext != GLRenderingContextHandle)
+	{
+		wglMakeCurrent(DeviceContextHandle, GLRenderingContextHandle);
+		CurrentDeviceContext = DeviceContextHandle;
+		CurrentRenderingContext = GLRenderingContextHandle;
+		WindowManager::GetInstance()->ContextSwitches++;
+	}
+#else
+	if(CurrentDisplay != WindowManager::GetDisplay() ||
+		CurrentDrawable != WindowHandle || CurrentContext != Context)
+	{
+		glXMakeCurrent(WindowManager::GetDisplay(), WindowHandle, Context);
+		CurrentDisplay = WindowManager::GetDisplay();
+		CurrentDrawable = WindowHandle;
+		CurrentContext = Context;
+		WindowManager::GetInstance()->ContextSwitches++;
+	}
+#endif
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::UnbindContext()
+ *
+ * @brief	Releases the context of this window if it is current on the calling thread.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void FWindow::UnbindContext()
+{
+#if defined(_WIN32) || defined(_WIN64)
+	if(CurrentRenderingContext == GLRenderingContextHandle)
+	{
+		wglMakeCurrent(nullptr, nullptr);
+		CurrentDeviceContext = nullptr;
+		CurrentRenderingContext = nullptr;
+		FGLFunctions::Current = nullptr;
+	}
+#else
+	if(CurrentContext == Context || CurrentDrawable == WindowHandle)
+	{
+		glXMakeCurrent(WindowManager::GetDisplay(), None, nullptr);
+		CurrentDisplay = nullptr;
+		CurrentDrawable = None;
+		CurrentContext = nullptr;
+		FGLFunctions::Current = nullptr;
+	}
+#endif
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::GetContextHasBeenCreated()
+ *
+ * @brief	Gets context has been created.
+ *
+ * @author	Ziyad
+ * @date	3/01/2015
+ *
+ * @return	The context has been created.
+ **************************************************************************************************/
+
+GLboolean FWindow::GetContextHasBeenCreated()
+{
+	return ContextCreated;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::InitGLExtensions()
+ *
+ * @brief	Initializes the OpenGL extensions for this window.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ **************************************************************************************************/
+
+void FWindow::InitGLExtensions()
+{
+#if defined(_WIN32) || defined(_WIN64)
+	Windows_InitGLExtensions();
+#else
+	Linux_InitGLExtensions();
+#endif
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::PrintOpenGLVersion()
+ *
+ * @brief	Print open gl version.
+ *
+ * @author	Ziyad
+ * @date	3/01/2015
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FWindow::PrintOpenGLVersion()
+{
+	if(ContextCreated)
+	{
+		printf("%s\n", glGetString(GL_VERSION));
+		return FOUNDATION_OKAY;
+	}
+
+	PrintErrorMessage(ERROR_NOCONTEXT);
+	return FOUNDATION_ERROR;
+}
+
+const char* FWindow::GetOpenGLVersion()
+{
+	if(ContextCreated)
+	{
+		return (const char*)glGetString(GL_VERSION);
+	}
+	PrintErrorMessage(ERROR_NOCONTEXT);
+	return nullptr;
+}
+
+GLboolean FWindow::PrintOpenGLExtensions()
+{
+	if(ContextCreated)
+	{
+		printf("%s \n", Extensions->ExtensionString.c_str());
+		return FOUNDATION_OKAY;
+	}
+
+		PrintErrorMessage(ERROR_NOCONTEXT);
+		return FOUNDATION_ERROR;
 }
 
 /**********************************************************************************************//**
  * @fn	const char* FWindow::GetOpenGLExtensions()
  *
- * @brief	Gets open gl extensions.
+ * @brief	Gets open gl extensions.
+ *
+ * @author	Ziyad
+ * @date	3/01/2015
+ *
+ * @return	null if it fails, else the open gl extensions.
+ **************************************************************************************************/
+
+const char* FWindow::GetOpenGLExtensions()
+{
+	if(ContextCreated)
+	{
+		return Extensions->ExtensionString.c_str();
+	}
+
+	else
+	{
+		PrintErrorMessage(ERROR_NOCONTEXT);
+		return nullptr;
+	}
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::HasGLExtension(const char* Extension)
+ *
+ * @brief	Query whether the context of this window supports the given OpenGL extension. the
+ * 			extensions are parsed once per renderer so this is a single hash lookup.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Extension	The name of the extension.
+ *
+ * @return	whether the extension is supported.
+ **************************************************************************************************/
+
+GLboolean FWindow::HasGLExtension(const char* Extension)
+{
+	if(ContextCreated)
+	{
+		if(IsValidString(Extension))
+		{
+			return Extensions->Extensions.count(Extension) > 0;
+		}
+
+		return GL_FALSE;
+	}
+
+	PrintErrorMessage(ERROR_NOCONTEXT);
+	return GL_FALSE;
+}
+
+/**********************************************************************************************//**
+ * @fn	FGLFunctions* FWindow::GetGLFunctions()
+ *
+ * @brief	Gets the OpenGL function table of this window's renderer.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	null if there is no context, else the function table.
+ **************************************************************************************************/
+
+FGLFunctions* FWindow::GetGLFunctions()
+{
+	if(ContextCreated)
+	{
+		return GLFunctions;
+	}
+
+	PrintErrorMessage(ERROR_NOCONTEXT);
+	return nullptr;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::LoadGLFunctions()
+ *
+ * @brief	Looks up every function in the table in bulk instead of on first use. windows that
+ * 			share a renderer share the table so this only does the work once.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FWindow::LoadGLFunctions()
+{
+	if(ContextCreated)
+	{
+		BindContext();
+		GLFunctions->Load();
+		return FOUNDATION_OKAY;
+	}
+
+	PrintErrorMessage(ERROR_NOCONTEXT);
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::GetInFocus()
+ *
+ * @brief	Gets whether the window is in event focus.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @return	The in focus.
+ **************************************************************************************************/
+
+GLboolean FWindow::GetInFocus()
+{
+	return InFocus;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::Focus(GLboolean NewState)
+ *
+ * @brief	put the window into event focus.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @param	NewState	whether to put the window into event focus.
+ **************************************************************************************************/
+
+GLboolean FWindow::Focus(GLboolean ShouldBeInFocus)
+{
+	if (Initialized)
+	{
+		InFocus = ShouldBeInFocus;
+
+#if defined(_WIN32) || defined(_WIN64)
+		Windows_Focus();	
+#else
+		Linux_Focus(ShouldBeInFocus);
+#endif
+		return FOUNDATION_OKAY;
+	}
+
+	PrintErrorMessage(ERROR_NOCONTEXT);
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::SetOnKeyEvent(OnKeyEvent OnKey)
+ *
+ * @brief	Sets on key event.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @param	OnKey	The on key event.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FWindow::SetOnKeyEvent(OnKeyEvent OnKey)
+{
+	if (IsValidKeyEvent(OnKey))
+	{
+		KeyEvent = OnKey;
+		return FOUNDATION_OKAY;
+	}
+
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::SetOnMouseButtonEvent(OnMouseButtonEvent OnMouseButtonEvent)
+ *
+ * @brief	Sets on mouse button event.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @param	OnMouseButtonEvent	The on mouse button event.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FWindow::SetOnMouseButtonEvent(OnMouseButtonEvent OnMouseButtonEvent)
+{
+	//we don't really need to check if the context has been created
+	if(IsValidKeyEvent(OnMouseButtonEvent))
+	{
+		MouseButtonEvent = OnMouseButtonEvent;
+		return FOUNDATION_OKAY;
+	}
+
+	PrintErrorMessage(ERROR_INVALIDEVENT);
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::SetOnMouseWheelEvent(OnMouseWheelEvent OnMouseWheel)
+ *
+ * @brief	Sets on mouse wheel event.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @param	OnMouseWheel	The on mouse wheel event.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FWindow::SetOnMouseWheelEvent(OnMouseWheelEvent OnMouseWheel)
+{
+	if(IsValidMouseWheelEvent(OnMouseWheel))
+	{
+		MouseWheelEvent = OnMouseWheel;
+		return FOUNDATION_OKAY;
+	}
+
+	PrintErrorMessage(ERROR_INVALIDEVENT);
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::SetOnDestroyed(OnDestroyedEvent OnDestroyed)
+ *
+ * @brief	Sets on destroyed.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @param	OnDestroyed	The on destroyed event.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FWindow::SetOnDestroyed(OnDestroyedEvent OnDestroyed)
+{
+	if(IsValidDestroyedEvent(OnDestroyed))
+	{
+		DestroyedEvent = OnDestroyed;
+		return FOUNDATION_OKAY;
+	}
+
+	PrintErrorMessage(ERROR_INVALIDEVENT);
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::SetOnMaximized(OnMaximizedEvent OnMaximized)
+ *
+ * @brief	Sets on maximized.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @param	OnMaximized	The on maximized event.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FWindow::SetOnMaximized(OnMaximizedEvent OnMaximized)
+{
+	if(IsValidDestroyedEvent(OnMaximized))
+	{
+		MaximizedEvent = OnMaximized;
+		return FOUNDATION_OKAY;
+	}
+	PrintErrorMessage(ERROR_INVALIDEVENT);
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::SetOnMinimized(OnMinimizedEvent OnMinimized)
+ *
+ * @brief	Sets on minimized.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @param	OnMinimized	The on minimized event.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FWindow::SetOnMinimized(OnMinimizedEvent OnMinimized)
+{
+	if(IsValidDestroyedEvent(OnMinimized))
+	{
+		MinimizedEvent = OnMinimized;
+		return FOUNDATION_OKAY;
+	}
+
+	PrintErrorMessage(ERROR_INVALIDEVENT);
+	return FOUNDATION_ERROR;
+}
+
+/*void FWindow::SetOnRestored(OnRestoredEvent OnRestored)
+{
+	if (IsValid(OnRestored))
+	{
+		RestoredEvent = OnRestored;
+	}
+}*/
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::SetOnFocus(OnFocusEvent OnFocus)
+ *
+ * @brief	Sets on focus.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @param	OnFocus	The on focus event.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FWindow::SetOnFocus(OnFocusEvent OnFocus)
+{
+	if(IsValidFocusEvent(OnFocus))
+	{
+		FocusEvent = OnFocus;
+		return FOUNDATION_OKAY;
+	}
+
+	PrintErrorMessage(ERROR_INVALIDEVENT);
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::SetOnMoved(OnMovedEvent OnMoved)
+ *
+ * @brief	Sets on moved.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @param	OnMoved	The on moved event.
+ **************************************************************************************************/
+
+GLboolean FWindow::SetOnMoved(OnMovedEvent OnMoved)
+{
+	if(IsValidMovedEvent(OnMoved))
+	{
+		MovedEvent = OnMoved;
+		return FOUNDATION_OKAY;
+	}
+	PrintErrorMessage(ERROR_INVALIDEVENT);
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::SetOnResize(OnResizeEvent OnResize)
+ *
+ * @brief	Sets on resize.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @param	OnResize	The on resize event.
+ **************************************************************************************************/
+
+GLboolean FWindow::SetOnResize(OnResizeEvent OnResize)
+{
+	if(IsValidMovedEvent(OnResize))
+	{
+		ResizeEvent = OnResize;
+		return FOUNDATION_OKAY;
+	}
+
+	PrintErrorMessage(ERROR_INVALIDEVENT);
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::SetOnMouseMove(OnMouseMoveEvent OnMouseMove)
+ *
+ * @brief	Sets on mouse move.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @param	OnMouseMove	The on mouse move event.
+ **************************************************************************************************/
+
+GLboolean FWindow::SetOnMouseMove(OnMouseMoveEvent OnMouseMove)
+{
+	if(IsValidMouseMoveEvent(OnMouseMove))
+	{
+		MouseMoveEvent = OnMouseMove;
+		return FOUNDATION_OKAY;
+	}
+
+	PrintErrorMessage(ERROR_INVALIDEVENT);
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::SetOnLateLatch(OnLateLatchEvent OnLateLatch)
+ *
+ * @brief	Sets the callback that runs right before this window swaps. the key states and 
+ * 			mouse position are read straight from the platform first so they are as fresh as 
+ * 			they can be, and the context is made current so the callback can update buffers.
+ * 			no events are dispatched, so no other callback can run in the middle of the swap.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	OnLateLatch	The on late latch event.
+ **************************************************************************************************/
+
+GLboolean FWindow::SetOnLateLatch(OnLateLatchEvent OnLateLatch)
+{
+	if(IsValidLateLatchEvent(OnLateLatch))
+	{
+		LateLatchEvent = OnLateLatch;
+		return FOUNDATION_OKAY;
+	}
+
+	PrintErrorMessage(ERROR_INVALIDEVENT);
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::AddSwapHook(GLuint Stage, OnSwapEvent Hook, void* UserData, GLint Priority)
+ *
+ * @brief	Adds a function to run at every swap of this window, so capture, overlays, timing
+ * 			and fences can hook the swap without wrapping SwapDrawBuffers. pre hooks run once the
+ * 			frame is fully drawn(after dynamic resolution upscales it) and before it is captured,
+ * 			so whatever they draw is captured and presented too. the hooks live in a fixed array 
+ * 			so nothing is allocated, and a window without hooks only pays for two comparisons.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Stage		SWAPHOOK_PRE or SWAPHOOK_POST.
+ * @param	Hook		The function to call.
+ * @param	UserData	Handed to the function every time it is called.
+ * @param	Priority	Where the hook goes in the chain. lower priorities run first.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FWindow::AddSwapHook(GLuint Stage, OnSwapEvent Hook, void* UserData, GLint Priority)
+{
+	if(Stage <= SWAPHOOK_POST && SwapHooks[Stage].Add(Hook, UserData, Priority))
+	{
+		return FOUNDATION_OKAY;
+	}
+
+	PrintErrorMessage(ERROR_SWAPHOOK);
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::RemoveSwapHook(GLuint Stage, OnSwapEvent Hook, void* UserData)
+ *
+ * @brief	Removes a swap hook that was added with the same function and user data.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Stage		SWAPHOOK_PRE or SWAPHOOK_POST.
+ * @param	Hook		The function that was added.
+ * @param	UserData	The user data it was added with.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FWindow::RemoveSwapHook(GLuint Stage, OnSwapEvent Hook, void* UserData)
+{
+	if(Stage <= SWAPHOOK_POST && SwapHooks[Stage].Remove(Hook, UserData))
+	{
+		return FOUNDATION_OKAY;
+	}
+
+	PrintErrorMessage(ERROR_SWAPHOOK);
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::RunSwapHooks(GLuint Stage, GLdouble SwapStart, GLdouble SwapEnd)
+ *
+ * @brief	Runs the swap hooks of a stage. the global hooks wrap the window's own, i.e. they 
+ * 			run first before the swap and last after it.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Stage	 	SWAPHOOK_PRE or SWAPHOOK_POST.
+ * @param	SwapStart	When the platform swap started. 0 before it.
+ * @param	SwapEnd  	When the platform swap returned. 0 before it.
+ **************************************************************************************************/
+
+void FWindow::RunSwapHooks(GLuint Stage, GLdouble SwapStart, GLdouble SwapEnd)
+{
+	FSwapHookList& GlobalHooks = WindowManager::GetInstance()->SwapHooks[Stage];
+
+	if(SwapHooks[Stage].Count == 0 && GlobalHooks.Count == 0)
+	{
+		return;
+	}
+
+	FSwapInfo Info;
+	Info.Stage = Stage;
+	Info.Frame = SwapCount;
+	Info.FrameStartTime = LastSwapTime;
+	Info.PacerWaitTime = PacerWaitTime;
+	Info.SwapStartTime = SwapStart;
+	Info.SwapEndTime = SwapEnd;
+
+	if(ContextCreation != CONTEXTCREATION_SOFTWARE)
+	{
+		BindContext();
+	}
+
+	if(Stage == SWAPHOOK_PRE)
+	{
+		GlobalHooks.Run(this, Info);
+		SwapHooks[Stage].Run(this, Info);
+	}
+
+	else
+	{
+		SwapHooks[Stage].Run(this, Info);
+		GlobalHooks.Run(this, Info);
+	}
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::RouteVirtualKey(GLuint Key, GLboolean KeyState)
+ *
+ * @brief	Hands a key event to the virtual window in focus, if there is one.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Key			The key.
+ * @param	KeyState	KEYSTATE_DOWN or KEYSTATE_UP.
+ *
+ * @return	Whether a virtual window took the event.
+ **************************************************************************************************/
+
+GLboolean FWindow::RouteVirtualKey(GLuint Key, GLboolean KeyState)
+{
+	FVirtualWindow* Panel = FocusedVirtualWindow;
+
+	if(!Panel)
+	{
+		return GL_FALSE;
+	}
+
+	Panel->Keys[Key] = KeyState;
+
+	if(IsValidKeyEvent(Panel->KeyEvent))
+	{
+		Panel->KeyEvent(Key, KeyState);
+	}
+
+	return GL_TRUE;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::RouteVirtualMouseButton(GLuint Button, GLboolean ButtonState)
+ *
+ * @brief	Hands a mouse button event to the virtual window under the mouse. pressing a button
+ * 			on a virtual window focuses it and sends it the mouse until the button is released,
+ * 			and pressing one anywhere else gives focus back to this window.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Button	   	The mouse button.
+ * @param	ButtonState	MOUSE_BUTTONDOWN or MOUSE_BUTTONUP.
+ *
+ * @return	Whether a virtual window took the event.
+ **************************************************************************************************/
+
+GLboolean FWindow::RouteVirtualMouseButton(GLuint Button, GLboolean ButtonState)
+{
+	if(VirtualWindows.empty())
+	{
+		return GL_FALSE;
+	}
+
+	FVirtualWindow* Panel = PointerVirtualWindow ? PointerVirtualWindow : GetVirtualWindowAt(MousePosition[0], MousePosition[1]);
+
+	if(ButtonState == MOUSE_BUTTONDOWN)
+	{
+		if(Panel)
+		{
+			Panel->Focus(GL_TRUE);
+		}
+
+		else if(FocusedVirtualWindow)
+		{
+			FocusedVirtualWindow->Focus(GL_FALSE);
+		}
+
+		PointerVirtualWindow = Panel;
+	}
+
+	else
+	{
+		PointerVirtualWindow = nullptr;
+	}
+
+	if(!Panel)
+	{
+		return GL_FALSE;
+	}
+
+	Panel->MouseButton[Button] = ButtonState;
+
+	if(IsValidKeyEvent(Panel->MouseButtonEvent))
+	{
+		Panel->MouseButtonEvent(Button, ButtonState);
+	}
+
+	return GL_TRUE;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::RouteVirtualMouseWheel(GLuint WheelDirection)
+ *
+ * @brief	Hands a mouse wheel event to the virtual window under the mouse.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	WheelDirection	MOUSE_SCROLL_UP or MOUSE_SCROLL_DOWN.
+ *
+ * @return	Whether a virtual window took the event.
+ **************************************************************************************************/
+
+GLboolean FWindow::RouteVirtualMouseWheel(GLuint WheelDirection)
+{
+	FVirtualWindow* Panel = VirtualWindows.empty() ? nullptr : GetVirtualWindowAt(MousePosition[0], MousePosition[1]);
+
+	if(!Panel)
+	{
+		return GL_FALSE;
+	}
+
+	if(IsValidMouseWheelEvent(Panel->MouseWheelEvent))
+	{
+		Panel->MouseWheelEvent(WheelDirection);
+	}
+
+	return GL_TRUE;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::RouteVirtualMouseMove(GLuint WindowX, GLuint WindowY, GLuint ScreenX, 
+ * 		GLuint ScreenY)
+ *
+ * @brief	Hands a mouse move to the virtual window holding the mouse or under it, with the
+ * 			position made relative to the virtual window. positions left of or above a virtual
+ * 			window holding the mouse are clamped to its edge.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	WindowX	The horizontal position of the mouse in this window.
+ * @param	WindowY	The vertical position of the mouse in this window.
+ * @param	ScreenX	The horizontal position of the mouse on the screen.
+ * @param	ScreenY	The vertical position of the mouse on the screen.
+ *
+ * @return	Whether a virtual window took the event.
+ **************************************************************************************************/
+
+GLboolean FWindow::RouteVirtualMouseMove(GLuint WindowX, GLuint WindowY, GLuint ScreenX, GLuint ScreenY)
+{
+	if(VirtualWindows.empty())
+	{
+		return GL_FALSE;
+	}
+
+	FVirtualWindow* Panel = PointerVirtualWindow ? PointerVirtualWindow : GetVirtualWindowAt(WindowX, WindowY);
+
+	if(!Panel)
+	{
+		return GL_FALSE;
+	}
+
+	Panel->MousePosition[0] = (WindowX > Panel->Position[0]) ? WindowX - Panel->Position[0] : 0;
+	Panel->MousePosition[1] = (WindowY > Panel->Position[1]) ? WindowY - Panel->Position[1] : 0;
+
+	if(IsValidMouseMoveEvent(Panel->MouseMoveEvent))
+	{
+		Panel->MouseMoveEvent(Panel->MousePosition[0], Panel->MousePosition[1], ScreenX, ScreenY);
+	}
+
+	return GL_TRUE;
+}
+
+/**********************************************************************************************//**
+ * @fn	FVirtualWindow* FWindow::GetVirtualWindowAt(GLint X, GLint Y)
+ *
+ * @brief	Gets the topmost visible virtual window at a point.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	X	The horizontal position in this window.
+ * @param	Y	The vertical position in this window.
+ *
+ * @return	null if there is no virtual window there, else the virtual window.
+ **************************************************************************************************/
+
+FVirtualWindow* FWindow::GetVirtualWindowAt(GLint X, GLint Y)
+{
+	for(GLuint Iterator = VirtualWindows.size(); Iterator > 0; Iterator--)
+	{
+		FVirtualWindow* Panel = VirtualWindows[Iterator - 1];
+
+		if(!Panel->Minimized && Panel->Contains(X, Y))
+		{
+			return Panel;
+		}
+	}
+
+	return nullptr;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::CompositeVirtualWindows()
+ *
+ * @brief	Copies every visible virtual window that has been drawn into the back buffer at its
+ * 			position, bottom first, with one blit each. panels keep their framebuffers between 
+ * 			frames so ones that didn't change don't have to be redrawn. the scissor test is off
+ * 			for the blits and put back afterwards. every panel shown is added to the frame's 
+ * 			damage so partial presents include it.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void FWindow::CompositeVirtualWindows()
+{
+	BindContext();
+	GLFunctions->glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+
+	//blits are clipped by the scissor box the application may have left on
+	GLboolean ScissorEnabled = glIsEnabled(GL_SCISSOR_TEST);
+	glDisable(GL_SCISSOR_TEST);
+
+	for(GLuint Iterator = 0; Iterator < VirtualWindows.size(); Iterator++)
+	{
+		FVirtualWindow* Panel = VirtualWindows[Iterator];
+		FDamageRect Area;
+
+		if(!Panel->Minimized && Panel->Drawn)
+		{
+			Area = FDamageRect(Panel->Position[0], Panel->Position[1], Panel->FramebufferSize[0], Panel->FramebufferSize[1]);
+		}
+
+		//the damage rectangles were given before the panels were drawn over them, so a partial
+		//present has to include each panel, and where it was last frame if it moved or was hidden
+		AddDamage(Area);
+
+		if(Area.X != Panel->CompositedArea.X || Area.Y != Panel->CompositedArea.Y ||
+			Area.Width != Panel->CompositedArea.Width || Area.Height != Panel->CompositedArea.Height)
+		{
+			AddDamage(Panel->CompositedArea);
+		}
+
+		Panel->CompositedArea = Area;
+
+		if(Area.IsEmpty())
+		{
+			continue;
+		}
+
+		//OpenGL puts the origin at the bottom left
+		GLint Left = Panel->Position[0];
+		GLint Bottom = (GLint)Resolution[1] - (GLint)(Panel->Position[1] + Panel->FramebufferSize[1]);
+
+		GLFunctions->glBindFramebuffer(GL_READ_FRAMEBUFFER, Panel->Framebuffer);
+		GLFunctions->glBlitFramebuffer(0, 0, Panel->FramebufferSize[0], Panel->FramebufferSize[1],
+			Left, Bottom, Left + Panel->FramebufferSize[0], Bottom + Panel->FramebufferSize[1], GL_COLOR_BUFFER_BIT, GL_NEAREST);
+	}
+
+	if(ScissorEnabled)
+	{
+		glEnable(GL_SCISSOR_TEST);
+	}
+
+	GLFunctions->glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::SetMirrorSource(FWindow* Source, GLboolean KeepAspectRatio)
+ *
+ * @brief	Makes this window show the last frame of another window instead of drawing, e.g. to
+ * 			show a scene on a control monitor and a wall display while rendering it once. the 
+ * 			source copies its back buffer into one of two textures in turn right before it 
+ * 			swaps, and this window blits the newest one into its back buffer with linear 
+ * 			filtering when it swaps. both directions are fenced on the GPU without the CPU 
+ * 			stalling: the mirror waits for the copy, and the source waits for the mirror's
+ * 			last read of a texture before copying into it again. anything drawn into the 
+ * 			mirror before its swap is covered.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param [in,out]	Source	The window to mirror. null to stop mirroring.
+ * @param	KeepAspectRatio   	Whether to keep the source's aspect ratio, with black bars 
+ * 							around the frame, rather than stretching it to fill this window.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FWindow::SetMirrorSource(FWindow* Source, GLboolean KeepAspectRatio)
+{
+	if(MirrorSource)
+	{
+		FWindow* OldSource = MirrorSource;
+		OldSource->MirrorWindows.erase(std::remove(OldSource->MirrorWindows.begin(), OldSource->MirrorWindows.end(), this),
+			OldSource->MirrorWindows.end());
+
+		//the texture is only copied while someone is looking at it
+		if(OldSource->MirrorWindows.empty() && OldSource->ContextCreated)
+		{
+			OldSource->BindContext();
+			OldSource->DestroyMirrorTexture();
+		}
+
+		if(ContextCreated)
+		{
+			BindContext();
+
+			if(MirrorReadFramebuffer)
+			{
+				GLFunctions->glDeleteFramebuffers(1, &MirrorReadFramebuffer);
+			}
+
+			if(MirrorReadFence)
+			{
+				GLFunctions->glDeleteSync(MirrorReadFence);
+			}
+		}
+
+		MirrorReadFramebuffer = 0;
+		MirrorReadFence = nullptr;
+		MirrorSource = nullptr;
+	}
+
+	if(!Source)
+	{
+		return FOUNDATION_OKAY;
+	}
+
+	if(!ContextCreated || !Source->ContextCreated)
+	{
+		PrintErrorMessage(ERROR_NOCONTEXT);
+		return FOUNDATION_ERROR;
+	}
+
+	BindContext();
+	GLint MajorVersion = 0;
+	glGetIntegerv(GL_MAJOR_VERSION, &MajorVersion);
+
+	if(Source == this || GetShareRoot() != Source->GetShareRoot() ||
+		(MajorVersion < 3 && !HasGLExtension("GL_ARB_framebuffer_object")))
+	{
+		PrintErrorMessage(ERROR_MIRROR);
+		return FOUNDATION_ERROR;
+	}
+
+	MirrorSource = Source;
+	MirrorKeepAspect = KeepAspectRatio;
+	Source->MirrorWindows.push_back(this);
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	FWindow* FWindow::GetMirrorSource()
+ *
+ * @brief	Gets the window this window mirrors.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	null if this window isn't a mirror, else the mirrored window.
+ **************************************************************************************************/
+
+FWindow* FWindow::GetMirrorSource()
+{
+	return MirrorSource;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::UpdateMirrorTexture()
+ *
+ * @brief	Copies the back buffer into the mirror texture after the newest one with a single 
+ * 			blit, remaking the textures if the window was resized, then fences the copy for the
+ * 			mirrors to wait on. the GPU first waits for any mirror still reading that texture
+ * 			from an earlier frame. the application's scissor box is ignored for the copy.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void FWindow::UpdateMirrorTexture()
+{
+	BindContext();
+
+	if(!MirrorFramebuffers[0] || MirrorSize[0] != Resolution[0] || MirrorSize[1] != Resolution[1])
+	{
+		DestroyMirrorTexture();
+
+		glGenTextures(MIRROR_BUFFERS, MirrorTextures);
+		GLFunctions->glGenFramebuffers(MIRROR_BUFFERS, MirrorFramebuffers);
+
+		for(GLuint Iter = 0; Iter < MIRROR_BUFFERS; Iter++)
+		{
+			glBindTexture(GL_TEXTURE_2D, MirrorTextures[Iter]);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, Resolution[0], Resolution[1], 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+			glBindTexture(GL_TEXTURE_2D, 0);
+
+			GLFunctions->glBindFramebuffer(GL_FRAMEBUFFER, MirrorFramebuffers[Iter]);
+			GLFunctions->glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, MirrorTextures[Iter], 0);
+
+			if(GLFunctions->glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+			{
+				PrintErrorMessage(ERROR_NOFRAMEBUFFEROBJECT);
+				GLFunctions->glBindFramebuffer(GL_FRAMEBUFFER, 0);
+				DestroyMirrorTexture();
+				return;
+			}
+		}
+
+		GLFunctions->glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		MirrorSize[0] = Resolution[0];
+		MirrorSize[1] = Resolution[1];
+		//so the first copy goes into the first texture
+		MirrorHead = MIRROR_BUFFERS - 1;
+	}
+
+	GLuint Slot = (MirrorHead + 1) % MIRROR_BUFFERS;
+
+	//a mirror that hasn't swapped since it last read this texture may still be reading it
+	for(FWindow* Mirror : MirrorWindows)
+	{
+		if(Mirror->MirrorReadFence && Mirror->MirrorReadSlot == Slot)
+		{
+			GLFunctions->glWaitSync(Mirror->MirrorReadFence, 0, GL_TIMEOUT_IGNORED);
+		}
+	}
+
+	GLboolean ScissorEnabled = glIsEnabled(GL_SCISSOR_TEST);
+	glDisable(GL_SCISSOR_TEST);
+
+	GLFunctions->glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+	GLFunctions->glBindFramebuffer(GL_DRAW_FRAMEBUFFER, MirrorFramebuffers[Slot]);
+	GLFunctions->glBlitFramebuffer(0, 0, MirrorSize[0], MirrorSize[1], 0, 0, MirrorSize[0], MirrorSize[1], 
+		GL_COLOR_BUFFER_BIT, GL_NEAREST);
+	GLFunctions->glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+	if(ScissorEnabled)
+	{
+		glEnable(GL_SCISSOR_TEST);
+	}
+
+	//the swap right after this flushes the fence so other contexts can wait on it
+	if(MirrorFences[Slot])
+	{
+		GLFunctions->glDeleteSync(MirrorFences[Slot]);
+		MirrorFences[Slot] = nullptr;
+	}
+
+	if(HasGLExtension("GL_ARB_sync"))
+	{
+		MirrorFences[Slot] = GLFunctions->glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	}
+
+	MirrorHead = Slot;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::DestroyMirrorTexture()
+ *
+ * @brief	Deletes the mirror textures, their framebuffers and fences. the context has to be 
+ * 			current.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void FWindow::DestroyMirrorTexture()
+{
+	if(MirrorFramebuffers[0])
+	{
+		GLFunctions->glDeleteFramebuffers(MIRROR_BUFFERS, MirrorFramebuffers);
+		glDeleteTextures(MIRROR_BUFFERS, MirrorTextures);
+	}
+
+	for(GLuint Iter = 0; Iter < MIRROR_BUFFERS; Iter++)
+	{
+		if(MirrorFences[Iter])
+		{
+			GLFunctions->glDeleteSync(MirrorFences[Iter]);
+		}
+
+		MirrorFramebuffers[Iter] = 0;
+		MirrorTextures[Iter] = 0;
+		MirrorFences[Iter] = nullptr;
+	}
+
+	MirrorHead = 0;
+	MirrorSize[0] = MirrorSize[1] = 0;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::DrawMirror()
+ *
+ * @brief	Blits the mirror source's newest frame into the back buffer, scaled to fit, then
+ * 			fences the read so the source doesn't copy over that texture before it is done. 
+ * 			the texture is attached again every frame since changes made by another context 
+ * 			only have to show up once the object is bound again. the scissor test and colour
+ * 			mask are turned off for the bars and the blit and put back afterwards. nothing is
+ * 			drawn until the source has presented a frame.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void FWindow::DrawMirror()
+{
+	FWindow* Source = MirrorSource;
+	GLuint Slot = Source->MirrorHead;
+
+	if(!Source->MirrorTextures[Slot])
+	{
+		return;
+	}
+
+	BindContext();
+
+	if(!MirrorReadFramebuffer)
+	{
+		GLFunctions->glGenFramebuffers(1, &MirrorReadFramebuffer);
+	}
+
+	if(Source->MirrorFences[Slot])
+	{
+		GLFunctions->glWaitSync(Source->MirrorFences[Slot], 0, GL_TIMEOUT_IGNORED);
+	}
+
+	GLuint Width = Resolution[0];
+	GLuint Height = Resolution[1];
+
+	if(MirrorKeepAspect)
+	{
+		if((GLuint64)Source->MirrorSize[0] * Resolution[1] > (GLuint64)Resolution[0] * Source->MirrorSize[1])
+		{
+			Height = (GLuint)(((GLuint64)Resolution[0] * Source->MirrorSize[1]) / Source->MirrorSize[0]);
+		}
+
+		else
+		{
+			Width = (GLuint)(((GLuint64)Resolution[1] * Source->MirrorSize[0]) / Source->MirrorSize[1]);
+		}
+	}
+
+	GLint Left = (Resolution[0] - Width) / 2;
+	GLint Bottom = (Resolution[1] - Height) / 2;
+
+	//the application's state would otherwise crop or mask the frame
+	GLboolean ScissorEnabled = glIsEnabled(GL_SCISSOR_TEST);
+	GLboolean ColourMask[4];
+	glGetBooleanv(GL_COLOR_WRITEMASK, ColourMask);
+	glDisable(GL_SCISSOR_TEST);
+	glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+
+	GLFunctions->glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+
+	if(Width != Resolution[0] || Height != Resolution[1])
+	{
+		GLfloat ClearColour[4];
+		glGetFloatv(GL_COLOR_CLEAR_VALUE, ClearColour);
+		glClearColor(0, 0, 0, 1);
+		glClear(GL_COLOR_BUFFER_BIT);
+		glClearColor(ClearColour[0], ClearColour[1], ClearColour[2], ClearColour[3]);
+	}
+
+	GLFunctions->glBindFramebuffer(GL_READ_FRAMEBUFFER, MirrorReadFramebuffer);
+	GLFunctions->glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, Source->MirrorTextures[Slot], 0);
+	GLFunctions->glBlitFramebuffer(0, 0, Source->MirrorSize[0], Source->MirrorSize[1],
+		Left, Bottom, Left + Width, Bottom + Height, GL_COLOR_BUFFER_BIT, GL_LINEAR);
+	GLFunctions->glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+	glColorMask(ColourMask[0], ColourMask[1], ColourMask[2], ColourMask[3]);
+
+	if(ScissorEnabled)
+	{
+		glEnable(GL_SCISSOR_TEST);
+	}
+
+	if(MirrorReadFence)
+	{
+		GLFunctions->glDeleteSync(MirrorReadFence);
+		MirrorReadFence = nullptr;
+	}
+
+	if(HasGLExtension("GL_ARB_sync"))
+	{
+		MirrorReadFence = GLFunctions->glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		MirrorReadSlot = Slot;
+		//the source may wait on the fence before this window swaps
+		glFlush();
+	}
+}
+
+/**********************************************************************************************//**
+ * @fn	FWindow* FWindow::GetShareRoot()
+ *
+ * @brief	Gets the first window of the chain of windows this window shares its context with.
+ * 			two windows with the same root can use each other's textures.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	The root window. this window if it doesn't share.
+ **************************************************************************************************/
+
+FWindow* FWindow::GetShareRoot()
+{
+	FWindow* Root = this;
+
+	while(Root->ShareWindow && Root->ShareMode != CONTEXTSHARE_NONE)
+	{
+		Root = Root->ShareWindow;
+	}
+
+	return Root;
+}
+
+/**********************************************************************************************//**
+ * @fn	FFrameTimings FWindow::GetFrameTimings()
+ *
+ * @brief	Gets what the compositor last reported about a presented frame through the 
+ * 			_NET_WM_FRAME_DRAWN and _NET_WM_FRAME_TIMINGS messages. always empty on Windows.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	The frame timings.
+ **************************************************************************************************/
+
+FFrameTimings FWindow::GetFrameTimings()
+{
+	return FrameTimings;
+}
+
+/**********************************************************************************************//**
+ * @fn	FFrameStatistics FWindow::GetPresentLatencyStatistics()
+ *
+ * @brief	Gets statistics on the time between SwapDrawBuffers returning and the frame reaching
+ * 			the screen, as reported by the compositor.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	The present latency statistics.
+ **************************************************************************************************/
+
+FFrameStatistics FWindow::GetPresentLatencyStatistics()
+{
+	return PresentLatencies.GetStatistics();
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::EnableDynamicResolution(GLdouble TargetFrameTime, GLdouble MinScale, 
+ * 		GLdouble MaxScale)
+ *
+ * @brief	Starts rendering into an offscreen target whose resolution is adjusted from recent 
+ * 			render times, turning GPU timing on to measure them if it isn't already. the target is allocated at MaxScale of the window's size and only the 
+ * 			bottom left part of it is used, so changing the scale never reallocates. it is 
+ * 			bound along with a matching viewport after every swap and upscaled to the window
+ * 			right before the next one.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	TargetFrameTime	The frame time to aim for, in seconds. 0 for the pacer's target or 60 fps.
+ * @param	MinScale	   	The lowest fraction of the window's resolution to render at.
+ * @param	MaxScale	   	The highest fraction of the window's resolution to render at.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FWindow::EnableDynamicResolution(GLdouble TargetFrameTime, GLdouble MinScale, GLdouble MaxScale)
+{
+	if(!ContextCreated)
+	{
+		PrintErrorMessage(ERROR_NOCONTEXT);
+		return FOUNDATION_ERROR;
+	}
+
+	if(MinScale <= 0 || MaxScale <= 0 || MinScale > MaxScale || TargetFrameTime < 0)
+	{
+		PrintErrorMessage(ERROR_INVALIDRENDERSCALE);
+		return FOUNDATION_ERROR;
+	}
+
+	BindContext();
+	GLint MajorVersion = 0;
+	glGetIntegerv(GL_MAJOR_VERSION, &MajorVersion);
+
+	if(MajorVersion < 3 && !HasGLExtension("GL_ARB_framebuffer_object"))
+	{
+		PrintErrorMessage(ERROR_NOFRAMEBUFFEROBJECT);
+		return FOUNDATION_ERROR;
+	}
+
+	if(DynamicResolutionEnabled)
+	{
+		DisableDynamicResolution();
+	}
+
+	TargetRenderTime = TargetFrameTime;
+	MinRenderScale = MinScale;
+	MaxRenderScale = MaxScale;
+	RenderScale = MaxScale;
+	SmoothedRenderTime = 0;
+	DynamicResolutionEnabled = GL_TRUE;
+
+	//the scale follows the GPU's render time whenever it can be measured
+	if(!GPUTimingEnabled && HasGLExtension("GL_ARB_timer_query"))
+	{
+		DynamicResolutionTiming = EnableGPUTiming();
+	}
+
+	BeginRenderTarget();
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::DisableDynamicResolution()
+ *
+ * @brief	Goes back to rendering straight into the window and deletes the render target.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FWindow::DisableDynamicResolution()
+{
+	if(!DynamicResolutionEnabled)
+	{
+		return FOUNDATION_OKAY;
+	}
+
+	BindContext();
+	DestroyRenderTarget();
+	GLFunctions->glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	glViewport(0, 0, Resolution[0], Resolution[1]);
+	DynamicResolutionEnabled = GL_FALSE;
+	RenderScale = 1.0;
+
+	if(DynamicResolutionTiming)
+	{
+		DisableGPUTiming();
+	}
+
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::GetRenderResolution(GLuint& Width, GLuint& Height)
+ *
+ * @brief	Gets the resolution frames are currently rendered at. the window's resolution when
+ * 			dynamic resolution is off.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param [in,out]	Width 	The width.
+ * @param [in,out]	Height	The height.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FWindow::GetRenderResolution(GLuint& Width, GLuint& Height)
+{
+	Width = DynamicResolutionEnabled ? RenderResolution[0] : Resolution[0];
+	Height = DynamicResolutionEnabled ? RenderResolution[1] : Resolution[1];
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLdouble FWindow::GetRenderScale()
+ *
+ * @brief	Gets the render resolution as a fraction of the window's resolution.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	The render scale. 1 when dynamic resolution is off.
+ **************************************************************************************************/
+
+GLdouble FWindow::GetRenderScale()
+{
+	return RenderScale;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::BeginRenderTarget()
+ *
+ * @brief	Reallocates the render target if the window was resized, then binds it with a 
+ * 			viewport covering the current render resolution.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void FWindow::BeginRenderTarget()
+{
+	GLuint Width = (GLuint)(Resolution[0] * MaxRenderScale);
+	GLuint Height = (GLuint)(Resolution[1] * MaxRenderScale);
+	Width = (Width > 0) ? Width : 1;
+	Height = (Height > 0) ? Height : 1;
+
+	BindContext();
+
+	if(!RenderFramebuffer || RenderTargetSize[0] != Width || RenderTargetSize[1] != Height)
+	{
+		DestroyRenderTarget();
+
+		glGenTextures(1, &RenderColour);
+		glBindTexture(GL_TEXTURE_2D, RenderColour);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, Width, Height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+		glBindTexture(GL_TEXTURE_2D, 0);
+
+		GLFunctions->glGenRenderbuffers(1, &RenderDepthStencil);
+		GLFunctions->glBindRenderbuffer(GL_RENDERBUFFER, RenderDepthStencil);
+		GLFunctions->glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, Width, Height);
+		GLFunctions->glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+		GLFunctions->glGenFramebuffers(1, &RenderFramebuffer);
+		GLFunctions->glBindFramebuffer(GL_FRAMEBUFFER, RenderFramebuffer);
+		GLFunctions->glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, RenderColour, 0);
+		GLFunctions->glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, RenderDepthStencil);
+
+		if(GLFunctions->glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+		{
+			PrintErrorMessage(ERROR_NOFRAMEBUFFEROBJECT);
+			GLFunctions->glBindFramebuffer(GL_FRAMEBUFFER, 0);
+			DestroyRenderTarget();
+			DynamicResolutionEnabled = GL_FALSE;
+			RenderScale = 1.0;
+			return;
+		}
+
+		RenderTargetSize[0] = Width;
+		RenderTargetSize[1] = Height;
+	}
+
+	RenderResolution[0] = (GLuint)(Resolution[0] * RenderScale);
+	RenderResolution[1] = (GLuint)(Resolution[1] * RenderScale);
+	RenderResolution[0] = (RenderResolution[0] > 0) ? RenderResolution[0] : 1;
+	RenderResolution[1] = (RenderResolution[1] > 0) ? RenderResolution[1] : 1;
+
+	GLFunctions->glBindFramebuffer(GL_FRAMEBUFFER, RenderFramebuffer);
+	glViewport(0, 0, RenderResolution[0], RenderResolution[1]);
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::ResolveRenderTarget()
+ *
+ * @brief	Upscales the rendered part of the render target to the whole back buffer.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void FWindow::ResolveRenderTarget()
+{
+	if(!RenderFramebuffer)
+	{
+		return;
+	}
+
+	BindContext();
+	GLFunctions->glBindFramebuffer(GL_READ_FRAMEBUFFER, RenderFramebuffer);
+	GLFunctions->glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+	GLFunctions->glBlitFramebuffer(0, 0, RenderResolution[0], RenderResolution[1],
+		0, 0, Resolution[0], Resolution[1], GL_COLOR_BUFFER_BIT, GL_LINEAR);
+	GLFunctions->glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::UpdateRenderScale(GLdouble RenderTime)
+ *
+ * @brief	Picks the render scale for the next frame(see StepRenderScale). RenderTime only 
+ * 			covers the frame up to the render target resolve, since the swap and the pacer 
+ * 			block for as long as the scale saves and would keep it at the minimum.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	RenderTime	How long the last frame took to render, in seconds. 0 if unknown.
+ **************************************************************************************************/
+
+void FWindow::UpdateRenderScale(GLdouble RenderTime)
+{
+	GLdouble Target = TargetRenderTime;
+
+	if(Target == 0)
+	{
+		Target = (Pacer && Pacer->GetTargetFPS() > 0) ? 1.0 / Pacer->GetTargetFPS() : 1.0 / 60.0;
+	}
+
+	RenderScale = StepRenderScale(RenderScale, SmoothedRenderTime, RenderTime, Target, MinRenderScale, MaxRenderScale);
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::DestroyRenderTarget()
+ *
+ * @brief	Deletes the render target. the context has to be current.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void FWindow::DestroyRenderTarget()
+{
+	if(RenderFramebuffer)
+	{
+		GLFunctions->glDeleteFramebuffers(1, &RenderFramebuffer);
+		GLFunctions->glDeleteRenderbuffers(1, &RenderDepthStencil);
+		glDeleteTextures(1, &RenderColour);
+	}
+
+	RenderFramebuffer = 0;
+	RenderColour = 0;
+	RenderDepthStencil = 0;
+	RenderTargetSize[0] = RenderTargetSize[1] = 0;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::RequestCapture(OnCaptureEvent OnCapture, GLboolean Continuous)
+ *
+ * @brief	Asks for the next frame(or every frame) to be read back without stalling. right 
+ * 			before the swap the back buffer is read into a pixel buffer object and fenced. later
+ * 			swaps check the fence without waiting and once it has signalled, map the buffer and 
+ * 			hand it to the callback. if every buffer is still busy the frame is skipped and 
+ * 			counted as dropped.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	OnCapture 	Who gets the pixels. null stops continuous capture.
+ * @param	Continuous	Whether to keep capturing every frame.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FWindow::RequestCapture(OnCaptureEvent OnCapture, GLboolean Continuous)
+{
+	if(!ContextCreated)
+	{
+		PrintErrorMessage(ERROR_NOCONTEXT);
+		return FOUNDATION_ERROR;
+	}
+
+	if(!HasGLExtension("GL_ARB_sync"))
+	{
+		PrintErrorMessage(ERROR_NOFENCESYNC);
+		return FOUNDATION_ERROR;
+	}
+
+	CaptureEvent = OnCapture;
+	ContinuousCapture = IsValidCaptureEvent(OnCapture) ? Continuous : GL_FALSE;
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	FFrameStatistics FWindow::GetCaptureCostStatistics()
+ *
+ * @brief	Gets statistics on how long capturing took in each SwapDrawBuffers that issued or 
+ * 			delivered a capture, including the time spent in the callbacks.
  *
  * @author	Ziyad
- * @date	3/01/2015
+ * @date	18/10/2026
  *
- * @return	null if it fails, else the open gl extensions.
+ * @return	The capture cost statistics.
  **************************************************************************************************/
 
-const char* FWindow::GetOpenGLExtensions()
+FFrameStatistics FWindow::GetCaptureCostStatistics()
 {
-	if(ContextCreated)
-	{
-		return (const char*)glGetString(GL_EXTENSIONS);
-	}
-
-	else
-	{
-		PrintErrorMessage(ERROR_NOCONTEXT);
-		return nullptr;
-	}
+	return CaptureCosts.GetStatistics();
 }
 
 /**********************************************************************************************//**
- * @fn	GLboolean FWindow::GetInFocus()
+ * @fn	FFrameStatistics FWindow::GetCaptureLatencyStatistics()
  *
- * @brief	Gets whether the window is in event focus.
+ * @brief	Gets statistics on the time between a frame being read and its pixels reaching the 
+ * 			callback. the count is how many frames have been captured.
  *
  * @author	Ziyad
- * @date	29/11/2014
+ * @date	18/10/2026
  *
- * @return	The in focus.
+ * @return	The capture latency statistics.
  **************************************************************************************************/
 
-GLboolean FWindow::GetInFocus()
+FFrameStatistics FWindow::GetCaptureLatencyStatistics()
 {
-	return InFocus;
+	return CaptureLatencies.GetStatistics();
 }
 
 /**********************************************************************************************//**
- * @fn	void FWindow::Focus(GLboolean NewState)
+ * @fn	GLuint64 FWindow::GetDroppedCaptures()
  *
- * @brief	put the window into event focus.
+ * @brief	Gets how many requested frames were skipped because every pixel buffer was busy.
  *
  * @author	Ziyad
- * @date	29/11/2014
+ * @date	18/10/2026
  *
- * @param	NewState	whether to put the window into event focus.
+ * @return	The number of dropped captures.
  **************************************************************************************************/
 
-GLboolean FWindow::Focus(GLboolean ShouldBeInFocus)
+GLuint64 FWindow::GetDroppedCaptures()
 {
-	if (ContextCreated)
-	{
-		InFocus = ShouldBeInFocus;
-
-#if defined(_WIN32) || defined(_WIN64)
-		Windows_Focus();	
-#else
-		Linux_Focus(ShouldBeInFocus);
-#endif
-		return FOUNDATION_OKAY;
-	}
-
-	PrintErrorMessage(ERROR_NOCONTEXT);
-	return FOUNDATION_ERROR;
+	return DroppedCaptures;
 }
 
 /**********************************************************************************************//**
- * @fn	GLboolean FWindow::SetOnKeyEvent(OnKeyEvent OnKey)
+ * @fn	GLboolean FWindow::EnableFrameExport(const char* Name, GLuint MaxWidth, GLuint MaxHeight)
  *
- * @brief	Sets on key event.
+ * @brief	Starts publishing every frame into a named shared memory ring. frames go through the 
+ * 			same pixel buffer ring as RequestCapture and are copied straight from the mapped 
+ * 			buffer into shared memory, where readers in other processes use them in place.
  *
  * @author	Ziyad
- * @date	29/11/2014
+ * @date	18/10/2026
  *
- * @param	OnKey	The on key event.
+ * @param	Name	 	The name readers attach with.
+ * @param	MaxWidth 	The widest frame that can be exported. 0 for the screen width.
+ * @param	MaxHeight	The tallest frame that can be exported. 0 for the screen height.
  *
  * @return	A GLboolean.
  **************************************************************************************************/
 
-GLboolean FWindow::SetOnKeyEvent(OnKeyEvent OnKey)
+GLboolean FWindow::EnableFrameExport(const char* Name, GLuint MaxWidth, GLuint MaxHeight)
 {
-	if (IsValidKeyEvent(OnKey))
+	if(!ContextCreated)
 	{
-		KeyEvent = OnKey;
-		return FOUNDATION_OKAY;
+		PrintErrorMessage(ERROR_NOCONTEXT);
+		return FOUNDATION_ERROR;
 	}
 
-	return FOUNDATION_ERROR;
+	if(!HasGLExtension("GL_ARB_sync"))
+	{
+		PrintErrorMessage(ERROR_NOFENCESYNC);
+		return FOUNDATION_ERROR;
+	}
+
+	DisableFrameExport();
+
+	FrameExporter* NewExporter = new FrameExporter();
+
+	if(!NewExporter->Create(Name, (MaxWidth > 0) ? MaxWidth : WindowManager::GetScreenResolution()[0],
+		(MaxHeight > 0) ? MaxHeight : WindowManager::GetScreenResolution()[1]))
+	{
+		delete NewExporter;
+		return FOUNDATION_ERROR;
+	}
+
+	Exporter = NewExporter;
+	return FOUNDATION_OKAY;
 }
 
 /**********************************************************************************************//**
- * @fn	GLboolean FWindow::SetOnMouseButtonEvent(OnMouseButtonEvent OnMouseButtonEvent)
+ * @fn	GLboolean FWindow::DisableFrameExport()
  *
- * @brief	Sets on mouse button event.
+ * @brief	Stops publishing frames and removes the shared memory ring. frames still being read
+ * 			back are dropped.
  *
  * @author	Ziyad
- * @date	29/11/2014
- *
- * @param	OnMouseButtonEvent	The on mouse button event.
+ * @date	18/10/2026
  *
  * @return	A GLboolean.
  **************************************************************************************************/
 
-GLboolean FWindow::SetOnMouseButtonEvent(OnMouseButtonEvent OnMouseButtonEvent)
+GLboolean FWindow::DisableFrameExport()
 {
-	//we don't really need to check if the context has been created
-	if(IsValidKeyEvent(OnMouseButtonEvent))
+	if(Exporter)
 	{
-		MouseButtonEvent = OnMouseButtonEvent;
-		return FOUNDATION_OKAY;
+		delete Exporter;
+		Exporter = nullptr;
 	}
 
-	PrintErrorMessage(ERROR_INVALIDEVENT);
-	return FOUNDATION_ERROR;
+	return FOUNDATION_OKAY;
 }
 
 /**********************************************************************************************//**
- * @fn	GLboolean FWindow::SetOnMouseWheelEvent(OnMouseWheelEvent OnMouseWheel)
+ * @fn	FrameExporter* FWindow::GetFrameExporter()
  *
- * @brief	Sets on mouse wheel event.
+ * @brief	Gets the frame exporter of this window, e.g. to check how many frames were published.
  *
  * @author	Ziyad
- * @date	29/11/2014
- *
- * @param	OnMouseWheel	The on mouse wheel event.
+ * @date	18/10/2026
  *
- * @return	A GLboolean.
+ * @return	null if frame export is off, else the frame exporter.
  **************************************************************************************************/
 
-GLboolean FWindow::SetOnMouseWheelEvent(OnMouseWheelEvent OnMouseWheel)
+FrameExporter* FWindow::GetFrameExporter()
 {
-	if(IsValidMouseWheelEvent(OnMouseWheel))
-	{
-		MouseWheelEvent = OnMouseWheel;
-		return FOUNDATION_OKAY;
-	}
-
-	PrintErrorMessage(ERROR_INVALIDEVENT);
-	return FOUNDATION_ERROR;
+	return Exporter;
 }
 
 /**********************************************************************************************//**
- * @fn	GLboolean FWindow::SetOnDestroyed(OnDestroyedEvent OnDestroyed)
+ * @fn	GLboolean FWindow::StartRecording(const char* FileName, GLuint FramesPerSecond)
  *
- * @brief	Sets on destroyed.
+ * @brief	Starts recording every frame to a Y4M file at the window's current resolution. the
+ * 			render thread only pays for the read back and the conversion, the disk is written
+ * 			by the recorder's own thread.
  *
  * @author	Ziyad
- * @date	29/11/2014
+ * @date	18/10/2026
  *
- * @param	OnDestroyed	The on destroyed event.
+ * @param	FileName	   	The file to record to.
+ * @param	FramesPerSecond	The frame rate written in the file. 0 for the frame pacer's target or 60.
  *
  * @return	A GLboolean.
  **************************************************************************************************/
 
-GLboolean FWindow::SetOnDestroyed(OnDestroyedEvent OnDestroyed)
+GLboolean FWindow::StartRecording(const char* FileName, GLuint FramesPerSecond)
 {
-	if(IsValidDestroyedEvent(OnDestroyed))
+	if(!ContextCreated)
 	{
-		DestroyedEvent = OnDestroyed;
-		return FOUNDATION_OKAY;
+		PrintErrorMessage(ERROR_NOCONTEXT);
+		return FOUNDATION_ERROR;
 	}
 
-	PrintErrorMessage(ERROR_INVALIDEVENT);
-	return FOUNDATION_ERROR;
+	if(!HasGLExtension("GL_ARB_sync"))
+	{
+		PrintErrorMessage(ERROR_NOFENCESYNC);
+		return FOUNDATION_ERROR;
+	}
+
+	StopRecording();
+
+	if(FramesPerSecond == 0)
+	{
+		FramesPerSecond = (Pacer && Pacer->GetTargetFPS() > 0) ? (GLuint)(Pacer->GetTargetFPS() + 0.5) : 60;
+	}
+
+	VideoRecorder* NewRecorder = new VideoRecorder();
+
+	if(!NewRecorder->Start(FileName, Resolution[0], Resolution[1], FramesPerSecond))
+	{
+		delete NewRecorder;
+		return FOUNDATION_ERROR;
+	}
+
+	Recorder = NewRecorder;
+	return FOUNDATION_OKAY;
 }
 
 /**********************************************************************************************//**
- * @fn	GLboolean FWindow::SetOnMaximized(OnMaximizedEvent OnMaximized)
+ * @fn	GLboolean FWindow::StopRecording()
  *
- * @brief	Sets on maximized.
+ * @brief	Stops recording. frames already converted are written before the file is closed but
+ * 			frames still being read back are dropped.
  *
  * @author	Ziyad
- * @date	29/11/2014
- *
- * @param	OnMaximized	The on maximized event.
+ * @date	18/10/2026
  *
  * @return	A GLboolean.
  **************************************************************************************************/
 
-GLboolean FWindow::SetOnMaximized(OnMaximizedEvent OnMaximized)
+GLboolean FWindow::StopRecording()
 {
-	if(IsValidDestroyedEvent(OnMaximized))
+	if(Recorder)
 	{
-		MaximizedEvent = OnMaximized;
-		return FOUNDATION_OKAY;
+		delete Recorder;
+		Recorder = nullptr;
 	}
-	PrintErrorMessage(ERROR_INVALIDEVENT);
-	return FOUNDATION_ERROR;
+
+	return FOUNDATION_OKAY;
 }
 
 /**********************************************************************************************//**
- * @fn	GLboolean FWindow::SetOnMinimized(OnMinimizedEvent OnMinimized)
+ * @fn	VideoRecorder* FWindow::GetVideoRecorder()
  *
- * @brief	Sets on minimized.
+ * @brief	Gets the video recorder of this window, e.g. to check how many frames were dropped.
  *
  * @author	Ziyad
- * @date	29/11/2014
- *
- * @param	OnMinimized	The on minimized event.
+ * @date	18/10/2026
  *
- * @return	A GLboolean.
+ * @return	null if not recording, else the video recorder.
  **************************************************************************************************/
 
-GLboolean FWindow::SetOnMinimized(OnMinimizedEvent OnMinimized)
+VideoRecorder* FWindow::GetVideoRecorder()
 {
-	if(IsValidDestroyedEvent(OnMinimized))
-	{
-		MinimizedEvent = OnMinimized;
-		return FOUNDATION_OKAY;
-	}
-
-	PrintErrorMessage(ERROR_INVALIDEVENT);
-	return FOUNDATION_ERROR;
+	return Recorder;
 }
 
-/*void FWindow::SetOnRestored(OnRestoredEvent OnRestored)
-{
-	if (IsValid(OnRestored))
-	{
-		RestoredEvent = OnRestored;
-	}
-}*/
-
 /**********************************************************************************************//**
- * @fn	GLboolean FWindow::SetOnFocus(OnFocusEvent OnFocus)
+ * @fn	void FWindow::ProcessCaptures()
  *
- * @brief	Sets on focus.
+ * @brief	Delivers every capture the GPU has finished, oldest first, then reads the back 
+ * 			buffer into the next free pixel buffer if a capture was requested. never waits on
+ * 			the GPU. the read buffer and pack alignment are put back afterwards.
  *
  * @author	Ziyad
- * @date	29/11/2014
- *
- * @param	OnFocus	The on focus event.
- *
- * @return	A GLboolean.
+ * @date	18/10/2026
  **************************************************************************************************/
 
-GLboolean FWindow::SetOnFocus(OnFocusEvent OnFocus)
+void FWindow::ProcessCaptures()
 {
-	if(IsValidFocusEvent(OnFocus))
+	GLdouble Start = GetMonotonicTime();
+
+	BindContext();
+
+	while(CapturePending > 0)
 	{
-		FocusEvent = OnFocus;
-		return FOUNDATION_OKAY;
+		FCaptureSlot& Slot = CaptureSlots[(CaptureHead + CAPTURE_RINGSIZE - CapturePending) % CAPTURE_RINGSIZE];
+		GLenum Result = GLFunctions->glClientWaitSync(Slot.Fence, 0, 0);
+
+		if(Result != GL_ALREADY_SIGNALED && Result != GL_CONDITION_SATISFIED)
+		{
+			break;
+		}
+
+		GLFunctions->glDeleteSync(Slot.Fence);
+		Slot.Fence = nullptr;
+		CapturePending--;
+
+		GLFunctions->glBindBuffer(GL_PIXEL_PACK_BUFFER, Slot.Buffer);
+		const GLubyte* Pixels = (const GLubyte*)GLFunctions->glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY);
+
+		if(Pixels)
+		{
+			CaptureLatencies.Record(GetMonotonicTime() - Slot.IssueTime);
+
+			if(IsValidCaptureEvent(Slot.Callback))
+			{
+				Slot.Callback(Pixels, Slot.Width, Slot.Height);
+			}
+
+			if(Slot.Export && Exporter)
+			{
+				Exporter->Publish(Pixels, Slot.Width, Slot.Height);
+			}
+
+			if(Slot.Record && Recorder)
+			{
+				Recorder->SubmitFrame(Pixels, Slot.Width, Slot.Height);
+			}
+
+			GLFunctions->glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+		}
+
+		GLFunctions->glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
 	}
 
-	PrintErrorMessage(ERROR_INVALIDEVENT);
-	return FOUNDATION_ERROR;
+	if(IsValidCaptureEvent(CaptureEvent) || Exporter || Recorder)
+	{
+		if(CapturePending == CAPTURE_RINGSIZE)
+		{
+			DroppedCaptures++;
+		}
+
+		else
+		{
+			FCaptureSlot& Slot = CaptureSlots[CaptureHead];
+			GLsizeiptr Size = (GLsizeiptr)Resolution[0] * Resolution[1] * 4;
+
+			if(!Slot.Buffer)
+			{
+				GLFunctions->glGenBuffers(1, &Slot.Buffer);
+			}
+
+			GLFunctions->glBindBuffer(GL_PIXEL_PACK_BUFFER, Slot.Buffer);
+
+			if(Slot.BufferSize != Size)
+			{
+				GLFunctions->glBufferData(GL_PIXEL_PACK_BUFFER, Size, nullptr, GL_STREAM_READ);
+				Slot.BufferSize = Size;
+			}
+
+			//the application's read state is left the way it was found
+			GLint PreviousReadBuffer = GL_BACK, PreviousAlignment = 4;
+			glGetIntegerv(GL_READ_BUFFER, &PreviousReadBuffer);
+			glGetIntegerv(GL_PACK_ALIGNMENT, &PreviousAlignment);
+
+			glReadBuffer(GL_BACK);
+			glPixelStorei(GL_PACK_ALIGNMENT, 4);
+			glReadPixels(0, 0, Resolution[0], Resolution[1], GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+			GLFunctions->glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+			glReadBuffer((GLenum)PreviousReadBuffer);
+			glPixelStorei(GL_PACK_ALIGNMENT, PreviousAlignment);
+
+			Slot.Fence = GLFunctions->glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+			Slot.Width = Resolution[0];
+			Slot.Height = Resolution[1];
+			Slot.Callback = CaptureEvent;
+			Slot.Export = (Exporter != nullptr);
+			Slot.Record = (Recorder != nullptr);
+			Slot.IssueTime = GetMonotonicTime();
+			CaptureHead = (CaptureHead + 1) % CAPTURE_RINGSIZE;
+			CapturePending++;
+		}
+
+		if(!ContinuousCapture)
+		{
+			CaptureEvent = nullptr;
+		}
+	}
+
+	CaptureCosts.Record(GetMonotonicTime() - Start);
 }
 
 /**********************************************************************************************//**
- * @fn	void FWindow::SetOnMoved(OnMovedEvent OnMoved)
+ * @fn	void FWindow::DestroyCaptures()
  *
- * @brief	Sets on moved.
+ * @brief	Drops every pending capture and deletes the pixel buffers.
  *
  * @author	Ziyad
- * @date	29/11/2014
- *
- * @param	OnMoved	The on moved event.
+ * @date	18/10/2026
  **************************************************************************************************/
 
-GLboolean FWindow::SetOnMoved(OnMovedEvent OnMoved)
+void FWindow::DestroyCaptures()
 {
-	if(IsValidMovedEvent(OnMoved))
+	if(!ContextCreated)
 	{
-		MovedEvent = OnMoved;
-		return FOUNDATION_OKAY;
+		return;
 	}
-	PrintErrorMessage(ERROR_INVALIDEVENT);
-	return FOUNDATION_ERROR;
-}
 
+	BindContext();
+
+	for(GLuint Iter = 0; Iter < CAPTURE_RINGSIZE; Iter++)
+	{
+		if(CaptureSlots[Iter].Fence)
+		{
+			GLFunctions->glDeleteSync(CaptureSlots[Iter].Fence);
+		}
+
+		if(CaptureSlots[Iter].Buffer)
+		{
+			GLFunctions->glDeleteBuffers(1, &CaptureSlots[Iter].Buffer);
+		}
+
+		CaptureSlots[Iter] = FCaptureSlot();
+	}
+
+	CaptureEvent = nullptr;
+	ContinuousCapture = GL_FALSE;
+	CaptureHead = 0;
+	CapturePending = 0;
+}
 /**********************************************************************************************//**
- * @fn	void FWindow::SetOnResize(OnResizeEvent OnResize)
+ * @fn	GLboolean FWindow::LatchInput()
  *
- * @brief	Sets on resize.
+ * @brief	Reads the mouse and keyboard state of this window straight from the platform. events
+ * 			that are still queued are left alone and update the same state again when they
+ * 			are processed, so callbacks only ever run from the event loop.
  *
  * @author	Ziyad
- * @date	29/11/2014
+ * @date	18/10/2026
  *
- * @param	OnResize	The on resize event.
+ * @return	Whether the mouse position, a mouse button or a key changed.
  **************************************************************************************************/
 
-GLboolean FWindow::SetOnResize(OnResizeEvent OnResize)
+GLboolean FWindow::LatchInput()
 {
-	if(IsValidMovedEvent(OnResize))
-	{
-		ResizeEvent = OnResize;
-		return FOUNDATION_OKAY;
-	}
-
-	PrintErrorMessage(ERROR_INVALIDEVENT);
-	return FOUNDATION_ERROR;
+#if defined(_WIN32) || defined(_WIN64)
+	return Windows_LatchInput();
+#else
+	return Linux_LatchInput();
+#endif
 }
 
 /**********************************************************************************************//**
- * @fn	void FWindow::SetOnMouseMove(OnMouseMoveEvent OnMouseMove)
+ * @fn	FFrameStatistics FWindow::GetLateLatchStatistics()
  *
- * @brief	Sets on mouse move.
+ * @brief	Gets statistics on how much staleness late latching removed. for each frame this is
+ * 			the time between the start of the frame(the first MakeCurrentContext after a swap)
+ * 			and the late latch, or 0 if the input didn't change in between.
  *
  * @author	Ziyad
- * @date	29/11/2014
+ * @date	18/10/2026
  *
- * @param	OnMouseMove	The on mouse move event.
+ * @return	The late latch statistics.
  **************************************************************************************************/
 
-GLboolean FWindow::SetOnMouseMove(OnMouseMoveEvent OnMouseMove)
+FFrameStatistics FWindow::GetLateLatchStatistics()
 {
-	if(IsValidMouseMoveEvent(OnMouseMove))
-	{
-		MouseMoveEvent = OnMouseMove;
-		return FOUNDATION_OKAY;
-	}
-
-	PrintErrorMessage(ERROR_INVALIDEVENT);
-	return FOUNDATION_ERROR;
+	return LateLatchGains.GetStatistics();
 }
 
 GLboolean FWindow::EnableDecorator(GLbitfield Decorator)
 {
-	if (ContextCreated)
+	if (Initialized)
 	{
 #if defined(_WIN32) || defined(_WIN64)
 		Windows_EnableDecorator(Decorator);
@@ -1336,7 +4580,7 @@ GLboolean FWindow::EnableDecorator(GLbitfield Decorator)
 
 GLboolean FWindow::DisableDecorator(GLbitfield Decorator)
 {
-	if (ContextCreated)
+	if (Initialized)
 	{
 #if defined(_WIN32) || defined(_WIN64)
 		Windows_DisableDecorator(Decorator);
@@ -33,6 +33,8 @@ WindowManager::WindowManager()
 GLboolean WindowManager::Initialize()
 {
 	GetInstance()->Initialized = GL_FALSE;
+	GetInstance()->ContextSwitches = 0;
+	GetInstance()->ContextSwitchesLastFrame = 0;
 #if defined(_WIN32) || defined(_WIN64)
 	return Windows_Initialize();
 #else
@@ -301,17 +303,37 @@ void WindowManager::ShutDown()
 	}
 #endif
 
+#if defined(_WIN32) || defined(_WIN64)
+	Windows_DestroyCapture();
+#endif
+
 #if defined(CURRENT_OS_LINUX)
 	for (auto CurrentWindow : GetInstance()->Windows)
 	{
 		delete CurrentWindow;
 	}
-	XCloseDisplay(GetInstance()->m_Display);
+	Linux_DestroyCapture();
+	Linux_Shutdown();
 #endif
 
 	GetInstance()->Windows.clear();
 
+	for (auto CurrentSet : GetInstance()->ExtensionSets)
+	{
+		delete CurrentSet;
+	}
+
+	GetInstance()->ExtensionSets.clear();
+
+	for (auto CurrentTable : GetInstance()->FunctionTables)
+	{
+		delete CurrentTable;
+	}
+
+	GetInstance()->FunctionTables.clear();
+
 	delete Instance;
+	Instance = nullptr;
 }
 
 /**********************************************************************************************//**
@@ -436,6 +458,7 @@ GLboolean WindowManager::PollForEvents()
 {
 	if (GetInstance()->IsInitialized())
 	{
+		EndFrame();
 #if defined(_WIN32) || defined(_WIN64)
 		return GetInstance()->Windows_PollForEvents();
 #else
@@ -451,6 +474,7 @@ GLboolean WindowManager::WaitForEvents()
 {
 	if (GetInstance()->IsInitialized())
 	{
+		EndFrame();
 #if defined(_WIN32) || defined(_WIN64)
 		return GetInstance()->Windows_WaitForEvents();
 #else
@@ -462,6 +486,397 @@ GLboolean WindowManager::WaitForEvents()
 	return FOUNDATION_ERROR;
 }
 
+/**********************************************************************************************//**
+ * @fn	GLuint WindowManager::GetContextSwitchesPerFrame()
+ *
+ * @brief	Gets the number of context switches that reached the driver during the last frame.
+ * 			redundant MakeCurrentContext calls are not counted.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	The number of context switches in the last frame.
+ **************************************************************************************************/
+
+GLuint WindowManager::GetContextSwitchesPerFrame()
+{
+	return GetInstance()->ContextSwitchesLastFrame;
+}
+
+/**********************************************************************************************//**
+ * @fn	void WindowManager::EndFrame()
+ *
+ * @brief	Latches the per frame counters. called every time events are polled or waited for.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void WindowManager::EndFrame()
+{
+	GetInstance()->ContextSwitchesLastFrame = GetInstance()->ContextSwitches.exchange(0);
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean WindowManager::CaptureScreen(FScreenCapture& Capture, GLint X, GLint Y, GLuint Width, GLuint Height)
+ *
+ * @brief	Captures part of the screen into the manager's persistent capture buffer and points
+ * 			Capture at it. the buffer is only reallocated when a capture needs more room than
+ * 			any before it.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param [out]	Capture	Where the view of the captured pixels goes.
+ * @param	X			   	The left edge of the area.
+ * @param	Y			   	The top edge of the area.
+ * @param	Width		   	The width of the area. 0 for up to the right edge of the screen.
+ * @param	Height		   	The height of the area. 0 for up to the bottom edge of the screen.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean WindowManager::CaptureScreen(FScreenCapture& Capture, GLint X, GLint Y, GLuint Width, GLuint Height)
+{
+	return CaptureArea(nullptr, X, Y, Width, Height, Capture);
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean WindowManager::CaptureWindow(const char* WindowName, FScreenCapture& Capture, GLint X, GLint Y, GLuint Width, GLuint Height)
+ *
+ * @brief	Captures part of a window into the manager's persistent capture buffer.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	WindowName	   	Name of the window.
+ * @param [out]	Capture	Where the view of the captured pixels goes.
+ * @param	X			   	The left edge of the area, relative to the window.
+ * @param	Y			   	The top edge of the area, relative to the window.
+ * @param	Width		   	The width of the area. 0 for up to the right edge of the window.
+ * @param	Height		   	The height of the area. 0 for up to the bottom edge of the window.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean WindowManager::CaptureWindow(const char* WindowName, FScreenCapture& Capture, GLint X, GLint Y, GLuint Width, GLuint Height)
+{
+	if(DoesExist(WindowName))
+	{
+		return CaptureArea(GetWindowByName(WindowName), X, Y, Width, Height, Capture);
+	}
+
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean WindowManager::CaptureWindow(GLuint WindowIndex, FScreenCapture& Capture, GLint X, GLint Y, GLuint Width, GLuint Height)
+ *
+ * @brief	Captures part of a window into the manager's persistent capture buffer.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	WindowIndex	   	Zero-based index of the window.
+ * @param [out]	Capture	Where the view of the captured pixels goes.
+ * @param	X			   	The left edge of the area, relative to the window.
+ * @param	Y			   	The top edge of the area, relative to the window.
+ * @param	Width		   	The width of the area. 0 for up to the right edge of the window.
+ * @param	Height		   	The height of the area. 0 for up to the bottom edge of the window.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean WindowManager::CaptureWindow(GLuint WindowIndex, FScreenCapture& Capture, GLint X, GLint Y, GLuint Width, GLuint Height)
+{
+	if(DoesExist(WindowIndex))
+	{
+		return CaptureArea(GetWindowByIndex(WindowIndex), X, Y, Width, Height, Capture);
+	}
+
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	FFrameStatistics WindowManager::GetScreenCaptureStatistics()
+ *
+ * @brief	Gets statistics on how long each screen or window capture took, e.g. to check a 
+ * 			capture loop can keep up with its rate.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	The screen capture statistics.
+ **************************************************************************************************/
+
+FFrameStatistics WindowManager::GetScreenCaptureStatistics()
+{
+	return GetInstance()->ScreenCaptureTimes.GetStatistics();
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean WindowManager::CaptureArea(FWindow* Source, GLint X, GLint Y, GLuint Width, GLuint Height, FScreenCapture& Capture)
+ *
+ * @brief	Clips the area to the window or screen, since the platforms refuse areas that go
+ * 			past the edge, then captures it.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Source		   	The window to capture. null for the screen.
+ * @param	X			   	The left edge of the area.
+ * @param	Y			   	The top edge of the area.
+ * @param	Width		   	The width of the area. 0 for up to the right edge.
+ * @param	Height		   	The height of the area. 0 for up to the bottom edge.
+ * @param [out]	Capture	Where the view of the captured pixels goes.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean WindowManager::CaptureArea(FWindow* Source, GLint X, GLint Y, GLuint Width, GLuint Height, FScreenCapture& Capture)
+{
+	if(!GetInstance()->IsInitialized())
+	{
+		PrintErrorMessage(ERROR_NOTINITIALIZED);
+		return FOUNDATION_ERROR;
+	}
+
+	GLint SourceWidth = Source ? Source->Resolution[0] : GetInstance()->ScreenResolution[0];
+	GLint SourceHeight = Source ? Source->Resolution[1] : GetInstance()->ScreenResolution[1];
+	FDamageRect Area = FDamageRect(X, Y, (Width > 0) ? (GLint)Width : SourceWidth - X,
+		(Height > 0) ? (GLint)Height : SourceHeight - Y).Intersect(FDamageRect(0, 0, SourceWidth, SourceHeight));
+
+	if(Area.IsEmpty())
+	{
+		PrintErrorMessage(ERROR_SCREENCAPTURE);
+		return FOUNDATION_ERROR;
+	}
+
+	GLdouble Start = GetMonotonicTime();
+#if defined(_WIN32) || defined(_WIN64)
+	GLboolean Captured = Windows_CaptureArea(Source ? Source->WindowHandle : nullptr, Area, Capture);
+#else
+	GLboolean Captured = Linux_CaptureArea(Source ? Source->WindowHandle : DefaultRootWindow(GetDisplay()), Area, Capture);
+#endif
+
+	if(!Captured)
+	{
+		PrintErrorMessage(ERROR_SCREENCAPTURE);
+		return FOUNDATION_ERROR;
+	}
+
+	GetInstance()->ScreenCaptureTimes.Record(GetMonotonicTime() - Start);
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean WindowManager::AddSwapHook(GLuint Stage, OnSwapEvent Hook, void* UserData, GLint Priority)
+ *
+ * @brief	Adds a function to run at the swap of every window, e.g. for instrumentation that
+ * 			covers the whole application. global pre hooks run before the window's own and 
+ * 			global post hooks after them.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Stage		SWAPHOOK_PRE or SWAPHOOK_POST.
+ * @param	Hook		The function to call.
+ * @param	UserData	Handed to the function every time it is called.
+ * @param	Priority	Where the hook goes in the chain. lower priorities run first.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean WindowManager::AddSwapHook(GLuint Stage, OnSwapEvent Hook, void* UserData, GLint Priority)
+{
+	if(Stage <= SWAPHOOK_POST && GetInstance()->SwapHooks[Stage].Add(Hook, UserData, Priority))
+	{
+		return FOUNDATION_OKAY;
+	}
+
+	PrintErrorMessage(ERROR_SWAPHOOK);
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean WindowManager::RemoveSwapHook(GLuint Stage, OnSwapEvent Hook, void* UserData)
+ *
+ * @brief	Removes a global swap hook that was added with the same function and user data.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Stage		SWAPHOOK_PRE or SWAPHOOK_POST.
+ * @param	Hook		The function that was added.
+ * @param	UserData	The user data it was added with.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean WindowManager::RemoveSwapHook(GLuint Stage, OnSwapEvent Hook, void* UserData)
+{
+	if(Stage <= SWAPHOOK_POST && GetInstance()->SwapHooks[Stage].Remove(Hook, UserData))
+	{
+		return FOUNDATION_OKAY;
+	}
+
+	PrintErrorMessage(ERROR_SWAPHOOK);
+	return FOUNDATION_ERROR;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean WindowManager::HasGLXExtension(const char* Extension)
+ *
+ * @brief	Query whether the display supports the given GLX extension. 
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Extension	The name of the extension.
+ *
+ * @return	whether the extension is supported.
+ **************************************************************************************************/
+
+GLboolean WindowManager::HasGLXExtension(const char* Extension)
+{
+#if defined(_WIN32) || defined(_WIN64)
+	return GL_FALSE;
+#else
+	if(IsValidString(Extension))
+	{
+		return GetInstance()->GLXExtensions.count(Extension) > 0;
+	}
+
+	return GL_FALSE;
+#endif
+}
+
+//the signature of glGetStringi, which the Windows GL header doesn't have
+typedef const GLubyte* (APIENTRY *GetStringiProc)(GLenum Name, GLuint Index);
+
+//identifies the renderer behind the current context. the version string tells profiles apart
+static std::string GetCurrentRenderer()
+{
+	const char* RendererName = (const char*)glGetString(GL_RENDERER);
+	const char* Version = (const char*)glGetString(GL_VERSION);
+	return std::string(RendererName ? RendererName : "") + " " + (Version ? Version : "");
+}
+
+/**********************************************************************************************//**
+ * @fn	FExtensionSet* WindowManager::GetCurrentExtensionSet()
+ *
+ * @brief	Gets the extensions of the renderer behind the current context. the first time a 
+ * 			renderer is seen its extensions are parsed using glGetStringi(or glGetString on 
+ * 			contexts older than 3.0) and every window on that renderer shares the result.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	the extension set of the current renderer.
+ **************************************************************************************************/
+
+FExtensionSet* WindowManager::GetCurrentExtensionSet()
+{
+	std::string Renderer = GetCurrentRenderer();
+
+	for (auto CurrentSet : GetInstance()->ExtensionSets)
+	{
+		if (CurrentSet->Renderer == Renderer)
+		{
+			return CurrentSet;
+		}
+	}
+
+	FExtensionSet* NewSet = new FExtensionSet();
+	NewSet->Renderer = Renderer;
+
+	GLint MajorVersion = 0;
+	GetStringiProc GetStringi = nullptr;
+	glGetIntegerv(GL_MAJOR_VERSION, &MajorVersion);
+	//contexts older than 3.0 raise GL_INVALID_ENUM on the query above
+	glGetError();
+
+	if (MajorVersion >= 3)
+	{
+#if defined(_WIN32) || defined(_WIN64)
+		GetStringi = (GetStringiProc)wglGetProcAddress("glGetStringi");
+#else
+		GetStringi = (GetStringiProc)glXGetProcAddress((const GLubyte*)"glGetStringi");
+#endif
+	}
+
+	if (GetStringi)
+	{
+		GLint NumExtensions = 0;
+		glGetIntegerv(GL_NUM_EXTENSIONS, &NumExtensions);
+
+		for (GLint CurrentExtension = 0; CurrentExtension < NumExtensions; CurrentExtension++)
+		{
+			const char* Extension = (const char*)GetStringi(GL_EXTENSIONS, CurrentExtension);
+
+			if (Extension)
+			{
+				NewSet->Extensions.insert(Extension);
+				NewSet->ExtensionString += Extension;
+				NewSet->ExtensionString += " ";
+			}
+		}
+	}
+
+	else
+	{
+		const char* Extensions = (const char*)glGetString(GL_EXTENSIONS);
+		NewSet->ExtensionString = Extensions ? Extensions : "";
+
+		for (const char* Start = NewSet->ExtensionString.c_str(); *Start;)
+		{
+			const char* End = strchr(Start, ' ');
+			End = End ? End : Start + strlen(Start);
+
+			if (End != Start)
+			{
+				NewSet->Extensions.insert(std::string(Start, End));
+			}
+
+			Start = *End ? End + 1 : End;
+		}
+	}
+
+	GetInstance()->ExtensionSets.push_back(NewSet);
+	return NewSet;
+}
+
+/**********************************************************************************************//**
+ * @fn	FGLFunctions* WindowManager::GetCurrentGLFunctions()
+ *
+ * @brief	Gets the function table of the renderer behind the current context. the table is
+ * 			made the first time a renderer is seen and shared by every window on it, so 
+ * 			functions are only ever looked up once per renderer.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	the function table of the current renderer.
+ **************************************************************************************************/
+
+FGLFunctions* WindowManager::GetCurrentGLFunctions()
+{
+	std::string Renderer = GetCurrentRenderer();
+
+	for (auto CurrentTable : GetInstance()->FunctionTables)
+	{
+		if (CurrentTable->Renderer == Renderer)
+		{
+			return CurrentTable;
+		}
+	}
+
+	FGLFunctions* NewTable = new FGLFunctions();
+	NewTable->Renderer = Renderer;
+	GetInstance()->FunctionTables.push_back(NewTable);
+	return NewTable;
+}
+
 /**********************************************************************************************//**
  * @fn	void WindowManager::GetScreenResolution(GLuint& Width, GLuint& Height)
  *
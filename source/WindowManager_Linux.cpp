@@ -7,8 +7,42 @@
 #include "WindowManager.h"
 
 #include <limits.h>
+#include <cstring>
+#include <signal.h>
+#include <mutex>
+#if defined(FOUNDATION_XRANDR)
+#include <X11/extensions/Xrandr.h>
+#endif
 #if defined(CURRENT_OS_LINUX)
 
+/**
+* the X error handler is process wide, so swapping it around a request that may fail races
+* with every other thread making requests. one handler is installed for the life of the
+* window manager instead, and errors for requests inside a trap are recorded rather than 
+* passed on to whatever handler was there before
+*/
+static std::mutex ErrorTrapLock;
+static GLboolean ErrorTrapActive = GL_FALSE; /**< whether a thread is between Linux_BeginErrorTrap and Linux_EndErrorTrap */
+static unsigned long ErrorTrapStart = 0; /**< the serial of the first trapped request */
+static unsigned long ErrorTrapEnd = 0; /**< one past the serial of the last trapped request. 0 while the trap is open */
+static GLboolean ErrorTrapped = GL_FALSE; /**< whether a trapped request has failed */
+static XErrorHandler PreviousErrorHandler = nullptr; /**< the handler that was installed before ours */
+
+static int Linux_ErrorHandler(Display* ErrorDisplay, XErrorEvent* Event)
+{
+	if(ErrorTrapActive && Event->serial >= ErrorTrapStart && (ErrorTrapEnd == 0 || Event->serial < ErrorTrapEnd))
+	{
+		ErrorTrapped = GL_TRUE;
+		return 0;
+	}
+
+	return PreviousErrorHandler ? PreviousErrorHandler(ErrorDisplay, Event) : 0;
+}
+
+#if defined(FOUNDATION_XRANDR)
+static void Linux_RemoveFatalHandlers();
+#endif
+
 /**********************************************************************************************//**
  * @fn	FWindow* WindowManager::GetWindowByHandle(Window WindowHandle)
  *
@@ -52,6 +86,8 @@ FWindow* WindowManager::GetWindowByHandle(Window WindowHandle)
 
 GLboolean WindowManager::Linux_Initialize()
 {
+	//contexts may be created from worker threads(CONTEXTCREATION_BACKGROUND)
+	XInitThreads();
 	GetInstance()->m_Display = XOpenDisplay(0);
 
 	if(!GetInstance()->m_Display)
@@ -60,17 +96,85 @@ GLboolean WindowManager::Linux_Initialize()
 		return FOUNDATION_ERROR;
 	}
 
+	PreviousErrorHandler = XSetErrorHandler(&Linux_ErrorHandler);
+
 	GetInstance()->ScreenResolution[0] = WidthOfScreen(XScreenOfDisplay(GetInstance()->m_Display, 
 				DefaultScreen(GetInstance()->m_Display)));
 
 	GetInstance()->ScreenResolution[1] = HeightOfScreen(XScreenOfDisplay(GetInstance()->m_Display,
 				DefaultScreen(GetInstance()->m_Display)));
 
+	Linux_InitGLXExtensions();
+
+	GLint SyncEvent = 0, SyncError = 0, SyncMajor = 0, SyncMinor = 0;
+	GetInstance()->XSyncSupported = XSyncQueryExtension(GetInstance()->m_Display, &SyncEvent, &SyncError) &&
+		XSyncInitialize(GetInstance()->m_Display, &SyncMajor, &SyncMinor);
+
+	GetInstance()->XShmSupported = XShmQueryExtension(GetInstance()->m_Display);
+	GetInstance()->CaptureImage = nullptr;
+	GetInstance()->CaptureSegment.shmid = -1;
+	GetInstance()->CaptureSegment.shmaddr = nullptr;
+	GetInstance()->CaptureSegmentSize = 0;
+	GetInstance()->CaptureVisual = nullptr;
+	GetInstance()->CaptureSharedFailed = GL_FALSE;
+	GetInstance()->XRandRSupported = GL_FALSE;
+#if defined(FOUNDATION_XRANDR)
+	GLint RandREvent = 0, RandRError = 0, RandRMajor = 0, RandRMinor = 0;
+	GetInstance()->XRandRSupported = XRRQueryExtension(GetInstance()->m_Display, &RandREvent, &RandRError) &&
+		XRRQueryVersion(GetInstance()->m_Display, &RandRMajor, &RandRMinor) &&
+		(RandRMajor > 1 || (RandRMajor == 1 && RandRMinor >= 3));
+#endif
+
 	GetInstance()->Initialized = GL_TRUE;
 
 	return FOUNDATION_OKAY;
 }
 
+/**********************************************************************************************//**
+ * @fn	void WindowManager::Linux_InitGLXExtensions()
+ *
+ * @brief	Parses the GLX extensions of the default screen and resolves the swap interval 
+ * 			extensions once so every window can share them. the functions are only resolved
+ * 			when advertised since glXGetProcAddress hands back stubs for unknown names.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void WindowManager::Linux_InitGLXExtensions()
+{
+	const char* Extensions = glXQueryExtensionsString(GetInstance()->m_Display,
+		DefaultScreen(GetInstance()->m_Display));
+
+	GetInstance()->GLXExtensions.clear();
+
+	for(const char* Start = Extensions; Start && *Start;)
+	{
+		const char* End = strchr(Start, ' ');
+		End = End ? End : Start + strlen(Start);
+
+		if(End != Start)
+		{
+			GetInstance()->GLXExtensions.insert(std::string(Start, End));
+		}
+
+		Start = *End ? End + 1 : End;
+	}
+
+	GetInstance()->SwapIntervalMESA = HasGLXExtension("GLX_MESA_swap_control") ?
+		(PFNGLXSWAPINTERVALMESAPROC)glXGetProcAddress((const GLubyte*)"glXSwapIntervalMESA") : nullptr;
+	GetInstance()->SwapIntervalEXT = HasGLXExtension("GLX_EXT_swap_control") ?
+		(PFNGLXSWAPINTERVALEXTPROC)glXGetProcAddress((const GLubyte*)"glXSwapIntervalEXT") : nullptr;
+	GetInstance()->SwapIntervalSGI = HasGLXExtension("GLX_SGI_swap_control") ?
+		(PFNGLXSWAPINTERVALSGIPROC)glXGetProcAddress((const GLubyte*)"glXSwapIntervalSGI") : nullptr;
+	GetInstance()->GetSyncValuesOML = HasGLXExtension("GLX_OML_sync_control") ?
+		(PFNGLXGETSYNCVALUESOMLPROC)glXGetProcAddress((const GLubyte*)"glXGetSyncValuesOML") : nullptr;
+	GetInstance()->GetMscRateOML = HasGLXExtension("GLX_OML_sync_control") ?
+		(PFNGLXGETMSCRATEOMLPROC)glXGetProcAddress((const GLubyte*)"glXGetMscRateOML") : nullptr;
+	GetInstance()->CopySubBufferMESA = HasGLXExtension("GLX_MESA_copy_sub_buffer") ?
+		(PFNGLXCOPYSUBBUFFERMESAPROC)glXGetProcAddress((const GLubyte*)"glXCopySubBufferMESA") : nullptr;
+}
+
 /**********************************************************************************************//**
  * @fn	void WindowManager::Linux_SetMousePositionInScreen(GLuint X, GLuint Y)
  *
@@ -102,7 +206,8 @@ GLboolean WindowManager::Linux_SetMousePositionInScreen(GLuint X, GLuint Y)
 /**********************************************************************************************//**
  * @fn	void WindowManager::Linux_Shutdown()
  *
- * @brief	Linux shutdown.
+ * @brief	Linux shutdown. puts the display modes, the fatal signal handlers and the X error
+ * 			handler back the way they were before Linux_Initialize and closes the display.
  *
  * @author	Ziyad
  * @date	29/11/2014
@@ -110,7 +215,438 @@ GLboolean WindowManager::Linux_SetMousePositionInScreen(GLuint X, GLuint Y)
 
 void WindowManager::Linux_Shutdown()
 {
+	Linux_RestoreDisplayModes();
+#if defined(FOUNDATION_XRANDR)
+	Linux_RemoveFatalHandlers();
+#endif
 	XCloseDisplay(GetInstance()->m_Display);
+	XSetErrorHandler(PreviousErrorHandler);
+	PreviousErrorHandler = nullptr;
+}
+
+/**********************************************************************************************//**
+ * @fn	void WindowManager::Linux_BeginErrorTrap()
+ *
+ * @brief	Starts catching the X errors of the requests this thread makes. the display is 
+ * 			locked until the trap ends so no other thread's requests land inside the range of
+ * 			trapped serials, and only one thread can trap at a time.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void WindowManager::Linux_BeginErrorTrap()
+{
+	ErrorTrapLock.lock();
+	XLockDisplay(GetDisplay());
+	ErrorTrapStart = NextRequest(GetDisplay());
+	ErrorTrapEnd = 0;
+	ErrorTrapped = GL_FALSE;
+	ErrorTrapActive = GL_TRUE;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean WindowManager::Linux_EndErrorTrap()
+ *
+ * @brief	Syncs with the X server so every trapped request has been processed, then stops
+ * 			catching errors.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	Whether any of the trapped requests failed.
+ **************************************************************************************************/
+
+GLboolean WindowManager::Linux_EndErrorTrap()
+{
+	ErrorTrapEnd = NextRequest(GetDisplay());
+	XSync(GetDisplay(), False);
+	ErrorTrapActive = GL_FALSE;
+	GLboolean Failed = ErrorTrapped;
+	XUnlockDisplay(GetDisplay());
+	ErrorTrapLock.unlock();
+	return Failed;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean WindowManager::Linux_AttachSharedSegment(XShmSegmentInfo& Segment, size_t Size)
+ *
+ * @brief	Creates a shared memory segment, maps it and has the X server attach it. the segment
+ * 			is marked for removal right away so it is freed once both sides have detached, even
+ * 			if the process dies first. servers on another machine can't attach it, which fails
+ * 			cleanly instead of killing the process.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param [out]	Segment	The segment. shmid is -1 and shmaddr null if it couldn't be attached.
+ * @param	Size		   	How many bytes the segment holds.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean WindowManager::Linux_AttachSharedSegment(XShmSegmentInfo& Segment, size_t Size)
+{
+	Segment.shmid = shmget(IPC_PRIVATE, Size, IPC_CREAT | 0600);
+	Segment.shmaddr = (Segment.shmid >= 0) ? (char*)shmat(Segment.shmid, nullptr, 0) : (char*)-1;
+	Segment.readOnly = False;
+	GLboolean Attached = GL_FALSE;
+
+	if(Segment.shmaddr != (char*)-1)
+	{
+		Linux_BeginErrorTrap();
+		XShmAttach(GetDisplay(), &Segment);
+		Attached = !Linux_EndErrorTrap();
+	}
+
+	if(Segment.shmid >= 0)
+	{
+		shmctl(Segment.shmid, IPC_RMID, nullptr);
+	}
+
+	if(!Attached)
+	{
+		if(Segment.shmaddr != (char*)-1)
+		{
+			shmdt(Segment.shmaddr);
+		}
+
+		Segment.shmid = -1;
+		Segment.shmaddr = nullptr;
+		return FOUNDATION_ERROR;
+	}
+
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	void WindowManager::Linux_DetachSharedSegment(XShmSegmentInfo& Segment)
+ *
+ * @brief	Has the X server detach a segment, waits for it to let go, then unmaps it here.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param [in,out]	Segment	The segment. does nothing if shmid is -1.
+ **************************************************************************************************/
+
+void WindowManager::Linux_DetachSharedSegment(XShmSegmentInfo& Segment)
+{
+	if(Segment.shmid < 0)
+	{
+		return;
+	}
+
+	XShmDetach(GetDisplay(), &Segment);
+	//the server has to let go of the segment before it is unmapped here
+	XSync(GetDisplay(), False);
+	shmdt(Segment.shmaddr);
+	Segment.shmid = -1;
+	Segment.shmaddr = nullptr;
+}
+
+#if defined(FOUNDATION_XRANDR)
+/**
+* how a CRTC was configured before a window changed its mode. kept out of WindowManager so its
+* layout doesn't depend on whether XRandR was built in
+*/
+struct FSavedCrtc
+{
+	RRCrtc Crtc; /**< the CRTC that was changed */
+	RRMode Mode; /**< its original mode */
+	GLint X; /**< its original position on the screen */
+	GLint Y;
+	Rotation CrtcRotation; /**< its original rotation */
+	std::vector<RROutput> Outputs; /**< the outputs it was driving */
+};
+
+static std::list<FSavedCrtc> SavedCrtcs; /**< every CRTC whose mode has been changed */
+
+/**
+* signals that kill the process without running atexit. SIGINT and SIGTERM are left to the 
+* application, which restores the modes through Shutdown or exit as usual
+*/
+static const GLint FatalSignals[] = { SIGSEGV, SIGABRT, SIGBUS, SIGFPE, SIGILL };
+static const GLuint FatalSignalCount = sizeof(FatalSignals) / sizeof(FatalSignals[0]);
+static struct sigaction PreviousFatalActions[FatalSignalCount]; /**< what each fatal signal did before, so it can be handed on */
+static GLboolean FatalHandlersInstalled = GL_FALSE;
+static Display* FatalDisplay = nullptr; /**< a connection only the fatal signal handler uses, so the thread that crashed can't be holding its lock */
+static XRRScreenResources* FatalResources = nullptr; /**< the screen resources of FatalDisplay, fetched up front so the handler doesn't allocate */
+
+/**********************************************************************************************//**
+ * @fn	void WindowManager::Linux_OnFatalSignal(int Signal)
+ *
+ * @brief	Puts the saved CRTCs back through a connection opened for nothing else, then puts
+ * 			back whatever handled the signal before and raises it again so that handler, or the
+ * 			default action, still happens. the main connection is never touched here since the
+ * 			crashed thread may have been in the middle of using it.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Signal	The signal that was raised.
+ **************************************************************************************************/
+
+void WindowManager::Linux_OnFatalSignal(int Signal)
+{
+	if(FatalDisplay && FatalResources)
+	{
+		for(auto& Saved : SavedCrtcs)
+		{
+			XRRSetCrtcConfig(FatalDisplay, FatalResources, Saved.Crtc, CurrentTime, Saved.X, Saved.Y,
+				Saved.Mode, Saved.CrtcRotation, Saved.Outputs.data(), (GLint)Saved.Outputs.size());
+		}
+
+		XFlush(FatalDisplay);
+	}
+
+	for(GLuint Iter = 0; Iter < FatalSignalCount; Iter++)
+	{
+		if(FatalSignals[Iter] == Signal)
+		{
+			sigaction(Signal, &PreviousFatalActions[Iter], nullptr);
+		}
+	}
+
+	raise(Signal);
+}
+
+/**********************************************************************************************//**
+ * @fn	static void Linux_InstallFatalHandlers(Display* MainDisplay, void (*Handler)(int))
+ *
+ * @brief	Opens the connection the fatal signal handler restores the display modes through
+ * 			and installs it for the fatal signals, remembering what was installed before.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param [in]	MainDisplay	The window manager's connection, for the name of the display.
+ * @param	Handler				The fatal signal handler.
+ **************************************************************************************************/
+
+static void Linux_InstallFatalHandlers(Display* MainDisplay, void (*Handler)(int))
+{
+	FatalDisplay = XOpenDisplay(DisplayString(MainDisplay));
+
+	if(!FatalDisplay)
+	{
+		return;
+	}
+
+	FatalResources = XRRGetScreenResourcesCurrent(FatalDisplay, DefaultRootWindow(FatalDisplay));
+
+	struct sigaction Action;
+	memset(&Action, 0, sizeof(Action));
+	Action.sa_handler = Handler;
+	sigemptyset(&Action.sa_mask);
+
+	for(GLuint Iter = 0; Iter < FatalSignalCount; Iter++)
+	{
+		sigaction(FatalSignals[Iter], &Action, &PreviousFatalActions[Iter]);
+	}
+
+	FatalHandlersInstalled = GL_TRUE;
+}
+
+/**********************************************************************************************//**
+ * @fn	static void Linux_RemoveFatalHandlers()
+ *
+ * @brief	Puts back the handlers the fatal signals had before and closes the connection the
+ * 			fatal signal handler used.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+static void Linux_RemoveFatalHandlers()
+{
+	if(FatalHandlersInstalled)
+	{
+		for(GLuint Iter = 0; Iter < FatalSignalCount; Iter++)
+		{
+			sigaction(FatalSignals[Iter], &PreviousFatalActions[Iter], nullptr);
+		}
+
+		FatalHandlersInstalled = GL_FALSE;
+	}
+
+	if(FatalResources)
+	{
+		XRRFreeScreenResources(FatalResources);
+		FatalResources = nullptr;
+	}
+
+	if(FatalDisplay)
+	{
+		XCloseDisplay(FatalDisplay);
+		FatalDisplay = nullptr;
+	}
+}
+
+/**********************************************************************************************//**
+ * @fn	XID WindowManager::Linux_GetCrtcAt(_XRRScreenResources* Resources, GLint X, GLint Y)
+ *
+ * @brief	Gets the active CRTC that shows the given point of the screen.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param [in]	Resources	The screen resources.
+ * @param	X				The horizontal position on the screen.
+ * @param	Y				The vertical position on the screen.
+ *
+ * @return	The CRTC showing the point, else the first active CRTC, else 0.
+ **************************************************************************************************/
+
+XID WindowManager::Linux_GetCrtcAt(_XRRScreenResources* Resources, GLint X, GLint Y)
+{
+	RRCrtc Fallback = 0;
+
+	for(GLint Iter = 0; Iter < Resources->ncrtc; Iter++)
+	{
+		XRRCrtcInfo* Info = XRRGetCrtcInfo(GetDisplay(), Resources, Resources->crtcs[Iter]);
+
+		if(!Info)
+		{
+			continue;
+		}
+
+		GLboolean Active = (Info->mode != None && Info->noutput > 0);
+		GLboolean Contains = (X >= Info->x && Y >= Info->y &&
+			X < Info->x + (GLint)Info->width && Y < Info->y + (GLint)Info->height);
+		XRRFreeCrtcInfo(Info);
+
+		if(Active && Contains)
+		{
+			return Resources->crtcs[Iter];
+		}
+
+		if(Active && !Fallback)
+		{
+			Fallback = Resources->crtcs[Iter];
+		}
+	}
+
+	return Fallback;
+}
+
+/**********************************************************************************************//**
+ * @fn	void WindowManager::Linux_SaveCrtc(_XRRScreenResources* Resources, XID Crtc)
+ *
+ * @brief	Remembers how a CRTC is configured before its mode is changed. the first time 
+ * 			anything is saved, handlers are installed that restore every saved CRTC when the
+ * 			process exits or dies from a fatal signal, since the X server keeps whatever mode
+ * 			it was last given. the fatal signal handlers are chained with sigaction so any the
+ * 			application installed still run.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param [in]	Resources	The screen resources.
+ * @param	Crtc			The CRTC that is about to change.
+ **************************************************************************************************/
+
+void WindowManager::Linux_SaveCrtc(_XRRScreenResources* Resources, XID Crtc)
+{
+	static GLboolean ExitHandlerInstalled = GL_FALSE;
+
+	for(auto& Saved : SavedCrtcs)
+	{
+		if(Saved.Crtc == Crtc)
+		{
+			return;
+		}
+	}
+
+	XRRCrtcInfo* Info = XRRGetCrtcInfo(GetDisplay(), Resources, Crtc);
+
+	if(!Info)
+	{
+		return;
+	}
+
+	FSavedCrtc Saved;
+	Saved.Crtc = Crtc;
+	Saved.Mode = Info->mode;
+	Saved.X = Info->x;
+	Saved.Y = Info->y;
+	Saved.CrtcRotation = Info->rotation;
+	Saved.Outputs.assign(Info->outputs, Info->outputs + Info->noutput);
+	XRRFreeCrtcInfo(Info);
+
+	SavedCrtcs.push_back(Saved);
+
+	if(!ExitHandlerInstalled)
+	{
+		atexit(&Linux_RestoreDisplayModes);
+		ExitHandlerInstalled = GL_TRUE;
+	}
+
+	if(!FatalHandlersInstalled)
+	{
+		Linux_InstallFatalHandlers(GetDisplay(), &Linux_OnFatalSignal);
+	}
+}
+
+/**********************************************************************************************//**
+ * @fn	void WindowManager::Linux_RestoreCrtc(XID Crtc)
+ *
+ * @brief	Puts a CRTC back to how it was before its mode was changed.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Crtc	The CRTC to restore.
+ **************************************************************************************************/
+
+void WindowManager::Linux_RestoreCrtc(XID Crtc)
+{
+	for(auto Saved = SavedCrtcs.begin(); Saved != SavedCrtcs.end(); ++Saved)
+	{
+		if(Saved->Crtc != Crtc)
+		{
+			continue;
+		}
+
+		XRRScreenResources* Resources = XRRGetScreenResourcesCurrent(GetDisplay(), DefaultRootWindow(GetDisplay()));
+
+		if(Resources)
+		{
+			XRRSetCrtcConfig(GetDisplay(), Resources, Saved->Crtc, CurrentTime, Saved->X, Saved->Y,
+				Saved->Mode, Saved->CrtcRotation, Saved->Outputs.data(), (GLint)Saved->Outputs.size());
+			XRRFreeScreenResources(Resources);
+		}
+
+		SavedCrtcs.erase(Saved);
+		XSync(GetDisplay(), False);
+		return;
+	}
+}
+#endif
+
+/**********************************************************************************************//**
+ * @fn	void WindowManager::Linux_RestoreDisplayModes()
+ *
+ * @brief	Puts every CRTC a window changed the mode of back to how it was. runs from Shutdown
+ * 			and on exit. the fatal signal handler does the same through its own connection.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void WindowManager::Linux_RestoreDisplayModes()
+{
+#if defined(FOUNDATION_XRANDR)
+	if(!Instance || !Instance->m_Display)
+	{
+		return;
+	}
+
+	while(!SavedCrtcs.empty())
+	{
+		Linux_RestoreCrtc(SavedCrtcs.front().Crtc);
+	}
+#endif
 }
 
 /**********************************************************************************************//**
@@ -284,6 +820,14 @@ GLvoid WindowManager::Linux_ProcessEvents(XEvent CurrentEvent)
 	{
 	case Expose:
 	{
+		//the first expose arrives once the window is actually viewable
+		if (l_Window->TimeToFirstMap == 0)
+		{
+			l_Window->TimeToFirstMap = GetMonotonicTime() - l_Window->InitializeTime;
+		}
+
+		l_Window->AddDamage(FDamageRect(CurrentEvent.xexpose.x, CurrentEvent.xexpose.y,
+			CurrentEvent.xexpose.width, CurrentEvent.xexpose.height));
 		break;
 	}
 
@@ -320,7 +864,7 @@ GLvoid WindowManager::Linux_ProcessEvents(XEvent CurrentEvent)
 		if (l_FunctionKeysym <= 255)
 		{
 			l_Window->Keys[l_FunctionKeysym] = KEYSTATE_DOWN;
-			if (IsValidKeyEvent(l_Window->KeyEvent))
+			if (!l_Window->RouteVirtualKey(l_FunctionKeysym, KEYSTATE_DOWN) && IsValidKeyEvent(l_Window->KeyEvent))
 			{
 				l_Window->KeyEvent(l_FunctionKeysym, KEYSTATE_DOWN);
 			}
@@ -331,7 +875,7 @@ GLvoid WindowManager::Linux_ProcessEvents(XEvent CurrentEvent)
 			l_Window->Keys[
 				Linux_TranslateKey(l_FunctionKeysym)] = KEYSTATE_DOWN;
 
-			if (IsValidKeyEvent(l_Window->KeyEvent))
+			if (!l_Window->RouteVirtualKey(Linux_TranslateKey(l_FunctionKeysym), KEYSTATE_DOWN) && IsValidKeyEvent(l_Window->KeyEvent))
 			{
 				l_Window->KeyEvent(Linux_TranslateKey(l_FunctionKeysym), KEYSTATE_DOWN);
 			}
@@ -367,7 +911,7 @@ GLvoid WindowManager::Linux_ProcessEvents(XEvent CurrentEvent)
 			{
 				l_Window->Keys[l_FunctionKeysym] = KEYSTATE_UP;
 
-				if (IsValidKeyEvent(l_Window->KeyEvent))
+				if (!l_Window->RouteVirtualKey(l_FunctionKeysym, KEYSTATE_UP) && IsValidKeyEvent(l_Window->KeyEvent))
 				{
 					l_Window->KeyEvent(l_FunctionKeysym, KEYSTATE_UP);
 				}
@@ -378,16 +922,11 @@ GLvoid WindowManager::Linux_ProcessEvents(XEvent CurrentEvent)
 				l_Window->Keys[
 					Linux_TranslateKey(l_FunctionKeysym)] = KEYSTATE_UP;
 
-				if (IsValidKeyEvent(l_Window->KeyEvent))
+				if (!l_Window->RouteVirtualKey(Linux_TranslateKey(l_FunctionKeysym), KEYSTATE_UP) && IsValidKeyEvent(l_Window->KeyEvent))
 				{
 					l_Window->KeyEvent(Linux_TranslateKey(l_FunctionKeysym), KEYSTATE_UP);
 				}
 			}
-
-			if (IsValidKeyEvent(l_Window->KeyEvent))
-			{
-				l_Window->KeyEvent(Linux_TranslateKey(l_FunctionKeysym), KEYSTATE_UP);
-			}
 		}
 
 		break;
@@ -395,13 +934,17 @@ GLvoid WindowManager::Linux_ProcessEvents(XEvent CurrentEvent)
 
 	case ButtonPress:
 	{
+		//virtual windows are hit tested against where the press actually happened
+		l_Window->MousePosition[0] = CurrentEvent.xbutton.x;
+		l_Window->MousePosition[1] = CurrentEvent.xbutton.y;
+
 		switch (CurrentEvent.xbutton.button)
 		{
 		case 1:
 		{
 			l_Window->MouseButton[MOUSE_LEFTBUTTON] = MOUSE_BUTTONDOWN;
 
-			if (IsValidKeyEvent(l_Window->MouseButtonEvent))
+			if (!l_Window->RouteVirtualMouseButton(MOUSE_LEFTBUTTON, MOUSE_BUTTONDOWN) && IsValidKeyEvent(l_Window->MouseButtonEvent))
 			{
 				l_Window->MouseButtonEvent(MOUSE_LEFTBUTTON, MOUSE_BUTTONDOWN);
 			}
@@ -412,7 +955,7 @@ GLvoid WindowManager::Linux_ProcessEvents(XEvent CurrentEvent)
 		{
 			l_Window->MouseButton[MOUSE_MIDDLEBUTTON] = MOUSE_BUTTONDOWN;
 
-			if (IsValidKeyEvent(l_Window->MouseButtonEvent))
+			if (!l_Window->RouteVirtualMouseButton(MOUSE_MIDDLEBUTTON, MOUSE_BUTTONDOWN) && IsValidKeyEvent(l_Window->MouseButtonEvent))
 			{
 				l_Window->MouseButtonEvent(MOUSE_MIDDLEBUTTON, MOUSE_BUTTONDOWN);
 			}
@@ -423,7 +966,7 @@ GLvoid WindowManager::Linux_ProcessEvents(XEvent CurrentEvent)
 		{
 			l_Window->MouseButton[MOUSE_RIGHTBUTTON] = MOUSE_BUTTONDOWN;
 
-			if (IsValidKeyEvent(l_Window->MouseButtonEvent))
+			if (!l_Window->RouteVirtualMouseButton(MOUSE_RIGHTBUTTON, MOUSE_BUTTONDOWN) && IsValidKeyEvent(l_Window->MouseButtonEvent))
 			{
 				l_Window->MouseButtonEvent(MOUSE_RIGHTBUTTON, MOUSE_BUTTONDOWN);
 			}
@@ -434,7 +977,7 @@ GLvoid WindowManager::Linux_ProcessEvents(XEvent CurrentEvent)
 		{
 			l_Window->MouseButton[MOUSE_SCROLL_UP] = MOUSE_BUTTONDOWN;
 
-			if (IsValidMouseWheelEvent(l_Window->MouseWheelEvent))
+			if (!l_Window->RouteVirtualMouseWheel(MOUSE_SCROLL_UP) && IsValidMouseWheelEvent(l_Window->MouseWheelEvent))
 			{
 				l_Window->MouseWheelEvent(MOUSE_SCROLL_UP);
 			}
@@ -445,7 +988,7 @@ GLvoid WindowManager::Linux_ProcessEvents(XEvent CurrentEvent)
 		{
 			l_Window->MouseButton[MOUSE_SCROLL_DOWN] = MOUSE_BUTTONDOWN;
 
-			if (IsValidMouseWheelEvent(l_Window->MouseWheelEvent))
+			if (!l_Window->RouteVirtualMouseWheel(MOUSE_SCROLL_DOWN) && IsValidMouseWheelEvent(l_Window->MouseWheelEvent))
 			{
 				l_Window->MouseWheelEvent(MOUSE_SCROLL_DOWN);
 			}
@@ -469,7 +1012,7 @@ GLvoid WindowManager::Linux_ProcessEvents(XEvent CurrentEvent)
 		{
 			l_Window->MouseButton[MOUSE_LEFTBUTTON] = MOUSE_BUTTONUP;
 
-			if (IsValidKeyEvent(l_Window->MouseButtonEvent))
+			if (!l_Window->RouteVirtualMouseButton(MOUSE_LEFTBUTTON, MOUSE_BUTTONUP) && IsValidKeyEvent(l_Window->MouseButtonEvent))
 			{
 				l_Window->MouseButtonEvent(MOUSE_LEFTBUTTON, MOUSE_BUTTONUP);
 			}
@@ -480,7 +1023,7 @@ GLvoid WindowManager::Linux_ProcessEvents(XEvent CurrentEvent)
 		{
 			l_Window->MouseButton[MOUSE_MIDDLEBUTTON] = MOUSE_BUTTONUP;
 
-			if (IsValidKeyEvent(l_Window->MouseButtonEvent))
+			if (!l_Window->RouteVirtualMouseButton(MOUSE_MIDDLEBUTTON, MOUSE_BUTTONUP) && IsValidKeyEvent(l_Window->MouseButtonEvent))
 			{
 				l_Window->MouseButtonEvent(MOUSE_MIDDLEBUTTON, MOUSE_BUTTONUP);
 			}
@@ -491,7 +1034,7 @@ GLvoid WindowManager::Linux_ProcessEvents(XEvent CurrentEvent)
 		{
 			l_Window->MouseButton[MOUSE_RIGHTBUTTON] = MOUSE_BUTTONUP;
 
-			if (IsValidKeyEvent(l_Window->MouseButtonEvent))
+			if (!l_Window->RouteVirtualMouseButton(MOUSE_RIGHTBUTTON, MOUSE_BUTTONUP) && IsValidKeyEvent(l_Window->MouseButtonEvent))
 			{
 				l_Window->MouseButtonEvent(MOUSE_RIGHTBUTTON, MOUSE_BUTTONUP);
 			}
@@ -532,7 +1075,9 @@ GLvoid WindowManager::Linux_ProcessEvents(XEvent CurrentEvent)
 		GetInstance()->ScreenMousePosition[0] = CurrentEvent.xmotion.x_root;
 		GetInstance()->ScreenMousePosition[1] = CurrentEvent.xmotion.y_root;
 
-		if (IsValidMouseMoveEvent(l_Window->MouseMoveEvent))
+		if (!l_Window->RouteVirtualMouseMove(CurrentEvent.xmotion.x,
+				CurrentEvent.xmotion.y, CurrentEvent.xmotion.x_root,
+				CurrentEvent.xmotion.y_root) && IsValidMouseMoveEvent(l_Window->MouseMoveEvent))
 		{
 			l_Window->MouseMoveEvent(CurrentEvent.xmotion.x,
 				CurrentEvent.xmotion.y, CurrentEvent.xmotion.x_root,
@@ -582,8 +1127,17 @@ GLvoid WindowManager::Linux_ProcessEvents(XEvent CurrentEvent)
 	//when a request to configure the window is made
 	case ConfigureNotify:
 	{
-		glViewport(0, 0, CurrentEvent.xconfigure.width,
-			CurrentEvent.xconfigure.height);
+		//frames presented from now on are at the size the window manager asked for
+		if (l_Window->SyncRequestPending || l_Window->FrameSyncPending)
+		{
+			l_Window->SyncResizeApplied = GL_TRUE;
+		}
+
+		if(l_Window->ContextCreated)
+		{
+			glViewport(0, 0, CurrentEvent.xconfigure.width,
+				CurrentEvent.xconfigure.height);
+		}
 
 		//check if window was resized
 		if ((GLuint)CurrentEvent.xconfigure.width != l_Window->Resolution[0]
@@ -596,6 +1150,7 @@ GLvoid WindowManager::Linux_ProcessEvents(XEvent CurrentEvent)
 
 			l_Window->Resolution[0] = CurrentEvent.xconfigure.width;
 			l_Window->Resolution[1] = CurrentEvent.xconfigure.height;
+			l_Window->ResetDamage();
 		}
 
 		//check if window was moved
@@ -609,6 +1164,8 @@ GLvoid WindowManager::Linux_ProcessEvents(XEvent CurrentEvent)
 
 			l_Window->Position[0] = CurrentEvent.xconfigure.x;
 			l_Window->Position[1] = CurrentEvent.xconfigure.y;
+			//it may now be on an output with a different refresh rate
+			l_Window->RefreshPeriod = 0;
 		}
 		break;
 	}
@@ -679,6 +1236,45 @@ GLvoid WindowManager::Linux_ProcessEvents(XEvent CurrentEvent)
 			//printf("%s\n", l_AtomName);
 		}
 
+		//the compositor drew one of our frames. the counter value and time are split into 32 bit halves
+		if (CurrentEvent.xclient.message_type == l_Window->AtomFrameDrawn)
+		{
+			GLuint64 Frame = ((GLuint64)(GLuint)CurrentEvent.xclient.data.l[1] << 32) | (GLuint)CurrentEvent.xclient.data.l[0];
+			GLuint64 DrawnTime = ((GLuint64)(GLuint)CurrentEvent.xclient.data.l[3] << 32) | (GLuint)CurrentEvent.xclient.data.l[2];
+			l_Window->Linux_OnFrameDrawn(Frame, DrawnTime * 1e-6);
+			break;
+		}
+
+		//the compositor knows when that frame reached the screen
+		if (CurrentEvent.xclient.message_type == l_Window->AtomFrameTimings)
+		{
+			GLuint64 Frame = ((GLuint64)(GLuint)CurrentEvent.xclient.data.l[1] << 32) | (GLuint)CurrentEvent.xclient.data.l[0];
+			l_Window->Linux_OnFrameTimings(Frame, (GLint)CurrentEvent.xclient.data.l[2], 
+				(GLuint)CurrentEvent.xclient.data.l[3], (GLuint)CurrentEvent.xclient.data.l[4]);
+			break;
+		}
+
+		//the window manager wants to know when the next frame at the new size is done
+		if (CurrentEvent.xclient.message_type == l_Window->AtomProtocols &&
+			(Atom)CurrentEvent.xclient.data.l[0] == l_Window->AtomSyncRequest && l_Window->SyncCounter != None)
+		{
+			//a set l[4] means the value is for the extended counter
+			if (CurrentEvent.xclient.data.l[4] != 0)
+			{
+				l_Window->FrameSyncValue = ((GLuint64)(GLuint)CurrentEvent.xclient.data.l[3] << 32) | (GLuint)CurrentEvent.xclient.data.l[2];
+				l_Window->FrameSyncPending = GL_TRUE;
+				l_Window->SyncResizeApplied = GL_FALSE;
+				break;
+			}
+
+			XSyncIntsToValue(&l_Window->SyncValue, (GLuint)CurrentEvent.xclient.data.l[2], 
+				(GLint)CurrentEvent.xclient.data.l[3]);
+			l_Window->SyncRequestPending = GL_TRUE;
+			//the counter is only set once the ConfigureNotify this request comes before has been applied
+			l_Window->SyncResizeApplied = GL_FALSE;
+			break;
+		}
+
 		if ((Atom)CurrentEvent.xclient.data.l[0] == l_Window->AtomClose)
 		{
 			//printf("window closed\n");
@@ -1121,4 +1717,202 @@ GLuint WindowManager::Linux_TranslateKey(GLuint KeySym)
 	}
 }
 
+/**********************************************************************************************//**
+ * @fn	GLboolean WindowManager::Linux_CaptureArea(Window Source, const FDamageRect& Area, FScreenCapture& Capture)
+ *
+ * @brief	Reads an area of a window into the capture image. with MIT-SHM the server writes
+ * 			straight into the shared segment, otherwise XGetSubImage still reuses the image
+ * 			instead of allocating a new one like XGetImage would. the image is made with the
+ * 			window's own visual and depth, since GLX windows often don't use the default ones.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Source		   	The window to read from.
+ * @param	Area		   	The area to read. must be inside the drawable.
+ * @param [out]	Capture	Where the view of the captured pixels goes.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean WindowManager::Linux_CaptureArea(Window Source, const FDamageRect& Area, FScreenCapture& Capture)
+{
+	XWindowAttributes Attributes;
+
+	Linux_BeginErrorTrap();
+	GLboolean HasAttributes = XGetWindowAttributes(GetDisplay(), Source, &Attributes);
+
+	if(Linux_EndErrorTrap() || !HasAttributes)
+	{
+		return FOUNDATION_ERROR;
+	}
+
+	XImage* Image = GetInstance()->CaptureImage;
+
+	if((!Image || Image->width != Area.Width || Image->height != Area.Height ||
+		Image->depth != Attributes.depth || GetInstance()->CaptureVisual != Attributes.visual) &&
+		!Linux_ResizeCaptureImage(Area.Width, Area.Height, Attributes.visual, Attributes.depth))
+	{
+		return FOUNDATION_ERROR;
+	}
+
+	Image = GetInstance()->CaptureImage;
+
+	if(Image->bits_per_pixel != 32)
+	{
+		return FOUNDATION_ERROR;
+	}
+
+	//the server rejects captures of e.g. unmapped windows, which would otherwise be fatal
+	Linux_BeginErrorTrap();
+	GLboolean Captured = GL_FALSE;
+
+	//both wait for the reply so any error has already arrived when they return
+	if(GetInstance()->CaptureSegment.shmid >= 0)
+	{
+		Captured = XShmGetImage(GetDisplay(), Source, Image, Area.X, Area.Y, AllPlanes);
+	}
+
+	else
+	{
+		Captured = (XGetSubImage(GetDisplay(), Source, Area.X, Area.Y, Area.Width, Area.Height,
+			AllPlanes, ZPixmap, Image, 0, 0) != nullptr);
+	}
+
+	if(Linux_EndErrorTrap() || !Captured)
+	{
+		return FOUNDATION_ERROR;
+	}
+
+	Capture.Pixels = (const GLubyte*)Image->data;
+	Capture.Width = Area.Width;
+	Capture.Height = Area.Height;
+	Capture.Stride = Image->bytes_per_line;
+	Capture.RedShift = Capture.GreenShift = Capture.BlueShift = 0;
+
+	for(unsigned long Mask = Image->red_mask; Mask && !(Mask & 1); Mask >>= 1, Capture.RedShift++);
+	for(unsigned long Mask = Image->green_mask; Mask && !(Mask & 1); Mask >>= 1, Capture.GreenShift++);
+	for(unsigned long Mask = Image->blue_mask; Mask && !(Mask & 1); Mask >>= 1, Capture.BlueShift++);
+
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean WindowManager::Linux_ResizeCaptureImage(GLuint Width, GLuint Height, Visual* ImageVisual, GLint Depth)
+ *
+ * @brief	Makes the capture image the given size and format. only the image header is remade
+ * 			when the shared memory segment is already big enough. a new segment is made at least
+ * 			as big as the screen so it rarely has to grow again. if the server can't attach the
+ * 			segment(e.g. it is on another machine) captures fall back to XGetSubImage for good.
+ * 			software surfaces keep using MIT-SHM on their own terms.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Width	   	The width of the image.
+ * @param	Height	   	The height of the image.
+ * @param	ImageVisual	The visual of the window that will be captured.
+ * @param	Depth	   	The depth of the window that will be captured.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean WindowManager::Linux_ResizeCaptureImage(GLuint Width, GLuint Height, Visual* ImageVisual, GLint Depth)
+{
+	Display* CurrentDisplay = GetDisplay();
+	XShmSegmentInfo& Segment = GetInstance()->CaptureSegment;
+	GetInstance()->CaptureVisual = ImageVisual;
+
+	if(GetInstance()->CaptureImage)
+	{
+		//the segment outlives the header
+		if(Segment.shmid >= 0)
+		{
+			GetInstance()->CaptureImage->data = nullptr;
+		}
+
+		XDestroyImage(GetInstance()->CaptureImage);
+		GetInstance()->CaptureImage = nullptr;
+	}
+
+	if(GetInstance()->XShmSupported && !GetInstance()->CaptureSharedFailed)
+	{
+		XImage* Image = XShmCreateImage(CurrentDisplay, ImageVisual, Depth, ZPixmap, nullptr, &Segment, Width, Height);
+		size_t Size = Image ? (size_t)Image->bytes_per_line * Image->height : 0;
+
+		if(Image && Size > GetInstance()->CaptureSegmentSize)
+		{
+			size_t ScreenSize = (size_t)GetInstance()->ScreenResolution[0] * GetInstance()->ScreenResolution[1] * 4;
+			Linux_DestroyCapture();
+			GetInstance()->CaptureVisual = ImageVisual;
+
+			Size = (Size > ScreenSize) ? Size : ScreenSize;
+
+			if(Linux_AttachSharedSegment(Segment, Size))
+			{
+				GetInstance()->CaptureSegmentSize = Size;
+			}
+
+			else
+			{
+				//don't keep trying on a server that can't share memory with us
+				GetInstance()->CaptureSharedFailed = GL_TRUE;
+			}
+		}
+
+		if(Image && Segment.shmid >= 0)
+		{
+			Image->data = Segment.shmaddr;
+			GetInstance()->CaptureImage = Image;
+			return FOUNDATION_OKAY;
+		}
+
+		if(Image)
+		{
+			XDestroyImage(Image);
+		}
+	}
+
+	XImage* Image = XCreateImage(CurrentDisplay, ImageVisual, Depth, ZPixmap, 0, nullptr, Width, Height, 32, 0);
+
+	if(!Image)
+	{
+		return FOUNDATION_ERROR;
+	}
+
+	//XDestroyImage frees this
+	Image->data = (char*)malloc((size_t)Image->bytes_per_line * Image->height);
+	GetInstance()->CaptureImage = Image;
+	return (Image->data != nullptr);
+}
+
+/**********************************************************************************************//**
+ * @fn	void WindowManager::Linux_DestroyCapture()
+ *
+ * @brief	Destroys the capture image and detaches its shared memory segment.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void WindowManager::Linux_DestroyCapture()
+{
+	XShmSegmentInfo& Segment = GetInstance()->CaptureSegment;
+
+	if(GetInstance()->CaptureImage)
+	{
+		if(Segment.shmid >= 0)
+		{
+			GetInstance()->CaptureImage->data = nullptr;
+		}
+
+		XDestroyImage(GetInstance()->CaptureImage);
+		GetInstance()->CaptureImage = nullptr;
+	}
+
+	Linux_DetachSharedSegment(Segment);
+	GetInstance()->CaptureSegmentSize = 0;
+	GetInstance()->CaptureVisual = nullptr;
+}
+
 #endif
@@ -21,6 +21,12 @@ GLboolean WindowManager::Windows_Initialize()
 {
 	CreateTerminal();
 	RECT l_Desktop;
+	GetInstance()->CaptureDeviceContext = nullptr;
+	GetInstance()->CaptureBitmap = nullptr;
+	GetInstance()->CaptureOldBitmap = nullptr;
+	GetInstance()->CaptureBits = nullptr;
+	GetInstance()->CaptureCapacity[0] = 0;
+	GetInstance()->CaptureCapacity[1] = 0;
 
 	HWND l_DesktopHandle = GetDesktopWindow();
 
@@ -86,7 +92,12 @@ LRESULT CALLBACK WindowManager::WindowProcedure(HWND WindowHandle, UINT Message,
 		GetWindowByIndex(GetInstance()->Windows.size() - 1)->WindowHandle = WindowHandle;
 		l_Window = GetWindowByHandle(WindowHandle);
 
-		l_Window->InitializeGL();
+		//lazy and background contexts are created on the first MakeCurrentContext instead.
+		//background creation isn't supported on Windows so it behaves like lazy creation
+		if (l_Window->ContextCreation == CONTEXTCREATION_IMMEDIATE)
+		{
+			l_Window->InitializeGL();
+		}
 		break;
 	}
 
@@ -131,6 +142,7 @@ LRESULT CALLBACK WindowManager::WindowProcedure(HWND WindowHandle, UINT Message,
 	{
 		l_Window->Resolution[0] = (GLuint)LOWORD(LongParam);
 		l_Window->Resolution[1] = (GLuint)HIWORD(LongParam);
+		l_Window->ResetDamage();
 
 		switch (WordParam)
 		{
@@ -234,7 +246,7 @@ LRESULT CALLBACK WindowManager::WindowProcedure(HWND WindowHandle, UINT Message,
 			}
 		}
 
-		if (IsValidKeyEvent(l_Window->KeyEvent))
+		if (!l_Window->RouteVirtualKey(l_TranslatedKey, KEYSTATE_DOWN) && IsValidKeyEvent(l_Window->KeyEvent))
 		{
 			l_Window->KeyEvent(l_TranslatedKey, KEYSTATE_DOWN);
 		}
@@ -283,7 +295,7 @@ LRESULT CALLBACK WindowManager::WindowProcedure(HWND WindowHandle, UINT Message,
 			}
 		}
 
-		if (IsValidKeyEvent(l_Window->KeyEvent))
+		if (!l_Window->RouteVirtualKey(l_TranslatedKey, KEYSTATE_UP) && IsValidKeyEvent(l_Window->KeyEvent))
 		{
 			l_Window->KeyEvent(l_TranslatedKey, KEYSTATE_UP);
 		}
@@ -315,7 +327,7 @@ LRESULT CALLBACK WindowManager::WindowProcedure(HWND WindowHandle, UINT Message,
 		}
 		}
 
-		if (IsValidKeyEvent(l_Window->KeyEvent))
+		if (!l_Window->RouteVirtualKey(l_TranslatedKey, KEYSTATE_DOWN) && IsValidKeyEvent(l_Window->KeyEvent))
 		{
 			l_Window->KeyEvent(l_TranslatedKey, KEYSTATE_DOWN);
 		}
@@ -349,7 +361,7 @@ LRESULT CALLBACK WindowManager::WindowProcedure(HWND WindowHandle, UINT Message,
 		}
 		}
 
-		if (IsValidKeyEvent(l_Window->KeyEvent))
+		if (!l_Window->RouteVirtualKey(l_TranslatedKey, KEYSTATE_UP) && IsValidKeyEvent(l_Window->KeyEvent))
 		{
 			l_Window->KeyEvent(l_TranslatedKey, KEYSTATE_UP);
 		}
@@ -369,7 +381,8 @@ LRESULT CALLBACK WindowManager::WindowProcedure(HWND WindowHandle, UINT Message,
 
 		//printf("%i %i \n", l_Point.x, l_Point.y);
 
-		if (IsValidMouseMoveEvent(l_Window->MouseMoveEvent))
+		if (!l_Window->RouteVirtualMouseMove(l_Window->MousePosition[0],
+				l_Window->MousePosition[1], l_Point.x, l_Point.y) && IsValidMouseMoveEvent(l_Window->MouseMoveEvent))
 		{
 			l_Window->MouseMoveEvent(l_Window->MousePosition[0],
 				l_Window->MousePosition[1], l_Point.x, l_Point.y);
@@ -381,7 +394,7 @@ LRESULT CALLBACK WindowManager::WindowProcedure(HWND WindowHandle, UINT Message,
 	{
 		l_Window->MouseButton[MOUSE_LEFTBUTTON] = MOUSE_BUTTONDOWN;
 
-		if (IsValidKeyEvent(l_Window->MouseButtonEvent))
+		if (!l_Window->RouteVirtualMouseButton(MOUSE_LEFTBUTTON, MOUSE_BUTTONDOWN) && IsValidKeyEvent(l_Window->MouseButtonEvent))
 		{
 			l_Window->MouseButtonEvent(MOUSE_LEFTBUTTON, MOUSE_BUTTONDOWN);
 		}
@@ -392,7 +405,7 @@ LRESULT CALLBACK WindowManager::WindowProcedure(HWND WindowHandle, UINT Message,
 	{
 		l_Window->MouseButton[MOUSE_LEFTBUTTON] = MOUSE_BUTTONUP;
 
-		if (IsValidKeyEvent(l_Window->MouseButtonEvent))
+		if (!l_Window->RouteVirtualMouseButton(MOUSE_LEFTBUTTON, MOUSE_BUTTONUP) && IsValidKeyEvent(l_Window->MouseButtonEvent))
 		{
 			l_Window->MouseButtonEvent(MOUSE_LEFTBUTTON, MOUSE_BUTTONUP);
 		}
@@ -403,7 +416,7 @@ LRESULT CALLBACK WindowManager::WindowProcedure(HWND WindowHandle, UINT Message,
 	{
 		l_Window->MouseButton[MOUSE_RIGHTBUTTON] = MOUSE_BUTTONDOWN;
 
-		if (IsValidKeyEvent(l_Window->MouseButtonEvent))
+		if (!l_Window->RouteVirtualMouseButton(MOUSE_RIGHTBUTTON, MOUSE_BUTTONDOWN) && IsValidKeyEvent(l_Window->MouseButtonEvent))
 		{
 			l_Window->MouseButtonEvent(MOUSE_RIGHTBUTTON, MOUSE_BUTTONDOWN);
 		}
@@ -414,7 +427,7 @@ LRESULT CALLBACK WindowManager::WindowProcedure(HWND WindowHandle, UINT Message,
 	{
 		l_Window->MouseButton[MOUSE_RIGHTBUTTON] = MOUSE_BUTTONUP;
 
-		if (IsValidKeyEvent(l_Window->MouseButtonEvent))
+		if (!l_Window->RouteVirtualMouseButton(MOUSE_RIGHTBUTTON, MOUSE_BUTTONUP) && IsValidKeyEvent(l_Window->MouseButtonEvent))
 		{
 			l_Window->MouseButtonEvent(MOUSE_RIGHTBUTTON, MOUSE_BUTTONUP);
 		}
@@ -425,7 +438,7 @@ LRESULT CALLBACK WindowManager::WindowProcedure(HWND WindowHandle, UINT Message,
 	{
 		l_Window->MouseButton[MOUSE_MIDDLEBUTTON] = MOUSE_BUTTONDOWN;
 
-		if (IsValidKeyEvent(l_Window->MouseButtonEvent))
+		if (!l_Window->RouteVirtualMouseButton(MOUSE_MIDDLEBUTTON, MOUSE_BUTTONDOWN) && IsValidKeyEvent(l_Window->MouseButtonEvent))
 		{
 			l_Window->MouseButtonEvent(MOUSE_MIDDLEBUTTON, MOUSE_BUTTONDOWN);
 		}
@@ -436,7 +449,7 @@ LRESULT CALLBACK WindowManager::WindowProcedure(HWND WindowHandle, UINT Message,
 	{
 		l_Window->MouseButton[MOUSE_MIDDLEBUTTON] = MOUSE_BUTTONUP;
 
-		if (IsValidKeyEvent(l_Window->MouseButtonEvent))
+		if (!l_Window->RouteVirtualMouseButton(MOUSE_MIDDLEBUTTON, MOUSE_BUTTONUP) && IsValidKeyEvent(l_Window->MouseButtonEvent))
 		{
 			l_Window->MouseButtonEvent(MOUSE_MIDDLEBUTTON, MOUSE_BUTTONUP);
 		}
@@ -447,7 +460,7 @@ LRESULT CALLBACK WindowManager::WindowProcedure(HWND WindowHandle, UINT Message,
 	{
 		if ((WordParam % WHEEL_DELTA) > 0)
 		{
-			if (IsValidMouseWheelEvent(l_Window->MouseWheelEvent))
+			if (!l_Window->RouteVirtualMouseWheel(MOUSE_SCROLL_DOWN) && IsValidMouseWheelEvent(l_Window->MouseWheelEvent))
 			{
 				l_Window->MouseWheelEvent(MOUSE_SCROLL_DOWN);
 			}
@@ -455,7 +468,7 @@ LRESULT CALLBACK WindowManager::WindowProcedure(HWND WindowHandle, UINT Message,
 
 		else
 		{
-			if (IsValidMouseWheelEvent(l_Window->MouseWheelEvent))
+			if (!l_Window->RouteVirtualMouseWheel(MOUSE_SCROLL_UP) && IsValidMouseWheelEvent(l_Window->MouseWheelEvent))
 			{
 				l_Window->MouseWheelEvent(MOUSE_SCROLL_UP);
 			}
@@ -790,4 +803,111 @@ GLuint WindowManager::Windows_TranslateKey(WPARAM WordParam, LPARAM LongParam)
 		}
 	}
 }
+
+/**********************************************************************************************//**
+ * @fn	GLboolean WindowManager::Windows_CaptureArea(HWND Source, const FDamageRect& Area, FScreenCapture& Capture)
+ *
+ * @brief	Copies an area of a window into the capture DIB section. the DIB section only 
+ * 			grows, so capturing the same area every frame doesn't allocate.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Source		   	The window to read from. null for the whole screen.
+ * @param	Area		   	The area to read. must be inside the window.
+ * @param [out]	Capture	Where the view of the captured pixels goes.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean WindowManager::Windows_CaptureArea(HWND Source, const FDamageRect& Area, FScreenCapture& Capture)
+{
+	if(!GetInstance()->CaptureBits ||
+		GetInstance()->CaptureCapacity[0] < Area.Width || GetInstance()->CaptureCapacity[1] < Area.Height)
+	{
+		GLuint Width = (Area.Width > GetInstance()->CaptureCapacity[0]) ? Area.Width : GetInstance()->CaptureCapacity[0];
+		GLuint Height = (Area.Height > GetInstance()->CaptureCapacity[1]) ? Area.Height : GetInstance()->CaptureCapacity[1];
+		Windows_DestroyCapture();
+
+		BITMAPINFO Info = {};
+		Info.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+		Info.bmiHeader.biWidth = Width;
+		//negative for rows from the top down like X11
+		Info.bmiHeader.biHeight = -(GLint)Height;
+		Info.bmiHeader.biPlanes = 1;
+		Info.bmiHeader.biBitCount = 32;
+		Info.bmiHeader.biCompression = BI_RGB;
+
+		void* Bits = nullptr;
+		GetInstance()->CaptureDeviceContext = CreateCompatibleDC(nullptr);
+		GetInstance()->CaptureBitmap = CreateDIBSection(GetInstance()->CaptureDeviceContext, &Info, DIB_RGB_COLORS, &Bits, nullptr, 0);
+
+		if(!GetInstance()->CaptureBitmap)
+		{
+			Windows_DestroyCapture();
+			return FOUNDATION_ERROR;
+		}
+
+		GetInstance()->CaptureOldBitmap = SelectObject(GetInstance()->CaptureDeviceContext, GetInstance()->CaptureBitmap);
+		GetInstance()->CaptureBits = (GLubyte*)Bits;
+		GetInstance()->CaptureCapacity[0] = Width;
+		GetInstance()->CaptureCapacity[1] = Height;
+	}
+
+	HDC SourceDeviceContext = GetDC(Source);
+	BOOL Copied = BitBlt(GetInstance()->CaptureDeviceContext, 0, 0, Area.Width, Area.Height,
+		SourceDeviceContext, Area.X, Area.Y, SRCCOPY);
+	ReleaseDC(Source, SourceDeviceContext);
+	//make sure the copy has landed before the caller reads it
+	GdiFlush();
+
+	if(!Copied)
+	{
+		return FOUNDATION_ERROR;
+	}
+
+	Capture.Pixels = GetInstance()->CaptureBits;
+	Capture.Width = Area.Width;
+	Capture.Height = Area.Height;
+	Capture.Stride = GetInstance()->CaptureCapacity[0] * 4;
+	Capture.RedShift = 16;
+	Capture.GreenShift = 8;
+	Capture.BlueShift = 0;
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	void WindowManager::Windows_DestroyCapture()
+ *
+ * @brief	Destroys the capture DIB section.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void WindowManager::Windows_DestroyCapture()
+{
+	if(GetInstance()->CaptureDeviceContext)
+	{
+		if(GetInstance()->CaptureOldBitmap)
+		{
+			SelectObject(GetInstance()->CaptureDeviceContext, GetInstance()->CaptureOldBitmap);
+		}
+
+		if(GetInstance()->CaptureBitmap)
+		{
+			DeleteObject(GetInstance()->CaptureBitmap);
+		}
+
+		DeleteDC(GetInstance()->CaptureDeviceContext);
+	}
+
+	GetInstance()->CaptureDeviceContext = nullptr;
+	GetInstance()->CaptureBitmap = nullptr;
+	GetInstance()->CaptureOldBitmap = nullptr;
+	GetInstance()->CaptureBits = nullptr;
+	GetInstance()->CaptureCapacity[0] = 0;
+	GetInstance()->CaptureCapacity[1] = 0;
+}
+
 #endif
@@ -6,8 +6,13 @@
 
 #include "Window.h"
 #include "WindowManager.h"
+#if defined(FOUNDATION_XRANDR)
+#include <X11/extensions/Xrandr.h>
+#endif
 #if defined(__linux__)
 #include <cstring> 
+#include <math.h>
+#include <X11/XKBlib.h>
 /**********************************************************************************************//**
  * @fn	GLboolean FWindow::Linux_Initialize()
  *
@@ -33,7 +38,36 @@ GLboolean FWindow::Linux_Initialize()
 		exit(0);
 	}
 
-	VisualInfo = glXGetVisualFromFBConfig(WindowManager::GetDisplay(), GetBestFrameBufferConfig()); 
+	//software surfaces don't touch GLX at all so they work on servers without it
+	if(ContextCreation == CONTEXTCREATION_SOFTWARE)
+	{
+		XVisualInfo Template;
+		GLint VisualCount = 0;
+		Template.visualid = XVisualIDFromVisual(DefaultVisual(WindowManager::GetDisplay(), DefaultScreen(WindowManager::GetDisplay())));
+		VisualInfo = XGetVisualInfo(WindowManager::GetDisplay(), VisualIDMask, &Template, &VisualCount);
+	}
+
+	else
+	{
+		//the context we share with has to exist before ours can be created
+		if(ShareWindow && !ShareWindow->ContextCreated)
+		{
+			ShareWindow->InitializeGL();
+		}
+
+		//a window that renders with another window's context has to use the same configuration
+		if(ShareMode == CONTEXTSHARE_SINGLE)
+		{
+			FrameBufferConfig = ShareWindow->FrameBufferConfig;
+		}
+
+		else
+		{
+			FrameBufferConfig = GetBestFrameBufferConfig();
+		}
+
+		VisualInfo = glXGetVisualFromFBConfig(WindowManager::GetDisplay(), FrameBufferConfig);
+	}
 
 	//VisualInfo = glXChooseVisual(WindowManager::GetDisplay(), 0, Attributes);
 
@@ -71,10 +105,46 @@ GLboolean FWindow::Linux_Initialize()
 		Name);
 
 	InitializeAtomics();
+	Linux_InitSyncCounter();
+
+	if(LowLatencyMode)
+	{
+		Linux_UpdateCompositorBypass();
+	}
+
+	Initialized = GL_TRUE;
+
+	switch(ContextCreation)
+	{
+		case CONTEXTCREATION_LAZY:
+		{
+			XFlush(WindowManager::GetDisplay());
+			return FOUNDATION_OKAY;
+		}
+
+		case CONTEXTCREATION_BACKGROUND:
+		{
+			XFlush(WindowManager::GetDisplay());
+
+			//a borrowed context doesn't need creating
+			if(ShareMode != CONTEXTSHARE_SINGLE)
+			{
+				ContextThread = std::thread([this]() { Context = Linux_CreateContext(); });
+			}
+			return FOUNDATION_OKAY;
+		}
 
-	XSetWMProtocols(WindowManager::GetDisplay(), WindowHandle, &AtomClose, GL_TRUE);	
+		case CONTEXTCREATION_SOFTWARE:
+		{
+			XFlush(WindowManager::GetDisplay());
+			return CreateSoftwareSurface();
+		}
 
-	return Linux_InitializeGL();
+		default:
+		{
+			return Linux_InitializeGL();
+		}
+	}
 }
 
 /**********************************************************************************************//**
@@ -93,7 +163,33 @@ void FWindow::Linux_Shutdown()
 		Restore();
 	}
 
-	glXDestroyContext(WindowManager::GetDisplay(), Context);
+	if(ContextThread.joinable())
+	{
+		ContextThread.join();
+	}
+
+	if(ContextCreation != CONTEXTCREATION_SOFTWARE)
+	{
+		UnbindContext();
+	}
+
+	//the context belongs to the window we are sharing it with
+	if(Context && ShareMode != CONTEXTSHARE_SINGLE)
+	{
+		glXDestroyContext(WindowManager::GetDisplay(), Context);
+	}
+
+	if(SyncCounter != None)
+	{
+		XSyncDestroyCounter(WindowManager::GetDisplay(), SyncCounter);
+		XSyncDestroyCounter(WindowManager::GetDisplay(), FrameCounter);
+		SyncCounter = None;
+		FrameCounter = None;
+		SyncRequestPending = GL_FALSE;
+		FrameSyncPending = GL_FALSE;
+		SyncResizeApplied = GL_FALSE;
+	}
+
 	XUnmapWindow(WindowManager::GetDisplay(), WindowHandle);
 	XDestroyWindow(WindowManager::GetDisplay(), WindowHandle);
 	WindowHandle = 0;
@@ -192,6 +288,228 @@ void FWindow::Linux_FullScreen(GLboolean ShouldBeFullscreen)
 	XSendEvent(WindowManager::GetDisplay(),
 			XDefaultRootWindow(WindowManager::GetDisplay()),
 			0, SubstructureNotifyMask, &l_Event);
+
+	Linux_UpdateCompositorBypass();
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::Linux_UpdateCompositorBypass()
+ *
+ * @brief	Asks the compositor to unredirect the window while it is full screen or in low
+ * 			latency mode, so frames go straight to the screen instead of being copied a frame 
+ * 			later. the hint is removed otherwise.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void FWindow::Linux_UpdateCompositorBypass()
+{
+	if(LowLatencyMode || CurrentState == WINDOWSTATE_FULLSCREEN)
+	{
+		//1 asks for bypass, 2 would ask to always be composited
+		unsigned long Bypass = 1;
+		XChangeProperty(WindowManager::GetDisplay(), WindowHandle, AtomBypassCompositor, XA_CARDINAL, 32,
+			PropModeReplace, (unsigned char*)&Bypass, 1);
+	}
+
+	else
+	{
+		XDeleteProperty(WindowManager::GetDisplay(), WindowHandle, AtomBypassCompositor);
+	}
+
+	XFlush(WindowManager::GetDisplay());
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::Linux_GetIsBypassingCompositor()
+ *
+ * @brief	Reads _NET_WM_BYPASS_COMPOSITOR back from the X server.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	Whether the window asks for the compositor to be bypassed.
+ **************************************************************************************************/
+
+GLboolean FWindow::Linux_GetIsBypassingCompositor()
+{
+	Atom Type = None;
+	GLint Format = 0;
+	unsigned long Count = 0, BytesLeft = 0;
+	unsigned char* Data = nullptr;
+	GLboolean Bypassing = GL_FALSE;
+
+	if(XGetWindowProperty(WindowManager::GetDisplay(), WindowHandle, AtomBypassCompositor, 0, 1, GL_FALSE,
+		XA_CARDINAL, &Type, &Format, &Count, &BytesLeft, &Data) == Success && Data)
+	{
+		Bypassing = (Type == XA_CARDINAL && Count == 1 && *(unsigned long*)Data == 1);
+		XFree(Data);
+	}
+
+	return Bypassing;
+}
+
+/**********************************************************************************************//**
+ * @fn	std::list<FDisplayMode> FWindow::Linux_GetDisplayModes()
+ *
+ * @brief	Lists the modes of the output driven by the CRTC the middle of the window is on. the
+ * 			refresh rate of each mode comes from its pixel clock and total size.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	The display modes. empty without XRandR 1.3.
+ **************************************************************************************************/
+
+std::list<FDisplayMode> FWindow::Linux_GetDisplayModes()
+{
+	std::list<FDisplayMode> Modes;
+
+#if defined(FOUNDATION_XRANDR)
+	if(WindowManager::GetInstance()->XRandRSupported)
+	{
+		XRRScreenResources* Resources = XRRGetScreenResourcesCurrent(WindowManager::GetDisplay(),
+			DefaultRootWindow(WindowManager::GetDisplay()));
+		RRCrtc Crtc = Resources ? WindowManager::Linux_GetCrtcAt(Resources, (GLint)(Position[0] + (Resolution[0] / 2)),
+			(GLint)(Position[1] + (Resolution[1] / 2))) : 0;
+		XRRCrtcInfo* CrtcInfo = Crtc ? XRRGetCrtcInfo(WindowManager::GetDisplay(), Resources, Crtc) : nullptr;
+		XRROutputInfo* OutputInfo = (CrtcInfo && CrtcInfo->noutput > 0) ?
+			XRRGetOutputInfo(WindowManager::GetDisplay(), Resources, CrtcInfo->outputs[0]) : nullptr;
+
+		for(GLint OutputMode = 0; OutputInfo && OutputMode < OutputInfo->nmode; OutputMode++)
+		{
+			for(GLint Iter = 0; Iter < Resources->nmode; Iter++)
+			{
+				const XRRModeInfo& Mode = Resources->modes[Iter];
+
+				if(Mode.id != OutputInfo->modes[OutputMode])
+				{
+					continue;
+				}
+
+				GLdouble Lines = Mode.vTotal;
+				Lines *= (Mode.modeFlags & RR_DoubleScan) ? 2 : 1;
+				Lines /= (Mode.modeFlags & RR_Interlace) ? 2 : 1;
+
+				Modes.push_back(FDisplayMode(Mode.width, Mode.height, 
+					(Mode.hTotal > 0 && Lines > 0) ? Mode.dotClock / (Mode.hTotal * Lines) : 0, Mode.id));
+			}
+		}
+
+		if(OutputInfo)
+		{
+			XRRFreeOutputInfo(OutputInfo);
+		}
+
+		if(CrtcInfo)
+		{
+			XRRFreeCrtcInfo(CrtcInfo);
+		}
+
+		if(Resources)
+		{
+			XRRFreeScreenResources(Resources);
+		}
+
+		return Modes;
+	}
+#endif
+
+	PrintErrorMessage(ERROR_NOMODESWITCHING);
+	return Modes;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::Linux_SetDisplayMode(const FDisplayMode& Mode)
+ *
+ * @brief	Switches the CRTC the window is on to the given mode and moves the window over it.
+ * 			the screen itself isn't resized so modes bigger than the current screen are refused.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Mode	The mode to switch to, from Linux_GetDisplayModes.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FWindow::Linux_SetDisplayMode(const FDisplayMode& Mode)
+{
+#if defined(FOUNDATION_XRANDR)
+	if(Mode.Width > WindowManager::GetScreenResolution()[0] || Mode.Height > WindowManager::GetScreenResolution()[1])
+	{
+		PrintErrorMessage(ERROR_INVALIDDISPLAYMODE);
+		return FOUNDATION_ERROR;
+	}
+
+	XRRScreenResources* Resources = XRRGetScreenResourcesCurrent(WindowManager::GetDisplay(),
+		DefaultRootWindow(WindowManager::GetDisplay()));
+
+	if(!Resources)
+	{
+		PrintErrorMessage(ERROR_NOMODESWITCHING);
+		return FOUNDATION_ERROR;
+	}
+
+	RRCrtc Crtc = ModeSwitchedCrtc ? ModeSwitchedCrtc : WindowManager::Linux_GetCrtcAt(Resources, 
+		(GLint)(Position[0] + (Resolution[0] / 2)), (GLint)(Position[1] + (Resolution[1] / 2)));
+	XRRCrtcInfo* CrtcInfo = Crtc ? XRRGetCrtcInfo(WindowManager::GetDisplay(), Resources, Crtc) : nullptr;
+
+	if(!CrtcInfo)
+	{
+		XRRFreeScreenResources(Resources);
+		PrintErrorMessage(ERROR_NOMODESWITCHING);
+		return FOUNDATION_ERROR;
+	}
+
+	WindowManager::Linux_SaveCrtc(Resources, Crtc);
+
+	Status Result = XRRSetCrtcConfig(WindowManager::GetDisplay(), Resources, Crtc, CurrentTime, 
+		CrtcInfo->x, CrtcInfo->y, (RRMode)Mode.Handle, CrtcInfo->rotation, CrtcInfo->outputs, CrtcInfo->noutput);
+
+	if(Result == RRSetConfigSuccess)
+	{
+		ModeSwitchedCrtc = Crtc;
+		XMoveResizeWindow(WindowManager::GetDisplay(), WindowHandle, CrtcInfo->x, CrtcInfo->y, Mode.Width, Mode.Height);
+	}
+
+	XRRFreeCrtcInfo(CrtcInfo);
+	XRRFreeScreenResources(Resources);
+
+	if(Result != RRSetConfigSuccess)
+	{
+		WindowManager::Linux_RestoreCrtc(Crtc);
+		PrintErrorMessage(ERROR_INVALIDDISPLAYMODE);
+		return FOUNDATION_ERROR;
+	}
+
+	return FOUNDATION_OKAY;
+#else
+	(void)Mode;
+	PrintErrorMessage(ERROR_NOMODESWITCHING);
+	return FOUNDATION_ERROR;
+#endif
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::Linux_RestoreDisplayMode()
+ *
+ * @brief	Puts the CRTC the window switched back to its original mode.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void FWindow::Linux_RestoreDisplayMode()
+{
+#if defined(FOUNDATION_XRANDR)
+	if(ModeSwitchedCrtc)
+	{
+		WindowManager::Linux_RestoreCrtc(ModeSwitchedCrtc);
+		ModeSwitchedCrtc = 0;
+	}
+#endif
 }
 
 /**********************************************************************************************//**
@@ -381,6 +699,56 @@ void FWindow::Linux_VerticalSync(GLint EnableSync)
 	}
 }
 
+/**********************************************************************************************//**
+ * @fn	static void Linux_QueryContextAttributes(FContextAttributes& Attributes)
+ *
+ * @brief	Reads the version, profile and flags back from the current context. the driver may
+ * 			give a newer version than asked for, and the legacy fallback ignores the request
+ * 			entirely, so what was asked for can't be trusted to describe the context.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param [in,out]	Attributes	The attributes to update.
+ **************************************************************************************************/
+
+static void Linux_QueryContextAttributes(FContextAttributes& Attributes)
+{
+	const char* Version = (const char*)glGetString(GL_VERSION);
+	GLint Major = 0, Minor = 0;
+
+	//GL_MAJOR_VERSION doesn't exist before 3.0 but the version string always does
+	if(!Version || sscanf(Version, "%d.%d", &Major, &Minor) != 2)
+	{
+		return;
+	}
+
+	Attributes.MajorVersion = Major;
+	Attributes.MinorVersion = Minor;
+	Attributes.Profile = CONTEXTPROFILE_COMPATIBILITY;
+	Attributes.Debug = GL_FALSE;
+	Attributes.ForwardCompatible = GL_FALSE;
+
+	if(Major >= 3)
+	{
+		GLint Flags = 0;
+		glGetIntegerv(GL_CONTEXT_FLAGS, &Flags);
+		Attributes.Debug = (Flags & GL_CONTEXT_FLAG_DEBUG_BIT) != 0;
+		Attributes.ForwardCompatible = (Flags & GL_CONTEXT_FLAG_FORWARD_COMPATIBLE_BIT) != 0;
+	}
+
+	if(Major > 3 || (Major == 3 && Minor >= 2))
+	{
+		GLint ProfileMask = 0;
+		glGetIntegerv(GL_CONTEXT_PROFILE_MASK, &ProfileMask);
+
+		if(ProfileMask & GL_CONTEXT_CORE_PROFILE_BIT)
+		{
+			Attributes.Profile = CONTEXTPROFILE_CORE;
+		}
+	}
+}
+
 /**********************************************************************************************//**
  * @fn	GLboolean FWindow::Linux_InitializeGL()
  *
@@ -394,17 +762,34 @@ void FWindow::Linux_VerticalSync(GLint EnableSync)
 
 GLboolean FWindow::Linux_InitializeGL()
 {
-	if(!Context)
+	if(!ContextCreated)
 	{
-		Context = glXCreateContext(
-			WindowManager::GetDisplay(),
-			VisualInfo, 0, GL_TRUE);
+		//the worker thread may already be creating the context for us
+		if(ContextThread.joinable())
+		{
+			ContextThread.join();
+		}
+
+		else if(ShareMode == CONTEXTSHARE_SINGLE)
+		{
+			Context = ShareWindow->Context;
+			ContextAttributes = ShareWindow->ContextAttributes;
+		}
+
+		else
+		{
+			Context = Linux_CreateContext();
+		}
 
 		if(Context)
 		{
 			
-			glXMakeCurrent(WindowManager::GetDisplay(),
-			WindowHandle, Context);
+			BindContext();
+
+			if(ShareMode != CONTEXTSHARE_SINGLE)
+			{
+				Linux_QueryContextAttributes(ContextAttributes);
+			}
 
 			XWindowAttributes l_Attributes;
 
@@ -413,11 +798,11 @@ GLboolean FWindow::Linux_InitializeGL()
 			Position[0] = l_Attributes.x;
 			Position[1] = l_Attributes.y;
 
-			const char* ExtensionsAvailable = 0;
+			Extensions = WindowManager::GetCurrentExtensionSet();
+			GLFunctions = WindowManager::GetCurrentGLFunctions();
+			FGLFunctions::Current = GLFunctions;
 
-			ExtensionsAvailable = glXQueryExtensionsString(WindowManager::GetDisplay(), 0);
-
-			if(!ExtensionsAvailable)
+			if(WindowManager::GetInstance()->GLXExtensions.empty())
 			{
 				PrintWarningMessage(WARNING_NOGLEXTENSIONS);
 			}
@@ -429,6 +814,9 @@ GLboolean FWindow::Linux_InitializeGL()
 			ContextCreated = GL_TRUE;
 			return FOUNDATION_OKAY;
 		}
+
+		PrintErrorMessage(ERROR_INVALIDCONTEXT);
+		return FOUNDATION_ERROR;
 	}
 
 	else
@@ -436,8 +824,127 @@ GLboolean FWindow::Linux_InitializeGL()
 		PrintErrorMessage(ERROR_EXISTINGCONTEXT);
 		return FOUNDATION_ERROR;	
 	}
+}
 
-	return FOUNDATION_ERROR;
+/**********************************************************************************************//**
+ * @fn	GLXContext FWindow::Linux_CreateContext()
+ *
+ * @brief	Creates the GLX context using the requested context attributes. the no-error and
+ * 			flush control attributes are dropped if the driver refuses them and if 
+ * 			GLX_ARB_create_context is not available at all a legacy context is created instead.
+ * 			this does not make the context current so it is safe to call from a worker thread.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	the new context or 0 if it fails.
+ **************************************************************************************************/
+
+GLXContext FWindow::Linux_CreateContext()
+{
+	PFNGLXCREATECONTEXTATTRIBSARBPROC CreateContextAttribsARB = nullptr;
+	GLXContext SharedContext = (ShareMode == CONTEXTSHARE_GROUP) ? ShareWindow->Context : 0;
+
+	if(WindowManager::HasGLXExtension("GLX_ARB_create_context"))
+	{
+		CreateContextAttribsARB = (PFNGLXCREATECONTEXTATTRIBSARBPROC)glXGetProcAddressARB(
+			(const GLubyte*)"glXCreateContextAttribsARB");
+	}
+
+	if(CreateContextAttribsARB)
+	{
+		GLboolean NoErrorSupported = !ContextAttributes.Debug && ContextAttributes.NoError &&
+			WindowManager::HasGLXExtension("GLX_ARB_create_context_no_error");
+		GLboolean FlushControlSupported = !ContextAttributes.FlushOnRelease &&
+			WindowManager::HasGLXExtension("GLX_ARB_context_flush_control");
+
+		//first try with everything that was asked for then without the optional extras
+		for(GLuint Attempt = 0; Attempt < 2; Attempt++)
+		{
+			GLint AttributeList[16];
+			GLuint CurrentAttribute = 0;
+			GLint Flags = 0;
+
+			if(ContextAttributes.MajorVersion > 0)
+			{
+				AttributeList[CurrentAttribute++] = GLX_CONTEXT_MAJOR_VERSION_ARB;
+				AttributeList[CurrentAttribute++] = ContextAttributes.MajorVersion;
+				AttributeList[CurrentAttribute++] = GLX_CONTEXT_MINOR_VERSION_ARB;
+				AttributeList[CurrentAttribute++] = ContextAttributes.MinorVersion;
+			}
+
+			if(WindowManager::HasGLXExtension("GLX_ARB_create_context_profile"))
+			{
+				AttributeList[CurrentAttribute++] = GLX_CONTEXT_PROFILE_MASK_ARB;
+				AttributeList[CurrentAttribute++] = (ContextAttributes.Profile == CONTEXTPROFILE_CORE) ?
+					GLX_CONTEXT_CORE_PROFILE_BIT_ARB : GLX_CONTEXT_COMPATIBILITY_PROFILE_BIT_ARB;
+			}
+
+			if(ContextAttributes.Debug)
+			{
+				Flags |= GLX_CONTEXT_DEBUG_BIT_ARB;
+			}
+
+			if(ContextAttributes.ForwardCompatible)
+			{
+				Flags |= GLX_CONTEXT_FORWARD_COMPATIBLE_BIT_ARB;
+			}
+
+			if(Flags)
+			{
+				AttributeList[CurrentAttribute++] = GLX_CONTEXT_FLAGS_ARB;
+				AttributeList[CurrentAttribute++] = Flags;
+			}
+
+			if(NoErrorSupported)
+			{
+				AttributeList[CurrentAttribute++] = GLX_CONTEXT_OPENGL_NO_ERROR_ARB;
+				AttributeList[CurrentAttribute++] = GL_TRUE;
+			}
+
+			if(FlushControlSupported)
+			{
+				AttributeList[CurrentAttribute++] = GLX_CONTEXT_RELEASE_BEHAVIOR_ARB;
+				AttributeList[CurrentAttribute++] = GLX_CONTEXT_RELEASE_BEHAVIOR_NONE_ARB;
+			}
+
+			AttributeList[CurrentAttribute] = None;
+
+			//a refused attribute list is an X error, which would otherwise kill the application
+			WindowManager::Linux_BeginErrorTrap();
+			GLXContext NewContext = CreateContextAttribsARB(WindowManager::GetDisplay(),
+				FrameBufferConfig, SharedContext, GL_TRUE, AttributeList);
+			GLboolean Failed = WindowManager::Linux_EndErrorTrap();
+
+			if(NewContext && !Failed)
+			{
+				ContextAttributes.NoError = NoErrorSupported;
+				ContextAttributes.FlushOnRelease = !FlushControlSupported;
+				return NewContext;
+			}
+
+			//the driver can hand back a context and still report an error for it
+			if(NewContext)
+			{
+				glXDestroyContext(WindowManager::GetDisplay(), NewContext);
+			}
+
+			if(!NoErrorSupported && !FlushControlSupported)
+			{
+				break;
+			}
+
+			NoErrorSupported = GL_FALSE;
+			FlushControlSupported = GL_FALSE;
+		}
+	}
+
+	PrintWarningMessage(WARNING_LEGACYCONTEXT);
+	ContextAttributes.NoError = GL_FALSE;
+	ContextAttributes.FlushOnRelease = GL_TRUE;
+
+	return glXCreateContext(WindowManager::GetDisplay(),
+		VisualInfo, SharedContext, GL_TRUE);
 }
 
 /**********************************************************************************************//**
@@ -478,6 +985,13 @@ void FWindow::InitializeAtomics()
 	AtomActionClose = XInternAtom(WindowManager::GetDisplay(), "_WM_ACTION_CLOSE", GL_FALSE);
 
 	AtomDesktopGeometry = XInternAtom(WindowManager::GetDisplay(), "_NET_DESKTOP_GEOMETRY", GL_FALSE);
+
+	AtomProtocols = XInternAtom(WindowManager::GetDisplay(), "WM_PROTOCOLS", GL_FALSE);
+	AtomSyncRequest = XInternAtom(WindowManager::GetDisplay(), "_NET_WM_SYNC_REQUEST", GL_FALSE);
+	AtomSyncRequestCounter = XInternAtom(WindowManager::GetDisplay(), "_NET_WM_SYNC_REQUEST_COUNTER", GL_FALSE);
+	AtomFrameDrawn = XInternAtom(WindowManager::GetDisplay(), "_NET_WM_FRAME_DRAWN", GL_FALSE);
+	AtomFrameTimings = XInternAtom(WindowManager::GetDisplay(), "_NET_WM_FRAME_TIMINGS", GL_FALSE);
+	AtomBypassCompositor = XInternAtom(WindowManager::GetDisplay(), "_NET_WM_BYPASS_COMPOSITOR", GL_FALSE);
 }
 
 /**********************************************************************************************//**
@@ -491,13 +1005,14 @@ void FWindow::InitializeAtomics()
 
 void FWindow::Linux_InitGLExtensions()
 {
-	SwapIntervalEXT = nullptr;
-	SwapIntervalSGI = nullptr;
-	SwapIntervalMESA = nullptr;
-
-	SwapIntervalMESA = (PFNGLXSWAPINTERVALMESAPROC)glXGetProcAddress((const GLubyte*)"glXSwapIntervalMESA");
-	SwapIntervalEXT = (PFNGLXSWAPINTERVALEXTPROC)glXGetProcAddress((const GLubyte*)"glXSwapIntervalEXT");
-	SwapIntervalSGI = (PFNGLXSWAPINTERVALSGIPROC)glXGetProcAddress((const GLubyte*)"glXSwapIntervalSGI");
+	//these were resolved once by the window manager
+	SwapIntervalMESA = WindowManager::GetInstance()->SwapIntervalMESA;
+	SwapIntervalEXT = WindowManager::GetInstance()->SwapIntervalEXT;
+	SwapIntervalSGI = WindowManager::GetInstance()->SwapIntervalSGI;
+	OMLSyncControlSupported = WindowManager::GetInstance()->GetSyncValuesOML &&
+		WindowManager::GetInstance()->GetMscRateOML;
+	CopySubBufferSupported = (WindowManager::GetInstance()->CopySubBufferMESA != nullptr);
+	BufferAgeSupported = WindowManager::HasGLXExtension("GLX_EXT_buffer_age");
 
 	if(SwapIntervalMESA)
 	{
@@ -519,14 +1034,374 @@ void FWindow::Linux_InitGLExtensions()
 }
 
 /**********************************************************************************************//**
- * @fn	Window FWindow::GetWindowHandle()
+ * @fn	GLboolean FWindow::Linux_GetVBlank(GLdouble& Time, GLdouble& Period)
  *
- * @brief	Gets window handle.
+ * @brief	Gets when the display last refreshed and its refresh period using GLX_OML_sync_control.
+ * 			the UST of the extension is CLOCK_MONOTONIC in microseconds on the drivers we know of.
+ * 			if it is wildly off from GetMonotonicTime it is on some other clock so only the
+ * 			period is reported. without the extension the compositor's frame timings are used.
+ * 			the period is cached so each frame only costs the one round trip for the UST.
  *
  * @author	Ziyad
- * @date	29/11/2014
+ * @date	18/10/2026
  *
- * @return	The window handle.
+ * @param [in,out]	Time  	When the display last refreshed, in seconds. 0 if unknown.
+ * @param [in,out]	Period	The refresh period in seconds.
+ *
+ * @return	whether the refresh information is available.
+ **************************************************************************************************/
+
+GLboolean FWindow::Linux_GetVBlank(GLdouble& Time, GLdouble& Period)
+{
+	int64_t UST = 0, MSC = 0, SBC = 0;
+	int32_t Numerator = 0, Denominator = 0;
+
+	//the rate only changes when the window ends up on another output, so it isn't asked for every frame
+	if(OMLSyncControlSupported && RefreshPeriod == 0 &&
+		WindowManager::GetInstance()->GetMscRateOML(WindowManager::GetDisplay(), WindowHandle, &Numerator, &Denominator) &&
+		Numerator > 0 && Denominator > 0)
+	{
+		RefreshPeriod = (GLdouble)Denominator / (GLdouble)Numerator;
+	}
+
+	if(!OMLSyncControlSupported || RefreshPeriod == 0 ||
+		!WindowManager::GetInstance()->GetSyncValuesOML(WindowManager::GetDisplay(), WindowHandle, &UST, &MSC, &SBC))
+	{
+		//fall back to what the compositor reported about the last frame it showed
+		if(FrameTimings.RefreshInterval > 0)
+		{
+			Period = FrameTimings.RefreshInterval;
+			Time = FrameTimings.PresentTime;
+			return GL_TRUE;
+		}
+
+		return GL_FALSE;
+	}
+
+	Period = RefreshPeriod;
+	Time = (GLdouble)UST * 1e-6;
+
+	if(fabs(Time - GetMonotonicTime()) > 1.0)
+	{
+		Time = 0;
+	}
+
+	return GL_TRUE;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::Linux_LatchInput()
+ *
+ * @brief	Reads the pointer with XQueryPointer and, if the window has focus, the keyboard with
+ * 			XQueryKeymap. keycodes are translated the same way key events are so both agree on
+ * 			which index a key has. the pointer is only taken while it is over the window, like
+ * 			MotionNotify.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	Whether anything changed.
+ **************************************************************************************************/
+
+GLboolean FWindow::Linux_LatchInput()
+{
+	Display* CurrentDisplay = WindowManager::GetDisplay();
+	Window RootWindow = 0, ChildWindow = 0;
+	int RootX = 0, RootY = 0, WindowX = 0, WindowY = 0;
+	unsigned int ButtonMask = 0;
+	GLboolean Changed = GL_FALSE;
+
+	if(XQueryPointer(CurrentDisplay, WindowHandle, &RootWindow, &ChildWindow, &RootX, &RootY,
+		&WindowX, &WindowY, &ButtonMask))
+	{
+		if(WindowX >= 0 && WindowY >= 0 && (GLuint)WindowX < Resolution[0] && (GLuint)WindowY < Resolution[1])
+		{
+			Changed = ((GLuint)WindowX != MousePosition[0] || (GLuint)WindowY != MousePosition[1]);
+			MousePosition[0] = WindowX;
+			MousePosition[1] = WindowY;
+		}
+
+		const GLuint Buttons[3] = {MOUSE_LEFTBUTTON, MOUSE_MIDDLEBUTTON, MOUSE_RIGHTBUTTON};
+		const unsigned int Masks[3] = {Button1Mask, Button2Mask, Button3Mask};
+
+		for(GLuint Iter = 0; Iter < 3; Iter++)
+		{
+			GLboolean State = (ButtonMask & Masks[Iter]) ? MOUSE_BUTTONDOWN : MOUSE_BUTTONUP;
+			Changed |= (MouseButton[Buttons[Iter]] != State);
+			MouseButton[Buttons[Iter]] = State;
+		}
+	}
+
+	if(!InFocus)
+	{
+		return Changed;
+	}
+
+	char KeyMap[32] = {0};
+	GLboolean Seen[KEY_LAST] = {GL_FALSE};
+	GLboolean Down[KEY_LAST] = {GL_FALSE};
+	XQueryKeymap(CurrentDisplay, KeyMap);
+
+	//several keycodes can share a key so it is down if any of them are. the second shift level 
+	//is looked up, the same one key events are translated with
+	for(GLuint KeyCode = 8; KeyCode < 256; KeyCode++)
+	{
+		GLuint KeySym = XkbKeycodeToKeysym(CurrentDisplay, KeyCode, 0, 1);
+		GLuint Key = (KeySym <= 255) ? KeySym : WindowManager::Linux_TranslateKey(KeySym);
+
+		if(KeySym != NoSymbol && Key > 0 && Key < KEY_LAST)
+		{
+			Seen[Key] = GL_TRUE;
+			Down[Key] |= (KeyMap[KeyCode / 8] >> (KeyCode % 8)) & 1;
+		}
+	}
+
+	for(GLuint Key = 0; Key < KEY_LAST; Key++)
+	{
+		if(Seen[Key])
+		{
+			GLboolean State = Down[Key] ? KEYSTATE_DOWN : KEYSTATE_UP;
+			Changed |= (Keys[Key] != State);
+			Keys[Key] = State;
+		}
+	}
+
+	return Changed;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::Linux_PresentBuffers(const FDamageRect* Rects, GLuint NumRects)
+ *
+ * @brief	Presents the back buffer. if rectangles are given, GLX_MESA_copy_sub_buffer is
+ * 			supported and the swap interval is 0, only those rectangles and any pending damage 
+ * 			are copied to the front buffer, otherwise the buffers are swapped.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Rects   	The rectangles to present. null for the whole window.
+ * @param	NumRects	How many rectangles there are.
+ **************************************************************************************************/
+
+void FWindow::Linux_PresentBuffers(const FDamageRect* Rects, GLuint NumRects)
+{
+	Linux_BeginFrameSync();
+
+	//the copy isn't synchronised to the refresh so it would tear with vertical sync on
+	if(!Rects || NumRects == 0 || !CopySubBufferSupported || CurrentSwapInterval != 0)
+	{
+		glXSwapBuffers(WindowManager::GetDisplay(), WindowHandle);
+		LastSwapWasPartial = GL_FALSE;
+		Linux_EndFrameSync();
+		return;
+	}
+
+	BindContext();
+
+	for(GLuint Iter = 0; Iter < NumRects + PendingDamageCount; Iter++)
+	{
+		const FDamageRect& Rect = (Iter < NumRects) ? Rects[Iter] : PendingDamage[Iter - NumRects];
+
+		if(!Rect.IsEmpty())
+		{
+			//GLX counts from the bottom left
+			WindowManager::GetInstance()->CopySubBufferMESA(WindowManager::GetDisplay(), WindowHandle,
+				Rect.X, (GLint)Resolution[1] - (Rect.Y + Rect.Height), Rect.Width, Rect.Height);
+		}
+	}
+
+	LastSwapWasPartial = GL_TRUE;
+	Linux_EndFrameSync();
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::Linux_InitSyncCounter()
+ *
+ * @brief	Registers the window manager protocols the window understands. if the X server has
+ * 			the SYNC extension the window also takes part in _NET_WM_SYNC_REQUEST, so during an
+ * 			interactive resize the window manager waits for a frame at each new size before 
+ * 			resizing again instead of outrunning the renderer. the second(extended) counter 
+ * 			opts into the frame timing protocol, so compositors report back when each frame 
+ * 			was drawn and shown.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void FWindow::Linux_InitSyncCounter()
+{
+	Atom Protocols[2] = { AtomClose, AtomSyncRequest };
+
+	if(!WindowManager::GetInstance()->XSyncSupported)
+	{
+		XSetWMProtocols(WindowManager::GetDisplay(), WindowHandle, Protocols, 1);
+		return;
+	}
+
+	XSyncValue InitialValue;
+	XSyncIntToValue(&InitialValue, 0);
+	SyncCounter = XSyncCreateCounter(WindowManager::GetDisplay(), InitialValue);
+	FrameCounter = XSyncCreateCounter(WindowManager::GetDisplay(), InitialValue);
+	FrameCounterValue = 0;
+
+	XSyncCounter Counters[2] = { SyncCounter, FrameCounter };
+	XChangeProperty(WindowManager::GetDisplay(), WindowHandle, AtomSyncRequestCounter, XA_CARDINAL, 32,
+		PropModeReplace, (unsigned char*)Counters, 2);
+	XSetWMProtocols(WindowManager::GetDisplay(), WindowHandle, Protocols, 2);
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::Linux_BeginFrameSync()
+ *
+ * @brief	Moves the extended frame counter to an odd value, telling the compositor a frame is 
+ * 			on its way. if the window manager asked for a value during a resize the counter 
+ * 			jumps up to it first.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void FWindow::Linux_BeginFrameSync()
+{
+	if(FrameCounter == None)
+	{
+		return;
+	}
+
+	//a frame drawn before the matching ConfigureNotify was processed is still at the old size
+	if(FrameSyncPending && SyncResizeApplied)
+	{
+		FrameCounterValue = (FrameSyncValue > FrameCounterValue) ? FrameSyncValue : FrameCounterValue;
+		FrameSyncPending = GL_FALSE;
+	}
+
+	//an even value means no frame is in progress
+	FrameCounterValue += (FrameCounterValue % 2 == 0) ? 1 : 2;
+
+	XSyncValue Value;
+	XSyncIntsToValue(&Value, (GLuint)(FrameCounterValue & 0xFFFFFFFF), (GLint)(FrameCounterValue >> 32));
+	XSyncSetCounter(WindowManager::GetDisplay(), FrameCounter, Value);
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::Linux_EndFrameSync()
+ *
+ * @brief	Moves the extended frame counter back to an even value once the frame has been 
+ * 			presented and remembers when, so compositor feedback can be matched to it. the 
+ * 			basic counter is set if the window manager is waiting on a resize and the
+ * 			ConfigureNotify for it was processed before this frame was presented.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void FWindow::Linux_EndFrameSync()
+{
+	if(FrameCounter != None && FrameCounterValue % 2 == 1)
+	{
+		FrameCounterValue++;
+
+		FPendingFrame& Pending = PendingFrames[(FrameCounterValue / 2) % FRAMETIMINGS_HISTORY];
+		Pending.Frame = FrameCounterValue;
+		Pending.SwapTime = GetMonotonicTime();
+		Pending.DrawnTime = 0;
+
+		XSyncValue Value;
+		XSyncIntsToValue(&Value, (GLuint)(FrameCounterValue & 0xFFFFFFFF), (GLint)(FrameCounterValue >> 32));
+		XSyncSetCounter(WindowManager::GetDisplay(), FrameCounter, Value);
+	}
+
+	if(SyncRequestPending && SyncResizeApplied && SyncCounter != None)
+	{
+		XSyncSetCounter(WindowManager::GetDisplay(), SyncCounter, SyncValue);
+		SyncRequestPending = GL_FALSE;
+	}
+
+	if(!SyncRequestPending && !FrameSyncPending)
+	{
+		SyncResizeApplied = GL_FALSE;
+	}
+
+	XFlush(WindowManager::GetDisplay());
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::Linux_OnFrameDrawn(GLuint64 Frame, GLdouble DrawnTime)
+ *
+ * @brief	Handles _NET_WM_FRAME_DRAWN, sent once the compositor has drawn a frame.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Frame	 	The frame counter value of the frame.
+ * @param	DrawnTime	When the compositor drew it, in seconds.
+ **************************************************************************************************/
+
+void FWindow::Linux_OnFrameDrawn(GLuint64 Frame, GLdouble DrawnTime)
+{
+	FPendingFrame& Pending = PendingFrames[(Frame / 2) % FRAMETIMINGS_HISTORY];
+
+	if(Pending.Frame == Frame)
+	{
+		Pending.DrawnTime = DrawnTime;
+	}
+
+	FrameTimings.Frame = Frame;
+	FrameTimings.DrawnTime = DrawnTime;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::Linux_OnFrameTimings(GLuint64 Frame, GLint PresentOffset, 
+ * 		GLuint RefreshInterval, GLuint FrameDelay)
+ *
+ * @brief	Handles _NET_WM_FRAME_TIMINGS, sent once a frame has reached the screen. the present
+ * 			time is relative to when the frame was drawn so it needs the matching 
+ * 			_NET_WM_FRAME_DRAWN, which always arrives first.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Frame		   	The frame counter value of the frame.
+ * @param	PresentOffset  	When the frame was shown relative to when it was drawn, in microseconds. 0 if unknown.
+ * @param	RefreshInterval	The refresh period of the display, in microseconds. 0 if unknown.
+ * @param	FrameDelay	   	How long the compositor takes to get a drawn frame on screen, in microseconds.
+ **************************************************************************************************/
+
+void FWindow::Linux_OnFrameTimings(GLuint64 Frame, GLint PresentOffset, GLuint RefreshInterval, GLuint FrameDelay)
+{
+	FPendingFrame& Pending = PendingFrames[(Frame / 2) % FRAMETIMINGS_HISTORY];
+
+	if(Pending.Frame != Frame || Pending.DrawnTime == 0)
+	{
+		return;
+	}
+
+	FrameTimings.Frame = Frame;
+	FrameTimings.DrawnTime = Pending.DrawnTime;
+	FrameTimings.RefreshInterval = RefreshInterval * 1e-6;
+	FrameTimings.PresentTime = 0;
+	FrameTimings.Latency = 0;
+
+	//without a present time the compositor's own delay is the best guess
+	if(PresentOffset != 0 || FrameDelay != 0)
+	{
+		FrameTimings.PresentTime = Pending.DrawnTime + ((PresentOffset != 0) ? PresentOffset : FrameDelay) * 1e-6;
+		FrameTimings.Latency = FrameTimings.PresentTime - Pending.SwapTime;
+		PresentLatencies.Record(FrameTimings.Latency);
+	}
+
+	Pending.Frame = 0;
+}
+
+/**********************************************************************************************//**
+ * @fn	Window FWindow::GetWindowHandle()
+ *
+ * @brief	Gets window handle.
+ *
+ * @author	Ziyad
+ * @date	29/11/2014
+ *
+ * @return	The window handle.
  **************************************************************************************************/
 
 Window FWindow::GetWindowHandle()
@@ -744,7 +1619,7 @@ GLXFBConfig FWindow::GetBestFrameBufferConfig()
 	};
 
 	GLint FrameBufferCount;
-	GLuint BestBufferConfig, BestNumSamples = 0;
+	GLuint BestBufferConfig = 0, BestNumSamples = 0;
 	GLXFBConfig* Configs = glXChooseFBConfig(WindowManager::GetDisplay(), 0, VisualAttributes, &FrameBufferCount);
 
 	for(GLuint CurrentConfig = 0; CurrentConfig < FrameBufferCount; CurrentConfig++)
@@ -774,4 +1649,262 @@ GLXFBConfig FWindow::GetBestFrameBufferConfig()
 
 	return BestConfig;
 }
+
+/**********************************************************************************************//**
+ * @fn	static void Linux_GetMaskLayout(unsigned long Mask, GLuint& Shift, GLuint& Bits)
+ *
+ * @brief	Works out where a visual's colour mask starts and how wide it is.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Mask		 	The red, green or blue mask of the visual.
+ * @param [out]	Shift	The bit offset of the channel.
+ * @param [out]	Bits 	How many bits the channel has.
+ **************************************************************************************************/
+
+static void Linux_GetMaskLayout(unsigned long Mask, GLuint& Shift, GLuint& Bits)
+{
+	Shift = 0;
+	Bits = 0;
+
+	while(Mask && !(Mask & 1))
+	{
+		Mask >>= 1;
+		Shift++;
+	}
+
+	while(Mask & 1)
+	{
+		Mask >>= 1;
+		Bits++;
+	}
+}
+
+/**********************************************************************************************//**
+ * @fn	static GLboolean Linux_IsHostOrder32(XImage* Image, GLuint& RedShift, GLuint& GreenShift, GLuint& BlueShift)
+ *
+ * @brief	Gets whether an image has 32 bit pixels with 8 bit channels in the host's byte order,
+ * 			i.e. whether a pixel can be written as a GLuint, and where each channel sits.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param [in]	Image	  	The image.
+ * @param [out]	RedShift  	The bit offset of the red channel.
+ * @param [out]	GreenShift	The bit offset of the green channel.
+ * @param [out]	BlueShift 	The bit offset of the blue channel.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+static GLboolean Linux_IsHostOrder32(XImage* Image, GLuint& RedShift, GLuint& GreenShift, GLuint& BlueShift)
+{
+	GLuint RedBits = 0, GreenBits = 0, BlueBits = 0;
+	const GLuint HostOrder = 1;
+
+	Linux_GetMaskLayout(Image->red_mask, RedShift, RedBits);
+	Linux_GetMaskLayout(Image->green_mask, GreenShift, GreenBits);
+	Linux_GetMaskLayout(Image->blue_mask, BlueShift, BlueBits);
+
+	return Image->bits_per_pixel == 32 && RedBits == 8 && GreenBits == 8 && BlueBits == 8 &&
+		Image->byte_order == ((*(const GLubyte*)&HostOrder == 1) ? LSBFirst : MSBFirst);
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::Linux_CreateSoftwareSurface()
+ *
+ * @brief	Creates the XImage the software surface is presented from. with MIT-SHM the image
+ * 			lives in a shared memory segment the X server reads straight out of, otherwise it
+ * 			is an ordinary image sent over the connection. servers on another machine can't
+ * 			attach the segment, which is checked for before relying on it. an RGBA or BGRA 
+ * 			image in the host's byte order becomes the software surface itself.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FWindow::Linux_CreateSoftwareSurface()
+{
+	Display* CurrentDisplay = WindowManager::GetDisplay();
+
+	SurfaceGC = XCreateGC(CurrentDisplay, WindowHandle, 0, nullptr);
+	SurfaceSegment.shmid = -1;
+	SurfaceSegment.shmaddr = nullptr;
+	SurfaceBusy = GL_FALSE;
+
+	if(WindowManager::GetInstance()->XShmSupported)
+	{
+		SurfaceImage = XShmCreateImage(CurrentDisplay, VisualInfo->visual, VisualInfo->depth, ZPixmap,
+			nullptr, &SurfaceSegment, SoftwareSize[0], SoftwareSize[1]);
+
+		if(SurfaceImage && WindowManager::Linux_AttachSharedSegment(SurfaceSegment, (size_t)SurfaceImage->bytes_per_line * SurfaceImage->height))
+		{
+			SurfaceImage->data = SurfaceSegment.shmaddr;
+		}
+
+		else if(SurfaceImage)
+		{
+			XDestroyImage(SurfaceImage);
+			SurfaceImage = nullptr;
+		}
+	}
+
+	if(!SurfaceImage)
+	{
+		SurfaceImage = XCreateImage(CurrentDisplay, VisualInfo->visual, VisualInfo->depth, ZPixmap, 0,
+			nullptr, SoftwareSize[0], SoftwareSize[1], 32, 0);
+
+		if(SurfaceImage)
+		{
+			//XDestroyImage frees this
+			SurfaceImage->data = (char*)calloc((size_t)SurfaceImage->bytes_per_line * SurfaceImage->height, 1);
+		}
+	}
+
+	if(!SurfaceImage || !SurfaceImage->data)
+	{
+		return FOUNDATION_ERROR;
+	}
+
+	GLuint RedShift = 0, GreenShift = 0, BlueShift = 0;
+
+	//nearly every visual is one of these, otherwise CreateSoftwareSurface makes a staging copy
+	if(Linux_IsHostOrder32(SurfaceImage, RedShift, GreenShift, BlueShift) && GreenShift == 8 &&
+		((RedShift == 0 && BlueShift == 16) || (RedShift == 16 && BlueShift == 0)))
+	{
+		SoftwarePixels = (GLubyte*)SurfaceImage->data;
+		SoftwareStride = SurfaceImage->bytes_per_line;
+		SoftwareFormat = (RedShift == 0) ? SOFTWAREFORMAT_RGBA : SOFTWAREFORMAT_BGRA;
+	}
+
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::Linux_DestroySoftwareSurface()
+ *
+ * @brief	Detaches the shared memory and destroys the XImage.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void FWindow::Linux_DestroySoftwareSurface()
+{
+	Display* CurrentDisplay = WindowManager::GetDisplay();
+
+	if(SurfaceImage)
+	{
+		if(SurfaceSegment.shmid >= 0)
+		{
+			WindowManager::Linux_DetachSharedSegment(SurfaceSegment);
+			SurfaceImage->data = nullptr;
+		}
+
+		XDestroyImage(SurfaceImage);
+		SurfaceImage = nullptr;
+	}
+
+	if(SurfaceGC)
+	{
+		XFreeGC(CurrentDisplay, SurfaceGC);
+		SurfaceGC = 0;
+	}
+
+	SurfaceBusy = GL_FALSE;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::Linux_PresentSoftwareSurface(const FDamageRect* Rects, GLuint NumRects)
+ *
+ * @brief	Puts the given rectangles and any pending damage on the window. when the application
+ * 			draws into a staging copy the rectangles are converted into the XImage first, 32 bit
+ * 			visuals in the host's byte order through ConvertSoftwareRow and anything else with
+ * 			XPutPixel. a shared image may still be being read by the server from the last 
+ * 			present so that has to finish first, but the round trip is only paid here(or in
+ * 			GetSoftwareSurface) rather than right after the put.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Rects   	The rectangles to present. null for the whole surface.
+ * @param	NumRects	How many rectangles there are.
+ **************************************************************************************************/
+
+void FWindow::Linux_PresentSoftwareSurface(const FDamageRect* Rects, GLuint NumRects)
+{
+	Display* CurrentDisplay = WindowManager::GetDisplay();
+	GLuint RedShift = 0, GreenShift = 0, BlueShift = 0;
+	GLuint RedBits = 0, GreenBits = 0, BlueBits = 0;
+
+	if(SurfaceBusy)
+	{
+		XSync(CurrentDisplay, False);
+		SurfaceBusy = GL_FALSE;
+	}
+
+	GLboolean FastPath = Linux_IsHostOrder32(SurfaceImage, RedShift, GreenShift, BlueShift);
+	Linux_GetMaskLayout(SurfaceImage->red_mask, RedShift, RedBits);
+	Linux_GetMaskLayout(SurfaceImage->green_mask, GreenShift, GreenBits);
+	Linux_GetMaskLayout(SurfaceImage->blue_mask, BlueShift, BlueBits);
+	//narrower channels drop their low bits in the slow path
+	GLuint RedLoss = (RedBits < 8) ? 8 - RedBits : 0;
+	GLuint GreenLoss = (GreenBits < 8) ? 8 - GreenBits : 0;
+	GLuint BlueLoss = (BlueBits < 8) ? 8 - BlueBits : 0;
+	GLuint Count = (Rects ? NumRects : 0) + PendingDamageCount;
+	FDamageRect Whole(0, 0, SoftwareSize[0], SoftwareSize[1]);
+
+	Linux_BeginFrameSync();
+
+	for(GLuint Iter = 0; Iter < ((Count > 0) ? Count : 1); Iter++)
+	{
+		FDamageRect Rect = (Count == 0) ? Whole :
+			(Rects && Iter < NumRects) ? Rects[Iter] : PendingDamage[Iter - (Rects ? NumRects : 0)];
+		Rect = Rect.Intersect(Whole);
+
+		if(Rect.IsEmpty())
+		{
+			continue;
+		}
+
+		for(GLint Row = Rect.Y; SoftwareStaged && Row < Rect.Y + Rect.Height; Row++)
+		{
+			const GLubyte* Source = SoftwarePixels + ((((size_t)Row * SoftwareSize[0]) + Rect.X) * 4);
+
+			if(FastPath)
+			{
+				ConvertSoftwareRow(Source, (GLuint*)(SurfaceImage->data + ((size_t)Row * SurfaceImage->bytes_per_line)) + Rect.X,
+					Rect.Width, RedShift, GreenShift, BlueShift);
+				continue;
+			}
+
+			for(GLint Column = 0; Column < Rect.Width; Column++, Source += 4)
+			{
+				XPutPixel(SurfaceImage, Rect.X + Column, Row,
+					((unsigned long)(Source[0] >> RedLoss) << RedShift) |
+					((unsigned long)(Source[1] >> GreenLoss) << GreenShift) |
+					((unsigned long)(Source[2] >> BlueLoss) << BlueShift));
+			}
+		}
+
+		if(SurfaceSegment.shmid >= 0)
+		{
+			XShmPutImage(CurrentDisplay, WindowHandle, SurfaceGC, SurfaceImage, Rect.X, Rect.Y,
+				Rect.X, Rect.Y, Rect.Width, Rect.Height, False);
+		}
+
+		else
+		{
+			XPutImage(CurrentDisplay, WindowHandle, SurfaceGC, SurfaceImage, Rect.X, Rect.Y,
+				Rect.X, Rect.Y, Rect.Width, Rect.Height);
+		}
+	}
+
+	Linux_EndFrameSync();
+	XFlush(CurrentDisplay);
+	SurfaceBusy = (SurfaceSegment.shmid >= 0);
+}
 #endif
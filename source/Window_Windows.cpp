@@ -41,13 +41,31 @@ GLboolean FWindow::Windows_InitializeGL()
 
 		DeviceContextHandle = GetDC(WindowHandle);
 		InitializePixelFormat();
-		GLRenderingContextHandle = wglCreateContext(DeviceContextHandle);
-		wglMakeCurrent(DeviceContextHandle, GLRenderingContextHandle);
+
+		if (ShareMode == CONTEXTSHARE_SINGLE)
+		{
+			GLRenderingContextHandle = ShareWindow->GLRenderingContextHandle;
+		}
+
+		else
+		{
+			GLRenderingContextHandle = wglCreateContext(DeviceContextHandle);
+
+			if (GLRenderingContextHandle && ShareMode == CONTEXTSHARE_GROUP)
+			{
+				wglShareLists(ShareWindow->GLRenderingContextHandle, GLRenderingContextHandle);
+			}
+		}
+
+		BindContext();
 
 		ContextCreated = (GLRenderingContextHandle != nullptr);
 
 		if (ContextCreated)
 		{
+			Extensions = WindowManager::GetCurrentExtensionSet();
+			GLFunctions = WindowManager::GetCurrentGLFunctions();
+			FGLFunctions::Current = GLFunctions;
 			Windows_InitGLExtensions();
 			return FOUNDATION_OKAY;
 		}
@@ -144,6 +162,14 @@ GLboolean FWindow::Windows_Initialize(
 	{
 		ShowWindow(WindowHandle, GL_TRUE);
 		UpdateWindow(WindowHandle);
+		TimeToFirstMap = GetMonotonicTime() - InitializeTime;
+		Initialized = GL_TRUE;
+
+		if (ContextCreation == CONTEXTCREATION_SOFTWARE)
+		{
+			return CreateSoftwareSurface();
+		}
+
 		return FOUNDATION_OKAY;
 	}
 
@@ -155,8 +181,13 @@ void FWindow::Windows_Shutdown()
 {
 	if (GLRenderingContextHandle)
 	{
-		wglMakeCurrent(nullptr, nullptr);
-		wglDeleteContext(GLRenderingContextHandle);
+		UnbindContext();
+
+		//the context belongs to the window we are sharing it with
+		if (ShareMode != CONTEXTSHARE_SINGLE)
+		{
+			wglDeleteContext(GLRenderingContextHandle);
+		}
 	}
 
 	if (PaletteHandle)
@@ -227,6 +258,91 @@ void FWindow::Windows_FullScreen()
 		MoveWindow(m_WindowHandle, m_Position[0], m_Position[1], l_Rect.right, l_Rect.bottom, GL_TRUE);*/
 }
 
+/**********************************************************************************************//**
+ * @fn	std::list<FDisplayMode> FWindow::Windows_GetDisplayModes()
+ *
+ * @brief	Lists the 32 bit modes of the primary display.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	The display modes.
+ **************************************************************************************************/
+
+std::list<FDisplayMode> FWindow::Windows_GetDisplayModes()
+{
+	std::list<FDisplayMode> Modes;
+	DEVMODE DeviceMode;
+	memset(&DeviceMode, 0, sizeof(DeviceMode));
+	DeviceMode.dmSize = sizeof(DeviceMode);
+
+	for(DWORD Iter = 0; EnumDisplaySettings(nullptr, Iter, &DeviceMode); Iter++)
+	{
+		if(DeviceMode.dmBitsPerPel == 32)
+		{
+			Modes.push_back(FDisplayMode(DeviceMode.dmPelsWidth, DeviceMode.dmPelsHeight, 
+				DeviceMode.dmDisplayFrequency, Iter));
+		}
+	}
+
+	return Modes;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::Windows_SetDisplayMode(const FDisplayMode& Mode)
+ *
+ * @brief	Switches the primary display to the given mode and covers it with the window. the
+ * 			change is made with CDS_FULLSCREEN so Windows puts the old mode back by itself if 
+ * 			the process dies.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Mode	The mode to switch to, from Windows_GetDisplayModes.
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FWindow::Windows_SetDisplayMode(const FDisplayMode& Mode)
+{
+	DEVMODE DeviceMode;
+	memset(&DeviceMode, 0, sizeof(DeviceMode));
+	DeviceMode.dmSize = sizeof(DeviceMode);
+
+	if(!EnumDisplaySettings(nullptr, (DWORD)Mode.Handle, &DeviceMode))
+	{
+		PrintErrorMessage(ERROR_INVALIDDISPLAYMODE);
+		return FOUNDATION_ERROR;
+	}
+
+	DeviceMode.dmFields = DM_PELSWIDTH | DM_PELSHEIGHT | DM_BITSPERPEL | DM_DISPLAYFREQUENCY;
+
+	if(ChangeDisplaySettings(&DeviceMode, CDS_FULLSCREEN) != DISP_CHANGE_SUCCESSFUL)
+	{
+		PrintErrorMessage(ERROR_INVALIDDISPLAYMODE);
+		return FOUNDATION_ERROR;
+	}
+
+	SetWindowLongPtr(WindowHandle, GWL_STYLE,
+		WS_SYSMENU | WS_POPUP | WS_CLIPCHILDREN | WS_CLIPSIBLINGS | WS_VISIBLE);
+	MoveWindow(WindowHandle, 0, 0, Mode.Width, Mode.Height, GL_TRUE);
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::Windows_RestoreDisplayMode()
+ *
+ * @brief	Puts the primary display back to the mode stored in the registry.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void FWindow::Windows_RestoreDisplayMode()
+{
+	ChangeDisplaySettings(nullptr, 0);
+}
+
 void FWindow::Windows_Minimize()
 {
 	if (CurrentState == WINDOWSTATE_MINIMIZED)
@@ -468,4 +584,187 @@ void FWindow::Windows_SetStyle(GLuint WindowType)
 	}
 }
 
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::Windows_LatchInput()
+ *
+ * @brief	Reads the cursor with GetCursorPos and, if the window has focus, the keyboard with
+ * 			GetAsyncKeyState. virtual keys are translated the same way key messages are. the
+ * 			cursor is only taken while it is over the client area, like WM_MOUSEMOVE.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	Whether anything changed.
+ **************************************************************************************************/
+
+GLboolean FWindow::Windows_LatchInput()
+{
+	POINT CursorPoint;
+	GLboolean Changed = GL_FALSE;
+
+	if(GetCursorPos(&CursorPoint) && ScreenToClient(WindowHandle, &CursorPoint) &&
+		CursorPoint.x >= 0 && CursorPoint.y >= 0 && (GLuint)CursorPoint.x < Resolution[0] && (GLuint)CursorPoint.y < Resolution[1])
+	{
+		Changed = ((GLuint)CursorPoint.x != MousePosition[0] || (GLuint)CursorPoint.y != MousePosition[1]);
+		MousePosition[0] = CursorPoint.x;
+		MousePosition[1] = CursorPoint.y;
+	}
+
+	const GLuint Buttons[3] = {MOUSE_LEFTBUTTON, MOUSE_MIDDLEBUTTON, MOUSE_RIGHTBUTTON};
+	const int VirtualButtons[3] = {VK_LBUTTON, VK_MBUTTON, VK_RBUTTON};
+
+	for(GLuint Iter = 0; Iter < 3; Iter++)
+	{
+		GLboolean State = (GetAsyncKeyState(VirtualButtons[Iter]) & 0x8000) ? MOUSE_BUTTONDOWN : MOUSE_BUTTONUP;
+		Changed |= (MouseButton[Buttons[Iter]] != State);
+		MouseButton[Buttons[Iter]] = State;
+	}
+
+	if(!InFocus)
+	{
+		return Changed;
+	}
+
+	GLboolean Seen[KEY_LAST] = {GL_FALSE};
+	GLboolean Down[KEY_LAST] = {GL_FALSE};
+
+	//the mouse buttons are virtual keys too and were handled above
+	for(int VirtualKey = VK_BACK; VirtualKey < 255; VirtualKey++)
+	{
+		GLuint Key = WindowManager::Windows_TranslateKey(VirtualKey, 0);
+
+		if(Key > 0 && Key < KEY_LAST)
+		{
+			Seen[Key] = GL_TRUE;
+			Down[Key] |= (GetAsyncKeyState(VirtualKey) & 0x8000) != 0;
+		}
+	}
+
+	for(GLuint Key = 0; Key < KEY_LAST; Key++)
+	{
+		if(Seen[Key])
+		{
+			GLboolean State = Down[Key] ? KEYSTATE_DOWN : KEYSTATE_UP;
+			Changed |= (Keys[Key] != State);
+			Keys[Key] = State;
+		}
+	}
+
+	return Changed;
+}
+
+/**********************************************************************************************//**
+ * @fn	GLboolean FWindow::Windows_CreateSoftwareSurface()
+ *
+ * @brief	Creates the top down 32 bit DIB section the software surface is presented from and
+ * 			selects it into a memory device context for BitBlt. the DIB section is always BGRA
+ * 			so the application draws straight into it.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	A GLboolean.
+ **************************************************************************************************/
+
+GLboolean FWindow::Windows_CreateSoftwareSurface()
+{
+	BITMAPINFO BitmapInfo = {};
+	BitmapInfo.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+	BitmapInfo.bmiHeader.biWidth = SoftwareSize[0];
+	//a negative height makes the rows go from the top down like the surface
+	BitmapInfo.bmiHeader.biHeight = -(LONG)SoftwareSize[1];
+	BitmapInfo.bmiHeader.biPlanes = 1;
+	BitmapInfo.bmiHeader.biBitCount = 32;
+	BitmapInfo.bmiHeader.biCompression = BI_RGB;
+
+	if (!DeviceContextHandle)
+	{
+		DeviceContextHandle = GetDC(WindowHandle);
+	}
+
+	SurfaceDeviceContext = CreateCompatibleDC(DeviceContextHandle);
+	SurfaceBitmap = CreateDIBSection(DeviceContextHandle, &BitmapInfo, DIB_RGB_COLORS, (void**)&SurfaceBits, nullptr, 0);
+
+	if (!SurfaceDeviceContext || !SurfaceBitmap)
+	{
+		return FOUNDATION_ERROR;
+	}
+
+	SurfaceOldBitmap = SelectObject(SurfaceDeviceContext, SurfaceBitmap);
+	SoftwarePixels = (GLubyte*)SurfaceBits;
+	SoftwareFormat = SOFTWAREFORMAT_BGRA;
+	return FOUNDATION_OKAY;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::Windows_DestroySoftwareSurface()
+ *
+ * @brief	Deletes the DIB section and its memory device context.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ **************************************************************************************************/
+
+void FWindow::Windows_DestroySoftwareSurface()
+{
+	if (SurfaceDeviceContext)
+	{
+		SelectObject(SurfaceDeviceContext, SurfaceOldBitmap);
+		DeleteDC(SurfaceDeviceContext);
+	}
+
+	if (SurfaceBitmap)
+	{
+		DeleteObject(SurfaceBitmap);
+	}
+
+	SurfaceDeviceContext = nullptr;
+	SurfaceBitmap = nullptr;
+	SurfaceOldBitmap = nullptr;
+	SurfaceBits = nullptr;
+}
+
+/**********************************************************************************************//**
+ * @fn	void FWindow::Windows_PresentSoftwareSurface(const FDamageRect* Rects, GLuint NumRects)
+ *
+ * @brief	Blits the given rectangles and any pending damage from the DIB section to the window,
+ * 			converting them from the staging copy first if there is one.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @param	Rects   	The rectangles to present. null for the whole surface.
+ * @param	NumRects	How many rectangles there are.
+ **************************************************************************************************/
+
+void FWindow::Windows_PresentSoftwareSurface(const FDamageRect* Rects, GLuint NumRects)
+{
+	GLuint Count = (Rects ? NumRects : 0) + PendingDamageCount;
+	FDamageRect Whole(0, 0, SoftwareSize[0], SoftwareSize[1]);
+
+	//GDI may still be drawing from the DIB section
+	GdiFlush();
+
+	for (GLuint Iter = 0; Iter < ((Count > 0) ? Count : 1); Iter++)
+	{
+		FDamageRect Rect = (Count == 0) ? Whole :
+			(Rects && Iter < NumRects) ? Rects[Iter] : PendingDamage[Iter - (Rects ? NumRects : 0)];
+		Rect = Rect.Intersect(Whole);
+
+		if (Rect.IsEmpty())
+		{
+			continue;
+		}
+
+		for (GLint Row = Rect.Y; SoftwareStaged && Row < Rect.Y + Rect.Height; Row++)
+		{
+			size_t Offset = ((size_t)Row * SoftwareSize[0]) + Rect.X;
+			ConvertSoftwareRow(SoftwarePixels + (Offset * 4), SurfaceBits + Offset, Rect.Width, 16, 8, 0);
+		}
+
+		BitBlt(DeviceContextHandle, Rect.X, Rect.Y, Rect.Width, Rect.Height,
+			SurfaceDeviceContext, Rect.X, Rect.Y, SRCCOPY);
+	}
+}
+
 #endif
@@ -0,0 +1,71 @@
+/**********************************************************************************************//**
+ * @file	WindowAPI\tests\CaptureTest.cpp
+ *
+ * @brief	Checks screen captures and their sub rectangles, then measures how many full screen 
+ * 			captures a second the persistent capture image sustains. needs an X server, e.g. 
+ * 			xvfb-run make Test, and is skipped without one.
+ **************************************************************************************************/
+#include <stdio.h>
+#include "WindowManager.h"
+
+static const GLuint BenchmarkCaptures = 300;
+static GLuint Failures = 0;
+
+static void Check(GLboolean Passed, const char* Description)
+{
+	printf("%s: %s\n", Passed ? "PASS" : "FAIL", Description);
+	Failures += Passed ? 0 : 1;
+}
+
+int main()
+{
+	Display* Probe = XOpenDisplay(0);
+
+	if(!Probe)
+	{
+		printf("SKIP: no X server to connect to\n");
+		return 0;
+	}
+
+	XCloseDisplay(Probe);
+
+	if(!WindowManager::Initialize())
+	{
+		printf("FAIL: the window manager could not be initialized\n");
+		return 1;
+	}
+
+	GLuint ScreenWidth = 0, ScreenHeight = 0;
+	WindowManager::GetScreenResolution(ScreenWidth, ScreenHeight);
+	FScreenCapture Capture;
+
+	Check(WindowManager::CaptureScreen(Capture) && Capture.Pixels != nullptr &&
+		Capture.Width == ScreenWidth && Capture.Height == ScreenHeight && Capture.Stride >= ScreenWidth * 4,
+		"the whole screen is captured");
+
+	Check(WindowManager::CaptureScreen(Capture, 16, 16, 64, 32) && Capture.Pixels != nullptr &&
+		Capture.Width == 64 && Capture.Height == 32,
+		"a sub rectangle is captured at its own size");
+
+	Check(WindowManager::CaptureScreen(Capture, ScreenWidth - 10, 0, 100, 10) && Capture.Width == 10,
+		"a rectangle past the edge of the screen is clipped");
+
+	//the throughput benchmark. the capture times are recorded by the manager itself
+	GLdouble Start = GetMonotonicTime();
+
+	for(GLuint Iter = 0; Iter < BenchmarkCaptures; Iter++)
+	{
+		WindowManager::CaptureScreen(Capture);
+	}
+
+	GLdouble Elapsed = GetMonotonicTime() - Start;
+	FFrameStatistics Statistics = WindowManager::GetScreenCaptureStatistics();
+
+	printf("BENCHMARK: %u full screen captures of %ux%u in %.3f s, %.1f captures/s, %.1f MB/s, "
+		"mean %.3f ms, p95 %.3f ms\n", BenchmarkCaptures, ScreenWidth, ScreenHeight, Elapsed,
+		BenchmarkCaptures / Elapsed, (BenchmarkCaptures * (GLdouble)ScreenWidth * ScreenHeight * 4) / (Elapsed * 1e6),
+		Statistics.Mean * 1e3, Statistics.P95 * 1e3);
+
+	WindowManager::ShutDown();
+	return (Failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,78 @@
+/**********************************************************************************************//**
+ * @file	WindowAPI\tests\FrameExportTest.cpp
+ *
+ * @brief	Checks that a frame export reader refuses slots that describe pixels outside the 
+ * 			shared block, as a corrupt or hostile exporter could write. run with make Test.
+ **************************************************************************************************/
+#include <stdio.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "FrameExport.h"
+
+static const char* BlockName = "FoundationFrameExportTest";
+static GLuint Failures = 0;
+
+static void Check(GLboolean Passed, const char* Description)
+{
+	printf("%s: %s\n", Passed ? "PASS" : "FAIL", Description);
+	Failures += Passed ? 0 : 1;
+}
+
+/**********************************************************************************************//**
+ * @fn	static GLboolean AcquireCorrupted(FrameExporter& Exporter, FrameExportReader& Reader,
+ * 		GLuint64 Offset, GLuint Width, GLuint Height)
+ *
+ * @brief	Publishes a frame, overwrites its slot through a mapping of its own the way another
+ * 			process could, then tries to acquire it.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	Whether the reader handed out the frame.
+ **************************************************************************************************/
+
+static GLboolean AcquireCorrupted(FrameExporter& Exporter, FrameExportReader& Reader, GLuint64 Offset, GLuint Width, GLuint Height)
+{
+	GLubyte Pixels[4 * 4 * 4] = {};
+	Exporter.Publish(Pixels, 4, 4);
+
+	GLint Descriptor = shm_open((std::string("/") + BlockName).c_str(), O_RDWR, 0);
+	FFrameExportHeader* Header = (FFrameExportHeader*)mmap(nullptr, sizeof(FFrameExportHeader), PROT_READ | PROT_WRITE, MAP_SHARED, Descriptor, 0);
+	close(Descriptor);
+
+	FFrameExportSlot& Slot = Header->Slots[Header->LatestFrame.load() % FRAMEEXPORT_SLOTS];
+	Slot.Offset = Offset;
+	Slot.Width = Width;
+	Slot.Height = Height;
+	munmap(Header, sizeof(FFrameExportHeader));
+
+	GLuint FrameWidth = 0, FrameHeight = 0;
+	GLuint64 FrameNumber = 0;
+	const GLubyte* Frame = Reader.AcquireFrame(0, FrameWidth, FrameHeight, FrameNumber);
+	Reader.ReleaseFrame();
+	return (Frame != nullptr);
+}
+
+int main()
+{
+	FrameExporter Exporter;
+	FrameExportReader Reader;
+
+	if(!Exporter.Create(BlockName, 4, 4) || !Reader.Attach(BlockName))
+	{
+		printf("FAIL: the shared block could not be created\n");
+		return 1;
+	}
+
+	GLuint64 Offset = sizeof(FFrameExportHeader);
+	Check(AcquireCorrupted(Exporter, Reader, Offset, 4, 4), "a frame inside the block is acquired");
+	Check(!AcquireCorrupted(Exporter, Reader, (GLuint64)1 << 40, 4, 4), "an offset past the block is refused");
+	Check(!AcquireCorrupted(Exporter, Reader, Offset, 4096, 4096), "a frame too big for the block is refused");
+	Check(!AcquireCorrupted(Exporter, Reader, Offset, 0xFFFFFFFF, 0xFFFFFFFF), "a frame size that overflows is refused");
+	Check(!AcquireCorrupted(Exporter, Reader, 0, 4, 4), "an offset into the header is refused");
+
+	Reader.Detach();
+	Exporter.Destroy();
+	return (Failures == 0) ? 0 : 1;
+}
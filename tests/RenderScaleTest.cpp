@@ -0,0 +1,76 @@
+/**********************************************************************************************//**
+ * @file	WindowAPI\tests\RenderScaleTest.cpp
+ *
+ * @brief	Checks that the dynamic resolution scale drops under load and comes back once the
+ * 			load drops. run with make Test.
+ **************************************************************************************************/
+#include <stdio.h>
+#include "WindowAPI_Defs.h"
+
+static const GLdouble Target = 1.0 / 60.0;
+static const GLdouble MinScale = 0.5;
+static const GLdouble MaxScale = 1.0;
+
+/**********************************************************************************************//**
+ * @fn	GLdouble RunFrames(GLdouble Scale, GLdouble& Smoothed, GLdouble FullCost, GLuint Frames,
+ * 		GLboolean VSync)
+ *
+ * @brief	Runs frames whose render time grows with the pixel count, i.e. FullCost * Scale^2.
+ * 			with VSync the time fed back is the whole frame interval instead, which can't go
+ * 			below the refresh period, the way it was measured before.
+ *
+ * @author	Ziyad
+ * @date	18/10/2026
+ *
+ * @return	The scale after the last frame.
+ **************************************************************************************************/
+
+static GLdouble RunFrames(GLdouble Scale, GLdouble& Smoothed, GLdouble FullCost, GLuint Frames, GLboolean VSync)
+{
+	for(GLuint Frame = 0; Frame < Frames; Frame++)
+	{
+		GLdouble RenderTime = FullCost * Scale * Scale;
+
+		if(VSync)
+		{
+			RenderTime = (RenderTime > Target) ? ceil(RenderTime / Target) * Target : Target;
+		}
+
+		Scale = StepRenderScale(Scale, Smoothed, RenderTime, Target, MinScale, MaxScale);
+	}
+
+	return Scale;
+}
+
+static GLuint Failures = 0;
+
+static void Check(GLboolean Passed, const char* Description, GLdouble Scale)
+{
+	printf("%s: %s (scale %.3f)\n", Passed ? "PASS" : "FAIL", Description, Scale);
+	Failures += Passed ? 0 : 1;
+}
+
+int main()
+{
+	GLdouble Smoothed = 0;
+	//four times over budget at full resolution
+	GLdouble Scale = RunFrames(MaxScale, Smoothed, Target * 4, 300, GL_FALSE);
+	Check(Scale < 0.6, "the scale drops under heavy load", Scale);
+
+	//the load drops to half the budget at full resolution
+	Scale = RunFrames(Scale, Smoothed, Target * 0.5, 300, GL_FALSE);
+	Check(Scale == MaxScale, "the scale recovers once the load drops", Scale);
+
+	//the render time only changes within the deadband, so the scale holds
+	Smoothed = 0;
+	GLdouble Held = RunFrames(0.75, Smoothed, (Target * 0.95) / (0.75 * 0.75), 100, GL_FALSE);
+	Check(Held == 0.75, "the scale holds within 10% under the target", Held);
+
+	//the frame interval with vsync never drops below the target, so it can't be what drives the scale
+	Smoothed = 0;
+	GLdouble Stuck = RunFrames(MaxScale, Smoothed, Target * 4, 300, GL_TRUE);
+	Stuck = RunFrames(Stuck, Smoothed, Target * 0.5, 300, GL_TRUE);
+	Check(Stuck < MaxScale, "the frame interval with vsync keeps the scale down", Stuck);
+
+	return (Failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,46 @@
+/**********************************************************************************************//**
+ * @file	WindowAPI\tests\ShutdownTest.cpp
+ *
+ * @brief	Checks that shutting the window manager down puts back the X error handler that was
+ * 			installed before it started. needs an X server, and is skipped without one. run with 
+ * 			make Test.
+ **************************************************************************************************/
+#include <stdio.h>
+#include "WindowManager.h"
+
+static int TestErrorHandler(Display*, XErrorEvent*)
+{
+	return 0;
+}
+
+int main()
+{
+	Display* Probe = XOpenDisplay(0);
+
+	if(!Probe)
+	{
+		printf("SKIP: no X server to connect to\n");
+		return 0;
+	}
+
+	XCloseDisplay(Probe);
+	XSetErrorHandler(&TestErrorHandler);
+
+	if(!WindowManager::Initialize())
+	{
+		printf("FAIL: the window manager could not be initialized\n");
+		return 1;
+	}
+
+	//XSetErrorHandler is the only way to read the current handler, so put it straight back
+	XErrorHandler Installed = XSetErrorHandler(nullptr);
+	XSetErrorHandler(Installed);
+	GLboolean Replaced = (Installed != &TestErrorHandler);
+
+	WindowManager::ShutDown();
+	GLboolean Restored = (XSetErrorHandler(nullptr) == &TestErrorHandler);
+
+	printf("%s: the window manager installs its own X error handler\n", Replaced ? "PASS" : "FAIL");
+	printf("%s: shutdown restores the previous X error handler\n", Restored ? "PASS" : "FAIL");
+	return (Replaced && Restored) ? 0 : 1;
+}
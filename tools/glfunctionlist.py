@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+#writes include/dependencies/glfunctionlist.h from the PFN...PROC typedefs of the bundled glext.h
+#and glxext.h. run it from the root of the repository after updating either header:
+#	python3 tools/glfunctionlist.py
+
+import re
+
+HEADER = """/**********************************************************************************************//**
+ * @file	WindowAPI\\dependencies\\glfunctionlist.h
+ *
+ * @brief	Lists every OpenGL and GLX entry point declared in the bundled glext.h and glxext.h
+ * 			as FOUNDATION_GL_FUNCTION(Return, Name, Parameters), grouped by the version or extension that 
+ * 			declares it so entries the included headers don't know about are skipped. 
+ * 			define FOUNDATION_GL_FUNCTION before including this file. the signatures are 
+ * 			taken from the PFN...PROC typedefs of the bundled headers rather than relying on the 
+ * 			system headers to declare the same typedefs. regenerated by tools/glfunctionlist.py.
+ **************************************************************************************************/
+"""
+
+GUARD = re.compile(r"^#ifndef (\w+)\n#define \1 1$", re.M)
+TYPEDEF = re.compile(r"^typedef (.+?)\(\s*(?:APIENTRYP|\*)\s*PFN(\w+)PROC\)\s*(\(.*\));$", re.M)
+PROTOTYPE = re.compile(r"\b(gl\w+)\s*\(")
+
+def ReadGroups(Path):
+	Text = open(Path).read()
+	Names = {}
+
+	#the typedefs are upper case, so take the real names from the prototypes
+	for Line in Text.splitlines():
+		Match = PROTOTYPE.search(Line)
+
+		if Match and not Line.startswith("typedef"):
+			Names[Match.group(1).upper()] = Match.group(1)
+
+	Groups = []
+	Guards = list(GUARD.finditer(Text))
+
+	for Iter, Guard in enumerate(Guards):
+		End = Guards[Iter + 1].start() if Iter + 1 < len(Guards) else len(Text)
+		Functions = []
+
+		Depth = 0
+
+		#typedefs behind a further #ifdef need headers of their own(e.g. the SGIX video ones), so skip them
+		for Line in Text[Guard.end():End].splitlines():
+			if Line.startswith("#if"):
+				Depth += 1
+			elif Line.startswith("#endif"):
+				Depth -= 1
+
+			Typedef = TYPEDEF.match(Line)
+
+			if Typedef and Depth == 0 and Typedef.group(2) in Names:
+				Functions.append((Typedef.group(1).strip(), Names[Typedef.group(2)], Typedef.group(3)))
+
+		if Functions:
+			Groups.append((Guard.group(1), Functions))
+
+	return Groups
+
+def WriteGroups(Output, Groups):
+	for Iter, (Guard, Functions) in enumerate(Groups):
+		if Iter > 0:
+			Output.append("")
+
+		Output.append("#ifdef " + Guard)
+
+		for Return, Name, Parameters in Functions:
+			Output.append("FOUNDATION_GL_FUNCTION(%s, %s, %s)" % (Return, Name, Parameters))
+
+		Output.append("#endif")
+
+Output = [HEADER]
+WriteGroups(Output, ReadGroups("include/dependencies/glext.h"))
+Output.append("")
+Output.append("#if defined(__linux__)")
+WriteGroups(Output, ReadGroups("include/dependencies/glxext.h"))
+Output.append("#endif")
+
+open("include/dependencies/glfunctionlist.h", "w").write("\n".join(Output) + "\n")